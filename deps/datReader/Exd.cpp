@@ -2,11 +2,24 @@
 
 #include "bparse.h"
 #include "stream.h"
+#include <cstring>
 #include <fstream>
 #include "Exh.h"
 
 using xiv::utils::bparse::extract;
 
+namespace
+{
+   // Columns are stored big endian
+   template< typename T >
+   T read_be( const char* i_src )
+   {
+      T value;
+      std::memcpy( &value, i_src, sizeof( T ) );
+      return xiv::utils::bparse::byteswap( value );
+   }
+}
+
 
 namespace xiv 
 {
@@ -54,12 +67,11 @@ namespace xiv
 
 
          // Iterates over all the files
-         const uint32_t member_count = _exh->get_members().size();
          for ( auto &file_ptr : _files )
          {
             // Get a stream
-            std::vector< char > dataCpy = file_ptr->get_data_sections().front();
-            std::istringstream iss( std::string( dataCpy.begin(), dataCpy.end() ) );
+            auto& data = file_ptr->get_data_sections().front();
+            std::istringstream iss( std::string( data.begin(), data.end() ) );
 
             // Extract the header and skip to the record indices
             auto exd_header = extract< ExdHeader >( iss );
@@ -67,314 +79,154 @@ namespace xiv
 
             // Preallocate and extract the record_indices
             const uint32_t record_count = exd_header.index_size / sizeof( ExdRecordIndex );
-            std::vector< ExdRecordIndex > record_indices;
-            record_indices.reserve( record_count );
             for ( uint32_t i = 0; i < record_count; ++i )
             {
                 auto recordIndex = extract< ExdRecordIndex >( iss );
-               _idCache[recordIndex.id] = ExdCacheEntry{file_ptr, recordIndex.offset};
+               _idCache[recordIndex.id] = ExdCacheEntry{ &data[ recordIndex.offset ] };
             }
          }
       }
 
+      Exd::Exd( std::shared_ptr<Exh> i_exh, std::shared_ptr<const void> i_memory,
+                const std::map<uint32_t, ExdCacheEntry>& i_records ) :
+         _memory( i_memory ),
+         _exh( i_exh ),
+         _idCache( i_records )
+      {
+      }
+
       Exd::~Exd()
       {
       }
 
       const std::vector<Field> Exd::get_row( uint32_t id, uint32_t subRow )
       {
-  
+         auto row = get_row_data( id, subRow );
+         return decode_row( row.data, row.strings );
+      }
+
+      const std::vector<Field> Exd::get_row( uint32_t id )
+      {
+         auto row = get_row_data( id );
+         return decode_row( row.data, row.strings );
+      }
+
+      RowData Exd::get_row_data( uint32_t id ) const
+      {
          auto cacheEntryIt = _idCache.find( id );
          if( cacheEntryIt == _idCache.end() )
             throw std::runtime_error( "Id not found: " + std::to_string( id ) );
-  
-         // Iterates over all the files
-         const uint32_t member_count = _exh->get_members().size();
-         auto& file_ptr = cacheEntryIt->second.file;
-  
-         std::vector< char > dataCpy = file_ptr->get_data_sections().front();
-         std::istringstream iss( std::string( dataCpy.begin(), dataCpy.end() ) );
-  
-         // Get the vector fields for the given record and preallocate it
-         auto fields = _data[id];
-         fields.reserve( member_count );
-         iss.seekg( cacheEntryIt->second.offset + 6 );
-  
-         uint8_t subRows = *reinterpret_cast< uint8_t* >( &dataCpy[ cacheEntryIt->second.offset + 5 ] );
 
+         // 6 is because we have uint32_t/uint16_t at the start of each record
+         const char* row = cacheEntryIt->second.record + 6;
+         return RowData{ row, row + _exh->get_header().data_offset };
+      }
+
+      RowData Exd::get_row_data( uint32_t id, uint32_t subRow ) const
+      {
+         auto cacheEntryIt = _idCache.find( id );
+         if( cacheEntryIt == _idCache.end() )
+            throw std::runtime_error( "Id not found: " + std::to_string( id ) );
+
+         auto record = cacheEntryIt->second.record;
+
+         uint8_t subRows = *reinterpret_cast< const uint8_t* >( record + 5 );
          if( subRow >= subRows )
            throw std::runtime_error( "Out of bounds sub-row!" );
 
-         int offset = cacheEntryIt->second.offset + 6 + ( subRow * _exh->get_header().data_offset + 2 * ( subRow + 1 ) );
+         // every sub-row is prefixed by its uint16_t id
+         const char* row = record + 6 + ( subRow * _exh->get_header().data_offset + 2 * ( subRow + 1 ) );
+         return RowData{ row, nullptr };
+      }
 
-         for( auto& member_entry : _exh->get_exh_members() )
+      // Get all rows
+      const std::map<uint32_t, std::vector<Field>>& Exd::get_rows()
+      {
+         for( auto& entry : _idCache )
          {
-            // Seek to the position of the member to extract.
-            // 6 is because we have uint32_t/uint16_t at the start of each record
-            iss.seekg( offset + member_entry.offset );
-  
-            // Switch depending on the type to extract
-            switch( member_entry.type )
-            {
-            case DataType::string:
-               // Extract the offset to the actual string
-               // Seek to it then extract the actual string
-            {
-               throw std::runtime_error( "String not implemented for variant 2!" );
-               //auto string_offset = extract<uint32_t>( iss, "string_offset", false );
-               //iss.seekg( cacheEntryIt->second.offset + 6 + _exh->get_header().data_offset + string_offset );
-               //fields.emplace_back( utils::bparse::extract_cstring( iss, "string" ) );
-            }
-            break;
-  
-            case DataType::boolean:
-               fields.emplace_back( extract<bool>( iss, "bool" ) );
-               break;
-  
-            case DataType::int8:
-               fields.emplace_back( extract<int8_t>( iss, "int8_t" ) );
-               break;
+            auto row = get_row_data( entry.first );
+            _data[entry.first] = decode_row( row.data, row.strings );
+         }
+         return _data;
+      }
+
+      const std::map<uint32_t, ExdCacheEntry>& Exd::get_records() const
+      {
+         return _idCache;
+      }
 
-            case DataType::uint8:
-               fields.emplace_back( extract<uint8_t>( iss, "uint8_t" ) );
-               break;
+      const Exh& Exd::get_exh() const
+      {
+         return *_exh;
+      }
 
-            case DataType::int16:
-               fields.emplace_back( extract<int16_t>( iss, "int16_t", false ) );
-               break;
+      Field Exd::get_field( const RowData& i_row, uint32_t i_index ) const
+      {
+         return decode_field( _exh->get_exh_members().at( i_index ), i_row.data, i_row.strings );
+      }
 
-            case DataType::uint16:
-               fields.emplace_back( extract<uint16_t>( iss, "uint16_t", false ) );
-               break;
+      std::vector<Field> Exd::decode_row( const char* row, const char* strings ) const
+      {
+         std::vector<Field> fields;
+         fields.reserve( _exh->get_exh_members().size() );
 
-            case DataType::int32:
-               fields.emplace_back( extract<int32_t>( iss, "int32_t", false ) );
-               break;
-  
-            case DataType::uint32:
-               fields.emplace_back( extract<uint32_t>( iss, "uint32_t", false ) );
-               break;
-
-            case DataType::float32:
-               fields.emplace_back( extract<float>( iss, "float", false ) );
-               break;
-
-            case DataType::uint64:
-               fields.emplace_back( extract<uint64_t>( iss, "uint64_t", false ) );
-               break;
-
-            default:
-               auto type = static_cast< uint16_t >( member_entry.type );
-               if( type < 0x19 || type > 0x20 )
-                  throw std::runtime_error("Unknown DataType: " + std::to_string( type ));
-               uint64_t val = extract< uint64_t >( iss, "bool" );
-               int32_t shift = type - 0x19;
-               int32_t i = 1 << shift;
-               val &= i;
-               fields.emplace_back( ( val & i ) == i );
-               break;
-            }
-         }
-         return fields;
+         for( auto& member_entry : _exh->get_exh_members() )
+            fields.push_back( decode_field( member_entry, row, strings ) );
 
+         return fields;
       }
 
-
-      const std::vector<Field> Exd::get_row( uint32_t id )
+      Field Exd::decode_field( const ExhMember& member_entry, const char* row, const char* strings ) const
       {
+         const char* src = row + member_entry.offset;
 
-         auto cacheEntryIt = _idCache.find( id );
-         if( cacheEntryIt == _idCache.end() )
-            throw std::runtime_error( "Id not found: " + std::to_string( id ) );
+         // Switch depending on the type to extract
+         switch( member_entry.type )
+         {
+         case DataType::string:
+            // Extract the offset to the actual string
+            if( !strings )
+               throw std::runtime_error( "String not implemented for variant 2!" );
+            return std::string( strings + read_be< uint32_t >( src ) );
 
-         // Iterates over all the files
-         const uint32_t member_count = _exh->get_members().size();
-         auto& file_ptr = cacheEntryIt->second.file;
+         case DataType::boolean:
+            return *src != 0;
 
-         std::vector< char > dataCpy = file_ptr->get_data_sections().front();
-         std::istringstream iss( std::string( dataCpy.begin(), dataCpy.end() ) );
+         case DataType::int8:
+            return static_cast< int8_t >( *src );
 
-         // Get the vector fields for the given record and preallocate it
-         auto fields = _data[id];
-         fields.reserve( member_count );
-         iss.seekg( cacheEntryIt->second.offset + 6 );
+         case DataType::uint8:
+            return static_cast< uint8_t >( *src );
 
-         uint8_t subRows = *reinterpret_cast< uint8_t* >( &dataCpy[ cacheEntryIt->second.offset + 5 ] );
+         case DataType::int16:
+            return read_be< int16_t >( src );
 
-         for( auto& member_entry : _exh->get_exh_members() )
-         {
-            // Seek to the position of the member to extract.
-            // 6 is because we have uint32_t/uint16_t at the start of each record
-            iss.seekg( cacheEntryIt->second.offset + 6 + member_entry.offset );
+         case DataType::uint16:
+            return read_be< uint16_t >( src );
 
-            // Switch depending on the type to extract
-            switch( member_entry.type )
-            {
-            case DataType::string:
-               // Extract the offset to the actual string
-               // Seek to it then extract the actual string
-            {
-               auto string_offset = extract<uint32_t>( iss, "string_offset", false );
-               iss.seekg( cacheEntryIt->second.offset + 6 + _exh->get_header().data_offset + string_offset );
-               fields.emplace_back( utils::bparse::extract_cstring( iss, "string" ) );
-            }
-            break;
-
-            case DataType::boolean:
-               fields.emplace_back( extract<bool>( iss, "bool" ) );
-               break;
-
-            case DataType::int8:
-               fields.emplace_back( extract<int8_t>( iss, "int8_t" ) );
-               break;
-
-            case DataType::uint8:
-               fields.emplace_back( extract<uint8_t>( iss, "uint8_t" ) );
-               break;
-
-            case DataType::int16:
-               fields.emplace_back( extract<int16_t>( iss, "int16_t", false ) );
-               break;
-
-            case DataType::uint16:
-               fields.emplace_back( extract<uint16_t>( iss, "uint16_t", false ) );
-               break;
-
-            case DataType::int32:
-               fields.emplace_back( extract<int32_t>( iss, "int32_t", false ) );
-               break;
-
-            case DataType::uint32:
-               fields.emplace_back( extract<uint32_t>( iss, "uint32_t", false ) );
-               break;
-
-            case DataType::float32:
-               fields.emplace_back( extract<float>( iss, "float", false ) );
-               break;
-
-            case DataType::uint64:
-               fields.emplace_back( extract<uint64_t>( iss, "uint64_t", false ) );
-               break;
-
-            default:
-               auto type = static_cast< uint16_t >( member_entry.type );
-               if( type < 0x19 || type > 0x20 )
-                  throw std::runtime_error("Unknown DataType: " + std::to_string( type ));
-               uint64_t val = extract< uint64_t >( iss, "bool" );
-               int32_t shift = type - 0x19;
-               int32_t i = 1 << shift;
-               val &= i;
-               fields.emplace_back( ( val & i ) == i );
-               break;
-            }
-         }
-         return fields;
+         case DataType::int32:
+            return read_be< int32_t >( src );
 
-      }
+         case DataType::uint32:
+            return read_be< uint32_t >( src );
 
-      // Get all rows
-      const std::map<uint32_t, std::vector<Field>>& Exd::get_rows()
-      {
-         // Iterates over all the files
-         const uint32_t member_count = _exh->get_members().size();
-         for( auto& file_ptr : _files )
-         {
-            // Get a stream
-            std::vector< char > dataCpy = file_ptr->get_data_sections().front();
-            std::istringstream iss( std::string( dataCpy.begin(), dataCpy.end() ) );
+         case DataType::float32:
+            return read_be< float >( src );
 
-            // Extract the header and skip to the record indices
-            auto exd_header = extract<ExdHeader>( iss );
-            iss.seekg( 0x20 );
+         case DataType::uint64:
+            return read_be< uint64_t >( src );
 
-            // Preallocate and extract the record_indices
-            const uint32_t record_count = exd_header.index_size / sizeof( ExdRecordIndex );
-            std::vector<ExdRecordIndex> record_indices;
-            record_indices.reserve( record_count );
-            for( uint32_t i = 0; i < record_count; ++i )
-            {
-               record_indices.emplace_back( extract<ExdRecordIndex>( iss ) );
-            }
-
-            for( auto& record_index : record_indices )
-            {
-               // Get the vector fields for the given record and preallocate it
-               auto& fields = _data[record_index.id];
-               fields.reserve( member_count );
-
-               for( auto& member_entry : _exh->get_exh_members() )
-               //for( auto& member_entry : _exh->get_members() )
-               {
-                  // Seek to the position of the member to extract.
-                  // 6 is because we have uint32_t/uint16_t at the start of each record
-                  iss.seekg( record_index.offset + 6 + member_entry.offset );
-
-                  // Switch depending on the type to extract
-                  switch( member_entry.type )
-                  {
-                  case DataType::string:
-                     // Extract the offset to the actual string
-                     // Seek to it then extract the actual string
-                  {
-                     auto string_offset = extract<uint32_t>( iss, "string_offset", false );
-                     iss.seekg( record_index.offset + 6 + _exh->get_header().data_offset + string_offset );
-                     fields.emplace_back( utils::bparse::extract_cstring( iss, "string" ) );
-                  }
-                  break;
-
-                  case DataType::boolean:
-                     fields.emplace_back( extract<bool>( iss, "bool" ) );
-                     break;
-
-                  case DataType::int8:
-                     fields.emplace_back( extract<int8_t>( iss, "int8_t" ) );
-                     break;
-
-                  case DataType::uint8:
-                     fields.emplace_back( extract<uint8_t>( iss, "uint8_t" ) );
-                     break;
-
-                  case DataType::int16:
-                     fields.emplace_back( extract<int16_t>( iss, "int16_t", false ) );
-                     break;
-
-                  case DataType::uint16:
-                     fields.emplace_back( extract<uint16_t>( iss, "uint16_t", false ) );
-                     break;
-
-                  case DataType::int32:
-                     fields.emplace_back( extract<int32_t>( iss, "int32_t", false ) );
-                     break;
-
-                  case DataType::uint32:
-                     fields.emplace_back( extract<uint32_t>( iss, "uint32_t", false ) );
-                     break;
-
-                  case DataType::float32:
-                     fields.emplace_back( extract<float>( iss, "float", false ) );
-                     break;
-
-                  case DataType::uint64:
-                     fields.emplace_back( extract<uint64_t>( iss, "uint64_t", false ) );
-                     break;
-
-                  default:
-                     auto type = static_cast< uint16_t >( member_entry.type );
-                     if( type < 0x19 || type > 0x20 )
-                        throw std::runtime_error("Unknown DataType: " + std::to_string( type ));
-                     uint64_t val = extract< uint64_t >( iss, "bool" );
-                     int32_t shift = type - 0x19;
-                     int32_t i = 1 << shift;
-                     val &= i;
-                     fields.emplace_back( ( val & i ) == i );
-                     break;
-                  }
-               }
-            }
+         default:
+         {
+            // packed booleans, a single bit of the byte
+            auto type = static_cast< uint16_t >( member_entry.type );
+            if( type < 0x19 || type > 0x20 )
+               throw std::runtime_error("Unknown DataType: " + std::to_string( type ));
+            int32_t shift = type - 0x19;
+            return ( ( static_cast< uint8_t >( *src ) >> shift ) & 1 ) != 0;
+         }
          }
-         return _data;
       }
 
    }
 }
-
@@ -14,6 +14,7 @@ namespace exd
 {
 
 class Exh;
+struct ExhMember;
 
 // Field type containing all the possible types in the data files
 using Field = std::variant<
@@ -28,10 +29,19 @@ using Field = std::variant<
     float,
     uint64_t >;
   
+// A record: uint32_t size and uint16_t sub-row count, both big endian, followed by the row data
 struct ExdCacheEntry
 {
-   std::shared_ptr<dat::File> file;
-   uint32_t offset;
+   const char* record;
+};
+
+// Undecoded row, columns are big endian and sit at their exh offset from data.
+// String columns hold an offset relative to strings, which is null for sub-rows.
+// Both point into the exd page and stay valid as long as the Exd does.
+struct RowData
+{
+   const char* data;
+   const char* strings;
 };
 
 // Data for a given language
@@ -42,6 +52,8 @@ public:
     // i_files: the multiple exd files
     Exd() {}
     Exd(std::shared_ptr<Exh> i_exh, const std::vector<std::shared_ptr<dat::File>>& i_files);
+    // i_records: the records of the rows, they are not copied and have to live as long as i_memory
+    Exd(std::shared_ptr<Exh> i_exh, std::shared_ptr<const void> i_memory, const std::map<uint32_t, ExdCacheEntry>& i_records);
     ~Exd();
 
     // Get a row by its id
@@ -52,10 +64,31 @@ public:
     // Get all rows
     const std::map<uint32_t, std::vector<Field>>& get_rows();
 
+    // Get a row without copying or decoding it
+    RowData get_row_data(uint32_t id) const;
+
+    // Get a sub-row without copying or decoding it
+    RowData get_row_data(uint32_t id, uint32_t subRow) const;
+
+    // Decode a single column of a row, i_index is the position of the column in the exh
+    Field get_field(const RowData& i_row, uint32_t i_index) const;
+
+    // The records of all rows, by id
+    const std::map<uint32_t, ExdCacheEntry>& get_records() const;
+
+    // The header the rows are laid out by
+    const Exh& get_exh() const;
+
 protected:
     // Data indexed by the ID of the row, the vector is field with the same order as exh.members
     std::map<uint32_t, std::vector<Field>> _data;
+    // Decodes the columns of a row, strings is null for sub-rows
+    std::vector<Field> decode_row(const char* row, const char* strings) const;
+    Field decode_field(const ExhMember& member_entry, const char* row, const char* strings) const;
+
     std::vector<std::shared_ptr<dat::File>> _files;
+    // Keeps the records alive if they are not in _files
+    std::shared_ptr<const void> _memory;
     std::shared_ptr<Exh> _exh;
     std::map< uint32_t, ExdCacheEntry > _idCache;
 };
@@ -24,7 +24,7 @@ namespace xiv
    namespace exd
    {
 
-      Cat::Cat(dat::GameData& i_game_data, const std::string& i_name) :
+      Cat::Cat(dat::GameData& i_game_data, const std::string& i_name, Language i_language) :
          _name(i_name)
       {
          //XIV_INFO(xiv_exd_logger, "Initializing Cat with name: " << i_name);
@@ -37,8 +37,8 @@ namespace xiv
 
          for(auto language: _header->get_languages())
          {
-            // chs not yet in data files
-            if (language == Language::en || language == Language::none)
+            // only the requested language is loaded, chs is not yet in data files
+            if (language == i_language || language == Language::none)
             {
                // Get all the files for a given category/language, in case of multiple range of IDs in separate files (like Quest)
                std::vector<std::shared_ptr<dat::File>> files;
@@ -39,7 +39,8 @@ namespace xiv
       public:
          // i_name: name of the category
          // i_game_data: used to fetch the files needed
-         Cat( dat::GameData& i_game_data, const std::string& i_name );
+         // i_language: the only language loaded if the category has more than one
+         Cat( dat::GameData& i_game_data, const std::string& i_name, Language i_language = Language::en );
          ~Cat();
 
          // Returns the name of the category
@@ -12,8 +12,14 @@ namespace xiv
 namespace exd
 {
 
-ExdData::ExdData(dat::GameData& i_game_data) try :
-    _game_data(i_game_data)
+ExdData::ExdData(dat::GameData& i_game_data) :
+    ExdData(i_game_data, Language::en)
+{
+}
+
+ExdData::ExdData(dat::GameData& i_game_data, Language i_language) try :
+    _game_data(i_game_data),
+    _language(i_language)
 {
     //XIV_INFO(xiv_exd_logger, "Initializing ExdData");
 
@@ -92,7 +98,7 @@ void ExdData::create_category(const std::string& i_cat_name)
     // Maybe after unlocking it has already been created, so check (most likely if it blocked)
     if (!_cats[i_cat_name])
     {
-        _cats[i_cat_name] = std::unique_ptr<Cat>(new Cat(_game_data, i_cat_name));
+        _cats[i_cat_name] = std::unique_ptr<Cat>(new Cat(_game_data, i_cat_name, _language));
     }
 }
 
@@ -1,6 +1,7 @@
 #ifndef XIV_EXD_EXDDATA_H
 #define XIV_EXD_EXDDATA_H
 
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
@@ -17,6 +18,7 @@ namespace xiv
    {
 
       class Cat;
+      enum Language : uint16_t;
 
       // Interface for retrieval of exd data - Main entry point
       // the game_data object should outlive the exd_data object
@@ -24,6 +26,8 @@ namespace xiv
       {
       public:
           // Need an initialized dat::GameData to retrieve the files from the dat
+          // i_language: the only language loaded for categories that have more than one
+          ExdData(dat::GameData& i_game_data, Language i_language);
           ExdData(dat::GameData& i_game_data);
           ~ExdData();
 
@@ -43,6 +47,9 @@ namespace xiv
           // Reference to the game_data object
           dat::GameData& _game_data;
 
+          // Language loaded for the categories
+          Language _language;
+
           // Categories, indexed by their name
           std::unordered_map<std::string, std::unique_ptr<Cat>> _cats;
           // List of category names = m_cats.keys()
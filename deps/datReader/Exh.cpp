@@ -44,6 +44,17 @@ Exh::Exh(const dat::File& i_file)
     }
 }
 
+Exh::Exh(const ExhHeader& i_header, const std::vector<ExhMember>& i_members, const std::vector<Language>& i_languages) :
+    _header(i_header),
+    _exh_defs(i_members),
+    _languages(i_languages)
+{
+    for (auto& member : _exh_defs)
+    {
+        _members[member.offset] = member;
+    }
+}
+
 Exh::~Exh()
 {
 }
@@ -80,6 +80,8 @@ namespace xiv
       public:
          // The header file
          Exh( const dat::File& i_file );
+         // A header that does not come from a dat file, the sheet has no exd files
+         Exh( const ExhHeader& i_header, const std::vector<ExhMember>& i_members, const std::vector<Language>& i_languages );
          ~Exh();
 
          const ExhHeader& get_header() const;
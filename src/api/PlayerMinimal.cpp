@@ -41,47 +41,52 @@ void PlayerMinimal::load( uint32_t charId )
 
   m_id = charId;
 
+  loadFromResult( *res );
+
+  res.reset();
+
+  // SELECT ClassIdx, Exp, Lvl
+  auto stmtClass = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_CLASS_SEL );
+  stmtClass->setInt( 1, m_id );
+
+  auto resClass = g_charaDb.query( stmtClass );
+
+  while( resClass->next() )
+    setClassLevel( resClass->getUInt( 1 ), resClass->getUInt( 3 ) );
+}
+
+void PlayerMinimal::loadFromResult( Mysql::PreparedResultSet& res )
+{
   memset( m_name, 0, 32 );
 
-  strcpy( m_name, res->getString( "Name" ).c_str() );
+  strcpy( m_name, res.getString( "Name" ).c_str() );
 
-  auto customize = res->getBlobVector( "Customize" );
+  auto customize = res.getBlobVector( "Customize" );
   memcpy( ( char* ) m_look, customize.data(), customize.size() );
   for( int32_t i = 0; i < 26; i++ )
   {
     m_lookMap[ i ] = m_look[ i ];
   }
 
-  auto modelEquip = res->getBlobVector( "ModelEquip" );
+  auto modelEquip = res.getBlobVector( "ModelEquip" );
   memcpy( ( char* ) m_modelEquip, modelEquip.data(), modelEquip.size() );
 
-  m_modelMainWeapon = res->getUInt64( "ModelMainWeapon" );
-  m_modelSubWeapon = res->getUInt64( "ModelSubWeapon" );
-  m_equipDisplayFlags = res->getUInt8( "EquipDisplayFlags" );
-
+  m_modelMainWeapon = res.getUInt64( "ModelMainWeapon" );
+  m_modelSubWeapon = res.getUInt64( "ModelSubWeapon" );
+  m_equipDisplayFlags = res.getUInt8( "EquipDisplayFlags" );
 
-  setBirthDay( res->getUInt8( "BirthDay" ), res->getUInt8( "BirthMonth" ) );
-  m_guardianDeity = res->getUInt8( "GuardianDeity" );
-  m_class = res->getUInt8( "Class" );
-  m_contentId = res->getUInt64( "ContentId" );
-  m_territoryTypeId = res->getUInt16( "TerritoryType" );
 
-  res.reset();
-
-  // SELECT ClassIdx, Exp, Lvl
-  auto stmtClass = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_CLASS_SEL );
-  stmtClass->setInt( 1, m_id );
-
-  auto resClass = g_charaDb.query( stmtClass );
-
-  while( resClass->next() )
-  {
-    auto classIdx = resClass->getUInt( 1 );
-    auto lvl = resClass->getUInt( 3 );
+  setBirthDay( res.getUInt8( "BirthDay" ), res.getUInt8( "BirthMonth" ) );
+  m_guardianDeity = res.getUInt8( "GuardianDeity" );
+  m_class = res.getUInt8( "Class" );
+  m_contentId = res.getUInt64( "ContentId" );
+  m_territoryTypeId = res.getUInt16( "TerritoryType" );
+}
 
-    m_classMap[ classIdx ] = lvl;
-    m_classLevel = getClassLevel();
-  }
+void PlayerMinimal::setClassLevel( uint8_t classIdx, uint16_t level )
+{
+  m_classMap[ classIdx ] = level;
+  m_classLevel = getClassLevel();
 }
 
 
@@ -5,6 +5,11 @@
 #include <stdint.h>
 #include <string.h>
 
+namespace Mysql
+{
+  class PreparedResultSet;
+}
+
 namespace Sapphire::Api
 {
 
@@ -21,6 +26,12 @@ namespace Sapphire::Api
     // load player from db, by id
     void load( uint32_t charId );
 
+    // load player from the current row of a CHARA_SEL_MINIMAL / CHARA_SEL_MINIMAL_ACCOUNT result
+    void loadFromResult( Mysql::PreparedResultSet& res );
+
+    // store the level of a single class, as read from characlass
+    void setClassLevel( uint8_t classIdx, uint16_t level );
+
     void saveAsNew();
 
     std::string getLookString();
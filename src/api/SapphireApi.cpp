@@ -9,6 +9,7 @@
 #include <nlohmann/json.hpp>
 
 #include <Database/DatabaseDef.h>
+#include <Util/Util.h>
 
 using namespace Sapphire::Api;
 
@@ -168,6 +169,8 @@ int SapphireApi::createCharacter( const uint32_t accountId, const std::string& n
 
   newPlayer.saveAsNew();
 
+  invalidateCharList( accountId );
+
   return newPlayer.getAccountId();
 }
 
@@ -199,41 +202,121 @@ void SapphireApi::deleteCharacter( std::string name, const uint32_t accountId )
   g_charaDb.execute( "DELETE FROM charaiteminventory WHERE CharacterId LIKE '" + std::to_string( id ) + "';" );
   g_charaDb.execute( "DELETE FROM charaitemgearset WHERE CharacterId LIKE '" + std::to_string( id ) + "';" );
   g_charaDb.execute( "DELETE FROM charaquest WHERE CharacterId LIKE '" + std::to_string( id ) + "';" );
+
+  invalidateCharList( accountId );
 }
 
 std::vector< PlayerMinimal > SapphireApi::getCharList( uint32_t accountId )
 {
+  auto now = Common::Util::getTimeMs();
+  auto revision = getCharListRevision( accountId );
+  uint64_t epoch;
+
+  {
+    std::lock_guard< std::mutex > lock( m_charListCacheMutex );
+    auto it = m_charListCache.find( accountId );
+    if( it != m_charListCache.end() && it->second.expireTime > now && it->second.revision == revision.first )
+      return it->second.charList;
+
+    epoch = m_charListEpoch;
+  }
+
+  auto charList = loadCharList( accountId );
+
+  std::lock_guard< std::mutex > lock( m_charListCacheMutex );
 
+  // invalidated while loading, the list may already be outdated
+  if( epoch != m_charListEpoch )
+    return charList;
+
+  // UPDATE_DATE only has a resolution of seconds, a write later in the same second would not change it
+  if( revision.first < revision.second )
+    m_charListCache[ accountId ] = { now + CharListCacheTtl, revision.first, charList };
+  else
+    m_charListCache.erase( accountId );
+
+  // drop expired entries so accounts that logged in once don't stay around forever
+  for( auto it = m_charListCache.begin(); it != m_charListCache.end(); )
+  {
+    if( it->second.expireTime <= now )
+      it = m_charListCache.erase( it );
+    else
+      ++it;
+  }
+
+  return charList;
+}
+
+std::vector< PlayerMinimal > SapphireApi::loadCharList( uint32_t accountId )
+{
   std::vector< Api::PlayerMinimal > charList;
+  std::map< uint32_t, size_t > charIdToIndex;
 
-  auto pQR = g_charaDb.query(
-    "SELECT CharacterId, ContentId FROM charainfo WHERE AccountId = " + std::to_string( accountId ) + ";" );
+  // one query for all characters of the account...
+  auto stmt = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_SEL_MINIMAL_ACCOUNT );
+  stmt->setUInt( 1, accountId );
+  auto pQR = g_charaDb.query( stmt );
 
   while( pQR->next() )
   {
     Api::PlayerMinimal player;
 
-    uint32_t charId = pQR->getUInt( 1 );
-
-    player.load( charId );
+    player.setId( pQR->getUInt( "CharacterId" ) );
+    player.setAccountId( accountId );
+    player.loadFromResult( *pQR );
 
+    charIdToIndex[ player.getId() ] = charList.size();
     charList.push_back( player );
   }
+
+  if( charList.empty() )
+    return charList;
+
+  // ...and one for all of their class levels
+  auto stmtClass = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_CLASS_SEL_ACCOUNT );
+  stmtClass->setUInt( 1, accountId );
+  auto resClass = g_charaDb.query( stmtClass );
+
+  while( resClass->next() )
+  {
+    auto it = charIdToIndex.find( resClass->getUInt( 1 ) );
+    if( it == charIdToIndex.end() )
+      continue;
+
+    charList[ it->second ].setClassLevel( resClass->getUInt( 2 ), resClass->getUInt( 4 ) );
+  }
+
   return charList;
 }
 
+std::pair< uint64_t, uint64_t > SapphireApi::getCharListRevision( uint32_t accountId )
+{
+  auto stmt = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_SEL_LIST_REVISION );
+  stmt->setUInt( 1, accountId );
+  stmt->setUInt( 2, accountId );
+  auto pQR = g_charaDb.query( stmt );
+
+  if( !pQR->next() )
+    return { 0, 0 };
+
+  return { pQR->getUInt64( 1 ), pQR->getUInt64( 2 ) };
+}
+
 bool SapphireApi::checkNameTaken( std::string name )
 {
+  auto stmt = g_charaDb.getPreparedStatement( Db::ZoneDbStatements::CHARA_SEL_NAME_TAKEN );
+  stmt->setString( 1, name );
 
-  g_charaDb.escapeString( name );
-  std::string query = "SELECT * FROM charainfo WHERE Name = '" + name + "';";
+  auto pQR = g_charaDb.query( stmt );
 
-  auto pQR = g_charaDb.query( query );
+  return pQR->next();
+}
 
-  if( !pQR->next() )
-    return false;
-  else
-    return true;
+void SapphireApi::invalidateCharList( uint32_t accountId )
+{
+  std::lock_guard< std::mutex > lock( m_charListCacheMutex );
+  m_charListCache.erase( accountId );
+  ++m_charListEpoch;
 }
 
 uint32_t SapphireApi::getNextCharId()
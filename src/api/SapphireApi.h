@@ -5,6 +5,7 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <mutex>
 #include "PlayerMinimal.h"
 
 namespace Sapphire::Api
@@ -32,6 +33,11 @@ namespace Sapphire::Api
 
     std::vector< Api::PlayerMinimal > getCharList( uint32_t accountId );
 
+    // drops the cached character list of an account, has to be called whenever a character
+    // of that account is created or deleted by the api. changes made by the world server are
+    // picked up through the UPDATE_DATE of charainfo and characlass
+    void invalidateCharList( uint32_t accountId );
+
     bool checkNameTaken( std::string name );
 
     uint32_t getNextCharId();
@@ -44,6 +50,28 @@ namespace Sapphire::Api
 
     SessionMap m_sessionMap;
 
+  private:
+    // time in ms a cached character list stays valid
+    static constexpr uint64_t CharListCacheTtl = 5000;
+
+    struct CharListCacheEntry
+    {
+      uint64_t expireTime;
+      // newest UPDATE_DATE of the characters and classes of the account when it was loaded
+      uint64_t revision;
+      std::vector< Api::PlayerMinimal > charList;
+    };
+
+    std::vector< Api::PlayerMinimal > loadCharList( uint32_t accountId );
+
+    // newest UPDATE_DATE of the account's characters and classes, and the db server time, in seconds
+    std::pair< uint64_t, uint64_t > getCharListRevision( uint32_t accountId );
+
+    std::mutex m_charListCacheMutex;
+    std::map< uint32_t, CharListCacheEntry > m_charListCache;
+    // bumped by every invalidation, a load that started before one is not cached
+    uint64_t m_charListEpoch{ 0 };
+
   };
 }
 
@@ -4,6 +4,7 @@
 #include <nlohmann/json.hpp>
 
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <Config/ConfigMgr.h>
 
 #include <Network/Connection.h>
@@ -88,9 +89,13 @@ void reloadConfig()
   m_config.network.listenIP = pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
 }
 
-void print_request_info( shared_ptr< HttpServer::Request > request )
+// route is the fixed name of the handler, the raw path is client controlled and only logged
+void print_request_info( shared_ptr< HttpServer::Request > request, const std::string& route )
 {
   Logger::info( "Request from {0} ({1})", request->remote_endpoint_address, request->path  );
+
+  Metrics::Registry::counter( "api_requests_total", "route=\"" + route + "\"",
+                              "Handled api requests per route" ).inc();
 }
 
 bool loadSettings( int32_t argc, char* argv[] )
@@ -223,7 +228,7 @@ void getZoneName( shared_ptr< HttpServer::Response > response, shared_ptr< HttpS
 
 void createAccount( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "createAccount" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -255,7 +260,7 @@ void createAccount( shared_ptr< HttpServer::Response > response, shared_ptr< Htt
 
 void login( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "login" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -290,7 +295,7 @@ void login( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer:
 
 void deleteCharacter( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "deleteCharacter" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -325,7 +330,7 @@ void deleteCharacter( shared_ptr< HttpServer::Response > response, shared_ptr< H
 
 void createCharacter( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "createCharacter" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -373,7 +378,7 @@ void createCharacter( shared_ptr< HttpServer::Response > response, shared_ptr< H
 
 void insertSession( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "insertSession" );
 
   try
   {
@@ -405,7 +410,7 @@ void insertSession( shared_ptr< HttpServer::Response > response, shared_ptr< Htt
 
 void checkNameTaken( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "checkNameTaken" );
 
   try
   {
@@ -440,7 +445,7 @@ void checkNameTaken( shared_ptr< HttpServer::Response > response, shared_ptr< Ht
 
 void checkSession( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "checkSession" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -483,7 +488,7 @@ void checkSession( shared_ptr< HttpServer::Response > response, shared_ptr< Http
 
 void getNextCharId( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "getNextCharId" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -513,7 +518,7 @@ void getNextCharId( shared_ptr< HttpServer::Response > response, shared_ptr< Htt
 
 void getNextContentId( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "getNextContentId" );
 
   try
   {
@@ -544,7 +549,7 @@ void getNextContentId( shared_ptr< HttpServer::Response > response, shared_ptr<
 
 void getCharacterList( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "getCharacterList" );
   try
   {
     auto json = nlohmann::json::parse( request->content );
@@ -599,7 +604,7 @@ void getCharacterList( shared_ptr< HttpServer::Response > response, shared_ptr<
 
 void get_init( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "get_init" );
   try
   {
     auto web_root_path = fs::canonical( "web" );
@@ -634,7 +639,7 @@ void get_init( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServ
 
 void get_headline_all( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "get_headline_all" );
   try
   {
     auto web_root_path = fs::canonical( "web" );
@@ -668,7 +673,7 @@ void get_headline_all( shared_ptr< HttpServer::Response > response, shared_ptr<
 
 void defaultGet( shared_ptr< HttpServer::Response > response, shared_ptr< HttpServer::Request > request )
 {
-  print_request_info( request );
+  print_request_info( request, "static" );
   try
   {
     auto web_root_path = fs::canonical( "web" );
@@ -718,6 +723,8 @@ int main( int argc, char* argv[] )
 
   Logger::setLogLevel( m_config.global.general.logLevel );
 
+  Metrics::Registry::startExporter( m_config.global.metrics.path + "/api.prom", m_config.global.metrics.interval );
+
   server.resource[ "^/ZoneName/([0-9]+)$" ][ "GET" ] = &getZoneName;
   server.resource[ "^/sapphire-api/lobby/createAccount" ][ "POST" ] = &createAccount;
   server.resource[ "^/sapphire-api/lobby/login" ][ "POST" ] = &login;
@@ -31,6 +31,14 @@ namespace Sapphire::Common::Config
       std::string restHost;
       uint16_t restPort;
     } network;
+
+    struct Metrics
+    {
+      // directory the prometheus text files are written to
+      std::string path;
+      // export interval in seconds, 0 disables the exporter
+      uint32_t interval;
+    } metrics;
   };
 
   struct WorldConfig
@@ -45,6 +53,13 @@ namespace Sapphire::Common::Config
       uint16_t disconnectTimeout;
 
       float inRangeDistance;
+      // charas spawned for a player per tick at most, the most relevant ones first. 0 for no limit
+      uint32_t spawnsPerTick;
+      // bytes of spawn packets sent per tick after zoning, 0 sends them all at once
+      uint32_t zoneInBundleSize;
+
+      // folder the inbound packets of every session are captured to, empty disables capturing
+      std::string capturePath;
     } network;
 
     struct Housing
@@ -64,6 +79,35 @@ namespace Sapphire::Common::Config
       std::string meshPath;
     } navigation;
 
+    struct Instances
+    {
+      // finished instances kept per content for reuse, 0 disables pooling
+      uint32_t poolSize;
+      // comma separated contentFinderConditionIds / questBattleIds whose pools are filled on startup
+      std::string warmContent;
+      std::string warmQuestBattles;
+    } instances;
+
+    struct ContentFinder
+    {
+      // milliseconds between two matching passes
+      uint32_t matchInterval;
+      // seconds players have to accept a popped duty
+      uint32_t readyCheckTimeout;
+    } contentFinder;
+
+    struct Exd
+    {
+      // comma separated sheets opened on startup, every other sheet is opened the first time it is used
+      std::string preloadSheets;
+      // ja, en, de or fr, the only language loaded for sheets with text
+      std::string language;
+      // sheets that are not preloaded are never opened and read as empty
+      bool strict;
+      // decoded sheets of the current game version are mapped from here, empty disables it
+      std::string snapshotPath;
+    } exd;
+
     std::string motd;
   };
 
@@ -79,6 +123,15 @@ namespace Sapphire::Common::Config
 
     bool allowNoSessionConnect;
     std::string worldName;
+
+    struct Api
+    {
+      uint32_t poolSize;
+      uint32_t timeout;
+      uint32_t retries;
+      uint32_t retryBackoff;
+      uint32_t statsInterval;
+    } api;
   };
 
   struct ApiConfig
@@ -71,6 +71,10 @@ bool ConfigMgr::loadGlobalConfig( Common::Config::GlobalConfig& config, const st
   config.network.restHost = getValue< std::string >( "Network", "RestHost", "127.0.0.1" );
   config.network.restPort = getValue< uint16_t >( "Network", "RestPort", 80 );
 
+  // metrics
+  config.metrics.path = getValue< std::string >( "Metrics", "Path", "metrics" );
+  config.metrics.interval = getValue< uint32_t >( "Metrics", "Interval", 0 );
+
   return true;
 }
 
@@ -5,24 +5,27 @@
 // Converted to C++ class 5/96, Jim Conger
 
 #include <cstdint>
+#include <cstring>
 #include "blowfish.h"
 #include "blowfish.h2"  // holds the random digit tables
 
 #define S( x, i ) (SBoxes[i][x.w.byte##i])
 #define bf_F( x ) (((S(x,0) + S(x,1)) ^ S(x,2)) + S(x,3))
 #define ROUND( a, b, n ) (a.dword ^= bf_F(b) ^ PArray[n])
+#define ROUND4( a, b, n ) ROUND( a##0, b##0, n ); ROUND( a##1, b##1, n ); ROUND( a##2, b##2, n ); ROUND( a##3, b##3, n )
 
 
 BlowFish::BlowFish()
 {
-  PArray = new DWORD[18];
-  SBoxes = new DWORD[4][256];
+}
+
+BlowFish::BlowFish( BYTE key[], int32_t keybytes )
+{
+  initialize( key, keybytes );
 }
 
 BlowFish::~BlowFish()
 {
-  delete PArray;
-  delete[] SBoxes;
 }
 
 // the low level (private) encryption function
@@ -88,6 +91,66 @@ void BlowFish::Blowfish_decipher( DWORD* xl, DWORD* xr )
   *xr = Xl.dword;
 }
 
+// interleaved version of Blowfish_encipher, blocks are stored xl, xr, xl, xr...
+void BlowFish::Blowfish_encipher4( DWORD* pBlocks )
+{
+  union aword L0, R0, L1, R1, L2, R2, L3, R3;
+
+  L0.dword = pBlocks[ 0 ] ^ PArray[ 0 ];
+  R0.dword = pBlocks[ 1 ];
+  L1.dword = pBlocks[ 2 ] ^ PArray[ 0 ];
+  R1.dword = pBlocks[ 3 ];
+  L2.dword = pBlocks[ 4 ] ^ PArray[ 0 ];
+  R2.dword = pBlocks[ 5 ];
+  L3.dword = pBlocks[ 6 ] ^ PArray[ 0 ];
+  R3.dword = pBlocks[ 7 ];
+
+  for( int n = 1; n <= NPASS; n += 2 )
+  {
+    ROUND4( R, L, n );
+    ROUND4( L, R, n + 1 );
+  }
+
+  pBlocks[ 0 ] = R0.dword ^ PArray[ 17 ];
+  pBlocks[ 1 ] = L0.dword;
+  pBlocks[ 2 ] = R1.dword ^ PArray[ 17 ];
+  pBlocks[ 3 ] = L1.dword;
+  pBlocks[ 4 ] = R2.dword ^ PArray[ 17 ];
+  pBlocks[ 5 ] = L2.dword;
+  pBlocks[ 6 ] = R3.dword ^ PArray[ 17 ];
+  pBlocks[ 7 ] = L3.dword;
+}
+
+// interleaved version of Blowfish_decipher, blocks are stored xl, xr, xl, xr...
+void BlowFish::Blowfish_decipher4( DWORD* pBlocks )
+{
+  union aword L0, R0, L1, R1, L2, R2, L3, R3;
+
+  L0.dword = pBlocks[ 0 ] ^ PArray[ 17 ];
+  R0.dword = pBlocks[ 1 ];
+  L1.dword = pBlocks[ 2 ] ^ PArray[ 17 ];
+  R1.dword = pBlocks[ 3 ];
+  L2.dword = pBlocks[ 4 ] ^ PArray[ 17 ];
+  R2.dword = pBlocks[ 5 ];
+  L3.dword = pBlocks[ 6 ] ^ PArray[ 17 ];
+  R3.dword = pBlocks[ 7 ];
+
+  for( int n = NPASS; n >= 1; n -= 2 )
+  {
+    ROUND4( R, L, n );
+    ROUND4( L, R, n - 1 );
+  }
+
+  pBlocks[ 0 ] = R0.dword ^ PArray[ 0 ];
+  pBlocks[ 1 ] = L0.dword;
+  pBlocks[ 2 ] = R1.dword ^ PArray[ 0 ];
+  pBlocks[ 3 ] = L1.dword;
+  pBlocks[ 4 ] = R2.dword ^ PArray[ 0 ];
+  pBlocks[ 5 ] = L2.dword;
+  pBlocks[ 6 ] = R3.dword ^ PArray[ 0 ];
+  pBlocks[ 7 ] = L3.dword;
+}
+
 
 // constructs the enctryption sieve
 void BlowFish::initialize( BYTE key[], int32_t keybytes )
@@ -192,7 +255,20 @@ DWORD BlowFish::Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize )
   int SameDest = ( pInput == pOutput ? 1 : 0 );
 
   lOutSize = GetOutputLength( lSize );
-  for( lCount = 0; lCount < lOutSize; lCount += 8 )
+
+  // full groups of 4 blocks go through the interleaved path, the rest is done block by block
+  DWORD lBulk = lSize & ~31u;
+  DWORD blocks[ 8 ];
+  for( lCount = 0; lCount < lBulk; lCount += 32 )
+  {
+    memcpy( blocks, pInput + lCount, 32 );
+    Blowfish_encipher4( blocks );
+    memcpy( pOutput + lCount, blocks, 32 );
+  }
+  pInput += lBulk;
+  pOutput += lBulk;
+
+  for( lCount = lBulk; lCount < lOutSize; lCount += 8 )
   {
     if( SameDest )  // if encoded data is being written into input buffer
     {
@@ -203,7 +279,7 @@ DWORD BlowFish::Encode( BYTE* pInput, BYTE* pOutput, DWORD lSize )
       }
       else    // pad end of data with null bytes to complete encryption
       {
-        po = pInput + lSize;  // point at byte past the end of actual data
+        po = pInput + ( lSize - lCount );  // point at byte past the end of actual data
         j = ( int ) ( lOutSize - lSize );  // number of bytes to set to null
         for( i = 0; i < j; i++ )
           *po++ = 0;
@@ -251,7 +327,18 @@ void BlowFish::Decode( BYTE* pInput, BYTE* pOutput, DWORD lSize )
   int i;
   int SameDest = ( pInput == pOutput ? 1 : 0 );
 
-  for( lCount = 0; lCount < lSize; lCount += 8 )
+  DWORD lBulk = lSize & ~31u;
+  DWORD blocks[ 8 ];
+  for( lCount = 0; lCount < lBulk; lCount += 32 )
+  {
+    memcpy( blocks, pInput + lCount, 32 );
+    Blowfish_decipher4( blocks );
+    memcpy( pOutput + lCount, blocks, 32 );
+  }
+  pInput += lBulk;
+  pOutput += lBulk;
+
+  for( lCount = lBulk; lCount < lSize; lCount += 8 )
   {
     if( SameDest )  // if encoded data is being written into input buffer
     {
@@ -13,19 +13,27 @@
 #define WORD      unsigned short
 #define BYTE      uint8_t
 
+// the key schedule costs 521 block encryptions, keep one instance per key and reuse it
 class BlowFish
 {
 private:
-  DWORD* PArray;
-  DWORD    (* SBoxes)[256];
+  DWORD PArray[18];
+  DWORD SBoxes[4][256];
 
   void Blowfish_encipher( DWORD* xl, DWORD* xr );
 
   void Blowfish_decipher( DWORD* xl, DWORD* xr );
 
+  // 4 independent blocks (8 dwords) at once, interleaving the rounds hides the sbox load latency
+  void Blowfish_encipher4( DWORD* pBlocks );
+
+  void Blowfish_decipher4( DWORD* pBlocks );
+
 public:
   BlowFish();
 
+  BlowFish( BYTE key[], int32_t keybytes );
+
   ~BlowFish();
 
   void initialize( BYTE key[], int32_t keybytes );
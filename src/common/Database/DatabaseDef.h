@@ -6,6 +6,7 @@
 #include "Database/ZoneDbConnection.h"
 #include "Database/DbWorkerPool.h"
 #include "Database/PreparedStatement.h"
+#include "Database/Transaction.h"
 
 extern Sapphire::Db::DbWorkerPool< Sapphire::Db::ZoneDbConnection > g_charaDb;
 
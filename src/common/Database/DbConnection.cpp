@@ -111,8 +111,8 @@ bool Sapphire::Db::DbConnection::execute( const std::string& sql )
   try
   {
     auto stmt = m_pConnection->createStatement();
-    bool result = stmt->execute( sql );
-    return result;
+    stmt->execute( sql );
+    return true;
   }
   catch( std::runtime_error& e )
   {
@@ -190,7 +190,8 @@ bool Sapphire::Db::DbConnection::execute( std::shared_ptr< Sapphire::Db::Prepare
   try
   {
     stmt->bindParameters();
-    return pStmt->execute();
+    pStmt->execute();
+    return true;
   }
   catch( std::runtime_error& e )
   {
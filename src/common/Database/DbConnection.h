@@ -52,6 +52,7 @@ namespace Sapphire::Db
 
     bool prepareStatements();
 
+    // both return false if the statement failed, the error is logged
     bool execute( const std::string& sql );
 
     bool execute( std::shared_ptr< PreparedStatement > stmt );
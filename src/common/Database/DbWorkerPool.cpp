@@ -3,6 +3,7 @@
 #include "PreparedStatement.h"
 #include <MySqlConnector.h>
 #include "StatementTask.h"
+#include "Transaction.h"
 #include "Operation.h"
 #include "ZoneDbConnection.h"
 #include "Framework.h"
@@ -195,12 +196,28 @@ unsigned long Sapphire::Db::DbWorkerPool< T >::escapeString( char* to, const cha
     m_connections[ IDX_SYNCH ].front()->getConnection()->getRawCon(), to, from, length );
 }
 
+template< class T >
+std::size_t Sapphire::Db::DbWorkerPool< T >::getQueueSize() const
+{
+  return m_queue->size();
+}
+
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::enqueue( std::shared_ptr< Operation > op )
 {
+  // nothing would ever take it off the queue
+  if( isOffline() )
+    return;
+
   m_queue->push( op );
 }
 
+template< class T >
+bool Sapphire::Db::DbWorkerPool< T >::isOffline() const
+{
+  return m_connections[ IDX_ASYNC ].empty() && m_connections[ IDX_SYNCH ].empty();
+}
+
 template< class T >
 std::shared_ptr< T > Sapphire::Db::DbWorkerPool< T >::getFreeConnection()
 {
@@ -208,6 +225,9 @@ std::shared_ptr< T > Sapphire::Db::DbWorkerPool< T >::getFreeConnection()
   const auto numCons = m_connections[ IDX_SYNCH ].size();
   std::shared_ptr< T > connection = nullptr;
 
+  if( numCons == 0 )
+    throw std::runtime_error( "DatabasePool " + getDatabaseName() + " has no synchronous connection" );
+
   while( true )
   {
     connection = m_connections[ IDX_SYNCH ][ i++ % numCons ];
@@ -239,9 +259,27 @@ void Sapphire::Db::DbWorkerPool< T >::execute( std::shared_ptr< PreparedStatemen
   enqueue( task );
 }
 
+template< class T >
+void Sapphire::Db::DbWorkerPool< T >::execute( std::shared_ptr< Transaction > transaction,
+                                               std::function< void( bool ) > callback )
+{
+  if( isOffline() )
+  {
+    if( callback )
+      callback( false );
+    return;
+  }
+
+  auto task = std::make_shared< TransactionTask >( transaction, callback );
+  enqueue( task );
+}
+
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::directExecute( const std::string& sql )
 {
+  if( isOffline() )
+    return;
+
   auto connection = getFreeConnection();
   connection->execute( sql );
   connection->unlock();
@@ -250,10 +288,30 @@ void Sapphire::Db::DbWorkerPool< T >::directExecute( const std::string& sql )
 template< class T >
 void Sapphire::Db::DbWorkerPool< T >::directExecute( std::shared_ptr< PreparedStatement > stmt )
 {
+  if( isOffline() )
+    return;
+
   auto connection = getFreeConnection();
   connection->execute( stmt );
   connection->unlock();
 }
 
+template< class T >
+bool Sapphire::Db::DbWorkerPool< T >::directExecute( std::shared_ptr< Transaction > transaction )
+{
+  if( isOffline() )
+    return false;
+
+  auto connection = getFreeConnection();
+
+  TransactionTask task( transaction );
+  task.setConnection( connection.get() );
+  bool committed = task.execute();
+
+  connection->unlock();
+
+  return committed;
+}
+
 template
 class Sapphire::Db::DbWorkerPool< Sapphire::Db::ZoneDbConnection >;
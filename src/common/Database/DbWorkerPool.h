@@ -2,6 +2,7 @@
 #define SAPPHIRE_DBWORKERPOOL_H
 
 #include <array>
+#include <functional>
 #include <string>
 #include <vector>
 #include <ResultSet.h>
@@ -18,8 +19,16 @@ namespace Sapphire::Db
 
   class PreparedStatement;
 
+  class Transaction;
+
   struct ConnectionInfo;
 
+  /*!
+   * @brief Connections to one database, shared by every thread of a process
+   *
+   * A pool that was never opened runs offline, which lets tools run world code without a database:
+   * statements are dropped, transactions report a rollback and queries throw std::runtime_error.
+   */
   template< class T >
   class DbWorkerPool
   {
@@ -54,11 +63,22 @@ namespace Sapphire::Db
 
     void execute( std::shared_ptr< PreparedStatement > stmt );
 
+    /*!
+     * @brief Queues a transaction for one of the async workers
+     *
+     * Transactions queued one after another may run concurrently on different workers,
+     * callers that depend on ordering have to wait for the callback before queueing the next one.
+     */
+    void execute( std::shared_ptr< Transaction > transaction, std::function< void( bool ) > callback = nullptr );
+
     // Sync execution
     void directExecute( const std::string& sql );
 
     void directExecute( std::shared_ptr< PreparedStatement > stmt );
 
+    /*! @return false if the transaction was rolled back */
+    bool directExecute( std::shared_ptr< Transaction > transaction );
+
     std::shared_ptr< Mysql::ResultSet >
     query( const std::string& sql, std::shared_ptr< T > connection = nullptr );
 
@@ -72,6 +92,9 @@ namespace Sapphire::Db
 
     void keepAlive();
 
+    // number of async operations waiting for a worker
+    std::size_t getQueueSize() const;
+
   private:
     uint32_t openConnections( InternalIndex type, uint8_t numConnections );
 
@@ -79,6 +102,8 @@ namespace Sapphire::Db
 
     void enqueue( std::shared_ptr< Operation > op );
 
+    bool isOffline() const;
+
     std::shared_ptr< T > getFreeConnection();
 
     const std::string& getDatabaseName() const;
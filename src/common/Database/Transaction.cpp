@@ -0,0 +1,80 @@
+#include "Transaction.h"
+#include "DbConnection.h"
+#include "PreparedStatement.h"
+#include "Logging/Logger.h"
+
+void Sapphire::Db::Transaction::append( const std::string& sql )
+{
+  m_entries.push_back( { sql, nullptr } );
+}
+
+void Sapphire::Db::Transaction::append( std::shared_ptr< PreparedStatement > stmt )
+{
+  m_entries.push_back( { "", std::move( stmt ) } );
+}
+
+std::size_t Sapphire::Db::Transaction::getSize() const
+{
+  return m_entries.size();
+}
+
+bool Sapphire::Db::Transaction::isEmpty() const
+{
+  return m_entries.empty();
+}
+
+Sapphire::Db::TransactionTask::TransactionTask( std::shared_ptr< Transaction > transaction,
+                                                std::function< void( bool ) > callback ) :
+  m_transaction( std::move( transaction ) ),
+  m_callback( std::move( callback ) )
+{
+}
+
+bool Sapphire::Db::TransactionTask::execute()
+{
+  bool committed = run();
+
+  if( m_callback )
+    m_callback( committed );
+
+  return committed;
+}
+
+bool Sapphire::Db::TransactionTask::run()
+{
+  try
+  {
+    m_pConn->beginTransaction();
+
+    // failing statements are logged by the connection, the whole batch is dropped then
+    for( auto& entry : m_transaction->m_entries )
+    {
+      bool success = entry.stmt ? m_pConn->execute( entry.stmt ) : m_pConn->execute( entry.sql );
+      if( !success )
+      {
+        m_pConn->rollbackTransaction();
+        Logger::error( "Transaction of {0} statements rolled back", m_transaction->getSize() );
+        return false;
+      }
+    }
+
+    m_pConn->commitTransaction();
+    return true;
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( "Transaction of {0} statements failed: {1}", m_transaction->getSize(), e.what() );
+  }
+
+  // begin or commit failed, nothing of the batch may stay applied
+  try
+  {
+    m_pConn->rollbackTransaction();
+  }
+  catch( std::runtime_error& e )
+  {
+    Logger::error( e.what() );
+  }
+
+  return false;
+}
@@ -0,0 +1,61 @@
+#ifndef SAPPHIRE_TRANSACTION_H
+#define SAPPHIRE_TRANSACTION_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Operation.h"
+
+namespace Sapphire::Db
+{
+  class PreparedStatement;
+
+  /*!
+   * @brief Set of statements executed in order inside a single database transaction
+   */
+  class Transaction
+  {
+  public:
+    void append( const std::string& sql );
+
+    void append( std::shared_ptr< PreparedStatement > stmt );
+
+    std::size_t getSize() const;
+
+    bool isEmpty() const;
+
+  private:
+    friend class TransactionTask;
+
+    struct Entry
+    {
+      std::string sql;
+      std::shared_ptr< PreparedStatement > stmt;
+    };
+
+    std::vector< Entry > m_entries;
+  };
+
+  class TransactionTask : public Operation
+  {
+  public:
+    /*!
+     * @param callback called on the worker thread once the transaction is done, with true if it was committed
+     *                 and false if it was rolled back
+     */
+    TransactionTask( std::shared_ptr< Transaction > transaction, std::function< void( bool ) > callback = nullptr );
+
+    /*! @return false if a statement failed and the transaction was rolled back */
+    bool execute() override;
+
+  private:
+    bool run();
+
+    std::shared_ptr< Transaction > m_transaction;
+    std::function< void( bool ) > m_callback;
+  };
+
+}
+
+#endif //SAPPHIRE_TRANSACTION_H
@@ -47,13 +47,27 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "ActiveTitle = ?, TitleList = ?, Achievement = ?, Aetheryte = ?, HowTo = ?, Minions = ?, Mounts = ?, Orchestrion = ?, "
                     "EquippedMannequin = ?, ConfigFlags = ?, QuestCompleteFlags = ?, OpeningSequence = ?, "
                     "QuestTracking = ?, GrandCompany = ?, GrandCompanyRank = ?, Discovery = ?, GMRank = ?, EquipDisplayFlags = ?, Unlocks = ?, "
-                    "CFPenaltyUntil = ?, Pose = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
+                    "CFPenaltyUntil = ?, Pose = ?, UPDATE_DATE = NOW() WHERE CharacterId = ?;", CONNECTION_ASYNC );
 
 
   prepareStatement( CHARA_SEL_MINIMAL, "SELECT Name, Customize, ModelMainWeapon, ModelSubWeapon, ModelEquip, TerritoryType, GuardianDeity, "
                                        "Class, ContentId, BirthDay, BirthMonth, EquipDisplayFlags "
                                        "FROM charainfo WHERE CharacterId = ?;", CONNECTION_SYNC );
 
+  prepareStatement( CHARA_SEL_MINIMAL_ACCOUNT, "SELECT CharacterId, Name, Customize, ModelMainWeapon, ModelSubWeapon, "
+                                               "ModelEquip, TerritoryType, GuardianDeity, Class, ContentId, BirthDay, "
+                                               "BirthMonth, EquipDisplayFlags "
+                                               "FROM charainfo WHERE AccountId = ? ORDER BY CharacterId;", CONNECTION_SYNC );
+  // newest UPDATE_DATE of the characters of an account and their classes, plus the current time of the db server
+  prepareStatement( CHARA_SEL_LIST_REVISION, "SELECT GREATEST( "
+                                             "IFNULL( UNIX_TIMESTAMP( ( SELECT MAX( UPDATE_DATE ) FROM charainfo "
+                                             "WHERE AccountId = ? ) ), 0 ), "
+                                             "IFNULL( UNIX_TIMESTAMP( ( SELECT MAX( cc.UPDATE_DATE ) FROM characlass cc "
+                                             "INNER JOIN charainfo ci ON ci.CharacterId = cc.CharacterId "
+                                             "WHERE ci.AccountId = ? ) ), 0 ) ), UNIX_TIMESTAMP();", CONNECTION_SYNC );
+
+  prepareStatement( CHARA_SEL_NAME_TAKEN, "SELECT CharacterId FROM charainfo WHERE Name = ? LIMIT 1;", CONNECTION_SYNC );
+
   prepareStatement( CHARA_INS, "INSERT INTO charainfo (AccountId, CharacterId, ContentId, Name, Hp, Mp, "
                                "Customize, Voice, IsNewGame, TerritoryType, PosX, PosY, PosZ, PosR, ModelEquip, "
                                "IsNewAdventurer, GuardianDeity, Birthday, BirthMonth, Class, Status, FirstClass, "
@@ -62,7 +76,7 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                                "VALUES ( ?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,NOW() );",
                     CONNECTION_SYNC );
 
-  prepareStatement( CHARA_UP_NAME, "UPDATE charainfo SET Name = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_NAME, "UPDATE charainfo SET Name = ?, UPDATE_DATE = NOW() WHERE CharacterId = ?;", CONNECTION_ASYNC );
   prepareStatement( CHARA_UP_HPMP, "UPDATE charainfo SET Hp = ?, Mp = ?, Tp = ?, Gp = ? WHERE CharacterId = ?;",
                     CONNECTION_ASYNC );
   prepareStatement( CHARA_UP_MODE, "UPDATE charainfo SET Mode = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
@@ -92,7 +106,7 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
   prepareStatement( CHARA_UP_POS,
                     "UPDATE charainfo SET OPosX = ?, OPosY = ?, OPosZ = ?, OPosR = ? WHERE CharacterId = ?;",
                     CONNECTION_ASYNC );
-  prepareStatement( CHARA_UP_CLASS, "UPDATE charainfo SET Class = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
+  prepareStatement( CHARA_UP_CLASS, "UPDATE charainfo SET Class = ?, UPDATE_DATE = NOW() WHERE CharacterId = ?;", CONNECTION_ASYNC );
   prepareStatement( CHARA_UP_STATUS, "UPDATE charainfo SET Status = ? WHERE CharacterId = ?;", CONNECTION_ASYNC );
   prepareStatement( CHARA_UP_TOTALPLAYTIME, "UPDATE charainfo SET TotalPlayTime = ? WHERE CharacterId = ?;",
                     CONNECTION_ASYNC );
@@ -159,9 +173,12 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
   /// CLASS INFO
   prepareStatement( CHARA_CLASS_SEL, "SELECT ClassIdx, Exp, Lvl FROM characlass WHERE CharacterId = ?;",
                     CONNECTION_SYNC );
+  prepareStatement( CHARA_CLASS_SEL_ACCOUNT, "SELECT cc.CharacterId, cc.ClassIdx, cc.Exp, cc.Lvl FROM characlass cc "
+                                             "INNER JOIN charainfo ci ON ci.CharacterId = cc.CharacterId "
+                                             "WHERE ci.AccountId = ?;", CONNECTION_SYNC );
   prepareStatement( CHARA_CLASS_INS, "INSERT INTO characlass ( CharacterId, ClassIdx, Exp, Lvl ) VALUES( ?,?,?,? );",
                     CONNECTION_BOTH );
-  prepareStatement( CHARA_CLASS_UP, "UPDATE characlass SET Exp = ?, Lvl = ? WHERE CharacterId = ? AND ClassIdx = ?;",
+  prepareStatement( CHARA_CLASS_UP, "UPDATE characlass SET Exp = ?, Lvl = ?, UPDATE_DATE = NOW() WHERE CharacterId = ? AND ClassIdx = ?;",
                     CONNECTION_ASYNC );
   prepareStatement( CHARA_CLASS_DEL, "DELETE FROM characlass WHERE CharacterId = ?;", CONNECTION_ASYNC );
 
@@ -173,7 +190,7 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
   /// ITEM GLOBAL
   prepareStatement( CHARA_ITEMGLOBAL_INS,
                     "INSERT INTO charaglobalitem ( CharacterId, ItemId, catalogId, stack, UPDATE_DATE ) VALUES ( ?, ?, ?, ?, NOW() );",
-                    CONNECTION_SYNC );
+                    CONNECTION_BOTH );
 
   prepareStatement( CHARA_ITEMGLOBAL_SELECT,
                     "SELECT catalogId, stack, reservedFlag, signatureId, flags, durability, refine, materia_0, materia_1, "
@@ -242,6 +259,10 @@ void Sapphire::Db::ZoneDbConnection::doPrepareStatements()
                     "UPDATE charaglobalitem SET deleted = 1 WHERE ItemId = ?;",
                     CONNECTION_BOTH );
 
+  prepareStatement( CHARA_ITEMGLOBAL_REMOVE,
+                    "DELETE FROM charaglobalitem WHERE ItemId = ?;",
+                    CONNECTION_BOTH );
+
   /// HOUSING
   prepareStatement( HOUSING_HOUSE_INS,
                     "INSERT INTO house ( LandSetId, HouseId, HouseName ) VALUES ( ?, ?, ? );",
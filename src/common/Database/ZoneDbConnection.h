@@ -11,6 +11,9 @@ namespace Sapphire::Db
   {
     CHARA_SEL,
     CHARA_SEL_MINIMAL,
+    CHARA_SEL_MINIMAL_ACCOUNT,
+    CHARA_SEL_LIST_REVISION,
+    CHARA_SEL_NAME_TAKEN,
     CHARA_SEL_SEARCHINFO,
     CHARA_SEL_QUEST,
     CHARA_INS,
@@ -66,6 +69,7 @@ namespace Sapphire::Db
     CHARA_QUEST_DEL,
 
     CHARA_CLASS_SEL,
+    CHARA_CLASS_SEL_ACCOUNT,
     CHARA_CLASS_INS,
     CHARA_CLASS_UP,
     CHARA_CLASS_DEL,
@@ -76,6 +80,7 @@ namespace Sapphire::Db
     CHARA_ITEMGLOBAL_INS,
     CHARA_ITEMGLOBAL_UP,
     CHARA_ITEMGLOBAL_DELETE,
+    CHARA_ITEMGLOBAL_REMOVE,
 
     CHARA_MONSTERNOTE_INS,
     CHARA_MONSTERNOTE_UP,
@@ -10,14 +10,45 @@
 #include <ExdData.h>
 #include <ExdCat.h>
 #include <Exd.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <variant>
+#include <Metrics/Metrics.h>
+#include "ExdSnapshot.h"
 
 namespace Sapphire {
 namespace Data {
 
 class ExdDataGenerated;
 
+// which sheets a process needs, every other sheet is only opened the first time it is used.
+// columns are not part of the profile, generated structs decode only the columns they map through getField,
+// while Exd::get_row still decodes every column of a row
+struct ExdProfile
+{
+  // opened by init, init fails if one of them does not exist
+  std::set< std::string > preloadSheets;
+  // the only language loaded for sheets that have text in more than one
+  xiv::exd::Language language = xiv::exd::Language::en;
+  // sheets that are not preloaded are never opened, they read as empty and an error is logged
+  bool strict = false;
+  // decoded sheets are mapped from this file instead of being read from the game files, empty disables it
+  std::string snapshotPath;
+};
+
+// a sheet and whether it has been opened yet
+struct ExdSheet
+{
+  xiv::exd::Exd dat;
+  std::once_flag opened;
+  // set once it is open
+  std::string name;
+  xiv::exd::Language language = xiv::exd::Language::none;
+};
+
 struct Achievement;
 struct AchievementCategory;
 struct AchievementKind;
@@ -5561,529 +5592,2483 @@ struct ZoneSharedGroup
     ExdDataGenerated();
     ~ExdDataGenerated();
 
-    bool init( const std::string& path );
+    bool init( const std::string& path, const ExdProfile& profile = ExdProfile() );
 
     xiv::exd::Exd setupDatAccess( const std::string& name, xiv::exd::Language lang );
 
+    // opens the sheet on first use, safe to call from any thread
+    xiv::exd::Exd& getSheet( ExdSheet& sheet, const std::string& name, xiv::exd::Language lang );
+
+    // opens a sheet by name, returns false if there is no struct generated for it
+    bool openSheet( const std::string& name );
+
+    // writes the sheets opened so far to the snapshot, unless it already held all of them.
+    // called after startup, periodically by the world server and on shutdown
+    bool writeSnapshot();
+
+    // opens sqpack, only done once a sheet is not in the snapshot
+    void openGameData();
+
+    void loadSnapshot();
+
+    // decodes only the requested column, straight from the row in the exd page
     template< class T >
-    T getField( std::vector< xiv::exd::Field >& fields, uint32_t index )
+    T getField( const xiv::exd::Exd& sheet, const xiv::exd::RowData& row, uint32_t index )
     {
-       return std::get< T >( fields.at( index ) );
+       return std::get< T >( sheet.get_field( row, index ) );
     }
 
     void loadIdList( xiv::exd::Exd& data, std::set< uint32_t >& outIdList );
 
+    // a lookup is a miss if its sheet had to be opened first, a hit if it was already in memory
+    void countLookup( uint32_t sheetsOpenedBefore );
+    static thread_local uint32_t s_sheetsOpenedByThread;
+
     std::shared_ptr< xiv::dat::GameData > m_data;
     std::shared_ptr< xiv::exd::ExdData > m_exd_data;
 
+    ExdProfile m_profile;
+    std::unordered_map< std::string, std::function< void() > > m_sheetOpeners;
+
+    std::string m_dataPath;
+    std::string m_gameVersion;
+    std::shared_ptr< ExdSnapshot > m_pSnapshot;
+    // set once a sheet had to be read from the game files
+    std::atomic< bool > m_snapshotStale{ false };
+    std::once_flag m_gameDataOpened;
+    std::mutex m_openedSheetsMutex;
+    std::vector< ExdSheet* > m_openedSheets;
+
     template< class T >
     std::shared_ptr< T > get( uint32_t id )
     {
+      static auto& rowsDecoded = Metrics::Registry::counter( "exd_rows_decoded_total", "",
+                                                             "Exd rows decoded into generated structs" );
+      rowsDecoded.inc();
+
+      auto sheetsOpened = s_sheetsOpenedByThread;
+      std::shared_ptr< T > info;
       try
       {
-        auto info = std::make_shared< T >( id, this );
-        return info;
+        info = std::make_shared< T >( id, this );
       }
       catch( ... )
       {
-        return nullptr;
       }
-      return nullptr;
+      countLookup( sheetsOpened );
+      return info;
     }
 
     template< class T >
     std::shared_ptr< T > get( uint32_t id, uint32_t slotId )
     {
+      static auto& rowsDecoded = Metrics::Registry::counter( "exd_rows_decoded_total", "",
+                                                             "Exd rows decoded into generated structs" );
+      rowsDecoded.inc();
+
+      auto sheetsOpened = s_sheetsOpenedByThread;
+      std::shared_ptr< T > info;
       try
       {
-        auto info = std::make_shared< T >( id, slotId, this );
-        return info;
+        info = std::make_shared< T >( id, slotId, this );
       }
       catch( ... )
       {
-        return nullptr;
       }
-      return nullptr;
+      countLookup( sheetsOpened );
+      return info;
     }
 
-     xiv::exd::Exd m_AchievementDat;
-     xiv::exd::Exd m_AchievementCategoryDat;
-     xiv::exd::Exd m_AchievementKindDat;
-     xiv::exd::Exd m_ActionDat;
-     xiv::exd::Exd m_ActionCastTimelineDat;
-     xiv::exd::Exd m_ActionCastVFXDat;
-     xiv::exd::Exd m_ActionCategoryDat;
-     xiv::exd::Exd m_ActionComboRouteDat;
-     xiv::exd::Exd m_ActionIndirectionDat;
-     xiv::exd::Exd m_ActionParamDat;
-     xiv::exd::Exd m_ActionProcStatusDat;
-     xiv::exd::Exd m_ActionTimelineDat;
-     xiv::exd::Exd m_ActionTimelineMoveDat;
-     xiv::exd::Exd m_ActionTimelineReplaceDat;
-     xiv::exd::Exd m_ActionTransientDat;
-     xiv::exd::Exd m_ActivityFeedButtonsDat;
-     xiv::exd::Exd m_ActivityFeedCaptionsDat;
-     xiv::exd::Exd m_ActivityFeedGroupCaptionsDat;
-     xiv::exd::Exd m_ActivityFeedImagesDat;
-     xiv::exd::Exd m_AddonDat;
-     xiv::exd::Exd m_AddonHudDat;
-     xiv::exd::Exd m_AdventureDat;
-     xiv::exd::Exd m_AdventureExPhaseDat;
-     xiv::exd::Exd m_AetherCurrentDat;
-     xiv::exd::Exd m_AetherCurrentCompFlgSetDat;
-     xiv::exd::Exd m_AetherialWheelDat;
-     xiv::exd::Exd m_AetheryteDat;
-     xiv::exd::Exd m_AetheryteSystemDefineDat;
-     xiv::exd::Exd m_AirshipExplorationLevelDat;
-     xiv::exd::Exd m_AirshipExplorationLogDat;
-     xiv::exd::Exd m_AirshipExplorationParamTypeDat;
-     xiv::exd::Exd m_AirshipExplorationPartDat;
-     xiv::exd::Exd m_AirshipExplorationPointDat;
-     xiv::exd::Exd m_AnimaWeapon5Dat;
-     xiv::exd::Exd m_AnimaWeapon5ParamDat;
-     xiv::exd::Exd m_AnimaWeapon5PatternGroupDat;
-     xiv::exd::Exd m_AnimaWeapon5SpiritTalkDat;
-     xiv::exd::Exd m_AnimaWeapon5SpiritTalkParamDat;
-     xiv::exd::Exd m_AnimaWeapon5TradeItemDat;
-     xiv::exd::Exd m_AnimaWeaponFUITalkDat;
-     xiv::exd::Exd m_AnimaWeaponFUITalkParamDat;
-     xiv::exd::Exd m_AnimaWeaponIconDat;
-     xiv::exd::Exd m_AnimaWeaponItemDat;
-     xiv::exd::Exd m_AozActionDat;
-     xiv::exd::Exd m_AozActionTransientDat;
-     xiv::exd::Exd m_AOZArrangementDat;
-     xiv::exd::Exd m_AOZBossDat;
-     xiv::exd::Exd m_AOZContentDat;
-     xiv::exd::Exd m_AOZContentBriefingBNpcDat;
-     xiv::exd::Exd m_AquariumFishDat;
-     xiv::exd::Exd m_AquariumWaterDat;
-     xiv::exd::Exd m_ArrayEventHandlerDat;
-     xiv::exd::Exd m_AttackTypeDat;
-     xiv::exd::Exd m_BacklightColorDat;
-     xiv::exd::Exd m_BalloonDat;
-     xiv::exd::Exd m_BaseParamDat;
-     xiv::exd::Exd m_BattleLeveDat;
-     xiv::exd::Exd m_BeastRankBonusDat;
-     xiv::exd::Exd m_BeastReputationRankDat;
-     xiv::exd::Exd m_BeastTribeDat;
-     xiv::exd::Exd m_BehaviorDat;
-     xiv::exd::Exd m_BGMDat;
-     xiv::exd::Exd m_BGMFadeDat;
-     xiv::exd::Exd m_BGMSituationDat;
-     xiv::exd::Exd m_BGMSwitchDat;
-     xiv::exd::Exd m_BGMSystemDefineDat;
-     xiv::exd::Exd m_BNpcAnnounceIconDat;
-     xiv::exd::Exd m_BNpcBaseDat;
-     xiv::exd::Exd m_BNpcCustomizeDat;
-     xiv::exd::Exd m_BNpcNameDat;
-     xiv::exd::Exd m_BNpcPartsDat;
-     xiv::exd::Exd m_BuddyDat;
-     xiv::exd::Exd m_BuddyActionDat;
-     xiv::exd::Exd m_BuddyEquipDat;
-     xiv::exd::Exd m_BuddyItemDat;
-     xiv::exd::Exd m_BuddyRankDat;
-     xiv::exd::Exd m_BuddySkillDat;
-     xiv::exd::Exd m_CabinetDat;
-     xiv::exd::Exd m_CabinetCategoryDat;
-     xiv::exd::Exd m_CalendarDat;
-     xiv::exd::Exd m_CharaMakeCustomizeDat;
-     xiv::exd::Exd m_CharaMakeTypeDat;
-     xiv::exd::Exd m_ChocoboRaceDat;
-     xiv::exd::Exd m_ChocoboRaceAbilityDat;
-     xiv::exd::Exd m_ChocoboRaceAbilityTypeDat;
-     xiv::exd::Exd m_ChocoboRaceItemDat;
-     xiv::exd::Exd m_ChocoboRaceRankDat;
-     xiv::exd::Exd m_ChocoboRaceStatusDat;
-     xiv::exd::Exd m_ChocoboRaceTerritoryDat;
-     xiv::exd::Exd m_ChocoboRaceTutorialDat;
-     xiv::exd::Exd m_ChocoboRaceWeatherDat;
-     xiv::exd::Exd m_ChocoboTaxiDat;
-     xiv::exd::Exd m_ChocoboTaxiStandDat;
-     xiv::exd::Exd m_ClassJobDat;
-     xiv::exd::Exd m_ClassJobCategoryDat;
-     xiv::exd::Exd m_CompanionDat;
-     xiv::exd::Exd m_CompanionMoveDat;
-     xiv::exd::Exd m_CompanionTransientDat;
-     xiv::exd::Exd m_CompanyActionDat;
-     xiv::exd::Exd m_CompanyCraftDraftDat;
-     xiv::exd::Exd m_CompanyCraftDraftCategoryDat;
-     xiv::exd::Exd m_CompanyCraftManufactoryStateDat;
-     xiv::exd::Exd m_CompanyCraftPartDat;
-     xiv::exd::Exd m_CompanyCraftProcessDat;
-     xiv::exd::Exd m_CompanyCraftSequenceDat;
-     xiv::exd::Exd m_CompanyCraftSupplyItemDat;
-     xiv::exd::Exd m_CompanyCraftTypeDat;
-     xiv::exd::Exd m_CompanyLeveDat;
-     xiv::exd::Exd m_CompanyLeveRuleDat;
-     xiv::exd::Exd m_CompleteJournalDat;
-     xiv::exd::Exd m_CompleteJournalCategoryDat;
-     xiv::exd::Exd m_ContentCloseCycleDat;
-     xiv::exd::Exd m_ContentExActionDat;
-     xiv::exd::Exd m_ContentFinderConditionDat;
-     xiv::exd::Exd m_ContentFinderConditionTransientDat;
-     xiv::exd::Exd m_ContentGaugeDat;
-     xiv::exd::Exd m_ContentGaugeColorDat;
-     xiv::exd::Exd m_ContentMemberTypeDat;
-     xiv::exd::Exd m_ContentNpcTalkDat;
-     xiv::exd::Exd m_ContentRouletteDat;
-     xiv::exd::Exd m_ContentRouletteOpenRuleDat;
-     xiv::exd::Exd m_ContentRouletteRoleBonusDat;
-     xiv::exd::Exd m_ContentsNoteDat;
-     xiv::exd::Exd m_ContentTalkDat;
-     xiv::exd::Exd m_ContentTalkParamDat;
-     xiv::exd::Exd m_ContentTypeDat;
-     xiv::exd::Exd m_CraftActionDat;
-     xiv::exd::Exd m_CraftLeveDat;
-     xiv::exd::Exd m_CraftTypeDat;
-     xiv::exd::Exd m_CreditDat;
-     xiv::exd::Exd m_CreditBackImageDat;
-     xiv::exd::Exd m_CreditCastDat;
-     xiv::exd::Exd m_CreditListDat;
-     xiv::exd::Exd m_CreditListTextDat;
-     xiv::exd::Exd m_CurrencyDat;
-     xiv::exd::Exd m_CustomTalkDat;
-     xiv::exd::Exd m_CustomTalkDynamicIconDat;
-     xiv::exd::Exd m_CustomTalkNestHandlersDat;
-     xiv::exd::Exd m_CutsceneDat;
-     xiv::exd::Exd m_CutScreenImageDat;
-     xiv::exd::Exd m_DailySupplyItemDat;
-     xiv::exd::Exd m_DeepDungeonDat;
-     xiv::exd::Exd m_DeepDungeonBanDat;
-     xiv::exd::Exd m_DeepDungeonDangerDat;
-     xiv::exd::Exd m_DeepDungeonEquipmentDat;
-     xiv::exd::Exd m_DeepDungeonFloorEffectUIDat;
-     xiv::exd::Exd m_DeepDungeonItemDat;
-     xiv::exd::Exd m_DeepDungeonLayerDat;
-     xiv::exd::Exd m_DeepDungeonMagicStoneDat;
-     xiv::exd::Exd m_DeepDungeonMap5XDat;
-     xiv::exd::Exd m_DeepDungeonRoomDat;
-     xiv::exd::Exd m_DeepDungeonStatusDat;
-     xiv::exd::Exd m_DefaultTalkDat;
-     xiv::exd::Exd m_DefaultTalkLipSyncTypeDat;
-     xiv::exd::Exd m_DeliveryQuestDat;
-     xiv::exd::Exd m_DescriptionPageDat;
-     xiv::exd::Exd m_DescriptionStringDat;
-     xiv::exd::Exd m_DisposalShopDat;
-     xiv::exd::Exd m_DisposalShopFilterTypeDat;
-     xiv::exd::Exd m_DisposalShopItemDat;
-     xiv::exd::Exd m_DpsChallengeDat;
-     xiv::exd::Exd m_DpsChallengeOfficerDat;
-     xiv::exd::Exd m_DpsChallengeTransientDat;
-     xiv::exd::Exd m_EmjAddonDat;
-     xiv::exd::Exd m_EmjDaniDat;
-     xiv::exd::Exd m_EmoteDat;
-     xiv::exd::Exd m_EmoteCategoryDat;
-     xiv::exd::Exd m_ENpcBaseDat;
-     xiv::exd::Exd m_ENpcDressUpDat;
-     xiv::exd::Exd m_ENpcDressUpDressDat;
-     xiv::exd::Exd m_ENpcResidentDat;
-     xiv::exd::Exd m_EObjDat;
-     xiv::exd::Exd m_EObjNameDat;
-     xiv::exd::Exd m_EquipRaceCategoryDat;
-     xiv::exd::Exd m_EquipSlotCategoryDat;
-     xiv::exd::Exd m_EurekaAetherItemDat;
-     xiv::exd::Exd m_EurekaAethernetDat;
-     xiv::exd::Exd m_EurekaGrowDataDat;
-     xiv::exd::Exd m_EurekaLogosMixerProbabilityDat;
-     xiv::exd::Exd m_EurekaMagiaActionDat;
-     xiv::exd::Exd m_EurekaMagiciteItemDat;
-     xiv::exd::Exd m_EurekaMagiciteItemTypeDat;
-     xiv::exd::Exd m_EurekaSphereElementAdjustDat;
-     xiv::exd::Exd m_EventActionDat;
-     xiv::exd::Exd m_EventIconPriorityDat;
-     xiv::exd::Exd m_EventIconTypeDat;
-     xiv::exd::Exd m_EventItemDat;
-     xiv::exd::Exd m_EventItemCastTimelineDat;
-     xiv::exd::Exd m_EventItemHelpDat;
-     xiv::exd::Exd m_EventItemTimelineDat;
-     xiv::exd::Exd m_ExportedSGDat;
-     xiv::exd::Exd m_ExVersionDat;
-     xiv::exd::Exd m_FateDat;
-     xiv::exd::Exd m_FCActivityDat;
-     xiv::exd::Exd m_FCActivityCategoryDat;
-     xiv::exd::Exd m_FCAuthorityDat;
-     xiv::exd::Exd m_FCAuthorityCategoryDat;
-     xiv::exd::Exd m_FCChestNameDat;
-     xiv::exd::Exd m_FccShopDat;
-     xiv::exd::Exd m_FCHierarchyDat;
-     xiv::exd::Exd m_FCProfileDat;
-     xiv::exd::Exd m_FCReputationDat;
-     xiv::exd::Exd m_FCRightsDat;
-     xiv::exd::Exd m_FestivalDat;
-     xiv::exd::Exd m_FieldMarkerDat;
-     xiv::exd::Exd m_FishingRecordTypeDat;
-     xiv::exd::Exd m_FishingRecordTypeTransientDat;
-     xiv::exd::Exd m_FishingSpotDat;
-     xiv::exd::Exd m_FishParameterDat;
-     xiv::exd::Exd m_Frontline03Dat;
-     xiv::exd::Exd m_Frontline04Dat;
-     xiv::exd::Exd m_GardeningSeedDat;
-     xiv::exd::Exd m_GatheringConditionDat;
-     xiv::exd::Exd m_GatheringExpDat;
-     xiv::exd::Exd m_GatheringItemDat;
-     xiv::exd::Exd m_GatheringItemLevelConvertTableDat;
-     xiv::exd::Exd m_GatheringItemPointDat;
-     xiv::exd::Exd m_GatheringLeveDat;
-     xiv::exd::Exd m_GatheringLeveRouteDat;
-     xiv::exd::Exd m_GatheringNotebookListDat;
-     xiv::exd::Exd m_GatheringPointDat;
-     xiv::exd::Exd m_GatheringPointBaseDat;
-     xiv::exd::Exd m_GatheringPointBonusDat;
-     xiv::exd::Exd m_GatheringPointBonusTypeDat;
-     xiv::exd::Exd m_GatheringPointNameDat;
-     xiv::exd::Exd m_GatheringSubCategoryDat;
-     xiv::exd::Exd m_GatheringTypeDat;
-     xiv::exd::Exd m_GcArmyCaptureTacticsDat;
-     xiv::exd::Exd m_GcArmyExpeditionDat;
-     xiv::exd::Exd m_GcArmyExpeditionMemberBonusDat;
-     xiv::exd::Exd m_GcArmyExpeditionTypeDat;
-     xiv::exd::Exd m_GcArmyMemberGrowDat;
-     xiv::exd::Exd m_GcArmyTrainingDat;
-     xiv::exd::Exd m_GCRankGridaniaFemaleTextDat;
-     xiv::exd::Exd m_GCRankGridaniaMaleTextDat;
-     xiv::exd::Exd m_GCRankLimsaFemaleTextDat;
-     xiv::exd::Exd m_GCRankLimsaMaleTextDat;
-     xiv::exd::Exd m_GCRankUldahFemaleTextDat;
-     xiv::exd::Exd m_GCRankUldahMaleTextDat;
-     xiv::exd::Exd m_GCScripShopCategoryDat;
-     xiv::exd::Exd m_GCScripShopItemDat;
-     xiv::exd::Exd m_GCShopDat;
-     xiv::exd::Exd m_GCShopItemCategoryDat;
-     xiv::exd::Exd m_GCSupplyDutyDat;
-     xiv::exd::Exd m_GCSupplyDutyRewardDat;
-     xiv::exd::Exd m_GeneralActionDat;
-     xiv::exd::Exd m_GFATEDat;
-     xiv::exd::Exd m_GFateClimbing2Dat;
-     xiv::exd::Exd m_GFateClimbing2ContentDat;
-     xiv::exd::Exd m_GFateClimbing2TotemTypeDat;
-     xiv::exd::Exd m_GFateRideShootingDat;
-     xiv::exd::Exd m_GilShopDat;
-     xiv::exd::Exd m_GilShopItemDat;
-     xiv::exd::Exd m_GoldSaucerArcadeMachineDat;
-     xiv::exd::Exd m_GoldSaucerTextDataDat;
-     xiv::exd::Exd m_GrandCompanyDat;
-     xiv::exd::Exd m_GrandCompanyRankDat;
-     xiv::exd::Exd m_GuardianDeityDat;
-     xiv::exd::Exd m_GuildleveAssignmentDat;
-     xiv::exd::Exd m_GuildleveAssignmentCategoryDat;
-     xiv::exd::Exd m_GuildOrderGuideDat;
-     xiv::exd::Exd m_GuildOrderOfficerDat;
-     xiv::exd::Exd m_HairMakeTypeDat;
-     xiv::exd::Exd m_HouseRetainerPoseDat;
-     xiv::exd::Exd m_HousingAethernetDat;
-     xiv::exd::Exd m_HousingAppealDat;
-     xiv::exd::Exd m_HousingEmploymentNpcListDat;
-     xiv::exd::Exd m_HousingEmploymentNpcRaceDat;
-     xiv::exd::Exd m_HousingExteriorDat;
-     xiv::exd::Exd m_HousingFurnitureDat;
-     xiv::exd::Exd m_HousingLandSetDat;
-     xiv::exd::Exd m_HousingMapMarkerInfoDat;
-     xiv::exd::Exd m_HousingMerchantPoseDat;
-     xiv::exd::Exd m_HousingPlacementDat;
-     xiv::exd::Exd m_HousingPresetDat;
-     xiv::exd::Exd m_HousingUnitedExteriorDat;
-     xiv::exd::Exd m_HousingYardObjectDat;
-     xiv::exd::Exd m_HowToDat;
-     xiv::exd::Exd m_HowToCategoryDat;
-     xiv::exd::Exd m_HowToPageDat;
-     xiv::exd::Exd m_InstanceContentDat;
-     xiv::exd::Exd m_InstanceContentBuffDat;
-     xiv::exd::Exd m_InstanceContentCSBonusDat;
-     xiv::exd::Exd m_InstanceContentGuideDat;
-     xiv::exd::Exd m_InstanceContentTextDataDat;
-     xiv::exd::Exd m_ItemDat;
-     xiv::exd::Exd m_ItemActionDat;
-     xiv::exd::Exd m_ItemFoodDat;
-     xiv::exd::Exd m_ItemLevelDat;
-     xiv::exd::Exd m_ItemSearchCategoryDat;
-     xiv::exd::Exd m_ItemSeriesDat;
-     xiv::exd::Exd m_ItemSpecialBonusDat;
-     xiv::exd::Exd m_ItemUICategoryDat;
-     xiv::exd::Exd m_JournalCategoryDat;
-     xiv::exd::Exd m_JournalGenreDat;
-     xiv::exd::Exd m_JournalSectionDat;
-     xiv::exd::Exd m_LeveDat;
-     xiv::exd::Exd m_LeveAssignmentTypeDat;
-     xiv::exd::Exd m_LeveClientDat;
-     xiv::exd::Exd m_LevelDat;
-     xiv::exd::Exd m_LeveRewardItemDat;
-     xiv::exd::Exd m_LeveRewardItemGroupDat;
-     xiv::exd::Exd m_LeveVfxDat;
-     xiv::exd::Exd m_LogFilterDat;
-     xiv::exd::Exd m_LogKindDat;
-     xiv::exd::Exd m_LogKindCategoryTextDat;
-     xiv::exd::Exd m_LogMessageDat;
-     xiv::exd::Exd m_LotteryExchangeShopDat;
-     xiv::exd::Exd m_MacroIconDat;
-     xiv::exd::Exd m_MacroIconRedirectOldDat;
-     xiv::exd::Exd m_MainCommandDat;
-     xiv::exd::Exd m_MainCommandCategoryDat;
-     xiv::exd::Exd m_ManeuversArmorDat;
-     xiv::exd::Exd m_MapDat;
-     xiv::exd::Exd m_MapMarkerDat;
-     xiv::exd::Exd m_MapMarkerRegionDat;
-     xiv::exd::Exd m_MapSymbolDat;
-     xiv::exd::Exd m_MarkerDat;
-     xiv::exd::Exd m_MasterpieceSupplyDutyDat;
-     xiv::exd::Exd m_MasterpieceSupplyMultiplierDat;
-     xiv::exd::Exd m_MateriaDat;
-     xiv::exd::Exd m_MiniGameRADat;
-     xiv::exd::Exd m_MinionRaceDat;
-     xiv::exd::Exd m_MinionRulesDat;
-     xiv::exd::Exd m_MinionSkillTypeDat;
-     xiv::exd::Exd m_MobHuntOrderTypeDat;
-     xiv::exd::Exd m_MobHuntTargetDat;
-     xiv::exd::Exd m_ModelCharaDat;
-     xiv::exd::Exd m_ModelSkeletonDat;
-     xiv::exd::Exd m_ModelStateDat;
-     xiv::exd::Exd m_MonsterNoteDat;
-     xiv::exd::Exd m_MonsterNoteTargetDat;
-     xiv::exd::Exd m_MountDat;
-     xiv::exd::Exd m_MountActionDat;
-     xiv::exd::Exd m_MountCustomizeDat;
-     xiv::exd::Exd m_MountFlyingConditionDat;
-     xiv::exd::Exd m_MountSpeedDat;
-     xiv::exd::Exd m_MountTransientDat;
-     xiv::exd::Exd m_MoveTimelineDat;
-     xiv::exd::Exd m_MoveVfxDat;
-     xiv::exd::Exd m_NotebookDivisionDat;
-     xiv::exd::Exd m_NotebookDivisionCategoryDat;
-     xiv::exd::Exd m_NpcEquipDat;
-     xiv::exd::Exd m_NpcYellDat;
-     xiv::exd::Exd m_OmenDat;
-     xiv::exd::Exd m_OnlineStatusDat;
-     xiv::exd::Exd m_OpeningDat;
-     xiv::exd::Exd m_OrchestrionDat;
-     xiv::exd::Exd m_OrchestrionCategoryDat;
-     xiv::exd::Exd m_OrchestrionPathDat;
-     xiv::exd::Exd m_OrchestrionUiparamDat;
-     xiv::exd::Exd m_ParamGrowDat;
-     xiv::exd::Exd m_PartyContentDat;
-     xiv::exd::Exd m_PartyContentCutsceneDat;
-     xiv::exd::Exd m_PartyContentTextDataDat;
-     xiv::exd::Exd m_PerformDat;
-     xiv::exd::Exd m_PerformTransientDat;
-     xiv::exd::Exd m_PetDat;
-     xiv::exd::Exd m_PetActionDat;
-     xiv::exd::Exd m_PictureDat;
-     xiv::exd::Exd m_PlaceNameDat;
-     xiv::exd::Exd m_PlantPotFlowerSeedDat;
-     xiv::exd::Exd m_PreHandlerDat;
-     xiv::exd::Exd m_PublicContentDat;
-     xiv::exd::Exd m_PublicContentCutsceneDat;
-     xiv::exd::Exd m_PublicContentTextDataDat;
-     xiv::exd::Exd m_PvPActionDat;
-     xiv::exd::Exd m_PvPActionSortDat;
-     xiv::exd::Exd m_PvPRankDat;
-     xiv::exd::Exd m_PvPSelectTraitDat;
-     xiv::exd::Exd m_PvPTraitDat;
-     xiv::exd::Exd m_QuestDat;
-     xiv::exd::Exd m_QuestBattleDat;
-     xiv::exd::Exd m_QuestClassJobRewardDat;
-     xiv::exd::Exd m_QuestClassJobSupplyDat;
-     xiv::exd::Exd m_QuestRepeatFlagDat;
-     xiv::exd::Exd m_QuestRewardOtherDat;
-     xiv::exd::Exd m_QuickChatDat;
-     xiv::exd::Exd m_QuickChatTransientDat;
-     xiv::exd::Exd m_RaceDat;
-     xiv::exd::Exd m_RacingChocoboItemDat;
-     xiv::exd::Exd m_RacingChocoboNameDat;
-     xiv::exd::Exd m_RacingChocoboNameCategoryDat;
-     xiv::exd::Exd m_RacingChocoboNameInfoDat;
-     xiv::exd::Exd m_RacingChocoboParamDat;
-     xiv::exd::Exd m_RecastNavimeshDat;
-     xiv::exd::Exd m_RecipeDat;
-     xiv::exd::Exd m_RecipeElementDat;
-     xiv::exd::Exd m_RecipeLevelTableDat;
-     xiv::exd::Exd m_RecipeNotebookListDat;
-     xiv::exd::Exd m_RecommendContentsDat;
-     xiv::exd::Exd m_RelicDat;
-     xiv::exd::Exd m_Relic3Dat;
-     xiv::exd::Exd m_RelicItemDat;
-     xiv::exd::Exd m_RelicNoteDat;
-     xiv::exd::Exd m_RelicNoteCategoryDat;
-     xiv::exd::Exd m_ResidentDat;
-     xiv::exd::Exd m_RetainerTaskDat;
-     xiv::exd::Exd m_RetainerTaskLvRangeDat;
-     xiv::exd::Exd m_RetainerTaskNormalDat;
-     xiv::exd::Exd m_RetainerTaskParameterDat;
-     xiv::exd::Exd m_RetainerTaskRandomDat;
-     xiv::exd::Exd m_RPParameterDat;
-     xiv::exd::Exd m_SalvageDat;
-     xiv::exd::Exd m_SatisfactionNpcDat;
-     xiv::exd::Exd m_SatisfactionSupplyDat;
-     xiv::exd::Exd m_SatisfactionSupplyRewardDat;
-     xiv::exd::Exd m_ScenarioTreeDat;
-     xiv::exd::Exd m_ScenarioTreeTipsDat;
-     xiv::exd::Exd m_ScenarioTreeTipsClassQuestDat;
-     xiv::exd::Exd m_ScenarioTreeTipsQuestDat;
-     xiv::exd::Exd m_ScenarioTypeDat;
-     xiv::exd::Exd m_ScreenImageDat;
-     xiv::exd::Exd m_SecretRecipeBookDat;
-     xiv::exd::Exd m_SkyIsland2MissionDat;
-     xiv::exd::Exd m_SkyIsland2MissionDetailDat;
-     xiv::exd::Exd m_SkyIsland2MissionTypeDat;
-     xiv::exd::Exd m_SkyIsland2RangeTypeDat;
-     xiv::exd::Exd m_SpearfishingItemDat;
-     xiv::exd::Exd m_SpearfishingNotebookDat;
-     xiv::exd::Exd m_SpearfishingRecordPageDat;
-     xiv::exd::Exd m_SpecialShopDat;
-     xiv::exd::Exd m_SpecialShopItemCategoryDat;
-     xiv::exd::Exd m_StainDat;
-     xiv::exd::Exd m_StainTransientDat;
-     xiv::exd::Exd m_StatusDat;
-     xiv::exd::Exd m_StatusHitEffectDat;
-     xiv::exd::Exd m_StatusLoopVFXDat;
-     xiv::exd::Exd m_StoryDat;
-     xiv::exd::Exd m_SubmarineExplorationDat;
-     xiv::exd::Exd m_SubmarinePartDat;
-     xiv::exd::Exd m_SubmarineRankDat;
-     xiv::exd::Exd m_SwitchTalkDat;
-     xiv::exd::Exd m_TerritoryTypeDat;
-     xiv::exd::Exd m_TextCommandDat;
-     xiv::exd::Exd m_TitleDat;
-     xiv::exd::Exd m_TomestonesDat;
-     xiv::exd::Exd m_TomestonesItemDat;
-     xiv::exd::Exd m_TopicSelectDat;
-     xiv::exd::Exd m_TownDat;
-     xiv::exd::Exd m_TraitDat;
-     xiv::exd::Exd m_TraitRecastDat;
-     xiv::exd::Exd m_TraitTransientDat;
-     xiv::exd::Exd m_TransformationDat;
-     xiv::exd::Exd m_TreasureDat;
-     xiv::exd::Exd m_TreasureHuntRankDat;
-     xiv::exd::Exd m_TreasureSpotDat;
-     xiv::exd::Exd m_TribeDat;
-     xiv::exd::Exd m_TripleTriadDat;
-     xiv::exd::Exd m_TripleTriadCardDat;
-     xiv::exd::Exd m_TripleTriadCardRarityDat;
-     xiv::exd::Exd m_TripleTriadCardResidentDat;
-     xiv::exd::Exd m_TripleTriadCardTypeDat;
-     xiv::exd::Exd m_TripleTriadCompetitionDat;
-     xiv::exd::Exd m_TripleTriadRuleDat;
-     xiv::exd::Exd m_TutorialDat;
-     xiv::exd::Exd m_TutorialDPSDat;
-     xiv::exd::Exd m_TutorialHealerDat;
-     xiv::exd::Exd m_TutorialTankDat;
-     xiv::exd::Exd m_UIColorDat;
-     xiv::exd::Exd m_VaseFlowerDat;
-     xiv::exd::Exd m_VFXDat;
-     xiv::exd::Exd m_WarpDat;
-     xiv::exd::Exd m_WarpConditionDat;
-     xiv::exd::Exd m_WarpLogicDat;
-     xiv::exd::Exd m_WeatherDat;
-     xiv::exd::Exd m_WeatherGroupDat;
-     xiv::exd::Exd m_WeatherRateDat;
-     xiv::exd::Exd m_WeatherReportReplaceDat;
-     xiv::exd::Exd m_WeddingBGMDat;
-     xiv::exd::Exd m_WeeklyBingoOrderDataDat;
-     xiv::exd::Exd m_WeeklyBingoRewardDataDat;
-     xiv::exd::Exd m_WeeklyBingoTextDat;
-     xiv::exd::Exd m_WeeklyLotBonusDat;
-     xiv::exd::Exd m_WorldDat;
-     xiv::exd::Exd m_WorldDCGroupTypeDat;
-     xiv::exd::Exd m_YKWDat;
-     xiv::exd::Exd m_ZoneSharedGroupDat;
+     ExdSheet m_AchievementDat;
+     xiv::exd::Exd& getAchievementDat()
+     {
+       return getSheet( m_AchievementDat, "Achievement", xiv::exd::Language::en );
+     }
+     ExdSheet m_AchievementCategoryDat;
+     xiv::exd::Exd& getAchievementCategoryDat()
+     {
+       return getSheet( m_AchievementCategoryDat, "AchievementCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_AchievementKindDat;
+     xiv::exd::Exd& getAchievementKindDat()
+     {
+       return getSheet( m_AchievementKindDat, "AchievementKind", xiv::exd::Language::en );
+     }
+     ExdSheet m_ActionDat;
+     xiv::exd::Exd& getActionDat()
+     {
+       return getSheet( m_ActionDat, "Action", xiv::exd::Language::en );
+     }
+     ExdSheet m_ActionCastTimelineDat;
+     xiv::exd::Exd& getActionCastTimelineDat()
+     {
+       return getSheet( m_ActionCastTimelineDat, "ActionCastTimeline", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionCastVFXDat;
+     xiv::exd::Exd& getActionCastVFXDat()
+     {
+       return getSheet( m_ActionCastVFXDat, "ActionCastVFX", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionCategoryDat;
+     xiv::exd::Exd& getActionCategoryDat()
+     {
+       return getSheet( m_ActionCategoryDat, "ActionCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_ActionComboRouteDat;
+     xiv::exd::Exd& getActionComboRouteDat()
+     {
+       return getSheet( m_ActionComboRouteDat, "ActionComboRoute", xiv::exd::Language::en );
+     }
+     ExdSheet m_ActionIndirectionDat;
+     xiv::exd::Exd& getActionIndirectionDat()
+     {
+       return getSheet( m_ActionIndirectionDat, "ActionIndirection", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionParamDat;
+     xiv::exd::Exd& getActionParamDat()
+     {
+       return getSheet( m_ActionParamDat, "ActionParam", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionProcStatusDat;
+     xiv::exd::Exd& getActionProcStatusDat()
+     {
+       return getSheet( m_ActionProcStatusDat, "ActionProcStatus", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionTimelineDat;
+     xiv::exd::Exd& getActionTimelineDat()
+     {
+       return getSheet( m_ActionTimelineDat, "ActionTimeline", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionTimelineMoveDat;
+     xiv::exd::Exd& getActionTimelineMoveDat()
+     {
+       return getSheet( m_ActionTimelineMoveDat, "ActionTimelineMove", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionTimelineReplaceDat;
+     xiv::exd::Exd& getActionTimelineReplaceDat()
+     {
+       return getSheet( m_ActionTimelineReplaceDat, "ActionTimelineReplace", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActionTransientDat;
+     xiv::exd::Exd& getActionTransientDat()
+     {
+       return getSheet( m_ActionTransientDat, "ActionTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_ActivityFeedButtonsDat;
+     xiv::exd::Exd& getActivityFeedButtonsDat()
+     {
+       return getSheet( m_ActivityFeedButtonsDat, "ActivityFeedButtons", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActivityFeedCaptionsDat;
+     xiv::exd::Exd& getActivityFeedCaptionsDat()
+     {
+       return getSheet( m_ActivityFeedCaptionsDat, "ActivityFeedCaptions", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActivityFeedGroupCaptionsDat;
+     xiv::exd::Exd& getActivityFeedGroupCaptionsDat()
+     {
+       return getSheet( m_ActivityFeedGroupCaptionsDat, "ActivityFeedGroupCaptions", xiv::exd::Language::none );
+     }
+     ExdSheet m_ActivityFeedImagesDat;
+     xiv::exd::Exd& getActivityFeedImagesDat()
+     {
+       return getSheet( m_ActivityFeedImagesDat, "ActivityFeedImages", xiv::exd::Language::none );
+     }
+     ExdSheet m_AddonDat;
+     xiv::exd::Exd& getAddonDat()
+     {
+       return getSheet( m_AddonDat, "Addon", xiv::exd::Language::en );
+     }
+     ExdSheet m_AddonHudDat;
+     xiv::exd::Exd& getAddonHudDat()
+     {
+       return getSheet( m_AddonHudDat, "AddonHud", xiv::exd::Language::en );
+     }
+     ExdSheet m_AdventureDat;
+     xiv::exd::Exd& getAdventureDat()
+     {
+       return getSheet( m_AdventureDat, "Adventure", xiv::exd::Language::en );
+     }
+     ExdSheet m_AdventureExPhaseDat;
+     xiv::exd::Exd& getAdventureExPhaseDat()
+     {
+       return getSheet( m_AdventureExPhaseDat, "AdventureExPhase", xiv::exd::Language::none );
+     }
+     ExdSheet m_AetherCurrentDat;
+     xiv::exd::Exd& getAetherCurrentDat()
+     {
+       return getSheet( m_AetherCurrentDat, "AetherCurrent", xiv::exd::Language::none );
+     }
+     ExdSheet m_AetherCurrentCompFlgSetDat;
+     xiv::exd::Exd& getAetherCurrentCompFlgSetDat()
+     {
+       return getSheet( m_AetherCurrentCompFlgSetDat, "AetherCurrentCompFlgSet", xiv::exd::Language::none );
+     }
+     ExdSheet m_AetherialWheelDat;
+     xiv::exd::Exd& getAetherialWheelDat()
+     {
+       return getSheet( m_AetherialWheelDat, "AetherialWheel", xiv::exd::Language::none );
+     }
+     ExdSheet m_AetheryteDat;
+     xiv::exd::Exd& getAetheryteDat()
+     {
+       return getSheet( m_AetheryteDat, "Aetheryte", xiv::exd::Language::en );
+     }
+     ExdSheet m_AetheryteSystemDefineDat;
+     xiv::exd::Exd& getAetheryteSystemDefineDat()
+     {
+       return getSheet( m_AetheryteSystemDefineDat, "AetheryteSystemDefine", xiv::exd::Language::none );
+     }
+     ExdSheet m_AirshipExplorationLevelDat;
+     xiv::exd::Exd& getAirshipExplorationLevelDat()
+     {
+       return getSheet( m_AirshipExplorationLevelDat, "AirshipExplorationLevel", xiv::exd::Language::none );
+     }
+     ExdSheet m_AirshipExplorationLogDat;
+     xiv::exd::Exd& getAirshipExplorationLogDat()
+     {
+       return getSheet( m_AirshipExplorationLogDat, "AirshipExplorationLog", xiv::exd::Language::en );
+     }
+     ExdSheet m_AirshipExplorationParamTypeDat;
+     xiv::exd::Exd& getAirshipExplorationParamTypeDat()
+     {
+       return getSheet( m_AirshipExplorationParamTypeDat, "AirshipExplorationParamType", xiv::exd::Language::en );
+     }
+     ExdSheet m_AirshipExplorationPartDat;
+     xiv::exd::Exd& getAirshipExplorationPartDat()
+     {
+       return getSheet( m_AirshipExplorationPartDat, "AirshipExplorationPart", xiv::exd::Language::none );
+     }
+     ExdSheet m_AirshipExplorationPointDat;
+     xiv::exd::Exd& getAirshipExplorationPointDat()
+     {
+       return getSheet( m_AirshipExplorationPointDat, "AirshipExplorationPoint", xiv::exd::Language::en );
+     }
+     ExdSheet m_AnimaWeapon5Dat;
+     xiv::exd::Exd& getAnimaWeapon5Dat()
+     {
+       return getSheet( m_AnimaWeapon5Dat, "AnimaWeapon5", xiv::exd::Language::none );
+     }
+     ExdSheet m_AnimaWeapon5ParamDat;
+     xiv::exd::Exd& getAnimaWeapon5ParamDat()
+     {
+       return getSheet( m_AnimaWeapon5ParamDat, "AnimaWeapon5Param", xiv::exd::Language::en );
+     }
+     ExdSheet m_AnimaWeapon5PatternGroupDat;
+     xiv::exd::Exd& getAnimaWeapon5PatternGroupDat()
+     {
+       return getSheet( m_AnimaWeapon5PatternGroupDat, "AnimaWeapon5PatternGroup", xiv::exd::Language::en );
+     }
+     ExdSheet m_AnimaWeapon5SpiritTalkDat;
+     xiv::exd::Exd& getAnimaWeapon5SpiritTalkDat()
+     {
+       return getSheet( m_AnimaWeapon5SpiritTalkDat, "AnimaWeapon5SpiritTalk", xiv::exd::Language::none );
+     }
+     ExdSheet m_AnimaWeapon5SpiritTalkParamDat;
+     xiv::exd::Exd& getAnimaWeapon5SpiritTalkParamDat()
+     {
+       return getSheet( m_AnimaWeapon5SpiritTalkParamDat, "AnimaWeapon5SpiritTalkParam", xiv::exd::Language::en );
+     }
+     ExdSheet m_AnimaWeapon5TradeItemDat;
+     xiv::exd::Exd& getAnimaWeapon5TradeItemDat()
+     {
+       return getSheet( m_AnimaWeapon5TradeItemDat, "AnimaWeapon5TradeItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_AnimaWeaponFUITalkDat;
+     xiv::exd::Exd& getAnimaWeaponFUITalkDat()
+     {
+       return getSheet( m_AnimaWeaponFUITalkDat, "AnimaWeaponFUITalk", xiv::exd::Language::none );
+     }
+     ExdSheet m_AnimaWeaponFUITalkParamDat;
+     xiv::exd::Exd& getAnimaWeaponFUITalkParamDat()
+     {
+       return getSheet( m_AnimaWeaponFUITalkParamDat, "AnimaWeaponFUITalkParam", xiv::exd::Language::en );
+     }
+     ExdSheet m_AnimaWeaponIconDat;
+     xiv::exd::Exd& getAnimaWeaponIconDat()
+     {
+       return getSheet( m_AnimaWeaponIconDat, "AnimaWeaponIcon", xiv::exd::Language::none );
+     }
+     ExdSheet m_AnimaWeaponItemDat;
+     xiv::exd::Exd& getAnimaWeaponItemDat()
+     {
+       return getSheet( m_AnimaWeaponItemDat, "AnimaWeaponItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_AozActionDat;
+     xiv::exd::Exd& getAozActionDat()
+     {
+       return getSheet( m_AozActionDat, "AozAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_AozActionTransientDat;
+     xiv::exd::Exd& getAozActionTransientDat()
+     {
+       return getSheet( m_AozActionTransientDat, "AozActionTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_AOZArrangementDat;
+     xiv::exd::Exd& getAOZArrangementDat()
+     {
+       return getSheet( m_AOZArrangementDat, "AOZArrangement", xiv::exd::Language::none );
+     }
+     ExdSheet m_AOZBossDat;
+     xiv::exd::Exd& getAOZBossDat()
+     {
+       return getSheet( m_AOZBossDat, "AOZBoss", xiv::exd::Language::none );
+     }
+     ExdSheet m_AOZContentDat;
+     xiv::exd::Exd& getAOZContentDat()
+     {
+       return getSheet( m_AOZContentDat, "AOZContent", xiv::exd::Language::none );
+     }
+     ExdSheet m_AOZContentBriefingBNpcDat;
+     xiv::exd::Exd& getAOZContentBriefingBNpcDat()
+     {
+       return getSheet( m_AOZContentBriefingBNpcDat, "AOZContentBriefingBNpc", xiv::exd::Language::none );
+     }
+     ExdSheet m_AquariumFishDat;
+     xiv::exd::Exd& getAquariumFishDat()
+     {
+       return getSheet( m_AquariumFishDat, "AquariumFish", xiv::exd::Language::none );
+     }
+     ExdSheet m_AquariumWaterDat;
+     xiv::exd::Exd& getAquariumWaterDat()
+     {
+       return getSheet( m_AquariumWaterDat, "AquariumWater", xiv::exd::Language::en );
+     }
+     ExdSheet m_ArrayEventHandlerDat;
+     xiv::exd::Exd& getArrayEventHandlerDat()
+     {
+       return getSheet( m_ArrayEventHandlerDat, "ArrayEventHandler", xiv::exd::Language::none );
+     }
+     ExdSheet m_AttackTypeDat;
+     xiv::exd::Exd& getAttackTypeDat()
+     {
+       return getSheet( m_AttackTypeDat, "AttackType", xiv::exd::Language::en );
+     }
+     ExdSheet m_BacklightColorDat;
+     xiv::exd::Exd& getBacklightColorDat()
+     {
+       return getSheet( m_BacklightColorDat, "BacklightColor", xiv::exd::Language::none );
+     }
+     ExdSheet m_BalloonDat;
+     xiv::exd::Exd& getBalloonDat()
+     {
+       return getSheet( m_BalloonDat, "Balloon", xiv::exd::Language::en );
+     }
+     ExdSheet m_BaseParamDat;
+     xiv::exd::Exd& getBaseParamDat()
+     {
+       return getSheet( m_BaseParamDat, "BaseParam", xiv::exd::Language::en );
+     }
+     ExdSheet m_BattleLeveDat;
+     xiv::exd::Exd& getBattleLeveDat()
+     {
+       return getSheet( m_BattleLeveDat, "BattleLeve", xiv::exd::Language::none );
+     }
+     ExdSheet m_BeastRankBonusDat;
+     xiv::exd::Exd& getBeastRankBonusDat()
+     {
+       return getSheet( m_BeastRankBonusDat, "BeastRankBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_BeastReputationRankDat;
+     xiv::exd::Exd& getBeastReputationRankDat()
+     {
+       return getSheet( m_BeastReputationRankDat, "BeastReputationRank", xiv::exd::Language::en );
+     }
+     ExdSheet m_BeastTribeDat;
+     xiv::exd::Exd& getBeastTribeDat()
+     {
+       return getSheet( m_BeastTribeDat, "BeastTribe", xiv::exd::Language::en );
+     }
+     ExdSheet m_BehaviorDat;
+     xiv::exd::Exd& getBehaviorDat()
+     {
+       return getSheet( m_BehaviorDat, "Behavior", xiv::exd::Language::none );
+     }
+     ExdSheet m_BGMDat;
+     xiv::exd::Exd& getBGMDat()
+     {
+       return getSheet( m_BGMDat, "BGM", xiv::exd::Language::none );
+     }
+     ExdSheet m_BGMFadeDat;
+     xiv::exd::Exd& getBGMFadeDat()
+     {
+       return getSheet( m_BGMFadeDat, "BGMFade", xiv::exd::Language::none );
+     }
+     ExdSheet m_BGMSituationDat;
+     xiv::exd::Exd& getBGMSituationDat()
+     {
+       return getSheet( m_BGMSituationDat, "BGMSituation", xiv::exd::Language::none );
+     }
+     ExdSheet m_BGMSwitchDat;
+     xiv::exd::Exd& getBGMSwitchDat()
+     {
+       return getSheet( m_BGMSwitchDat, "BGMSwitch", xiv::exd::Language::none );
+     }
+     ExdSheet m_BGMSystemDefineDat;
+     xiv::exd::Exd& getBGMSystemDefineDat()
+     {
+       return getSheet( m_BGMSystemDefineDat, "BGMSystemDefine", xiv::exd::Language::none );
+     }
+     ExdSheet m_BNpcAnnounceIconDat;
+     xiv::exd::Exd& getBNpcAnnounceIconDat()
+     {
+       return getSheet( m_BNpcAnnounceIconDat, "BNpcAnnounceIcon", xiv::exd::Language::none );
+     }
+     ExdSheet m_BNpcBaseDat;
+     xiv::exd::Exd& getBNpcBaseDat()
+     {
+       return getSheet( m_BNpcBaseDat, "BNpcBase", xiv::exd::Language::none );
+     }
+     ExdSheet m_BNpcCustomizeDat;
+     xiv::exd::Exd& getBNpcCustomizeDat()
+     {
+       return getSheet( m_BNpcCustomizeDat, "BNpcCustomize", xiv::exd::Language::none );
+     }
+     ExdSheet m_BNpcNameDat;
+     xiv::exd::Exd& getBNpcNameDat()
+     {
+       return getSheet( m_BNpcNameDat, "BNpcName", xiv::exd::Language::en );
+     }
+     ExdSheet m_BNpcPartsDat;
+     xiv::exd::Exd& getBNpcPartsDat()
+     {
+       return getSheet( m_BNpcPartsDat, "BNpcParts", xiv::exd::Language::none );
+     }
+     ExdSheet m_BuddyDat;
+     xiv::exd::Exd& getBuddyDat()
+     {
+       return getSheet( m_BuddyDat, "Buddy", xiv::exd::Language::none );
+     }
+     ExdSheet m_BuddyActionDat;
+     xiv::exd::Exd& getBuddyActionDat()
+     {
+       return getSheet( m_BuddyActionDat, "BuddyAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_BuddyEquipDat;
+     xiv::exd::Exd& getBuddyEquipDat()
+     {
+       return getSheet( m_BuddyEquipDat, "BuddyEquip", xiv::exd::Language::en );
+     }
+     ExdSheet m_BuddyItemDat;
+     xiv::exd::Exd& getBuddyItemDat()
+     {
+       return getSheet( m_BuddyItemDat, "BuddyItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_BuddyRankDat;
+     xiv::exd::Exd& getBuddyRankDat()
+     {
+       return getSheet( m_BuddyRankDat, "BuddyRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_BuddySkillDat;
+     xiv::exd::Exd& getBuddySkillDat()
+     {
+       return getSheet( m_BuddySkillDat, "BuddySkill", xiv::exd::Language::none );
+     }
+     ExdSheet m_CabinetDat;
+     xiv::exd::Exd& getCabinetDat()
+     {
+       return getSheet( m_CabinetDat, "Cabinet", xiv::exd::Language::none );
+     }
+     ExdSheet m_CabinetCategoryDat;
+     xiv::exd::Exd& getCabinetCategoryDat()
+     {
+       return getSheet( m_CabinetCategoryDat, "CabinetCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_CalendarDat;
+     xiv::exd::Exd& getCalendarDat()
+     {
+       return getSheet( m_CalendarDat, "Calendar", xiv::exd::Language::none );
+     }
+     ExdSheet m_CharaMakeCustomizeDat;
+     xiv::exd::Exd& getCharaMakeCustomizeDat()
+     {
+       return getSheet( m_CharaMakeCustomizeDat, "CharaMakeCustomize", xiv::exd::Language::none );
+     }
+     ExdSheet m_CharaMakeTypeDat;
+     xiv::exd::Exd& getCharaMakeTypeDat()
+     {
+       return getSheet( m_CharaMakeTypeDat, "CharaMakeType", xiv::exd::Language::en );
+     }
+     ExdSheet m_ChocoboRaceDat;
+     xiv::exd::Exd& getChocoboRaceDat()
+     {
+       return getSheet( m_ChocoboRaceDat, "ChocoboRace", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceAbilityDat;
+     xiv::exd::Exd& getChocoboRaceAbilityDat()
+     {
+       return getSheet( m_ChocoboRaceAbilityDat, "ChocoboRaceAbility", xiv::exd::Language::en );
+     }
+     ExdSheet m_ChocoboRaceAbilityTypeDat;
+     xiv::exd::Exd& getChocoboRaceAbilityTypeDat()
+     {
+       return getSheet( m_ChocoboRaceAbilityTypeDat, "ChocoboRaceAbilityType", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceItemDat;
+     xiv::exd::Exd& getChocoboRaceItemDat()
+     {
+       return getSheet( m_ChocoboRaceItemDat, "ChocoboRaceItem", xiv::exd::Language::en );
+     }
+     ExdSheet m_ChocoboRaceRankDat;
+     xiv::exd::Exd& getChocoboRaceRankDat()
+     {
+       return getSheet( m_ChocoboRaceRankDat, "ChocoboRaceRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceStatusDat;
+     xiv::exd::Exd& getChocoboRaceStatusDat()
+     {
+       return getSheet( m_ChocoboRaceStatusDat, "ChocoboRaceStatus", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceTerritoryDat;
+     xiv::exd::Exd& getChocoboRaceTerritoryDat()
+     {
+       return getSheet( m_ChocoboRaceTerritoryDat, "ChocoboRaceTerritory", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceTutorialDat;
+     xiv::exd::Exd& getChocoboRaceTutorialDat()
+     {
+       return getSheet( m_ChocoboRaceTutorialDat, "ChocoboRaceTutorial", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboRaceWeatherDat;
+     xiv::exd::Exd& getChocoboRaceWeatherDat()
+     {
+       return getSheet( m_ChocoboRaceWeatherDat, "ChocoboRaceWeather", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboTaxiDat;
+     xiv::exd::Exd& getChocoboTaxiDat()
+     {
+       return getSheet( m_ChocoboTaxiDat, "ChocoboTaxi", xiv::exd::Language::none );
+     }
+     ExdSheet m_ChocoboTaxiStandDat;
+     xiv::exd::Exd& getChocoboTaxiStandDat()
+     {
+       return getSheet( m_ChocoboTaxiStandDat, "ChocoboTaxiStand", xiv::exd::Language::en );
+     }
+     ExdSheet m_ClassJobDat;
+     xiv::exd::Exd& getClassJobDat()
+     {
+       return getSheet( m_ClassJobDat, "ClassJob", xiv::exd::Language::en );
+     }
+     ExdSheet m_ClassJobCategoryDat;
+     xiv::exd::Exd& getClassJobCategoryDat()
+     {
+       return getSheet( m_ClassJobCategoryDat, "ClassJobCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanionDat;
+     xiv::exd::Exd& getCompanionDat()
+     {
+       return getSheet( m_CompanionDat, "Companion", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanionMoveDat;
+     xiv::exd::Exd& getCompanionMoveDat()
+     {
+       return getSheet( m_CompanionMoveDat, "CompanionMove", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanionTransientDat;
+     xiv::exd::Exd& getCompanionTransientDat()
+     {
+       return getSheet( m_CompanionTransientDat, "CompanionTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyActionDat;
+     xiv::exd::Exd& getCompanyActionDat()
+     {
+       return getSheet( m_CompanyActionDat, "CompanyAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyCraftDraftDat;
+     xiv::exd::Exd& getCompanyCraftDraftDat()
+     {
+       return getSheet( m_CompanyCraftDraftDat, "CompanyCraftDraft", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyCraftDraftCategoryDat;
+     xiv::exd::Exd& getCompanyCraftDraftCategoryDat()
+     {
+       return getSheet( m_CompanyCraftDraftCategoryDat, "CompanyCraftDraftCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyCraftManufactoryStateDat;
+     xiv::exd::Exd& getCompanyCraftManufactoryStateDat()
+     {
+       return getSheet( m_CompanyCraftManufactoryStateDat, "CompanyCraftManufactoryState", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyCraftPartDat;
+     xiv::exd::Exd& getCompanyCraftPartDat()
+     {
+       return getSheet( m_CompanyCraftPartDat, "CompanyCraftPart", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompanyCraftProcessDat;
+     xiv::exd::Exd& getCompanyCraftProcessDat()
+     {
+       return getSheet( m_CompanyCraftProcessDat, "CompanyCraftProcess", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompanyCraftSequenceDat;
+     xiv::exd::Exd& getCompanyCraftSequenceDat()
+     {
+       return getSheet( m_CompanyCraftSequenceDat, "CompanyCraftSequence", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompanyCraftSupplyItemDat;
+     xiv::exd::Exd& getCompanyCraftSupplyItemDat()
+     {
+       return getSheet( m_CompanyCraftSupplyItemDat, "CompanyCraftSupplyItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompanyCraftTypeDat;
+     xiv::exd::Exd& getCompanyCraftTypeDat()
+     {
+       return getSheet( m_CompanyCraftTypeDat, "CompanyCraftType", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompanyLeveDat;
+     xiv::exd::Exd& getCompanyLeveDat()
+     {
+       return getSheet( m_CompanyLeveDat, "CompanyLeve", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompanyLeveRuleDat;
+     xiv::exd::Exd& getCompanyLeveRuleDat()
+     {
+       return getSheet( m_CompanyLeveRuleDat, "CompanyLeveRule", xiv::exd::Language::none );
+     }
+     ExdSheet m_CompleteJournalDat;
+     xiv::exd::Exd& getCompleteJournalDat()
+     {
+       return getSheet( m_CompleteJournalDat, "CompleteJournal", xiv::exd::Language::en );
+     }
+     ExdSheet m_CompleteJournalCategoryDat;
+     xiv::exd::Exd& getCompleteJournalCategoryDat()
+     {
+       return getSheet( m_CompleteJournalCategoryDat, "CompleteJournalCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentCloseCycleDat;
+     xiv::exd::Exd& getContentCloseCycleDat()
+     {
+       return getSheet( m_ContentCloseCycleDat, "ContentCloseCycle", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentExActionDat;
+     xiv::exd::Exd& getContentExActionDat()
+     {
+       return getSheet( m_ContentExActionDat, "ContentExAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentFinderConditionDat;
+     xiv::exd::Exd& getContentFinderConditionDat()
+     {
+       return getSheet( m_ContentFinderConditionDat, "ContentFinderCondition", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentFinderConditionTransientDat;
+     xiv::exd::Exd& getContentFinderConditionTransientDat()
+     {
+       return getSheet( m_ContentFinderConditionTransientDat, "ContentFinderConditionTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentGaugeDat;
+     xiv::exd::Exd& getContentGaugeDat()
+     {
+       return getSheet( m_ContentGaugeDat, "ContentGauge", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentGaugeColorDat;
+     xiv::exd::Exd& getContentGaugeColorDat()
+     {
+       return getSheet( m_ContentGaugeColorDat, "ContentGaugeColor", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentMemberTypeDat;
+     xiv::exd::Exd& getContentMemberTypeDat()
+     {
+       return getSheet( m_ContentMemberTypeDat, "ContentMemberType", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentNpcTalkDat;
+     xiv::exd::Exd& getContentNpcTalkDat()
+     {
+       return getSheet( m_ContentNpcTalkDat, "ContentNpcTalk", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentRouletteDat;
+     xiv::exd::Exd& getContentRouletteDat()
+     {
+       return getSheet( m_ContentRouletteDat, "ContentRoulette", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentRouletteOpenRuleDat;
+     xiv::exd::Exd& getContentRouletteOpenRuleDat()
+     {
+       return getSheet( m_ContentRouletteOpenRuleDat, "ContentRouletteOpenRule", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentRouletteRoleBonusDat;
+     xiv::exd::Exd& getContentRouletteRoleBonusDat()
+     {
+       return getSheet( m_ContentRouletteRoleBonusDat, "ContentRouletteRoleBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentsNoteDat;
+     xiv::exd::Exd& getContentsNoteDat()
+     {
+       return getSheet( m_ContentsNoteDat, "ContentsNote", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentTalkDat;
+     xiv::exd::Exd& getContentTalkDat()
+     {
+       return getSheet( m_ContentTalkDat, "ContentTalk", xiv::exd::Language::en );
+     }
+     ExdSheet m_ContentTalkParamDat;
+     xiv::exd::Exd& getContentTalkParamDat()
+     {
+       return getSheet( m_ContentTalkParamDat, "ContentTalkParam", xiv::exd::Language::none );
+     }
+     ExdSheet m_ContentTypeDat;
+     xiv::exd::Exd& getContentTypeDat()
+     {
+       return getSheet( m_ContentTypeDat, "ContentType", xiv::exd::Language::en );
+     }
+     ExdSheet m_CraftActionDat;
+     xiv::exd::Exd& getCraftActionDat()
+     {
+       return getSheet( m_CraftActionDat, "CraftAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_CraftLeveDat;
+     xiv::exd::Exd& getCraftLeveDat()
+     {
+       return getSheet( m_CraftLeveDat, "CraftLeve", xiv::exd::Language::none );
+     }
+     ExdSheet m_CraftTypeDat;
+     xiv::exd::Exd& getCraftTypeDat()
+     {
+       return getSheet( m_CraftTypeDat, "CraftType", xiv::exd::Language::en );
+     }
+     ExdSheet m_CreditDat;
+     xiv::exd::Exd& getCreditDat()
+     {
+       return getSheet( m_CreditDat, "Credit", xiv::exd::Language::none );
+     }
+     ExdSheet m_CreditBackImageDat;
+     xiv::exd::Exd& getCreditBackImageDat()
+     {
+       return getSheet( m_CreditBackImageDat, "CreditBackImage", xiv::exd::Language::none );
+     }
+     ExdSheet m_CreditCastDat;
+     xiv::exd::Exd& getCreditCastDat()
+     {
+       return getSheet( m_CreditCastDat, "CreditCast", xiv::exd::Language::en );
+     }
+     ExdSheet m_CreditListDat;
+     xiv::exd::Exd& getCreditListDat()
+     {
+       return getSheet( m_CreditListDat, "CreditList", xiv::exd::Language::none );
+     }
+     ExdSheet m_CreditListTextDat;
+     xiv::exd::Exd& getCreditListTextDat()
+     {
+       return getSheet( m_CreditListTextDat, "CreditListText", xiv::exd::Language::en );
+     }
+     ExdSheet m_CurrencyDat;
+     xiv::exd::Exd& getCurrencyDat()
+     {
+       return getSheet( m_CurrencyDat, "Currency", xiv::exd::Language::none );
+     }
+     ExdSheet m_CustomTalkDat;
+     xiv::exd::Exd& getCustomTalkDat()
+     {
+       return getSheet( m_CustomTalkDat, "CustomTalk", xiv::exd::Language::en );
+     }
+     ExdSheet m_CustomTalkDynamicIconDat;
+     xiv::exd::Exd& getCustomTalkDynamicIconDat()
+     {
+       return getSheet( m_CustomTalkDynamicIconDat, "CustomTalkDynamicIcon", xiv::exd::Language::none );
+     }
+     ExdSheet m_CustomTalkNestHandlersDat;
+     xiv::exd::Exd& getCustomTalkNestHandlersDat()
+     {
+       return getSheet( m_CustomTalkNestHandlersDat, "CustomTalkNestHandlers", xiv::exd::Language::none );
+     }
+     ExdSheet m_CutsceneDat;
+     xiv::exd::Exd& getCutsceneDat()
+     {
+       return getSheet( m_CutsceneDat, "Cutscene", xiv::exd::Language::none );
+     }
+     ExdSheet m_CutScreenImageDat;
+     xiv::exd::Exd& getCutScreenImageDat()
+     {
+       return getSheet( m_CutScreenImageDat, "CutScreenImage", xiv::exd::Language::none );
+     }
+     ExdSheet m_DailySupplyItemDat;
+     xiv::exd::Exd& getDailySupplyItemDat()
+     {
+       return getSheet( m_DailySupplyItemDat, "DailySupplyItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonDat;
+     xiv::exd::Exd& getDeepDungeonDat()
+     {
+       return getSheet( m_DeepDungeonDat, "DeepDungeon", xiv::exd::Language::en );
+     }
+     ExdSheet m_DeepDungeonBanDat;
+     xiv::exd::Exd& getDeepDungeonBanDat()
+     {
+       return getSheet( m_DeepDungeonBanDat, "DeepDungeonBan", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonDangerDat;
+     xiv::exd::Exd& getDeepDungeonDangerDat()
+     {
+       return getSheet( m_DeepDungeonDangerDat, "DeepDungeonDanger", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonEquipmentDat;
+     xiv::exd::Exd& getDeepDungeonEquipmentDat()
+     {
+       return getSheet( m_DeepDungeonEquipmentDat, "DeepDungeonEquipment", xiv::exd::Language::en );
+     }
+     ExdSheet m_DeepDungeonFloorEffectUIDat;
+     xiv::exd::Exd& getDeepDungeonFloorEffectUIDat()
+     {
+       return getSheet( m_DeepDungeonFloorEffectUIDat, "DeepDungeonFloorEffectUI", xiv::exd::Language::en );
+     }
+     ExdSheet m_DeepDungeonItemDat;
+     xiv::exd::Exd& getDeepDungeonItemDat()
+     {
+       return getSheet( m_DeepDungeonItemDat, "DeepDungeonItem", xiv::exd::Language::en );
+     }
+     ExdSheet m_DeepDungeonLayerDat;
+     xiv::exd::Exd& getDeepDungeonLayerDat()
+     {
+       return getSheet( m_DeepDungeonLayerDat, "DeepDungeonLayer", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonMagicStoneDat;
+     xiv::exd::Exd& getDeepDungeonMagicStoneDat()
+     {
+       return getSheet( m_DeepDungeonMagicStoneDat, "DeepDungeonMagicStone", xiv::exd::Language::en );
+     }
+     ExdSheet m_DeepDungeonMap5XDat;
+     xiv::exd::Exd& getDeepDungeonMap5XDat()
+     {
+       return getSheet( m_DeepDungeonMap5XDat, "DeepDungeonMap5X", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonRoomDat;
+     xiv::exd::Exd& getDeepDungeonRoomDat()
+     {
+       return getSheet( m_DeepDungeonRoomDat, "DeepDungeonRoom", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeepDungeonStatusDat;
+     xiv::exd::Exd& getDeepDungeonStatusDat()
+     {
+       return getSheet( m_DeepDungeonStatusDat, "DeepDungeonStatus", xiv::exd::Language::none );
+     }
+     ExdSheet m_DefaultTalkDat;
+     xiv::exd::Exd& getDefaultTalkDat()
+     {
+       return getSheet( m_DefaultTalkDat, "DefaultTalk", xiv::exd::Language::en );
+     }
+     ExdSheet m_DefaultTalkLipSyncTypeDat;
+     xiv::exd::Exd& getDefaultTalkLipSyncTypeDat()
+     {
+       return getSheet( m_DefaultTalkLipSyncTypeDat, "DefaultTalkLipSyncType", xiv::exd::Language::none );
+     }
+     ExdSheet m_DeliveryQuestDat;
+     xiv::exd::Exd& getDeliveryQuestDat()
+     {
+       return getSheet( m_DeliveryQuestDat, "DeliveryQuest", xiv::exd::Language::none );
+     }
+     ExdSheet m_DescriptionPageDat;
+     xiv::exd::Exd& getDescriptionPageDat()
+     {
+       return getSheet( m_DescriptionPageDat, "DescriptionPage", xiv::exd::Language::none );
+     }
+     ExdSheet m_DescriptionStringDat;
+     xiv::exd::Exd& getDescriptionStringDat()
+     {
+       return getSheet( m_DescriptionStringDat, "DescriptionString", xiv::exd::Language::en );
+     }
+     ExdSheet m_DisposalShopDat;
+     xiv::exd::Exd& getDisposalShopDat()
+     {
+       return getSheet( m_DisposalShopDat, "DisposalShop", xiv::exd::Language::en );
+     }
+     ExdSheet m_DisposalShopFilterTypeDat;
+     xiv::exd::Exd& getDisposalShopFilterTypeDat()
+     {
+       return getSheet( m_DisposalShopFilterTypeDat, "DisposalShopFilterType", xiv::exd::Language::en );
+     }
+     ExdSheet m_DisposalShopItemDat;
+     xiv::exd::Exd& getDisposalShopItemDat()
+     {
+       return getSheet( m_DisposalShopItemDat, "DisposalShopItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_DpsChallengeDat;
+     xiv::exd::Exd& getDpsChallengeDat()
+     {
+       return getSheet( m_DpsChallengeDat, "DpsChallenge", xiv::exd::Language::en );
+     }
+     ExdSheet m_DpsChallengeOfficerDat;
+     xiv::exd::Exd& getDpsChallengeOfficerDat()
+     {
+       return getSheet( m_DpsChallengeOfficerDat, "DpsChallengeOfficer", xiv::exd::Language::none );
+     }
+     ExdSheet m_DpsChallengeTransientDat;
+     xiv::exd::Exd& getDpsChallengeTransientDat()
+     {
+       return getSheet( m_DpsChallengeTransientDat, "DpsChallengeTransient", xiv::exd::Language::none );
+     }
+     ExdSheet m_EmjAddonDat;
+     xiv::exd::Exd& getEmjAddonDat()
+     {
+       return getSheet( m_EmjAddonDat, "EmjAddon", xiv::exd::Language::en );
+     }
+     ExdSheet m_EmjDaniDat;
+     xiv::exd::Exd& getEmjDaniDat()
+     {
+       return getSheet( m_EmjDaniDat, "EmjDani", xiv::exd::Language::none );
+     }
+     ExdSheet m_EmoteDat;
+     xiv::exd::Exd& getEmoteDat()
+     {
+       return getSheet( m_EmoteDat, "Emote", xiv::exd::Language::en );
+     }
+     ExdSheet m_EmoteCategoryDat;
+     xiv::exd::Exd& getEmoteCategoryDat()
+     {
+       return getSheet( m_EmoteCategoryDat, "EmoteCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_ENpcBaseDat;
+     xiv::exd::Exd& getENpcBaseDat()
+     {
+       return getSheet( m_ENpcBaseDat, "ENpcBase", xiv::exd::Language::none );
+     }
+     ExdSheet m_ENpcDressUpDat;
+     xiv::exd::Exd& getENpcDressUpDat()
+     {
+       return getSheet( m_ENpcDressUpDat, "ENpcDressUp", xiv::exd::Language::none );
+     }
+     ExdSheet m_ENpcDressUpDressDat;
+     xiv::exd::Exd& getENpcDressUpDressDat()
+     {
+       return getSheet( m_ENpcDressUpDressDat, "ENpcDressUpDress", xiv::exd::Language::none );
+     }
+     ExdSheet m_ENpcResidentDat;
+     xiv::exd::Exd& getENpcResidentDat()
+     {
+       return getSheet( m_ENpcResidentDat, "ENpcResident", xiv::exd::Language::en );
+     }
+     ExdSheet m_EObjDat;
+     xiv::exd::Exd& getEObjDat()
+     {
+       return getSheet( m_EObjDat, "EObj", xiv::exd::Language::none );
+     }
+     ExdSheet m_EObjNameDat;
+     xiv::exd::Exd& getEObjNameDat()
+     {
+       return getSheet( m_EObjNameDat, "EObjName", xiv::exd::Language::en );
+     }
+     ExdSheet m_EquipRaceCategoryDat;
+     xiv::exd::Exd& getEquipRaceCategoryDat()
+     {
+       return getSheet( m_EquipRaceCategoryDat, "EquipRaceCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_EquipSlotCategoryDat;
+     xiv::exd::Exd& getEquipSlotCategoryDat()
+     {
+       return getSheet( m_EquipSlotCategoryDat, "EquipSlotCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaAetherItemDat;
+     xiv::exd::Exd& getEurekaAetherItemDat()
+     {
+       return getSheet( m_EurekaAetherItemDat, "EurekaAetherItem", xiv::exd::Language::en );
+     }
+     ExdSheet m_EurekaAethernetDat;
+     xiv::exd::Exd& getEurekaAethernetDat()
+     {
+       return getSheet( m_EurekaAethernetDat, "EurekaAethernet", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaGrowDataDat;
+     xiv::exd::Exd& getEurekaGrowDataDat()
+     {
+       return getSheet( m_EurekaGrowDataDat, "EurekaGrowData", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaLogosMixerProbabilityDat;
+     xiv::exd::Exd& getEurekaLogosMixerProbabilityDat()
+     {
+       return getSheet( m_EurekaLogosMixerProbabilityDat, "EurekaLogosMixerProbability", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaMagiaActionDat;
+     xiv::exd::Exd& getEurekaMagiaActionDat()
+     {
+       return getSheet( m_EurekaMagiaActionDat, "EurekaMagiaAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaMagiciteItemDat;
+     xiv::exd::Exd& getEurekaMagiciteItemDat()
+     {
+       return getSheet( m_EurekaMagiciteItemDat, "EurekaMagiciteItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_EurekaMagiciteItemTypeDat;
+     xiv::exd::Exd& getEurekaMagiciteItemTypeDat()
+     {
+       return getSheet( m_EurekaMagiciteItemTypeDat, "EurekaMagiciteItemType", xiv::exd::Language::en );
+     }
+     ExdSheet m_EurekaSphereElementAdjustDat;
+     xiv::exd::Exd& getEurekaSphereElementAdjustDat()
+     {
+       return getSheet( m_EurekaSphereElementAdjustDat, "EurekaSphereElementAdjust", xiv::exd::Language::none );
+     }
+     ExdSheet m_EventActionDat;
+     xiv::exd::Exd& getEventActionDat()
+     {
+       return getSheet( m_EventActionDat, "EventAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_EventIconPriorityDat;
+     xiv::exd::Exd& getEventIconPriorityDat()
+     {
+       return getSheet( m_EventIconPriorityDat, "EventIconPriority", xiv::exd::Language::none );
+     }
+     ExdSheet m_EventIconTypeDat;
+     xiv::exd::Exd& getEventIconTypeDat()
+     {
+       return getSheet( m_EventIconTypeDat, "EventIconType", xiv::exd::Language::none );
+     }
+     ExdSheet m_EventItemDat;
+     xiv::exd::Exd& getEventItemDat()
+     {
+       return getSheet( m_EventItemDat, "EventItem", xiv::exd::Language::en );
+     }
+     ExdSheet m_EventItemCastTimelineDat;
+     xiv::exd::Exd& getEventItemCastTimelineDat()
+     {
+       return getSheet( m_EventItemCastTimelineDat, "EventItemCastTimeline", xiv::exd::Language::none );
+     }
+     ExdSheet m_EventItemHelpDat;
+     xiv::exd::Exd& getEventItemHelpDat()
+     {
+       return getSheet( m_EventItemHelpDat, "EventItemHelp", xiv::exd::Language::en );
+     }
+     ExdSheet m_EventItemTimelineDat;
+     xiv::exd::Exd& getEventItemTimelineDat()
+     {
+       return getSheet( m_EventItemTimelineDat, "EventItemTimeline", xiv::exd::Language::none );
+     }
+     ExdSheet m_ExportedSGDat;
+     xiv::exd::Exd& getExportedSGDat()
+     {
+       return getSheet( m_ExportedSGDat, "ExportedSG", xiv::exd::Language::none );
+     }
+     ExdSheet m_ExVersionDat;
+     xiv::exd::Exd& getExVersionDat()
+     {
+       return getSheet( m_ExVersionDat, "ExVersion", xiv::exd::Language::en );
+     }
+     ExdSheet m_FateDat;
+     xiv::exd::Exd& getFateDat()
+     {
+       return getSheet( m_FateDat, "Fate", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCActivityDat;
+     xiv::exd::Exd& getFCActivityDat()
+     {
+       return getSheet( m_FCActivityDat, "FCActivity", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCActivityCategoryDat;
+     xiv::exd::Exd& getFCActivityCategoryDat()
+     {
+       return getSheet( m_FCActivityCategoryDat, "FCActivityCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCAuthorityDat;
+     xiv::exd::Exd& getFCAuthorityDat()
+     {
+       return getSheet( m_FCAuthorityDat, "FCAuthority", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCAuthorityCategoryDat;
+     xiv::exd::Exd& getFCAuthorityCategoryDat()
+     {
+       return getSheet( m_FCAuthorityCategoryDat, "FCAuthorityCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCChestNameDat;
+     xiv::exd::Exd& getFCChestNameDat()
+     {
+       return getSheet( m_FCChestNameDat, "FCChestName", xiv::exd::Language::en );
+     }
+     ExdSheet m_FccShopDat;
+     xiv::exd::Exd& getFccShopDat()
+     {
+       return getSheet( m_FccShopDat, "FccShop", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCHierarchyDat;
+     xiv::exd::Exd& getFCHierarchyDat()
+     {
+       return getSheet( m_FCHierarchyDat, "FCHierarchy", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCProfileDat;
+     xiv::exd::Exd& getFCProfileDat()
+     {
+       return getSheet( m_FCProfileDat, "FCProfile", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCReputationDat;
+     xiv::exd::Exd& getFCReputationDat()
+     {
+       return getSheet( m_FCReputationDat, "FCReputation", xiv::exd::Language::en );
+     }
+     ExdSheet m_FCRightsDat;
+     xiv::exd::Exd& getFCRightsDat()
+     {
+       return getSheet( m_FCRightsDat, "FCRights", xiv::exd::Language::en );
+     }
+     ExdSheet m_FestivalDat;
+     xiv::exd::Exd& getFestivalDat()
+     {
+       return getSheet( m_FestivalDat, "Festival", xiv::exd::Language::none );
+     }
+     ExdSheet m_FieldMarkerDat;
+     xiv::exd::Exd& getFieldMarkerDat()
+     {
+       return getSheet( m_FieldMarkerDat, "FieldMarker", xiv::exd::Language::en );
+     }
+     ExdSheet m_FishingRecordTypeDat;
+     xiv::exd::Exd& getFishingRecordTypeDat()
+     {
+       return getSheet( m_FishingRecordTypeDat, "FishingRecordType", xiv::exd::Language::none );
+     }
+     ExdSheet m_FishingRecordTypeTransientDat;
+     xiv::exd::Exd& getFishingRecordTypeTransientDat()
+     {
+       return getSheet( m_FishingRecordTypeTransientDat, "FishingRecordTypeTransient", xiv::exd::Language::none );
+     }
+     ExdSheet m_FishingSpotDat;
+     xiv::exd::Exd& getFishingSpotDat()
+     {
+       return getSheet( m_FishingSpotDat, "FishingSpot", xiv::exd::Language::en );
+     }
+     ExdSheet m_FishParameterDat;
+     xiv::exd::Exd& getFishParameterDat()
+     {
+       return getSheet( m_FishParameterDat, "FishParameter", xiv::exd::Language::en );
+     }
+     ExdSheet m_Frontline03Dat;
+     xiv::exd::Exd& getFrontline03Dat()
+     {
+       return getSheet( m_Frontline03Dat, "Frontline03", xiv::exd::Language::none );
+     }
+     ExdSheet m_Frontline04Dat;
+     xiv::exd::Exd& getFrontline04Dat()
+     {
+       return getSheet( m_Frontline04Dat, "Frontline04", xiv::exd::Language::none );
+     }
+     ExdSheet m_GardeningSeedDat;
+     xiv::exd::Exd& getGardeningSeedDat()
+     {
+       return getSheet( m_GardeningSeedDat, "GardeningSeed", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringConditionDat;
+     xiv::exd::Exd& getGatheringConditionDat()
+     {
+       return getSheet( m_GatheringConditionDat, "GatheringCondition", xiv::exd::Language::en );
+     }
+     ExdSheet m_GatheringExpDat;
+     xiv::exd::Exd& getGatheringExpDat()
+     {
+       return getSheet( m_GatheringExpDat, "GatheringExp", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringItemDat;
+     xiv::exd::Exd& getGatheringItemDat()
+     {
+       return getSheet( m_GatheringItemDat, "GatheringItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringItemLevelConvertTableDat;
+     xiv::exd::Exd& getGatheringItemLevelConvertTableDat()
+     {
+       return getSheet( m_GatheringItemLevelConvertTableDat, "GatheringItemLevelConvertTable", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringItemPointDat;
+     xiv::exd::Exd& getGatheringItemPointDat()
+     {
+       return getSheet( m_GatheringItemPointDat, "GatheringItemPoint", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringLeveDat;
+     xiv::exd::Exd& getGatheringLeveDat()
+     {
+       return getSheet( m_GatheringLeveDat, "GatheringLeve", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringLeveRouteDat;
+     xiv::exd::Exd& getGatheringLeveRouteDat()
+     {
+       return getSheet( m_GatheringLeveRouteDat, "GatheringLeveRoute", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringNotebookListDat;
+     xiv::exd::Exd& getGatheringNotebookListDat()
+     {
+       return getSheet( m_GatheringNotebookListDat, "GatheringNotebookList", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringPointDat;
+     xiv::exd::Exd& getGatheringPointDat()
+     {
+       return getSheet( m_GatheringPointDat, "GatheringPoint", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringPointBaseDat;
+     xiv::exd::Exd& getGatheringPointBaseDat()
+     {
+       return getSheet( m_GatheringPointBaseDat, "GatheringPointBase", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringPointBonusDat;
+     xiv::exd::Exd& getGatheringPointBonusDat()
+     {
+       return getSheet( m_GatheringPointBonusDat, "GatheringPointBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_GatheringPointBonusTypeDat;
+     xiv::exd::Exd& getGatheringPointBonusTypeDat()
+     {
+       return getSheet( m_GatheringPointBonusTypeDat, "GatheringPointBonusType", xiv::exd::Language::en );
+     }
+     ExdSheet m_GatheringPointNameDat;
+     xiv::exd::Exd& getGatheringPointNameDat()
+     {
+       return getSheet( m_GatheringPointNameDat, "GatheringPointName", xiv::exd::Language::en );
+     }
+     ExdSheet m_GatheringSubCategoryDat;
+     xiv::exd::Exd& getGatheringSubCategoryDat()
+     {
+       return getSheet( m_GatheringSubCategoryDat, "GatheringSubCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_GatheringTypeDat;
+     xiv::exd::Exd& getGatheringTypeDat()
+     {
+       return getSheet( m_GatheringTypeDat, "GatheringType", xiv::exd::Language::en );
+     }
+     ExdSheet m_GcArmyCaptureTacticsDat;
+     xiv::exd::Exd& getGcArmyCaptureTacticsDat()
+     {
+       return getSheet( m_GcArmyCaptureTacticsDat, "GcArmyCaptureTactics", xiv::exd::Language::none );
+     }
+     ExdSheet m_GcArmyExpeditionDat;
+     xiv::exd::Exd& getGcArmyExpeditionDat()
+     {
+       return getSheet( m_GcArmyExpeditionDat, "GcArmyExpedition", xiv::exd::Language::en );
+     }
+     ExdSheet m_GcArmyExpeditionMemberBonusDat;
+     xiv::exd::Exd& getGcArmyExpeditionMemberBonusDat()
+     {
+       return getSheet( m_GcArmyExpeditionMemberBonusDat, "GcArmyExpeditionMemberBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_GcArmyExpeditionTypeDat;
+     xiv::exd::Exd& getGcArmyExpeditionTypeDat()
+     {
+       return getSheet( m_GcArmyExpeditionTypeDat, "GcArmyExpeditionType", xiv::exd::Language::en );
+     }
+     ExdSheet m_GcArmyMemberGrowDat;
+     xiv::exd::Exd& getGcArmyMemberGrowDat()
+     {
+       return getSheet( m_GcArmyMemberGrowDat, "GcArmyMemberGrow", xiv::exd::Language::none );
+     }
+     ExdSheet m_GcArmyTrainingDat;
+     xiv::exd::Exd& getGcArmyTrainingDat()
+     {
+       return getSheet( m_GcArmyTrainingDat, "GcArmyTraining", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankGridaniaFemaleTextDat;
+     xiv::exd::Exd& getGCRankGridaniaFemaleTextDat()
+     {
+       return getSheet( m_GCRankGridaniaFemaleTextDat, "GCRankGridaniaFemaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankGridaniaMaleTextDat;
+     xiv::exd::Exd& getGCRankGridaniaMaleTextDat()
+     {
+       return getSheet( m_GCRankGridaniaMaleTextDat, "GCRankGridaniaMaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankLimsaFemaleTextDat;
+     xiv::exd::Exd& getGCRankLimsaFemaleTextDat()
+     {
+       return getSheet( m_GCRankLimsaFemaleTextDat, "GCRankLimsaFemaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankLimsaMaleTextDat;
+     xiv::exd::Exd& getGCRankLimsaMaleTextDat()
+     {
+       return getSheet( m_GCRankLimsaMaleTextDat, "GCRankLimsaMaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankUldahFemaleTextDat;
+     xiv::exd::Exd& getGCRankUldahFemaleTextDat()
+     {
+       return getSheet( m_GCRankUldahFemaleTextDat, "GCRankUldahFemaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCRankUldahMaleTextDat;
+     xiv::exd::Exd& getGCRankUldahMaleTextDat()
+     {
+       return getSheet( m_GCRankUldahMaleTextDat, "GCRankUldahMaleText", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCScripShopCategoryDat;
+     xiv::exd::Exd& getGCScripShopCategoryDat()
+     {
+       return getSheet( m_GCScripShopCategoryDat, "GCScripShopCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_GCScripShopItemDat;
+     xiv::exd::Exd& getGCScripShopItemDat()
+     {
+       return getSheet( m_GCScripShopItemDat, "GCScripShopItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_GCShopDat;
+     xiv::exd::Exd& getGCShopDat()
+     {
+       return getSheet( m_GCShopDat, "GCShop", xiv::exd::Language::none );
+     }
+     ExdSheet m_GCShopItemCategoryDat;
+     xiv::exd::Exd& getGCShopItemCategoryDat()
+     {
+       return getSheet( m_GCShopItemCategoryDat, "GCShopItemCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_GCSupplyDutyDat;
+     xiv::exd::Exd& getGCSupplyDutyDat()
+     {
+       return getSheet( m_GCSupplyDutyDat, "GCSupplyDuty", xiv::exd::Language::none );
+     }
+     ExdSheet m_GCSupplyDutyRewardDat;
+     xiv::exd::Exd& getGCSupplyDutyRewardDat()
+     {
+       return getSheet( m_GCSupplyDutyRewardDat, "GCSupplyDutyReward", xiv::exd::Language::none );
+     }
+     ExdSheet m_GeneralActionDat;
+     xiv::exd::Exd& getGeneralActionDat()
+     {
+       return getSheet( m_GeneralActionDat, "GeneralAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_GFATEDat;
+     xiv::exd::Exd& getGFATEDat()
+     {
+       return getSheet( m_GFATEDat, "GFATE", xiv::exd::Language::none );
+     }
+     ExdSheet m_GFateClimbing2Dat;
+     xiv::exd::Exd& getGFateClimbing2Dat()
+     {
+       return getSheet( m_GFateClimbing2Dat, "GFateClimbing2", xiv::exd::Language::none );
+     }
+     ExdSheet m_GFateClimbing2ContentDat;
+     xiv::exd::Exd& getGFateClimbing2ContentDat()
+     {
+       return getSheet( m_GFateClimbing2ContentDat, "GFateClimbing2Content", xiv::exd::Language::none );
+     }
+     ExdSheet m_GFateClimbing2TotemTypeDat;
+     xiv::exd::Exd& getGFateClimbing2TotemTypeDat()
+     {
+       return getSheet( m_GFateClimbing2TotemTypeDat, "GFateClimbing2TotemType", xiv::exd::Language::none );
+     }
+     ExdSheet m_GFateRideShootingDat;
+     xiv::exd::Exd& getGFateRideShootingDat()
+     {
+       return getSheet( m_GFateRideShootingDat, "GFateRideShooting", xiv::exd::Language::none );
+     }
+     ExdSheet m_GilShopDat;
+     xiv::exd::Exd& getGilShopDat()
+     {
+       return getSheet( m_GilShopDat, "GilShop", xiv::exd::Language::en );
+     }
+     ExdSheet m_GilShopItemDat;
+     xiv::exd::Exd& getGilShopItemDat()
+     {
+       return getSheet( m_GilShopItemDat, "GilShopItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_GoldSaucerArcadeMachineDat;
+     xiv::exd::Exd& getGoldSaucerArcadeMachineDat()
+     {
+       return getSheet( m_GoldSaucerArcadeMachineDat, "GoldSaucerArcadeMachine", xiv::exd::Language::en );
+     }
+     ExdSheet m_GoldSaucerTextDataDat;
+     xiv::exd::Exd& getGoldSaucerTextDataDat()
+     {
+       return getSheet( m_GoldSaucerTextDataDat, "GoldSaucerTextData", xiv::exd::Language::en );
+     }
+     ExdSheet m_GrandCompanyDat;
+     xiv::exd::Exd& getGrandCompanyDat()
+     {
+       return getSheet( m_GrandCompanyDat, "GrandCompany", xiv::exd::Language::en );
+     }
+     ExdSheet m_GrandCompanyRankDat;
+     xiv::exd::Exd& getGrandCompanyRankDat()
+     {
+       return getSheet( m_GrandCompanyRankDat, "GrandCompanyRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_GuardianDeityDat;
+     xiv::exd::Exd& getGuardianDeityDat()
+     {
+       return getSheet( m_GuardianDeityDat, "GuardianDeity", xiv::exd::Language::en );
+     }
+     ExdSheet m_GuildleveAssignmentDat;
+     xiv::exd::Exd& getGuildleveAssignmentDat()
+     {
+       return getSheet( m_GuildleveAssignmentDat, "GuildleveAssignment", xiv::exd::Language::none );
+     }
+     ExdSheet m_GuildleveAssignmentCategoryDat;
+     xiv::exd::Exd& getGuildleveAssignmentCategoryDat()
+     {
+       return getSheet( m_GuildleveAssignmentCategoryDat, "GuildleveAssignmentCategory", xiv::exd::Language::none );
+     }
+     ExdSheet m_GuildOrderGuideDat;
+     xiv::exd::Exd& getGuildOrderGuideDat()
+     {
+       return getSheet( m_GuildOrderGuideDat, "GuildOrderGuide", xiv::exd::Language::none );
+     }
+     ExdSheet m_GuildOrderOfficerDat;
+     xiv::exd::Exd& getGuildOrderOfficerDat()
+     {
+       return getSheet( m_GuildOrderOfficerDat, "GuildOrderOfficer", xiv::exd::Language::none );
+     }
+     ExdSheet m_HairMakeTypeDat;
+     xiv::exd::Exd& getHairMakeTypeDat()
+     {
+       return getSheet( m_HairMakeTypeDat, "HairMakeType", xiv::exd::Language::none );
+     }
+     ExdSheet m_HouseRetainerPoseDat;
+     xiv::exd::Exd& getHouseRetainerPoseDat()
+     {
+       return getSheet( m_HouseRetainerPoseDat, "HouseRetainerPose", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingAethernetDat;
+     xiv::exd::Exd& getHousingAethernetDat()
+     {
+       return getSheet( m_HousingAethernetDat, "HousingAethernet", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingAppealDat;
+     xiv::exd::Exd& getHousingAppealDat()
+     {
+       return getSheet( m_HousingAppealDat, "HousingAppeal", xiv::exd::Language::en );
+     }
+     ExdSheet m_HousingEmploymentNpcListDat;
+     xiv::exd::Exd& getHousingEmploymentNpcListDat()
+     {
+       return getSheet( m_HousingEmploymentNpcListDat, "HousingEmploymentNpcList", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingEmploymentNpcRaceDat;
+     xiv::exd::Exd& getHousingEmploymentNpcRaceDat()
+     {
+       return getSheet( m_HousingEmploymentNpcRaceDat, "HousingEmploymentNpcRace", xiv::exd::Language::en );
+     }
+     ExdSheet m_HousingExteriorDat;
+     xiv::exd::Exd& getHousingExteriorDat()
+     {
+       return getSheet( m_HousingExteriorDat, "HousingExterior", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingFurnitureDat;
+     xiv::exd::Exd& getHousingFurnitureDat()
+     {
+       return getSheet( m_HousingFurnitureDat, "HousingFurniture", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingLandSetDat;
+     xiv::exd::Exd& getHousingLandSetDat()
+     {
+       return getSheet( m_HousingLandSetDat, "HousingLandSet", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingMapMarkerInfoDat;
+     xiv::exd::Exd& getHousingMapMarkerInfoDat()
+     {
+       return getSheet( m_HousingMapMarkerInfoDat, "HousingMapMarkerInfo", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingMerchantPoseDat;
+     xiv::exd::Exd& getHousingMerchantPoseDat()
+     {
+       return getSheet( m_HousingMerchantPoseDat, "HousingMerchantPose", xiv::exd::Language::en );
+     }
+     ExdSheet m_HousingPlacementDat;
+     xiv::exd::Exd& getHousingPlacementDat()
+     {
+       return getSheet( m_HousingPlacementDat, "HousingPlacement", xiv::exd::Language::en );
+     }
+     ExdSheet m_HousingPresetDat;
+     xiv::exd::Exd& getHousingPresetDat()
+     {
+       return getSheet( m_HousingPresetDat, "HousingPreset", xiv::exd::Language::en );
+     }
+     ExdSheet m_HousingUnitedExteriorDat;
+     xiv::exd::Exd& getHousingUnitedExteriorDat()
+     {
+       return getSheet( m_HousingUnitedExteriorDat, "HousingUnitedExterior", xiv::exd::Language::none );
+     }
+     ExdSheet m_HousingYardObjectDat;
+     xiv::exd::Exd& getHousingYardObjectDat()
+     {
+       return getSheet( m_HousingYardObjectDat, "HousingYardObject", xiv::exd::Language::none );
+     }
+     ExdSheet m_HowToDat;
+     xiv::exd::Exd& getHowToDat()
+     {
+       return getSheet( m_HowToDat, "HowTo", xiv::exd::Language::en );
+     }
+     ExdSheet m_HowToCategoryDat;
+     xiv::exd::Exd& getHowToCategoryDat()
+     {
+       return getSheet( m_HowToCategoryDat, "HowToCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_HowToPageDat;
+     xiv::exd::Exd& getHowToPageDat()
+     {
+       return getSheet( m_HowToPageDat, "HowToPage", xiv::exd::Language::en );
+     }
+     ExdSheet m_InstanceContentDat;
+     xiv::exd::Exd& getInstanceContentDat()
+     {
+       return getSheet( m_InstanceContentDat, "InstanceContent", xiv::exd::Language::en );
+     }
+     ExdSheet m_InstanceContentBuffDat;
+     xiv::exd::Exd& getInstanceContentBuffDat()
+     {
+       return getSheet( m_InstanceContentBuffDat, "InstanceContentBuff", xiv::exd::Language::none );
+     }
+     ExdSheet m_InstanceContentCSBonusDat;
+     xiv::exd::Exd& getInstanceContentCSBonusDat()
+     {
+       return getSheet( m_InstanceContentCSBonusDat, "InstanceContentCSBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_InstanceContentGuideDat;
+     xiv::exd::Exd& getInstanceContentGuideDat()
+     {
+       return getSheet( m_InstanceContentGuideDat, "InstanceContentGuide", xiv::exd::Language::none );
+     }
+     ExdSheet m_InstanceContentTextDataDat;
+     xiv::exd::Exd& getInstanceContentTextDataDat()
+     {
+       return getSheet( m_InstanceContentTextDataDat, "InstanceContentTextData", xiv::exd::Language::en );
+     }
+     ExdSheet m_ItemDat;
+     xiv::exd::Exd& getItemDat()
+     {
+       return getSheet( m_ItemDat, "Item", xiv::exd::Language::en );
+     }
+     ExdSheet m_ItemActionDat;
+     xiv::exd::Exd& getItemActionDat()
+     {
+       return getSheet( m_ItemActionDat, "ItemAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_ItemFoodDat;
+     xiv::exd::Exd& getItemFoodDat()
+     {
+       return getSheet( m_ItemFoodDat, "ItemFood", xiv::exd::Language::none );
+     }
+     ExdSheet m_ItemLevelDat;
+     xiv::exd::Exd& getItemLevelDat()
+     {
+       return getSheet( m_ItemLevelDat, "ItemLevel", xiv::exd::Language::none );
+     }
+     ExdSheet m_ItemSearchCategoryDat;
+     xiv::exd::Exd& getItemSearchCategoryDat()
+     {
+       return getSheet( m_ItemSearchCategoryDat, "ItemSearchCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_ItemSeriesDat;
+     xiv::exd::Exd& getItemSeriesDat()
+     {
+       return getSheet( m_ItemSeriesDat, "ItemSeries", xiv::exd::Language::en );
+     }
+     ExdSheet m_ItemSpecialBonusDat;
+     xiv::exd::Exd& getItemSpecialBonusDat()
+     {
+       return getSheet( m_ItemSpecialBonusDat, "ItemSpecialBonus", xiv::exd::Language::en );
+     }
+     ExdSheet m_ItemUICategoryDat;
+     xiv::exd::Exd& getItemUICategoryDat()
+     {
+       return getSheet( m_ItemUICategoryDat, "ItemUICategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_JournalCategoryDat;
+     xiv::exd::Exd& getJournalCategoryDat()
+     {
+       return getSheet( m_JournalCategoryDat, "JournalCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_JournalGenreDat;
+     xiv::exd::Exd& getJournalGenreDat()
+     {
+       return getSheet( m_JournalGenreDat, "JournalGenre", xiv::exd::Language::en );
+     }
+     ExdSheet m_JournalSectionDat;
+     xiv::exd::Exd& getJournalSectionDat()
+     {
+       return getSheet( m_JournalSectionDat, "JournalSection", xiv::exd::Language::en );
+     }
+     ExdSheet m_LeveDat;
+     xiv::exd::Exd& getLeveDat()
+     {
+       return getSheet( m_LeveDat, "Leve", xiv::exd::Language::en );
+     }
+     ExdSheet m_LeveAssignmentTypeDat;
+     xiv::exd::Exd& getLeveAssignmentTypeDat()
+     {
+       return getSheet( m_LeveAssignmentTypeDat, "LeveAssignmentType", xiv::exd::Language::en );
+     }
+     ExdSheet m_LeveClientDat;
+     xiv::exd::Exd& getLeveClientDat()
+     {
+       return getSheet( m_LeveClientDat, "LeveClient", xiv::exd::Language::en );
+     }
+     ExdSheet m_LevelDat;
+     xiv::exd::Exd& getLevelDat()
+     {
+       return getSheet( m_LevelDat, "Level", xiv::exd::Language::none );
+     }
+     ExdSheet m_LeveRewardItemDat;
+     xiv::exd::Exd& getLeveRewardItemDat()
+     {
+       return getSheet( m_LeveRewardItemDat, "LeveRewardItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_LeveRewardItemGroupDat;
+     xiv::exd::Exd& getLeveRewardItemGroupDat()
+     {
+       return getSheet( m_LeveRewardItemGroupDat, "LeveRewardItemGroup", xiv::exd::Language::none );
+     }
+     ExdSheet m_LeveVfxDat;
+     xiv::exd::Exd& getLeveVfxDat()
+     {
+       return getSheet( m_LeveVfxDat, "LeveVfx", xiv::exd::Language::none );
+     }
+     ExdSheet m_LogFilterDat;
+     xiv::exd::Exd& getLogFilterDat()
+     {
+       return getSheet( m_LogFilterDat, "LogFilter", xiv::exd::Language::en );
+     }
+     ExdSheet m_LogKindDat;
+     xiv::exd::Exd& getLogKindDat()
+     {
+       return getSheet( m_LogKindDat, "LogKind", xiv::exd::Language::en );
+     }
+     ExdSheet m_LogKindCategoryTextDat;
+     xiv::exd::Exd& getLogKindCategoryTextDat()
+     {
+       return getSheet( m_LogKindCategoryTextDat, "LogKindCategoryText", xiv::exd::Language::en );
+     }
+     ExdSheet m_LogMessageDat;
+     xiv::exd::Exd& getLogMessageDat()
+     {
+       return getSheet( m_LogMessageDat, "LogMessage", xiv::exd::Language::en );
+     }
+     ExdSheet m_LotteryExchangeShopDat;
+     xiv::exd::Exd& getLotteryExchangeShopDat()
+     {
+       return getSheet( m_LotteryExchangeShopDat, "LotteryExchangeShop", xiv::exd::Language::en );
+     }
+     ExdSheet m_MacroIconDat;
+     xiv::exd::Exd& getMacroIconDat()
+     {
+       return getSheet( m_MacroIconDat, "MacroIcon", xiv::exd::Language::none );
+     }
+     ExdSheet m_MacroIconRedirectOldDat;
+     xiv::exd::Exd& getMacroIconRedirectOldDat()
+     {
+       return getSheet( m_MacroIconRedirectOldDat, "MacroIconRedirectOld", xiv::exd::Language::none );
+     }
+     ExdSheet m_MainCommandDat;
+     xiv::exd::Exd& getMainCommandDat()
+     {
+       return getSheet( m_MainCommandDat, "MainCommand", xiv::exd::Language::en );
+     }
+     ExdSheet m_MainCommandCategoryDat;
+     xiv::exd::Exd& getMainCommandCategoryDat()
+     {
+       return getSheet( m_MainCommandCategoryDat, "MainCommandCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_ManeuversArmorDat;
+     xiv::exd::Exd& getManeuversArmorDat()
+     {
+       return getSheet( m_ManeuversArmorDat, "ManeuversArmor", xiv::exd::Language::en );
+     }
+     ExdSheet m_MapDat;
+     xiv::exd::Exd& getMapDat()
+     {
+       return getSheet( m_MapDat, "Map", xiv::exd::Language::none );
+     }
+     ExdSheet m_MapMarkerDat;
+     xiv::exd::Exd& getMapMarkerDat()
+     {
+       return getSheet( m_MapMarkerDat, "MapMarker", xiv::exd::Language::none );
+     }
+     ExdSheet m_MapMarkerRegionDat;
+     xiv::exd::Exd& getMapMarkerRegionDat()
+     {
+       return getSheet( m_MapMarkerRegionDat, "MapMarkerRegion", xiv::exd::Language::none );
+     }
+     ExdSheet m_MapSymbolDat;
+     xiv::exd::Exd& getMapSymbolDat()
+     {
+       return getSheet( m_MapSymbolDat, "MapSymbol", xiv::exd::Language::none );
+     }
+     ExdSheet m_MarkerDat;
+     xiv::exd::Exd& getMarkerDat()
+     {
+       return getSheet( m_MarkerDat, "Marker", xiv::exd::Language::en );
+     }
+     ExdSheet m_MasterpieceSupplyDutyDat;
+     xiv::exd::Exd& getMasterpieceSupplyDutyDat()
+     {
+       return getSheet( m_MasterpieceSupplyDutyDat, "MasterpieceSupplyDuty", xiv::exd::Language::none );
+     }
+     ExdSheet m_MasterpieceSupplyMultiplierDat;
+     xiv::exd::Exd& getMasterpieceSupplyMultiplierDat()
+     {
+       return getSheet( m_MasterpieceSupplyMultiplierDat, "MasterpieceSupplyMultiplier", xiv::exd::Language::none );
+     }
+     ExdSheet m_MateriaDat;
+     xiv::exd::Exd& getMateriaDat()
+     {
+       return getSheet( m_MateriaDat, "Materia", xiv::exd::Language::none );
+     }
+     ExdSheet m_MiniGameRADat;
+     xiv::exd::Exd& getMiniGameRADat()
+     {
+       return getSheet( m_MiniGameRADat, "MiniGameRA", xiv::exd::Language::none );
+     }
+     ExdSheet m_MinionRaceDat;
+     xiv::exd::Exd& getMinionRaceDat()
+     {
+       return getSheet( m_MinionRaceDat, "MinionRace", xiv::exd::Language::en );
+     }
+     ExdSheet m_MinionRulesDat;
+     xiv::exd::Exd& getMinionRulesDat()
+     {
+       return getSheet( m_MinionRulesDat, "MinionRules", xiv::exd::Language::en );
+     }
+     ExdSheet m_MinionSkillTypeDat;
+     xiv::exd::Exd& getMinionSkillTypeDat()
+     {
+       return getSheet( m_MinionSkillTypeDat, "MinionSkillType", xiv::exd::Language::en );
+     }
+     ExdSheet m_MobHuntOrderTypeDat;
+     xiv::exd::Exd& getMobHuntOrderTypeDat()
+     {
+       return getSheet( m_MobHuntOrderTypeDat, "MobHuntOrderType", xiv::exd::Language::none );
+     }
+     ExdSheet m_MobHuntTargetDat;
+     xiv::exd::Exd& getMobHuntTargetDat()
+     {
+       return getSheet( m_MobHuntTargetDat, "MobHuntTarget", xiv::exd::Language::none );
+     }
+     ExdSheet m_ModelCharaDat;
+     xiv::exd::Exd& getModelCharaDat()
+     {
+       return getSheet( m_ModelCharaDat, "ModelChara", xiv::exd::Language::none );
+     }
+     ExdSheet m_ModelSkeletonDat;
+     xiv::exd::Exd& getModelSkeletonDat()
+     {
+       return getSheet( m_ModelSkeletonDat, "ModelSkeleton", xiv::exd::Language::none );
+     }
+     ExdSheet m_ModelStateDat;
+     xiv::exd::Exd& getModelStateDat()
+     {
+       return getSheet( m_ModelStateDat, "ModelState", xiv::exd::Language::none );
+     }
+     ExdSheet m_MonsterNoteDat;
+     xiv::exd::Exd& getMonsterNoteDat()
+     {
+       return getSheet( m_MonsterNoteDat, "MonsterNote", xiv::exd::Language::en );
+     }
+     ExdSheet m_MonsterNoteTargetDat;
+     xiv::exd::Exd& getMonsterNoteTargetDat()
+     {
+       return getSheet( m_MonsterNoteTargetDat, "MonsterNoteTarget", xiv::exd::Language::none );
+     }
+     ExdSheet m_MountDat;
+     xiv::exd::Exd& getMountDat()
+     {
+       return getSheet( m_MountDat, "Mount", xiv::exd::Language::en );
+     }
+     ExdSheet m_MountActionDat;
+     xiv::exd::Exd& getMountActionDat()
+     {
+       return getSheet( m_MountActionDat, "MountAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_MountCustomizeDat;
+     xiv::exd::Exd& getMountCustomizeDat()
+     {
+       return getSheet( m_MountCustomizeDat, "MountCustomize", xiv::exd::Language::none );
+     }
+     ExdSheet m_MountFlyingConditionDat;
+     xiv::exd::Exd& getMountFlyingConditionDat()
+     {
+       return getSheet( m_MountFlyingConditionDat, "MountFlyingCondition", xiv::exd::Language::none );
+     }
+     ExdSheet m_MountSpeedDat;
+     xiv::exd::Exd& getMountSpeedDat()
+     {
+       return getSheet( m_MountSpeedDat, "MountSpeed", xiv::exd::Language::none );
+     }
+     ExdSheet m_MountTransientDat;
+     xiv::exd::Exd& getMountTransientDat()
+     {
+       return getSheet( m_MountTransientDat, "MountTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_MoveTimelineDat;
+     xiv::exd::Exd& getMoveTimelineDat()
+     {
+       return getSheet( m_MoveTimelineDat, "MoveTimeline", xiv::exd::Language::none );
+     }
+     ExdSheet m_MoveVfxDat;
+     xiv::exd::Exd& getMoveVfxDat()
+     {
+       return getSheet( m_MoveVfxDat, "MoveVfx", xiv::exd::Language::none );
+     }
+     ExdSheet m_NotebookDivisionDat;
+     xiv::exd::Exd& getNotebookDivisionDat()
+     {
+       return getSheet( m_NotebookDivisionDat, "NotebookDivision", xiv::exd::Language::en );
+     }
+     ExdSheet m_NotebookDivisionCategoryDat;
+     xiv::exd::Exd& getNotebookDivisionCategoryDat()
+     {
+       return getSheet( m_NotebookDivisionCategoryDat, "NotebookDivisionCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_NpcEquipDat;
+     xiv::exd::Exd& getNpcEquipDat()
+     {
+       return getSheet( m_NpcEquipDat, "NpcEquip", xiv::exd::Language::none );
+     }
+     ExdSheet m_NpcYellDat;
+     xiv::exd::Exd& getNpcYellDat()
+     {
+       return getSheet( m_NpcYellDat, "NpcYell", xiv::exd::Language::en );
+     }
+     ExdSheet m_OmenDat;
+     xiv::exd::Exd& getOmenDat()
+     {
+       return getSheet( m_OmenDat, "Omen", xiv::exd::Language::none );
+     }
+     ExdSheet m_OnlineStatusDat;
+     xiv::exd::Exd& getOnlineStatusDat()
+     {
+       return getSheet( m_OnlineStatusDat, "OnlineStatus", xiv::exd::Language::en );
+     }
+     ExdSheet m_OpeningDat;
+     xiv::exd::Exd& getOpeningDat()
+     {
+       return getSheet( m_OpeningDat, "Opening", xiv::exd::Language::none );
+     }
+     ExdSheet m_OrchestrionDat;
+     xiv::exd::Exd& getOrchestrionDat()
+     {
+       return getSheet( m_OrchestrionDat, "Orchestrion", xiv::exd::Language::en );
+     }
+     ExdSheet m_OrchestrionCategoryDat;
+     xiv::exd::Exd& getOrchestrionCategoryDat()
+     {
+       return getSheet( m_OrchestrionCategoryDat, "OrchestrionCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_OrchestrionPathDat;
+     xiv::exd::Exd& getOrchestrionPathDat()
+     {
+       return getSheet( m_OrchestrionPathDat, "OrchestrionPath", xiv::exd::Language::none );
+     }
+     ExdSheet m_OrchestrionUiparamDat;
+     xiv::exd::Exd& getOrchestrionUiparamDat()
+     {
+       return getSheet( m_OrchestrionUiparamDat, "OrchestrionUiparam", xiv::exd::Language::none );
+     }
+     ExdSheet m_ParamGrowDat;
+     xiv::exd::Exd& getParamGrowDat()
+     {
+       return getSheet( m_ParamGrowDat, "ParamGrow", xiv::exd::Language::none );
+     }
+     ExdSheet m_PartyContentDat;
+     xiv::exd::Exd& getPartyContentDat()
+     {
+       return getSheet( m_PartyContentDat, "PartyContent", xiv::exd::Language::en );
+     }
+     ExdSheet m_PartyContentCutsceneDat;
+     xiv::exd::Exd& getPartyContentCutsceneDat()
+     {
+       return getSheet( m_PartyContentCutsceneDat, "PartyContentCutscene", xiv::exd::Language::none );
+     }
+     ExdSheet m_PartyContentTextDataDat;
+     xiv::exd::Exd& getPartyContentTextDataDat()
+     {
+       return getSheet( m_PartyContentTextDataDat, "PartyContentTextData", xiv::exd::Language::en );
+     }
+     ExdSheet m_PerformDat;
+     xiv::exd::Exd& getPerformDat()
+     {
+       return getSheet( m_PerformDat, "Perform", xiv::exd::Language::en );
+     }
+     ExdSheet m_PerformTransientDat;
+     xiv::exd::Exd& getPerformTransientDat()
+     {
+       return getSheet( m_PerformTransientDat, "PerformTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_PetDat;
+     xiv::exd::Exd& getPetDat()
+     {
+       return getSheet( m_PetDat, "Pet", xiv::exd::Language::en );
+     }
+     ExdSheet m_PetActionDat;
+     xiv::exd::Exd& getPetActionDat()
+     {
+       return getSheet( m_PetActionDat, "PetAction", xiv::exd::Language::en );
+     }
+     ExdSheet m_PictureDat;
+     xiv::exd::Exd& getPictureDat()
+     {
+       return getSheet( m_PictureDat, "Picture", xiv::exd::Language::none );
+     }
+     ExdSheet m_PlaceNameDat;
+     xiv::exd::Exd& getPlaceNameDat()
+     {
+       return getSheet( m_PlaceNameDat, "PlaceName", xiv::exd::Language::en );
+     }
+     ExdSheet m_PlantPotFlowerSeedDat;
+     xiv::exd::Exd& getPlantPotFlowerSeedDat()
+     {
+       return getSheet( m_PlantPotFlowerSeedDat, "PlantPotFlowerSeed", xiv::exd::Language::none );
+     }
+     ExdSheet m_PreHandlerDat;
+     xiv::exd::Exd& getPreHandlerDat()
+     {
+       return getSheet( m_PreHandlerDat, "PreHandler", xiv::exd::Language::none );
+     }
+     ExdSheet m_PublicContentDat;
+     xiv::exd::Exd& getPublicContentDat()
+     {
+       return getSheet( m_PublicContentDat, "PublicContent", xiv::exd::Language::en );
+     }
+     ExdSheet m_PublicContentCutsceneDat;
+     xiv::exd::Exd& getPublicContentCutsceneDat()
+     {
+       return getSheet( m_PublicContentCutsceneDat, "PublicContentCutscene", xiv::exd::Language::none );
+     }
+     ExdSheet m_PublicContentTextDataDat;
+     xiv::exd::Exd& getPublicContentTextDataDat()
+     {
+       return getSheet( m_PublicContentTextDataDat, "PublicContentTextData", xiv::exd::Language::en );
+     }
+     ExdSheet m_PvPActionDat;
+     xiv::exd::Exd& getPvPActionDat()
+     {
+       return getSheet( m_PvPActionDat, "PvPAction", xiv::exd::Language::none );
+     }
+     ExdSheet m_PvPActionSortDat;
+     xiv::exd::Exd& getPvPActionSortDat()
+     {
+       return getSheet( m_PvPActionSortDat, "PvPActionSort", xiv::exd::Language::none );
+     }
+     ExdSheet m_PvPRankDat;
+     xiv::exd::Exd& getPvPRankDat()
+     {
+       return getSheet( m_PvPRankDat, "PvPRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_PvPSelectTraitDat;
+     xiv::exd::Exd& getPvPSelectTraitDat()
+     {
+       return getSheet( m_PvPSelectTraitDat, "PvPSelectTrait", xiv::exd::Language::en );
+     }
+     ExdSheet m_PvPTraitDat;
+     xiv::exd::Exd& getPvPTraitDat()
+     {
+       return getSheet( m_PvPTraitDat, "PvPTrait", xiv::exd::Language::none );
+     }
+     ExdSheet m_QuestDat;
+     xiv::exd::Exd& getQuestDat()
+     {
+       return getSheet( m_QuestDat, "Quest", xiv::exd::Language::en );
+     }
+     ExdSheet m_QuestBattleDat;
+     xiv::exd::Exd& getQuestBattleDat()
+     {
+       return getSheet( m_QuestBattleDat, "QuestBattle", xiv::exd::Language::none );
+     }
+     ExdSheet m_QuestClassJobRewardDat;
+     xiv::exd::Exd& getQuestClassJobRewardDat()
+     {
+       return getSheet( m_QuestClassJobRewardDat, "QuestClassJobReward", xiv::exd::Language::none );
+     }
+     ExdSheet m_QuestClassJobSupplyDat;
+     xiv::exd::Exd& getQuestClassJobSupplyDat()
+     {
+       return getSheet( m_QuestClassJobSupplyDat, "QuestClassJobSupply", xiv::exd::Language::none );
+     }
+     ExdSheet m_QuestRepeatFlagDat;
+     xiv::exd::Exd& getQuestRepeatFlagDat()
+     {
+       return getSheet( m_QuestRepeatFlagDat, "QuestRepeatFlag", xiv::exd::Language::none );
+     }
+     ExdSheet m_QuestRewardOtherDat;
+     xiv::exd::Exd& getQuestRewardOtherDat()
+     {
+       return getSheet( m_QuestRewardOtherDat, "QuestRewardOther", xiv::exd::Language::en );
+     }
+     ExdSheet m_QuickChatDat;
+     xiv::exd::Exd& getQuickChatDat()
+     {
+       return getSheet( m_QuickChatDat, "QuickChat", xiv::exd::Language::en );
+     }
+     ExdSheet m_QuickChatTransientDat;
+     xiv::exd::Exd& getQuickChatTransientDat()
+     {
+       return getSheet( m_QuickChatTransientDat, "QuickChatTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_RaceDat;
+     xiv::exd::Exd& getRaceDat()
+     {
+       return getSheet( m_RaceDat, "Race", xiv::exd::Language::en );
+     }
+     ExdSheet m_RacingChocoboItemDat;
+     xiv::exd::Exd& getRacingChocoboItemDat()
+     {
+       return getSheet( m_RacingChocoboItemDat, "RacingChocoboItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_RacingChocoboNameDat;
+     xiv::exd::Exd& getRacingChocoboNameDat()
+     {
+       return getSheet( m_RacingChocoboNameDat, "RacingChocoboName", xiv::exd::Language::en );
+     }
+     ExdSheet m_RacingChocoboNameCategoryDat;
+     xiv::exd::Exd& getRacingChocoboNameCategoryDat()
+     {
+       return getSheet( m_RacingChocoboNameCategoryDat, "RacingChocoboNameCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_RacingChocoboNameInfoDat;
+     xiv::exd::Exd& getRacingChocoboNameInfoDat()
+     {
+       return getSheet( m_RacingChocoboNameInfoDat, "RacingChocoboNameInfo", xiv::exd::Language::none );
+     }
+     ExdSheet m_RacingChocoboParamDat;
+     xiv::exd::Exd& getRacingChocoboParamDat()
+     {
+       return getSheet( m_RacingChocoboParamDat, "RacingChocoboParam", xiv::exd::Language::en );
+     }
+     ExdSheet m_RecastNavimeshDat;
+     xiv::exd::Exd& getRecastNavimeshDat()
+     {
+       return getSheet( m_RecastNavimeshDat, "RecastNavimesh", xiv::exd::Language::none );
+     }
+     ExdSheet m_RecipeDat;
+     xiv::exd::Exd& getRecipeDat()
+     {
+       return getSheet( m_RecipeDat, "Recipe", xiv::exd::Language::none );
+     }
+     ExdSheet m_RecipeElementDat;
+     xiv::exd::Exd& getRecipeElementDat()
+     {
+       return getSheet( m_RecipeElementDat, "RecipeElement", xiv::exd::Language::en );
+     }
+     ExdSheet m_RecipeLevelTableDat;
+     xiv::exd::Exd& getRecipeLevelTableDat()
+     {
+       return getSheet( m_RecipeLevelTableDat, "RecipeLevelTable", xiv::exd::Language::none );
+     }
+     ExdSheet m_RecipeNotebookListDat;
+     xiv::exd::Exd& getRecipeNotebookListDat()
+     {
+       return getSheet( m_RecipeNotebookListDat, "RecipeNotebookList", xiv::exd::Language::none );
+     }
+     ExdSheet m_RecommendContentsDat;
+     xiv::exd::Exd& getRecommendContentsDat()
+     {
+       return getSheet( m_RecommendContentsDat, "RecommendContents", xiv::exd::Language::none );
+     }
+     ExdSheet m_RelicDat;
+     xiv::exd::Exd& getRelicDat()
+     {
+       return getSheet( m_RelicDat, "Relic", xiv::exd::Language::none );
+     }
+     ExdSheet m_Relic3Dat;
+     xiv::exd::Exd& getRelic3Dat()
+     {
+       return getSheet( m_Relic3Dat, "Relic3", xiv::exd::Language::none );
+     }
+     ExdSheet m_RelicItemDat;
+     xiv::exd::Exd& getRelicItemDat()
+     {
+       return getSheet( m_RelicItemDat, "RelicItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_RelicNoteDat;
+     xiv::exd::Exd& getRelicNoteDat()
+     {
+       return getSheet( m_RelicNoteDat, "RelicNote", xiv::exd::Language::none );
+     }
+     ExdSheet m_RelicNoteCategoryDat;
+     xiv::exd::Exd& getRelicNoteCategoryDat()
+     {
+       return getSheet( m_RelicNoteCategoryDat, "RelicNoteCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_ResidentDat;
+     xiv::exd::Exd& getResidentDat()
+     {
+       return getSheet( m_ResidentDat, "Resident", xiv::exd::Language::none );
+     }
+     ExdSheet m_RetainerTaskDat;
+     xiv::exd::Exd& getRetainerTaskDat()
+     {
+       return getSheet( m_RetainerTaskDat, "RetainerTask", xiv::exd::Language::none );
+     }
+     ExdSheet m_RetainerTaskLvRangeDat;
+     xiv::exd::Exd& getRetainerTaskLvRangeDat()
+     {
+       return getSheet( m_RetainerTaskLvRangeDat, "RetainerTaskLvRange", xiv::exd::Language::none );
+     }
+     ExdSheet m_RetainerTaskNormalDat;
+     xiv::exd::Exd& getRetainerTaskNormalDat()
+     {
+       return getSheet( m_RetainerTaskNormalDat, "RetainerTaskNormal", xiv::exd::Language::none );
+     }
+     ExdSheet m_RetainerTaskParameterDat;
+     xiv::exd::Exd& getRetainerTaskParameterDat()
+     {
+       return getSheet( m_RetainerTaskParameterDat, "RetainerTaskParameter", xiv::exd::Language::none );
+     }
+     ExdSheet m_RetainerTaskRandomDat;
+     xiv::exd::Exd& getRetainerTaskRandomDat()
+     {
+       return getSheet( m_RetainerTaskRandomDat, "RetainerTaskRandom", xiv::exd::Language::en );
+     }
+     ExdSheet m_RPParameterDat;
+     xiv::exd::Exd& getRPParameterDat()
+     {
+       return getSheet( m_RPParameterDat, "RPParameter", xiv::exd::Language::none );
+     }
+     ExdSheet m_SalvageDat;
+     xiv::exd::Exd& getSalvageDat()
+     {
+       return getSheet( m_SalvageDat, "Salvage", xiv::exd::Language::none );
+     }
+     ExdSheet m_SatisfactionNpcDat;
+     xiv::exd::Exd& getSatisfactionNpcDat()
+     {
+       return getSheet( m_SatisfactionNpcDat, "SatisfactionNpc", xiv::exd::Language::none );
+     }
+     ExdSheet m_SatisfactionSupplyDat;
+     xiv::exd::Exd& getSatisfactionSupplyDat()
+     {
+       return getSheet( m_SatisfactionSupplyDat, "SatisfactionSupply", xiv::exd::Language::none );
+     }
+     ExdSheet m_SatisfactionSupplyRewardDat;
+     xiv::exd::Exd& getSatisfactionSupplyRewardDat()
+     {
+       return getSheet( m_SatisfactionSupplyRewardDat, "SatisfactionSupplyReward", xiv::exd::Language::none );
+     }
+     ExdSheet m_ScenarioTreeDat;
+     xiv::exd::Exd& getScenarioTreeDat()
+     {
+       return getSheet( m_ScenarioTreeDat, "ScenarioTree", xiv::exd::Language::none );
+     }
+     ExdSheet m_ScenarioTreeTipsDat;
+     xiv::exd::Exd& getScenarioTreeTipsDat()
+     {
+       return getSheet( m_ScenarioTreeTipsDat, "ScenarioTreeTips", xiv::exd::Language::none );
+     }
+     ExdSheet m_ScenarioTreeTipsClassQuestDat;
+     xiv::exd::Exd& getScenarioTreeTipsClassQuestDat()
+     {
+       return getSheet( m_ScenarioTreeTipsClassQuestDat, "ScenarioTreeTipsClassQuest", xiv::exd::Language::none );
+     }
+     ExdSheet m_ScenarioTreeTipsQuestDat;
+     xiv::exd::Exd& getScenarioTreeTipsQuestDat()
+     {
+       return getSheet( m_ScenarioTreeTipsQuestDat, "ScenarioTreeTipsQuest", xiv::exd::Language::none );
+     }
+     ExdSheet m_ScenarioTypeDat;
+     xiv::exd::Exd& getScenarioTypeDat()
+     {
+       return getSheet( m_ScenarioTypeDat, "ScenarioType", xiv::exd::Language::en );
+     }
+     ExdSheet m_ScreenImageDat;
+     xiv::exd::Exd& getScreenImageDat()
+     {
+       return getSheet( m_ScreenImageDat, "ScreenImage", xiv::exd::Language::none );
+     }
+     ExdSheet m_SecretRecipeBookDat;
+     xiv::exd::Exd& getSecretRecipeBookDat()
+     {
+       return getSheet( m_SecretRecipeBookDat, "SecretRecipeBook", xiv::exd::Language::en );
+     }
+     ExdSheet m_SkyIsland2MissionDat;
+     xiv::exd::Exd& getSkyIsland2MissionDat()
+     {
+       return getSheet( m_SkyIsland2MissionDat, "SkyIsland2Mission", xiv::exd::Language::en );
+     }
+     ExdSheet m_SkyIsland2MissionDetailDat;
+     xiv::exd::Exd& getSkyIsland2MissionDetailDat()
+     {
+       return getSheet( m_SkyIsland2MissionDetailDat, "SkyIsland2MissionDetail", xiv::exd::Language::en );
+     }
+     ExdSheet m_SkyIsland2MissionTypeDat;
+     xiv::exd::Exd& getSkyIsland2MissionTypeDat()
+     {
+       return getSheet( m_SkyIsland2MissionTypeDat, "SkyIsland2MissionType", xiv::exd::Language::none );
+     }
+     ExdSheet m_SkyIsland2RangeTypeDat;
+     xiv::exd::Exd& getSkyIsland2RangeTypeDat()
+     {
+       return getSheet( m_SkyIsland2RangeTypeDat, "SkyIsland2RangeType", xiv::exd::Language::none );
+     }
+     ExdSheet m_SpearfishingItemDat;
+     xiv::exd::Exd& getSpearfishingItemDat()
+     {
+       return getSheet( m_SpearfishingItemDat, "SpearfishingItem", xiv::exd::Language::en );
+     }
+     ExdSheet m_SpearfishingNotebookDat;
+     xiv::exd::Exd& getSpearfishingNotebookDat()
+     {
+       return getSheet( m_SpearfishingNotebookDat, "SpearfishingNotebook", xiv::exd::Language::none );
+     }
+     ExdSheet m_SpearfishingRecordPageDat;
+     xiv::exd::Exd& getSpearfishingRecordPageDat()
+     {
+       return getSheet( m_SpearfishingRecordPageDat, "SpearfishingRecordPage", xiv::exd::Language::none );
+     }
+     ExdSheet m_SpecialShopDat;
+     xiv::exd::Exd& getSpecialShopDat()
+     {
+       return getSheet( m_SpecialShopDat, "SpecialShop", xiv::exd::Language::en );
+     }
+     ExdSheet m_SpecialShopItemCategoryDat;
+     xiv::exd::Exd& getSpecialShopItemCategoryDat()
+     {
+       return getSheet( m_SpecialShopItemCategoryDat, "SpecialShopItemCategory", xiv::exd::Language::en );
+     }
+     ExdSheet m_StainDat;
+     xiv::exd::Exd& getStainDat()
+     {
+       return getSheet( m_StainDat, "Stain", xiv::exd::Language::en );
+     }
+     ExdSheet m_StainTransientDat;
+     xiv::exd::Exd& getStainTransientDat()
+     {
+       return getSheet( m_StainTransientDat, "StainTransient", xiv::exd::Language::none );
+     }
+     ExdSheet m_StatusDat;
+     xiv::exd::Exd& getStatusDat()
+     {
+       return getSheet( m_StatusDat, "Status", xiv::exd::Language::en );
+     }
+     ExdSheet m_StatusHitEffectDat;
+     xiv::exd::Exd& getStatusHitEffectDat()
+     {
+       return getSheet( m_StatusHitEffectDat, "StatusHitEffect", xiv::exd::Language::none );
+     }
+     ExdSheet m_StatusLoopVFXDat;
+     xiv::exd::Exd& getStatusLoopVFXDat()
+     {
+       return getSheet( m_StatusLoopVFXDat, "StatusLoopVFX", xiv::exd::Language::none );
+     }
+     ExdSheet m_StoryDat;
+     xiv::exd::Exd& getStoryDat()
+     {
+       return getSheet( m_StoryDat, "Story", xiv::exd::Language::none );
+     }
+     ExdSheet m_SubmarineExplorationDat;
+     xiv::exd::Exd& getSubmarineExplorationDat()
+     {
+       return getSheet( m_SubmarineExplorationDat, "SubmarineExploration", xiv::exd::Language::en );
+     }
+     ExdSheet m_SubmarinePartDat;
+     xiv::exd::Exd& getSubmarinePartDat()
+     {
+       return getSheet( m_SubmarinePartDat, "SubmarinePart", xiv::exd::Language::none );
+     }
+     ExdSheet m_SubmarineRankDat;
+     xiv::exd::Exd& getSubmarineRankDat()
+     {
+       return getSheet( m_SubmarineRankDat, "SubmarineRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_SwitchTalkDat;
+     xiv::exd::Exd& getSwitchTalkDat()
+     {
+       return getSheet( m_SwitchTalkDat, "SwitchTalk", xiv::exd::Language::none );
+     }
+     ExdSheet m_TerritoryTypeDat;
+     xiv::exd::Exd& getTerritoryTypeDat()
+     {
+       return getSheet( m_TerritoryTypeDat, "TerritoryType", xiv::exd::Language::none );
+     }
+     ExdSheet m_TextCommandDat;
+     xiv::exd::Exd& getTextCommandDat()
+     {
+       return getSheet( m_TextCommandDat, "TextCommand", xiv::exd::Language::en );
+     }
+     ExdSheet m_TitleDat;
+     xiv::exd::Exd& getTitleDat()
+     {
+       return getSheet( m_TitleDat, "Title", xiv::exd::Language::en );
+     }
+     ExdSheet m_TomestonesDat;
+     xiv::exd::Exd& getTomestonesDat()
+     {
+       return getSheet( m_TomestonesDat, "Tomestones", xiv::exd::Language::none );
+     }
+     ExdSheet m_TomestonesItemDat;
+     xiv::exd::Exd& getTomestonesItemDat()
+     {
+       return getSheet( m_TomestonesItemDat, "TomestonesItem", xiv::exd::Language::none );
+     }
+     ExdSheet m_TopicSelectDat;
+     xiv::exd::Exd& getTopicSelectDat()
+     {
+       return getSheet( m_TopicSelectDat, "TopicSelect", xiv::exd::Language::en );
+     }
+     ExdSheet m_TownDat;
+     xiv::exd::Exd& getTownDat()
+     {
+       return getSheet( m_TownDat, "Town", xiv::exd::Language::en );
+     }
+     ExdSheet m_TraitDat;
+     xiv::exd::Exd& getTraitDat()
+     {
+       return getSheet( m_TraitDat, "Trait", xiv::exd::Language::en );
+     }
+     ExdSheet m_TraitRecastDat;
+     xiv::exd::Exd& getTraitRecastDat()
+     {
+       return getSheet( m_TraitRecastDat, "TraitRecast", xiv::exd::Language::none );
+     }
+     ExdSheet m_TraitTransientDat;
+     xiv::exd::Exd& getTraitTransientDat()
+     {
+       return getSheet( m_TraitTransientDat, "TraitTransient", xiv::exd::Language::en );
+     }
+     ExdSheet m_TransformationDat;
+     xiv::exd::Exd& getTransformationDat()
+     {
+       return getSheet( m_TransformationDat, "Transformation", xiv::exd::Language::none );
+     }
+     ExdSheet m_TreasureDat;
+     xiv::exd::Exd& getTreasureDat()
+     {
+       return getSheet( m_TreasureDat, "Treasure", xiv::exd::Language::en );
+     }
+     ExdSheet m_TreasureHuntRankDat;
+     xiv::exd::Exd& getTreasureHuntRankDat()
+     {
+       return getSheet( m_TreasureHuntRankDat, "TreasureHuntRank", xiv::exd::Language::none );
+     }
+     ExdSheet m_TreasureSpotDat;
+     xiv::exd::Exd& getTreasureSpotDat()
+     {
+       return getSheet( m_TreasureSpotDat, "TreasureSpot", xiv::exd::Language::none );
+     }
+     ExdSheet m_TribeDat;
+     xiv::exd::Exd& getTribeDat()
+     {
+       return getSheet( m_TribeDat, "Tribe", xiv::exd::Language::en );
+     }
+     ExdSheet m_TripleTriadDat;
+     xiv::exd::Exd& getTripleTriadDat()
+     {
+       return getSheet( m_TripleTriadDat, "TripleTriad", xiv::exd::Language::none );
+     }
+     ExdSheet m_TripleTriadCardDat;
+     xiv::exd::Exd& getTripleTriadCardDat()
+     {
+       return getSheet( m_TripleTriadCardDat, "TripleTriadCard", xiv::exd::Language::en );
+     }
+     ExdSheet m_TripleTriadCardRarityDat;
+     xiv::exd::Exd& getTripleTriadCardRarityDat()
+     {
+       return getSheet( m_TripleTriadCardRarityDat, "TripleTriadCardRarity", xiv::exd::Language::none );
+     }
+     ExdSheet m_TripleTriadCardResidentDat;
+     xiv::exd::Exd& getTripleTriadCardResidentDat()
+     {
+       return getSheet( m_TripleTriadCardResidentDat, "TripleTriadCardResident", xiv::exd::Language::none );
+     }
+     ExdSheet m_TripleTriadCardTypeDat;
+     xiv::exd::Exd& getTripleTriadCardTypeDat()
+     {
+       return getSheet( m_TripleTriadCardTypeDat, "TripleTriadCardType", xiv::exd::Language::en );
+     }
+     ExdSheet m_TripleTriadCompetitionDat;
+     xiv::exd::Exd& getTripleTriadCompetitionDat()
+     {
+       return getSheet( m_TripleTriadCompetitionDat, "TripleTriadCompetition", xiv::exd::Language::en );
+     }
+     ExdSheet m_TripleTriadRuleDat;
+     xiv::exd::Exd& getTripleTriadRuleDat()
+     {
+       return getSheet( m_TripleTriadRuleDat, "TripleTriadRule", xiv::exd::Language::en );
+     }
+     ExdSheet m_TutorialDat;
+     xiv::exd::Exd& getTutorialDat()
+     {
+       return getSheet( m_TutorialDat, "Tutorial", xiv::exd::Language::none );
+     }
+     ExdSheet m_TutorialDPSDat;
+     xiv::exd::Exd& getTutorialDPSDat()
+     {
+       return getSheet( m_TutorialDPSDat, "TutorialDPS", xiv::exd::Language::none );
+     }
+     ExdSheet m_TutorialHealerDat;
+     xiv::exd::Exd& getTutorialHealerDat()
+     {
+       return getSheet( m_TutorialHealerDat, "TutorialHealer", xiv::exd::Language::none );
+     }
+     ExdSheet m_TutorialTankDat;
+     xiv::exd::Exd& getTutorialTankDat()
+     {
+       return getSheet( m_TutorialTankDat, "TutorialTank", xiv::exd::Language::none );
+     }
+     ExdSheet m_UIColorDat;
+     xiv::exd::Exd& getUIColorDat()
+     {
+       return getSheet( m_UIColorDat, "UIColor", xiv::exd::Language::none );
+     }
+     ExdSheet m_VaseFlowerDat;
+     xiv::exd::Exd& getVaseFlowerDat()
+     {
+       return getSheet( m_VaseFlowerDat, "VaseFlower", xiv::exd::Language::none );
+     }
+     ExdSheet m_VFXDat;
+     xiv::exd::Exd& getVFXDat()
+     {
+       return getSheet( m_VFXDat, "VFX", xiv::exd::Language::none );
+     }
+     ExdSheet m_WarpDat;
+     xiv::exd::Exd& getWarpDat()
+     {
+       return getSheet( m_WarpDat, "Warp", xiv::exd::Language::en );
+     }
+     ExdSheet m_WarpConditionDat;
+     xiv::exd::Exd& getWarpConditionDat()
+     {
+       return getSheet( m_WarpConditionDat, "WarpCondition", xiv::exd::Language::none );
+     }
+     ExdSheet m_WarpLogicDat;
+     xiv::exd::Exd& getWarpLogicDat()
+     {
+       return getSheet( m_WarpLogicDat, "WarpLogic", xiv::exd::Language::en );
+     }
+     ExdSheet m_WeatherDat;
+     xiv::exd::Exd& getWeatherDat()
+     {
+       return getSheet( m_WeatherDat, "Weather", xiv::exd::Language::en );
+     }
+     ExdSheet m_WeatherGroupDat;
+     xiv::exd::Exd& getWeatherGroupDat()
+     {
+       return getSheet( m_WeatherGroupDat, "WeatherGroup", xiv::exd::Language::none );
+     }
+     ExdSheet m_WeatherRateDat;
+     xiv::exd::Exd& getWeatherRateDat()
+     {
+       return getSheet( m_WeatherRateDat, "WeatherRate", xiv::exd::Language::none );
+     }
+     ExdSheet m_WeatherReportReplaceDat;
+     xiv::exd::Exd& getWeatherReportReplaceDat()
+     {
+       return getSheet( m_WeatherReportReplaceDat, "WeatherReportReplace", xiv::exd::Language::none );
+     }
+     ExdSheet m_WeddingBGMDat;
+     xiv::exd::Exd& getWeddingBGMDat()
+     {
+       return getSheet( m_WeddingBGMDat, "WeddingBGM", xiv::exd::Language::en );
+     }
+     ExdSheet m_WeeklyBingoOrderDataDat;
+     xiv::exd::Exd& getWeeklyBingoOrderDataDat()
+     {
+       return getSheet( m_WeeklyBingoOrderDataDat, "WeeklyBingoOrderData", xiv::exd::Language::none );
+     }
+     ExdSheet m_WeeklyBingoRewardDataDat;
+     xiv::exd::Exd& getWeeklyBingoRewardDataDat()
+     {
+       return getSheet( m_WeeklyBingoRewardDataDat, "WeeklyBingoRewardData", xiv::exd::Language::none );
+     }
+     ExdSheet m_WeeklyBingoTextDat;
+     xiv::exd::Exd& getWeeklyBingoTextDat()
+     {
+       return getSheet( m_WeeklyBingoTextDat, "WeeklyBingoText", xiv::exd::Language::en );
+     }
+     ExdSheet m_WeeklyLotBonusDat;
+     xiv::exd::Exd& getWeeklyLotBonusDat()
+     {
+       return getSheet( m_WeeklyLotBonusDat, "WeeklyLotBonus", xiv::exd::Language::none );
+     }
+     ExdSheet m_WorldDat;
+     xiv::exd::Exd& getWorldDat()
+     {
+       return getSheet( m_WorldDat, "World", xiv::exd::Language::none );
+     }
+     ExdSheet m_WorldDCGroupTypeDat;
+     xiv::exd::Exd& getWorldDCGroupTypeDat()
+     {
+       return getSheet( m_WorldDCGroupTypeDat, "WorldDCGroupType", xiv::exd::Language::none );
+     }
+     ExdSheet m_YKWDat;
+     xiv::exd::Exd& getYKWDat()
+     {
+       return getSheet( m_YKWDat, "YKW", xiv::exd::Language::en );
+     }
+     ExdSheet m_ZoneSharedGroupDat;
+     xiv::exd::Exd& getZoneSharedGroupDat()
+     {
+       return getSheet( m_ZoneSharedGroupDat, "ZoneSharedGroup", xiv::exd::Language::none );
+     }
 
 
      using AchievementPtr = std::shared_ptr< Achievement >;
@@ -7049,2869 +9034,2869 @@ struct ZoneSharedGroup
 const std::set< uint32_t >& getAchievementIdList()
 {
    if( m_AchievementIdList.size() == 0 )
-      loadIdList( m_AchievementDat, m_AchievementIdList );
+      loadIdList( getAchievementDat(), m_AchievementIdList );
    return m_AchievementIdList;
 }
 const std::set< uint32_t >& getAchievementCategoryIdList()
 {
    if( m_AchievementCategoryIdList.size() == 0 )
-      loadIdList( m_AchievementCategoryDat, m_AchievementCategoryIdList );
+      loadIdList( getAchievementCategoryDat(), m_AchievementCategoryIdList );
    return m_AchievementCategoryIdList;
 }
 const std::set< uint32_t >& getAchievementKindIdList()
 {
    if( m_AchievementKindIdList.size() == 0 )
-      loadIdList( m_AchievementKindDat, m_AchievementKindIdList );
+      loadIdList( getAchievementKindDat(), m_AchievementKindIdList );
    return m_AchievementKindIdList;
 }
 const std::set< uint32_t >& getActionIdList()
 {
    if( m_ActionIdList.size() == 0 )
-      loadIdList( m_ActionDat, m_ActionIdList );
+      loadIdList( getActionDat(), m_ActionIdList );
    return m_ActionIdList;
 }
 const std::set< uint32_t >& getActionCastTimelineIdList()
 {
    if( m_ActionCastTimelineIdList.size() == 0 )
-      loadIdList( m_ActionCastTimelineDat, m_ActionCastTimelineIdList );
+      loadIdList( getActionCastTimelineDat(), m_ActionCastTimelineIdList );
    return m_ActionCastTimelineIdList;
 }
 const std::set< uint32_t >& getActionCastVFXIdList()
 {
    if( m_ActionCastVFXIdList.size() == 0 )
-      loadIdList( m_ActionCastVFXDat, m_ActionCastVFXIdList );
+      loadIdList( getActionCastVFXDat(), m_ActionCastVFXIdList );
    return m_ActionCastVFXIdList;
 }
 const std::set< uint32_t >& getActionCategoryIdList()
 {
    if( m_ActionCategoryIdList.size() == 0 )
-      loadIdList( m_ActionCategoryDat, m_ActionCategoryIdList );
+      loadIdList( getActionCategoryDat(), m_ActionCategoryIdList );
    return m_ActionCategoryIdList;
 }
 const std::set< uint32_t >& getActionComboRouteIdList()
 {
    if( m_ActionComboRouteIdList.size() == 0 )
-      loadIdList( m_ActionComboRouteDat, m_ActionComboRouteIdList );
+      loadIdList( getActionComboRouteDat(), m_ActionComboRouteIdList );
    return m_ActionComboRouteIdList;
 }
 const std::set< uint32_t >& getActionIndirectionIdList()
 {
    if( m_ActionIndirectionIdList.size() == 0 )
-      loadIdList( m_ActionIndirectionDat, m_ActionIndirectionIdList );
+      loadIdList( getActionIndirectionDat(), m_ActionIndirectionIdList );
    return m_ActionIndirectionIdList;
 }
 const std::set< uint32_t >& getActionParamIdList()
 {
    if( m_ActionParamIdList.size() == 0 )
-      loadIdList( m_ActionParamDat, m_ActionParamIdList );
+      loadIdList( getActionParamDat(), m_ActionParamIdList );
    return m_ActionParamIdList;
 }
 const std::set< uint32_t >& getActionProcStatusIdList()
 {
    if( m_ActionProcStatusIdList.size() == 0 )
-      loadIdList( m_ActionProcStatusDat, m_ActionProcStatusIdList );
+      loadIdList( getActionProcStatusDat(), m_ActionProcStatusIdList );
    return m_ActionProcStatusIdList;
 }
 const std::set< uint32_t >& getActionTimelineIdList()
 {
    if( m_ActionTimelineIdList.size() == 0 )
-      loadIdList( m_ActionTimelineDat, m_ActionTimelineIdList );
+      loadIdList( getActionTimelineDat(), m_ActionTimelineIdList );
    return m_ActionTimelineIdList;
 }
 const std::set< uint32_t >& getActionTimelineMoveIdList()
 {
    if( m_ActionTimelineMoveIdList.size() == 0 )
-      loadIdList( m_ActionTimelineMoveDat, m_ActionTimelineMoveIdList );
+      loadIdList( getActionTimelineMoveDat(), m_ActionTimelineMoveIdList );
    return m_ActionTimelineMoveIdList;
 }
 const std::set< uint32_t >& getActionTimelineReplaceIdList()
 {
    if( m_ActionTimelineReplaceIdList.size() == 0 )
-      loadIdList( m_ActionTimelineReplaceDat, m_ActionTimelineReplaceIdList );
+      loadIdList( getActionTimelineReplaceDat(), m_ActionTimelineReplaceIdList );
    return m_ActionTimelineReplaceIdList;
 }
 const std::set< uint32_t >& getActionTransientIdList()
 {
    if( m_ActionTransientIdList.size() == 0 )
-      loadIdList( m_ActionTransientDat, m_ActionTransientIdList );
+      loadIdList( getActionTransientDat(), m_ActionTransientIdList );
    return m_ActionTransientIdList;
 }
 const std::set< uint32_t >& getActivityFeedButtonsIdList()
 {
    if( m_ActivityFeedButtonsIdList.size() == 0 )
-      loadIdList( m_ActivityFeedButtonsDat, m_ActivityFeedButtonsIdList );
+      loadIdList( getActivityFeedButtonsDat(), m_ActivityFeedButtonsIdList );
    return m_ActivityFeedButtonsIdList;
 }
 const std::set< uint32_t >& getActivityFeedCaptionsIdList()
 {
    if( m_ActivityFeedCaptionsIdList.size() == 0 )
-      loadIdList( m_ActivityFeedCaptionsDat, m_ActivityFeedCaptionsIdList );
+      loadIdList( getActivityFeedCaptionsDat(), m_ActivityFeedCaptionsIdList );
    return m_ActivityFeedCaptionsIdList;
 }
 const std::set< uint32_t >& getActivityFeedGroupCaptionsIdList()
 {
    if( m_ActivityFeedGroupCaptionsIdList.size() == 0 )
-      loadIdList( m_ActivityFeedGroupCaptionsDat, m_ActivityFeedGroupCaptionsIdList );
+      loadIdList( getActivityFeedGroupCaptionsDat(), m_ActivityFeedGroupCaptionsIdList );
    return m_ActivityFeedGroupCaptionsIdList;
 }
 const std::set< uint32_t >& getActivityFeedImagesIdList()
 {
    if( m_ActivityFeedImagesIdList.size() == 0 )
-      loadIdList( m_ActivityFeedImagesDat, m_ActivityFeedImagesIdList );
+      loadIdList( getActivityFeedImagesDat(), m_ActivityFeedImagesIdList );
    return m_ActivityFeedImagesIdList;
 }
 const std::set< uint32_t >& getAddonIdList()
 {
    if( m_AddonIdList.size() == 0 )
-      loadIdList( m_AddonDat, m_AddonIdList );
+      loadIdList( getAddonDat(), m_AddonIdList );
    return m_AddonIdList;
 }
 const std::set< uint32_t >& getAddonHudIdList()
 {
    if( m_AddonHudIdList.size() == 0 )
-      loadIdList( m_AddonHudDat, m_AddonHudIdList );
+      loadIdList( getAddonHudDat(), m_AddonHudIdList );
    return m_AddonHudIdList;
 }
 const std::set< uint32_t >& getAdventureIdList()
 {
    if( m_AdventureIdList.size() == 0 )
-      loadIdList( m_AdventureDat, m_AdventureIdList );
+      loadIdList( getAdventureDat(), m_AdventureIdList );
    return m_AdventureIdList;
 }
 const std::set< uint32_t >& getAdventureExPhaseIdList()
 {
    if( m_AdventureExPhaseIdList.size() == 0 )
-      loadIdList( m_AdventureExPhaseDat, m_AdventureExPhaseIdList );
+      loadIdList( getAdventureExPhaseDat(), m_AdventureExPhaseIdList );
    return m_AdventureExPhaseIdList;
 }
 const std::set< uint32_t >& getAetherCurrentIdList()
 {
    if( m_AetherCurrentIdList.size() == 0 )
-      loadIdList( m_AetherCurrentDat, m_AetherCurrentIdList );
+      loadIdList( getAetherCurrentDat(), m_AetherCurrentIdList );
    return m_AetherCurrentIdList;
 }
 const std::set< uint32_t >& getAetherCurrentCompFlgSetIdList()
 {
    if( m_AetherCurrentCompFlgSetIdList.size() == 0 )
-      loadIdList( m_AetherCurrentCompFlgSetDat, m_AetherCurrentCompFlgSetIdList );
+      loadIdList( getAetherCurrentCompFlgSetDat(), m_AetherCurrentCompFlgSetIdList );
    return m_AetherCurrentCompFlgSetIdList;
 }
 const std::set< uint32_t >& getAetherialWheelIdList()
 {
    if( m_AetherialWheelIdList.size() == 0 )
-      loadIdList( m_AetherialWheelDat, m_AetherialWheelIdList );
+      loadIdList( getAetherialWheelDat(), m_AetherialWheelIdList );
    return m_AetherialWheelIdList;
 }
 const std::set< uint32_t >& getAetheryteIdList()
 {
    if( m_AetheryteIdList.size() == 0 )
-      loadIdList( m_AetheryteDat, m_AetheryteIdList );
+      loadIdList( getAetheryteDat(), m_AetheryteIdList );
    return m_AetheryteIdList;
 }
 const std::set< uint32_t >& getAetheryteSystemDefineIdList()
 {
    if( m_AetheryteSystemDefineIdList.size() == 0 )
-      loadIdList( m_AetheryteSystemDefineDat, m_AetheryteSystemDefineIdList );
+      loadIdList( getAetheryteSystemDefineDat(), m_AetheryteSystemDefineIdList );
    return m_AetheryteSystemDefineIdList;
 }
 const std::set< uint32_t >& getAirshipExplorationLevelIdList()
 {
    if( m_AirshipExplorationLevelIdList.size() == 0 )
-      loadIdList( m_AirshipExplorationLevelDat, m_AirshipExplorationLevelIdList );
+      loadIdList( getAirshipExplorationLevelDat(), m_AirshipExplorationLevelIdList );
    return m_AirshipExplorationLevelIdList;
 }
 const std::set< uint32_t >& getAirshipExplorationLogIdList()
 {
    if( m_AirshipExplorationLogIdList.size() == 0 )
-      loadIdList( m_AirshipExplorationLogDat, m_AirshipExplorationLogIdList );
+      loadIdList( getAirshipExplorationLogDat(), m_AirshipExplorationLogIdList );
    return m_AirshipExplorationLogIdList;
 }
 const std::set< uint32_t >& getAirshipExplorationParamTypeIdList()
 {
    if( m_AirshipExplorationParamTypeIdList.size() == 0 )
-      loadIdList( m_AirshipExplorationParamTypeDat, m_AirshipExplorationParamTypeIdList );
+      loadIdList( getAirshipExplorationParamTypeDat(), m_AirshipExplorationParamTypeIdList );
    return m_AirshipExplorationParamTypeIdList;
 }
 const std::set< uint32_t >& getAirshipExplorationPartIdList()
 {
    if( m_AirshipExplorationPartIdList.size() == 0 )
-      loadIdList( m_AirshipExplorationPartDat, m_AirshipExplorationPartIdList );
+      loadIdList( getAirshipExplorationPartDat(), m_AirshipExplorationPartIdList );
    return m_AirshipExplorationPartIdList;
 }
 const std::set< uint32_t >& getAirshipExplorationPointIdList()
 {
    if( m_AirshipExplorationPointIdList.size() == 0 )
-      loadIdList( m_AirshipExplorationPointDat, m_AirshipExplorationPointIdList );
+      loadIdList( getAirshipExplorationPointDat(), m_AirshipExplorationPointIdList );
    return m_AirshipExplorationPointIdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5IdList()
 {
    if( m_AnimaWeapon5IdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5Dat, m_AnimaWeapon5IdList );
+      loadIdList( getAnimaWeapon5Dat(), m_AnimaWeapon5IdList );
    return m_AnimaWeapon5IdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5ParamIdList()
 {
    if( m_AnimaWeapon5ParamIdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5ParamDat, m_AnimaWeapon5ParamIdList );
+      loadIdList( getAnimaWeapon5ParamDat(), m_AnimaWeapon5ParamIdList );
    return m_AnimaWeapon5ParamIdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5PatternGroupIdList()
 {
    if( m_AnimaWeapon5PatternGroupIdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5PatternGroupDat, m_AnimaWeapon5PatternGroupIdList );
+      loadIdList( getAnimaWeapon5PatternGroupDat(), m_AnimaWeapon5PatternGroupIdList );
    return m_AnimaWeapon5PatternGroupIdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5SpiritTalkIdList()
 {
    if( m_AnimaWeapon5SpiritTalkIdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5SpiritTalkDat, m_AnimaWeapon5SpiritTalkIdList );
+      loadIdList( getAnimaWeapon5SpiritTalkDat(), m_AnimaWeapon5SpiritTalkIdList );
    return m_AnimaWeapon5SpiritTalkIdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5SpiritTalkParamIdList()
 {
    if( m_AnimaWeapon5SpiritTalkParamIdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5SpiritTalkParamDat, m_AnimaWeapon5SpiritTalkParamIdList );
+      loadIdList( getAnimaWeapon5SpiritTalkParamDat(), m_AnimaWeapon5SpiritTalkParamIdList );
    return m_AnimaWeapon5SpiritTalkParamIdList;
 }
 const std::set< uint32_t >& getAnimaWeapon5TradeItemIdList()
 {
    if( m_AnimaWeapon5TradeItemIdList.size() == 0 )
-      loadIdList( m_AnimaWeapon5TradeItemDat, m_AnimaWeapon5TradeItemIdList );
+      loadIdList( getAnimaWeapon5TradeItemDat(), m_AnimaWeapon5TradeItemIdList );
    return m_AnimaWeapon5TradeItemIdList;
 }
 const std::set< uint32_t >& getAnimaWeaponFUITalkIdList()
 {
    if( m_AnimaWeaponFUITalkIdList.size() == 0 )
-      loadIdList( m_AnimaWeaponFUITalkDat, m_AnimaWeaponFUITalkIdList );
+      loadIdList( getAnimaWeaponFUITalkDat(), m_AnimaWeaponFUITalkIdList );
    return m_AnimaWeaponFUITalkIdList;
 }
 const std::set< uint32_t >& getAnimaWeaponFUITalkParamIdList()
 {
    if( m_AnimaWeaponFUITalkParamIdList.size() == 0 )
-      loadIdList( m_AnimaWeaponFUITalkParamDat, m_AnimaWeaponFUITalkParamIdList );
+      loadIdList( getAnimaWeaponFUITalkParamDat(), m_AnimaWeaponFUITalkParamIdList );
    return m_AnimaWeaponFUITalkParamIdList;
 }
 const std::set< uint32_t >& getAnimaWeaponIconIdList()
 {
    if( m_AnimaWeaponIconIdList.size() == 0 )
-      loadIdList( m_AnimaWeaponIconDat, m_AnimaWeaponIconIdList );
+      loadIdList( getAnimaWeaponIconDat(), m_AnimaWeaponIconIdList );
    return m_AnimaWeaponIconIdList;
 }
 const std::set< uint32_t >& getAnimaWeaponItemIdList()
 {
    if( m_AnimaWeaponItemIdList.size() == 0 )
-      loadIdList( m_AnimaWeaponItemDat, m_AnimaWeaponItemIdList );
+      loadIdList( getAnimaWeaponItemDat(), m_AnimaWeaponItemIdList );
    return m_AnimaWeaponItemIdList;
 }
 const std::set< uint32_t >& getAozActionIdList()
 {
    if( m_AozActionIdList.size() == 0 )
-      loadIdList( m_AozActionDat, m_AozActionIdList );
+      loadIdList( getAozActionDat(), m_AozActionIdList );
    return m_AozActionIdList;
 }
 const std::set< uint32_t >& getAozActionTransientIdList()
 {
    if( m_AozActionTransientIdList.size() == 0 )
-      loadIdList( m_AozActionTransientDat, m_AozActionTransientIdList );
+      loadIdList( getAozActionTransientDat(), m_AozActionTransientIdList );
    return m_AozActionTransientIdList;
 }
 const std::set< uint32_t >& getAOZArrangementIdList()
 {
    if( m_AOZArrangementIdList.size() == 0 )
-      loadIdList( m_AOZArrangementDat, m_AOZArrangementIdList );
+      loadIdList( getAOZArrangementDat(), m_AOZArrangementIdList );
    return m_AOZArrangementIdList;
 }
 const std::set< uint32_t >& getAOZBossIdList()
 {
    if( m_AOZBossIdList.size() == 0 )
-      loadIdList( m_AOZBossDat, m_AOZBossIdList );
+      loadIdList( getAOZBossDat(), m_AOZBossIdList );
    return m_AOZBossIdList;
 }
 const std::set< uint32_t >& getAOZContentIdList()
 {
    if( m_AOZContentIdList.size() == 0 )
-      loadIdList( m_AOZContentDat, m_AOZContentIdList );
+      loadIdList( getAOZContentDat(), m_AOZContentIdList );
    return m_AOZContentIdList;
 }
 const std::set< uint32_t >& getAOZContentBriefingBNpcIdList()
 {
    if( m_AOZContentBriefingBNpcIdList.size() == 0 )
-      loadIdList( m_AOZContentBriefingBNpcDat, m_AOZContentBriefingBNpcIdList );
+      loadIdList( getAOZContentBriefingBNpcDat(), m_AOZContentBriefingBNpcIdList );
    return m_AOZContentBriefingBNpcIdList;
 }
 const std::set< uint32_t >& getAquariumFishIdList()
 {
    if( m_AquariumFishIdList.size() == 0 )
-      loadIdList( m_AquariumFishDat, m_AquariumFishIdList );
+      loadIdList( getAquariumFishDat(), m_AquariumFishIdList );
    return m_AquariumFishIdList;
 }
 const std::set< uint32_t >& getAquariumWaterIdList()
 {
    if( m_AquariumWaterIdList.size() == 0 )
-      loadIdList( m_AquariumWaterDat, m_AquariumWaterIdList );
+      loadIdList( getAquariumWaterDat(), m_AquariumWaterIdList );
    return m_AquariumWaterIdList;
 }
 const std::set< uint32_t >& getArrayEventHandlerIdList()
 {
    if( m_ArrayEventHandlerIdList.size() == 0 )
-      loadIdList( m_ArrayEventHandlerDat, m_ArrayEventHandlerIdList );
+      loadIdList( getArrayEventHandlerDat(), m_ArrayEventHandlerIdList );
    return m_ArrayEventHandlerIdList;
 }
 const std::set< uint32_t >& getAttackTypeIdList()
 {
    if( m_AttackTypeIdList.size() == 0 )
-      loadIdList( m_AttackTypeDat, m_AttackTypeIdList );
+      loadIdList( getAttackTypeDat(), m_AttackTypeIdList );
    return m_AttackTypeIdList;
 }
 const std::set< uint32_t >& getBacklightColorIdList()
 {
    if( m_BacklightColorIdList.size() == 0 )
-      loadIdList( m_BacklightColorDat, m_BacklightColorIdList );
+      loadIdList( getBacklightColorDat(), m_BacklightColorIdList );
    return m_BacklightColorIdList;
 }
 const std::set< uint32_t >& getBalloonIdList()
 {
    if( m_BalloonIdList.size() == 0 )
-      loadIdList( m_BalloonDat, m_BalloonIdList );
+      loadIdList( getBalloonDat(), m_BalloonIdList );
    return m_BalloonIdList;
 }
 const std::set< uint32_t >& getBaseParamIdList()
 {
    if( m_BaseParamIdList.size() == 0 )
-      loadIdList( m_BaseParamDat, m_BaseParamIdList );
+      loadIdList( getBaseParamDat(), m_BaseParamIdList );
    return m_BaseParamIdList;
 }
 const std::set< uint32_t >& getBattleLeveIdList()
 {
    if( m_BattleLeveIdList.size() == 0 )
-      loadIdList( m_BattleLeveDat, m_BattleLeveIdList );
+      loadIdList( getBattleLeveDat(), m_BattleLeveIdList );
    return m_BattleLeveIdList;
 }
 const std::set< uint32_t >& getBeastRankBonusIdList()
 {
    if( m_BeastRankBonusIdList.size() == 0 )
-      loadIdList( m_BeastRankBonusDat, m_BeastRankBonusIdList );
+      loadIdList( getBeastRankBonusDat(), m_BeastRankBonusIdList );
    return m_BeastRankBonusIdList;
 }
 const std::set< uint32_t >& getBeastReputationRankIdList()
 {
    if( m_BeastReputationRankIdList.size() == 0 )
-      loadIdList( m_BeastReputationRankDat, m_BeastReputationRankIdList );
+      loadIdList( getBeastReputationRankDat(), m_BeastReputationRankIdList );
    return m_BeastReputationRankIdList;
 }
 const std::set< uint32_t >& getBeastTribeIdList()
 {
    if( m_BeastTribeIdList.size() == 0 )
-      loadIdList( m_BeastTribeDat, m_BeastTribeIdList );
+      loadIdList( getBeastTribeDat(), m_BeastTribeIdList );
    return m_BeastTribeIdList;
 }
 const std::set< uint32_t >& getBehaviorIdList()
 {
    if( m_BehaviorIdList.size() == 0 )
-      loadIdList( m_BehaviorDat, m_BehaviorIdList );
+      loadIdList( getBehaviorDat(), m_BehaviorIdList );
    return m_BehaviorIdList;
 }
 const std::set< uint32_t >& getBGMIdList()
 {
    if( m_BGMIdList.size() == 0 )
-      loadIdList( m_BGMDat, m_BGMIdList );
+      loadIdList( getBGMDat(), m_BGMIdList );
    return m_BGMIdList;
 }
 const std::set< uint32_t >& getBGMFadeIdList()
 {
    if( m_BGMFadeIdList.size() == 0 )
-      loadIdList( m_BGMFadeDat, m_BGMFadeIdList );
+      loadIdList( getBGMFadeDat(), m_BGMFadeIdList );
    return m_BGMFadeIdList;
 }
 const std::set< uint32_t >& getBGMSituationIdList()
 {
    if( m_BGMSituationIdList.size() == 0 )
-      loadIdList( m_BGMSituationDat, m_BGMSituationIdList );
+      loadIdList( getBGMSituationDat(), m_BGMSituationIdList );
    return m_BGMSituationIdList;
 }
 const std::set< uint32_t >& getBGMSwitchIdList()
 {
    if( m_BGMSwitchIdList.size() == 0 )
-      loadIdList( m_BGMSwitchDat, m_BGMSwitchIdList );
+      loadIdList( getBGMSwitchDat(), m_BGMSwitchIdList );
    return m_BGMSwitchIdList;
 }
 const std::set< uint32_t >& getBGMSystemDefineIdList()
 {
    if( m_BGMSystemDefineIdList.size() == 0 )
-      loadIdList( m_BGMSystemDefineDat, m_BGMSystemDefineIdList );
+      loadIdList( getBGMSystemDefineDat(), m_BGMSystemDefineIdList );
    return m_BGMSystemDefineIdList;
 }
 const std::set< uint32_t >& getBNpcAnnounceIconIdList()
 {
    if( m_BNpcAnnounceIconIdList.size() == 0 )
-      loadIdList( m_BNpcAnnounceIconDat, m_BNpcAnnounceIconIdList );
+      loadIdList( getBNpcAnnounceIconDat(), m_BNpcAnnounceIconIdList );
    return m_BNpcAnnounceIconIdList;
 }
 const std::set< uint32_t >& getBNpcBaseIdList()
 {
    if( m_BNpcBaseIdList.size() == 0 )
-      loadIdList( m_BNpcBaseDat, m_BNpcBaseIdList );
+      loadIdList( getBNpcBaseDat(), m_BNpcBaseIdList );
    return m_BNpcBaseIdList;
 }
 const std::set< uint32_t >& getBNpcCustomizeIdList()
 {
    if( m_BNpcCustomizeIdList.size() == 0 )
-      loadIdList( m_BNpcCustomizeDat, m_BNpcCustomizeIdList );
+      loadIdList( getBNpcCustomizeDat(), m_BNpcCustomizeIdList );
    return m_BNpcCustomizeIdList;
 }
 const std::set< uint32_t >& getBNpcNameIdList()
 {
    if( m_BNpcNameIdList.size() == 0 )
-      loadIdList( m_BNpcNameDat, m_BNpcNameIdList );
+      loadIdList( getBNpcNameDat(), m_BNpcNameIdList );
    return m_BNpcNameIdList;
 }
 const std::set< uint32_t >& getBNpcPartsIdList()
 {
    if( m_BNpcPartsIdList.size() == 0 )
-      loadIdList( m_BNpcPartsDat, m_BNpcPartsIdList );
+      loadIdList( getBNpcPartsDat(), m_BNpcPartsIdList );
    return m_BNpcPartsIdList;
 }
 const std::set< uint32_t >& getBuddyIdList()
 {
    if( m_BuddyIdList.size() == 0 )
-      loadIdList( m_BuddyDat, m_BuddyIdList );
+      loadIdList( getBuddyDat(), m_BuddyIdList );
    return m_BuddyIdList;
 }
 const std::set< uint32_t >& getBuddyActionIdList()
 {
    if( m_BuddyActionIdList.size() == 0 )
-      loadIdList( m_BuddyActionDat, m_BuddyActionIdList );
+      loadIdList( getBuddyActionDat(), m_BuddyActionIdList );
    return m_BuddyActionIdList;
 }
 const std::set< uint32_t >& getBuddyEquipIdList()
 {
    if( m_BuddyEquipIdList.size() == 0 )
-      loadIdList( m_BuddyEquipDat, m_BuddyEquipIdList );
+      loadIdList( getBuddyEquipDat(), m_BuddyEquipIdList );
    return m_BuddyEquipIdList;
 }
 const std::set< uint32_t >& getBuddyItemIdList()
 {
    if( m_BuddyItemIdList.size() == 0 )
-      loadIdList( m_BuddyItemDat, m_BuddyItemIdList );
+      loadIdList( getBuddyItemDat(), m_BuddyItemIdList );
    return m_BuddyItemIdList;
 }
 const std::set< uint32_t >& getBuddyRankIdList()
 {
    if( m_BuddyRankIdList.size() == 0 )
-      loadIdList( m_BuddyRankDat, m_BuddyRankIdList );
+      loadIdList( getBuddyRankDat(), m_BuddyRankIdList );
    return m_BuddyRankIdList;
 }
 const std::set< uint32_t >& getBuddySkillIdList()
 {
    if( m_BuddySkillIdList.size() == 0 )
-      loadIdList( m_BuddySkillDat, m_BuddySkillIdList );
+      loadIdList( getBuddySkillDat(), m_BuddySkillIdList );
    return m_BuddySkillIdList;
 }
 const std::set< uint32_t >& getCabinetIdList()
 {
    if( m_CabinetIdList.size() == 0 )
-      loadIdList( m_CabinetDat, m_CabinetIdList );
+      loadIdList( getCabinetDat(), m_CabinetIdList );
    return m_CabinetIdList;
 }
 const std::set< uint32_t >& getCabinetCategoryIdList()
 {
    if( m_CabinetCategoryIdList.size() == 0 )
-      loadIdList( m_CabinetCategoryDat, m_CabinetCategoryIdList );
+      loadIdList( getCabinetCategoryDat(), m_CabinetCategoryIdList );
    return m_CabinetCategoryIdList;
 }
 const std::set< uint32_t >& getCalendarIdList()
 {
    if( m_CalendarIdList.size() == 0 )
-      loadIdList( m_CalendarDat, m_CalendarIdList );
+      loadIdList( getCalendarDat(), m_CalendarIdList );
    return m_CalendarIdList;
 }
 const std::set< uint32_t >& getCharaMakeCustomizeIdList()
 {
    if( m_CharaMakeCustomizeIdList.size() == 0 )
-      loadIdList( m_CharaMakeCustomizeDat, m_CharaMakeCustomizeIdList );
+      loadIdList( getCharaMakeCustomizeDat(), m_CharaMakeCustomizeIdList );
    return m_CharaMakeCustomizeIdList;
 }
 const std::set< uint32_t >& getCharaMakeTypeIdList()
 {
    if( m_CharaMakeTypeIdList.size() == 0 )
-      loadIdList( m_CharaMakeTypeDat, m_CharaMakeTypeIdList );
+      loadIdList( getCharaMakeTypeDat(), m_CharaMakeTypeIdList );
    return m_CharaMakeTypeIdList;
 }
 const std::set< uint32_t >& getChocoboRaceIdList()
 {
    if( m_ChocoboRaceIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceDat, m_ChocoboRaceIdList );
+      loadIdList( getChocoboRaceDat(), m_ChocoboRaceIdList );
    return m_ChocoboRaceIdList;
 }
 const std::set< uint32_t >& getChocoboRaceAbilityIdList()
 {
    if( m_ChocoboRaceAbilityIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceAbilityDat, m_ChocoboRaceAbilityIdList );
+      loadIdList( getChocoboRaceAbilityDat(), m_ChocoboRaceAbilityIdList );
    return m_ChocoboRaceAbilityIdList;
 }
 const std::set< uint32_t >& getChocoboRaceAbilityTypeIdList()
 {
    if( m_ChocoboRaceAbilityTypeIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceAbilityTypeDat, m_ChocoboRaceAbilityTypeIdList );
+      loadIdList( getChocoboRaceAbilityTypeDat(), m_ChocoboRaceAbilityTypeIdList );
    return m_ChocoboRaceAbilityTypeIdList;
 }
 const std::set< uint32_t >& getChocoboRaceItemIdList()
 {
    if( m_ChocoboRaceItemIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceItemDat, m_ChocoboRaceItemIdList );
+      loadIdList( getChocoboRaceItemDat(), m_ChocoboRaceItemIdList );
    return m_ChocoboRaceItemIdList;
 }
 const std::set< uint32_t >& getChocoboRaceRankIdList()
 {
    if( m_ChocoboRaceRankIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceRankDat, m_ChocoboRaceRankIdList );
+      loadIdList( getChocoboRaceRankDat(), m_ChocoboRaceRankIdList );
    return m_ChocoboRaceRankIdList;
 }
 const std::set< uint32_t >& getChocoboRaceStatusIdList()
 {
    if( m_ChocoboRaceStatusIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceStatusDat, m_ChocoboRaceStatusIdList );
+      loadIdList( getChocoboRaceStatusDat(), m_ChocoboRaceStatusIdList );
    return m_ChocoboRaceStatusIdList;
 }
 const std::set< uint32_t >& getChocoboRaceTerritoryIdList()
 {
    if( m_ChocoboRaceTerritoryIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceTerritoryDat, m_ChocoboRaceTerritoryIdList );
+      loadIdList( getChocoboRaceTerritoryDat(), m_ChocoboRaceTerritoryIdList );
    return m_ChocoboRaceTerritoryIdList;
 }
 const std::set< uint32_t >& getChocoboRaceTutorialIdList()
 {
    if( m_ChocoboRaceTutorialIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceTutorialDat, m_ChocoboRaceTutorialIdList );
+      loadIdList( getChocoboRaceTutorialDat(), m_ChocoboRaceTutorialIdList );
    return m_ChocoboRaceTutorialIdList;
 }
 const std::set< uint32_t >& getChocoboRaceWeatherIdList()
 {
    if( m_ChocoboRaceWeatherIdList.size() == 0 )
-      loadIdList( m_ChocoboRaceWeatherDat, m_ChocoboRaceWeatherIdList );
+      loadIdList( getChocoboRaceWeatherDat(), m_ChocoboRaceWeatherIdList );
    return m_ChocoboRaceWeatherIdList;
 }
 const std::set< uint32_t >& getChocoboTaxiIdList()
 {
    if( m_ChocoboTaxiIdList.size() == 0 )
-      loadIdList( m_ChocoboTaxiDat, m_ChocoboTaxiIdList );
+      loadIdList( getChocoboTaxiDat(), m_ChocoboTaxiIdList );
    return m_ChocoboTaxiIdList;
 }
 const std::set< uint32_t >& getChocoboTaxiStandIdList()
 {
    if( m_ChocoboTaxiStandIdList.size() == 0 )
-      loadIdList( m_ChocoboTaxiStandDat, m_ChocoboTaxiStandIdList );
+      loadIdList( getChocoboTaxiStandDat(), m_ChocoboTaxiStandIdList );
    return m_ChocoboTaxiStandIdList;
 }
 const std::set< uint32_t >& getClassJobIdList()
 {
    if( m_ClassJobIdList.size() == 0 )
-      loadIdList( m_ClassJobDat, m_ClassJobIdList );
+      loadIdList( getClassJobDat(), m_ClassJobIdList );
    return m_ClassJobIdList;
 }
 const std::set< uint32_t >& getClassJobCategoryIdList()
 {
    if( m_ClassJobCategoryIdList.size() == 0 )
-      loadIdList( m_ClassJobCategoryDat, m_ClassJobCategoryIdList );
+      loadIdList( getClassJobCategoryDat(), m_ClassJobCategoryIdList );
    return m_ClassJobCategoryIdList;
 }
 const std::set< uint32_t >& getCompanionIdList()
 {
    if( m_CompanionIdList.size() == 0 )
-      loadIdList( m_CompanionDat, m_CompanionIdList );
+      loadIdList( getCompanionDat(), m_CompanionIdList );
    return m_CompanionIdList;
 }
 const std::set< uint32_t >& getCompanionMoveIdList()
 {
    if( m_CompanionMoveIdList.size() == 0 )
-      loadIdList( m_CompanionMoveDat, m_CompanionMoveIdList );
+      loadIdList( getCompanionMoveDat(), m_CompanionMoveIdList );
    return m_CompanionMoveIdList;
 }
 const std::set< uint32_t >& getCompanionTransientIdList()
 {
    if( m_CompanionTransientIdList.size() == 0 )
-      loadIdList( m_CompanionTransientDat, m_CompanionTransientIdList );
+      loadIdList( getCompanionTransientDat(), m_CompanionTransientIdList );
    return m_CompanionTransientIdList;
 }
 const std::set< uint32_t >& getCompanyActionIdList()
 {
    if( m_CompanyActionIdList.size() == 0 )
-      loadIdList( m_CompanyActionDat, m_CompanyActionIdList );
+      loadIdList( getCompanyActionDat(), m_CompanyActionIdList );
    return m_CompanyActionIdList;
 }
 const std::set< uint32_t >& getCompanyCraftDraftIdList()
 {
    if( m_CompanyCraftDraftIdList.size() == 0 )
-      loadIdList( m_CompanyCraftDraftDat, m_CompanyCraftDraftIdList );
+      loadIdList( getCompanyCraftDraftDat(), m_CompanyCraftDraftIdList );
    return m_CompanyCraftDraftIdList;
 }
 const std::set< uint32_t >& getCompanyCraftDraftCategoryIdList()
 {
    if( m_CompanyCraftDraftCategoryIdList.size() == 0 )
-      loadIdList( m_CompanyCraftDraftCategoryDat, m_CompanyCraftDraftCategoryIdList );
+      loadIdList( getCompanyCraftDraftCategoryDat(), m_CompanyCraftDraftCategoryIdList );
    return m_CompanyCraftDraftCategoryIdList;
 }
 const std::set< uint32_t >& getCompanyCraftManufactoryStateIdList()
 {
    if( m_CompanyCraftManufactoryStateIdList.size() == 0 )
-      loadIdList( m_CompanyCraftManufactoryStateDat, m_CompanyCraftManufactoryStateIdList );
+      loadIdList( getCompanyCraftManufactoryStateDat(), m_CompanyCraftManufactoryStateIdList );
    return m_CompanyCraftManufactoryStateIdList;
 }
 const std::set< uint32_t >& getCompanyCraftPartIdList()
 {
    if( m_CompanyCraftPartIdList.size() == 0 )
-      loadIdList( m_CompanyCraftPartDat, m_CompanyCraftPartIdList );
+      loadIdList( getCompanyCraftPartDat(), m_CompanyCraftPartIdList );
    return m_CompanyCraftPartIdList;
 }
 const std::set< uint32_t >& getCompanyCraftProcessIdList()
 {
    if( m_CompanyCraftProcessIdList.size() == 0 )
-      loadIdList( m_CompanyCraftProcessDat, m_CompanyCraftProcessIdList );
+      loadIdList( getCompanyCraftProcessDat(), m_CompanyCraftProcessIdList );
    return m_CompanyCraftProcessIdList;
 }
 const std::set< uint32_t >& getCompanyCraftSequenceIdList()
 {
    if( m_CompanyCraftSequenceIdList.size() == 0 )
-      loadIdList( m_CompanyCraftSequenceDat, m_CompanyCraftSequenceIdList );
+      loadIdList( getCompanyCraftSequenceDat(), m_CompanyCraftSequenceIdList );
    return m_CompanyCraftSequenceIdList;
 }
 const std::set< uint32_t >& getCompanyCraftSupplyItemIdList()
 {
    if( m_CompanyCraftSupplyItemIdList.size() == 0 )
-      loadIdList( m_CompanyCraftSupplyItemDat, m_CompanyCraftSupplyItemIdList );
+      loadIdList( getCompanyCraftSupplyItemDat(), m_CompanyCraftSupplyItemIdList );
    return m_CompanyCraftSupplyItemIdList;
 }
 const std::set< uint32_t >& getCompanyCraftTypeIdList()
 {
    if( m_CompanyCraftTypeIdList.size() == 0 )
-      loadIdList( m_CompanyCraftTypeDat, m_CompanyCraftTypeIdList );
+      loadIdList( getCompanyCraftTypeDat(), m_CompanyCraftTypeIdList );
    return m_CompanyCraftTypeIdList;
 }
 const std::set< uint32_t >& getCompanyLeveIdList()
 {
    if( m_CompanyLeveIdList.size() == 0 )
-      loadIdList( m_CompanyLeveDat, m_CompanyLeveIdList );
+      loadIdList( getCompanyLeveDat(), m_CompanyLeveIdList );
    return m_CompanyLeveIdList;
 }
 const std::set< uint32_t >& getCompanyLeveRuleIdList()
 {
    if( m_CompanyLeveRuleIdList.size() == 0 )
-      loadIdList( m_CompanyLeveRuleDat, m_CompanyLeveRuleIdList );
+      loadIdList( getCompanyLeveRuleDat(), m_CompanyLeveRuleIdList );
    return m_CompanyLeveRuleIdList;
 }
 const std::set< uint32_t >& getCompleteJournalIdList()
 {
    if( m_CompleteJournalIdList.size() == 0 )
-      loadIdList( m_CompleteJournalDat, m_CompleteJournalIdList );
+      loadIdList( getCompleteJournalDat(), m_CompleteJournalIdList );
    return m_CompleteJournalIdList;
 }
 const std::set< uint32_t >& getCompleteJournalCategoryIdList()
 {
    if( m_CompleteJournalCategoryIdList.size() == 0 )
-      loadIdList( m_CompleteJournalCategoryDat, m_CompleteJournalCategoryIdList );
+      loadIdList( getCompleteJournalCategoryDat(), m_CompleteJournalCategoryIdList );
    return m_CompleteJournalCategoryIdList;
 }
 const std::set< uint32_t >& getContentCloseCycleIdList()
 {
    if( m_ContentCloseCycleIdList.size() == 0 )
-      loadIdList( m_ContentCloseCycleDat, m_ContentCloseCycleIdList );
+      loadIdList( getContentCloseCycleDat(), m_ContentCloseCycleIdList );
    return m_ContentCloseCycleIdList;
 }
 const std::set< uint32_t >& getContentExActionIdList()
 {
    if( m_ContentExActionIdList.size() == 0 )
-      loadIdList( m_ContentExActionDat, m_ContentExActionIdList );
+      loadIdList( getContentExActionDat(), m_ContentExActionIdList );
    return m_ContentExActionIdList;
 }
 const std::set< uint32_t >& getContentFinderConditionIdList()
 {
    if( m_ContentFinderConditionIdList.size() == 0 )
-      loadIdList( m_ContentFinderConditionDat, m_ContentFinderConditionIdList );
+      loadIdList( getContentFinderConditionDat(), m_ContentFinderConditionIdList );
    return m_ContentFinderConditionIdList;
 }
 const std::set< uint32_t >& getContentFinderConditionTransientIdList()
 {
    if( m_ContentFinderConditionTransientIdList.size() == 0 )
-      loadIdList( m_ContentFinderConditionTransientDat, m_ContentFinderConditionTransientIdList );
+      loadIdList( getContentFinderConditionTransientDat(), m_ContentFinderConditionTransientIdList );
    return m_ContentFinderConditionTransientIdList;
 }
 const std::set< uint32_t >& getContentGaugeIdList()
 {
    if( m_ContentGaugeIdList.size() == 0 )
-      loadIdList( m_ContentGaugeDat, m_ContentGaugeIdList );
+      loadIdList( getContentGaugeDat(), m_ContentGaugeIdList );
    return m_ContentGaugeIdList;
 }
 const std::set< uint32_t >& getContentGaugeColorIdList()
 {
    if( m_ContentGaugeColorIdList.size() == 0 )
-      loadIdList( m_ContentGaugeColorDat, m_ContentGaugeColorIdList );
+      loadIdList( getContentGaugeColorDat(), m_ContentGaugeColorIdList );
    return m_ContentGaugeColorIdList;
 }
 const std::set< uint32_t >& getContentMemberTypeIdList()
 {
    if( m_ContentMemberTypeIdList.size() == 0 )
-      loadIdList( m_ContentMemberTypeDat, m_ContentMemberTypeIdList );
+      loadIdList( getContentMemberTypeDat(), m_ContentMemberTypeIdList );
    return m_ContentMemberTypeIdList;
 }
 const std::set< uint32_t >& getContentNpcTalkIdList()
 {
    if( m_ContentNpcTalkIdList.size() == 0 )
-      loadIdList( m_ContentNpcTalkDat, m_ContentNpcTalkIdList );
+      loadIdList( getContentNpcTalkDat(), m_ContentNpcTalkIdList );
    return m_ContentNpcTalkIdList;
 }
 const std::set< uint32_t >& getContentRouletteIdList()
 {
    if( m_ContentRouletteIdList.size() == 0 )
-      loadIdList( m_ContentRouletteDat, m_ContentRouletteIdList );
+      loadIdList( getContentRouletteDat(), m_ContentRouletteIdList );
    return m_ContentRouletteIdList;
 }
 const std::set< uint32_t >& getContentRouletteOpenRuleIdList()
 {
    if( m_ContentRouletteOpenRuleIdList.size() == 0 )
-      loadIdList( m_ContentRouletteOpenRuleDat, m_ContentRouletteOpenRuleIdList );
+      loadIdList( getContentRouletteOpenRuleDat(), m_ContentRouletteOpenRuleIdList );
    return m_ContentRouletteOpenRuleIdList;
 }
 const std::set< uint32_t >& getContentRouletteRoleBonusIdList()
 {
    if( m_ContentRouletteRoleBonusIdList.size() == 0 )
-      loadIdList( m_ContentRouletteRoleBonusDat, m_ContentRouletteRoleBonusIdList );
+      loadIdList( getContentRouletteRoleBonusDat(), m_ContentRouletteRoleBonusIdList );
    return m_ContentRouletteRoleBonusIdList;
 }
 const std::set< uint32_t >& getContentsNoteIdList()
 {
    if( m_ContentsNoteIdList.size() == 0 )
-      loadIdList( m_ContentsNoteDat, m_ContentsNoteIdList );
+      loadIdList( getContentsNoteDat(), m_ContentsNoteIdList );
    return m_ContentsNoteIdList;
 }
 const std::set< uint32_t >& getContentTalkIdList()
 {
    if( m_ContentTalkIdList.size() == 0 )
-      loadIdList( m_ContentTalkDat, m_ContentTalkIdList );
+      loadIdList( getContentTalkDat(), m_ContentTalkIdList );
    return m_ContentTalkIdList;
 }
 const std::set< uint32_t >& getContentTalkParamIdList()
 {
    if( m_ContentTalkParamIdList.size() == 0 )
-      loadIdList( m_ContentTalkParamDat, m_ContentTalkParamIdList );
+      loadIdList( getContentTalkParamDat(), m_ContentTalkParamIdList );
    return m_ContentTalkParamIdList;
 }
 const std::set< uint32_t >& getContentTypeIdList()
 {
    if( m_ContentTypeIdList.size() == 0 )
-      loadIdList( m_ContentTypeDat, m_ContentTypeIdList );
+      loadIdList( getContentTypeDat(), m_ContentTypeIdList );
    return m_ContentTypeIdList;
 }
 const std::set< uint32_t >& getCraftActionIdList()
 {
    if( m_CraftActionIdList.size() == 0 )
-      loadIdList( m_CraftActionDat, m_CraftActionIdList );
+      loadIdList( getCraftActionDat(), m_CraftActionIdList );
    return m_CraftActionIdList;
 }
 const std::set< uint32_t >& getCraftLeveIdList()
 {
    if( m_CraftLeveIdList.size() == 0 )
-      loadIdList( m_CraftLeveDat, m_CraftLeveIdList );
+      loadIdList( getCraftLeveDat(), m_CraftLeveIdList );
    return m_CraftLeveIdList;
 }
 const std::set< uint32_t >& getCraftTypeIdList()
 {
    if( m_CraftTypeIdList.size() == 0 )
-      loadIdList( m_CraftTypeDat, m_CraftTypeIdList );
+      loadIdList( getCraftTypeDat(), m_CraftTypeIdList );
    return m_CraftTypeIdList;
 }
 const std::set< uint32_t >& getCreditIdList()
 {
    if( m_CreditIdList.size() == 0 )
-      loadIdList( m_CreditDat, m_CreditIdList );
+      loadIdList( getCreditDat(), m_CreditIdList );
    return m_CreditIdList;
 }
 const std::set< uint32_t >& getCreditBackImageIdList()
 {
    if( m_CreditBackImageIdList.size() == 0 )
-      loadIdList( m_CreditBackImageDat, m_CreditBackImageIdList );
+      loadIdList( getCreditBackImageDat(), m_CreditBackImageIdList );
    return m_CreditBackImageIdList;
 }
 const std::set< uint32_t >& getCreditCastIdList()
 {
    if( m_CreditCastIdList.size() == 0 )
-      loadIdList( m_CreditCastDat, m_CreditCastIdList );
+      loadIdList( getCreditCastDat(), m_CreditCastIdList );
    return m_CreditCastIdList;
 }
 const std::set< uint32_t >& getCreditListIdList()
 {
    if( m_CreditListIdList.size() == 0 )
-      loadIdList( m_CreditListDat, m_CreditListIdList );
+      loadIdList( getCreditListDat(), m_CreditListIdList );
    return m_CreditListIdList;
 }
 const std::set< uint32_t >& getCreditListTextIdList()
 {
    if( m_CreditListTextIdList.size() == 0 )
-      loadIdList( m_CreditListTextDat, m_CreditListTextIdList );
+      loadIdList( getCreditListTextDat(), m_CreditListTextIdList );
    return m_CreditListTextIdList;
 }
 const std::set< uint32_t >& getCurrencyIdList()
 {
    if( m_CurrencyIdList.size() == 0 )
-      loadIdList( m_CurrencyDat, m_CurrencyIdList );
+      loadIdList( getCurrencyDat(), m_CurrencyIdList );
    return m_CurrencyIdList;
 }
 const std::set< uint32_t >& getCustomTalkIdList()
 {
    if( m_CustomTalkIdList.size() == 0 )
-      loadIdList( m_CustomTalkDat, m_CustomTalkIdList );
+      loadIdList( getCustomTalkDat(), m_CustomTalkIdList );
    return m_CustomTalkIdList;
 }
 const std::set< uint32_t >& getCustomTalkDynamicIconIdList()
 {
    if( m_CustomTalkDynamicIconIdList.size() == 0 )
-      loadIdList( m_CustomTalkDynamicIconDat, m_CustomTalkDynamicIconIdList );
+      loadIdList( getCustomTalkDynamicIconDat(), m_CustomTalkDynamicIconIdList );
    return m_CustomTalkDynamicIconIdList;
 }
 const std::set< uint32_t >& getCustomTalkNestHandlersIdList()
 {
    if( m_CustomTalkNestHandlersIdList.size() == 0 )
-      loadIdList( m_CustomTalkNestHandlersDat, m_CustomTalkNestHandlersIdList );
+      loadIdList( getCustomTalkNestHandlersDat(), m_CustomTalkNestHandlersIdList );
    return m_CustomTalkNestHandlersIdList;
 }
 const std::set< uint32_t >& getCutsceneIdList()
 {
    if( m_CutsceneIdList.size() == 0 )
-      loadIdList( m_CutsceneDat, m_CutsceneIdList );
+      loadIdList( getCutsceneDat(), m_CutsceneIdList );
    return m_CutsceneIdList;
 }
 const std::set< uint32_t >& getCutScreenImageIdList()
 {
    if( m_CutScreenImageIdList.size() == 0 )
-      loadIdList( m_CutScreenImageDat, m_CutScreenImageIdList );
+      loadIdList( getCutScreenImageDat(), m_CutScreenImageIdList );
    return m_CutScreenImageIdList;
 }
 const std::set< uint32_t >& getDailySupplyItemIdList()
 {
    if( m_DailySupplyItemIdList.size() == 0 )
-      loadIdList( m_DailySupplyItemDat, m_DailySupplyItemIdList );
+      loadIdList( getDailySupplyItemDat(), m_DailySupplyItemIdList );
    return m_DailySupplyItemIdList;
 }
 const std::set< uint32_t >& getDeepDungeonIdList()
 {
    if( m_DeepDungeonIdList.size() == 0 )
-      loadIdList( m_DeepDungeonDat, m_DeepDungeonIdList );
+      loadIdList( getDeepDungeonDat(), m_DeepDungeonIdList );
    return m_DeepDungeonIdList;
 }
 const std::set< uint32_t >& getDeepDungeonBanIdList()
 {
    if( m_DeepDungeonBanIdList.size() == 0 )
-      loadIdList( m_DeepDungeonBanDat, m_DeepDungeonBanIdList );
+      loadIdList( getDeepDungeonBanDat(), m_DeepDungeonBanIdList );
    return m_DeepDungeonBanIdList;
 }
 const std::set< uint32_t >& getDeepDungeonDangerIdList()
 {
    if( m_DeepDungeonDangerIdList.size() == 0 )
-      loadIdList( m_DeepDungeonDangerDat, m_DeepDungeonDangerIdList );
+      loadIdList( getDeepDungeonDangerDat(), m_DeepDungeonDangerIdList );
    return m_DeepDungeonDangerIdList;
 }
 const std::set< uint32_t >& getDeepDungeonEquipmentIdList()
 {
    if( m_DeepDungeonEquipmentIdList.size() == 0 )
-      loadIdList( m_DeepDungeonEquipmentDat, m_DeepDungeonEquipmentIdList );
+      loadIdList( getDeepDungeonEquipmentDat(), m_DeepDungeonEquipmentIdList );
    return m_DeepDungeonEquipmentIdList;
 }
 const std::set< uint32_t >& getDeepDungeonFloorEffectUIIdList()
 {
    if( m_DeepDungeonFloorEffectUIIdList.size() == 0 )
-      loadIdList( m_DeepDungeonFloorEffectUIDat, m_DeepDungeonFloorEffectUIIdList );
+      loadIdList( getDeepDungeonFloorEffectUIDat(), m_DeepDungeonFloorEffectUIIdList );
    return m_DeepDungeonFloorEffectUIIdList;
 }
 const std::set< uint32_t >& getDeepDungeonItemIdList()
 {
    if( m_DeepDungeonItemIdList.size() == 0 )
-      loadIdList( m_DeepDungeonItemDat, m_DeepDungeonItemIdList );
+      loadIdList( getDeepDungeonItemDat(), m_DeepDungeonItemIdList );
    return m_DeepDungeonItemIdList;
 }
 const std::set< uint32_t >& getDeepDungeonLayerIdList()
 {
    if( m_DeepDungeonLayerIdList.size() == 0 )
-      loadIdList( m_DeepDungeonLayerDat, m_DeepDungeonLayerIdList );
+      loadIdList( getDeepDungeonLayerDat(), m_DeepDungeonLayerIdList );
    return m_DeepDungeonLayerIdList;
 }
 const std::set< uint32_t >& getDeepDungeonMagicStoneIdList()
 {
    if( m_DeepDungeonMagicStoneIdList.size() == 0 )
-      loadIdList( m_DeepDungeonMagicStoneDat, m_DeepDungeonMagicStoneIdList );
+      loadIdList( getDeepDungeonMagicStoneDat(), m_DeepDungeonMagicStoneIdList );
    return m_DeepDungeonMagicStoneIdList;
 }
 const std::set< uint32_t >& getDeepDungeonMap5XIdList()
 {
    if( m_DeepDungeonMap5XIdList.size() == 0 )
-      loadIdList( m_DeepDungeonMap5XDat, m_DeepDungeonMap5XIdList );
+      loadIdList( getDeepDungeonMap5XDat(), m_DeepDungeonMap5XIdList );
    return m_DeepDungeonMap5XIdList;
 }
 const std::set< uint32_t >& getDeepDungeonRoomIdList()
 {
    if( m_DeepDungeonRoomIdList.size() == 0 )
-      loadIdList( m_DeepDungeonRoomDat, m_DeepDungeonRoomIdList );
+      loadIdList( getDeepDungeonRoomDat(), m_DeepDungeonRoomIdList );
    return m_DeepDungeonRoomIdList;
 }
 const std::set< uint32_t >& getDeepDungeonStatusIdList()
 {
    if( m_DeepDungeonStatusIdList.size() == 0 )
-      loadIdList( m_DeepDungeonStatusDat, m_DeepDungeonStatusIdList );
+      loadIdList( getDeepDungeonStatusDat(), m_DeepDungeonStatusIdList );
    return m_DeepDungeonStatusIdList;
 }
 const std::set< uint32_t >& getDefaultTalkIdList()
 {
    if( m_DefaultTalkIdList.size() == 0 )
-      loadIdList( m_DefaultTalkDat, m_DefaultTalkIdList );
+      loadIdList( getDefaultTalkDat(), m_DefaultTalkIdList );
    return m_DefaultTalkIdList;
 }
 const std::set< uint32_t >& getDefaultTalkLipSyncTypeIdList()
 {
    if( m_DefaultTalkLipSyncTypeIdList.size() == 0 )
-      loadIdList( m_DefaultTalkLipSyncTypeDat, m_DefaultTalkLipSyncTypeIdList );
+      loadIdList( getDefaultTalkLipSyncTypeDat(), m_DefaultTalkLipSyncTypeIdList );
    return m_DefaultTalkLipSyncTypeIdList;
 }
 const std::set< uint32_t >& getDeliveryQuestIdList()
 {
    if( m_DeliveryQuestIdList.size() == 0 )
-      loadIdList( m_DeliveryQuestDat, m_DeliveryQuestIdList );
+      loadIdList( getDeliveryQuestDat(), m_DeliveryQuestIdList );
    return m_DeliveryQuestIdList;
 }
 const std::set< uint32_t >& getDescriptionPageIdList()
 {
    if( m_DescriptionPageIdList.size() == 0 )
-      loadIdList( m_DescriptionPageDat, m_DescriptionPageIdList );
+      loadIdList( getDescriptionPageDat(), m_DescriptionPageIdList );
    return m_DescriptionPageIdList;
 }
 const std::set< uint32_t >& getDescriptionStringIdList()
 {
    if( m_DescriptionStringIdList.size() == 0 )
-      loadIdList( m_DescriptionStringDat, m_DescriptionStringIdList );
+      loadIdList( getDescriptionStringDat(), m_DescriptionStringIdList );
    return m_DescriptionStringIdList;
 }
 const std::set< uint32_t >& getDisposalShopIdList()
 {
    if( m_DisposalShopIdList.size() == 0 )
-      loadIdList( m_DisposalShopDat, m_DisposalShopIdList );
+      loadIdList( getDisposalShopDat(), m_DisposalShopIdList );
    return m_DisposalShopIdList;
 }
 const std::set< uint32_t >& getDisposalShopFilterTypeIdList()
 {
    if( m_DisposalShopFilterTypeIdList.size() == 0 )
-      loadIdList( m_DisposalShopFilterTypeDat, m_DisposalShopFilterTypeIdList );
+      loadIdList( getDisposalShopFilterTypeDat(), m_DisposalShopFilterTypeIdList );
    return m_DisposalShopFilterTypeIdList;
 }
 const std::set< uint32_t >& getDisposalShopItemIdList()
 {
    if( m_DisposalShopItemIdList.size() == 0 )
-      loadIdList( m_DisposalShopItemDat, m_DisposalShopItemIdList );
+      loadIdList( getDisposalShopItemDat(), m_DisposalShopItemIdList );
    return m_DisposalShopItemIdList;
 }
 const std::set< uint32_t >& getDpsChallengeIdList()
 {
    if( m_DpsChallengeIdList.size() == 0 )
-      loadIdList( m_DpsChallengeDat, m_DpsChallengeIdList );
+      loadIdList( getDpsChallengeDat(), m_DpsChallengeIdList );
    return m_DpsChallengeIdList;
 }
 const std::set< uint32_t >& getDpsChallengeOfficerIdList()
 {
    if( m_DpsChallengeOfficerIdList.size() == 0 )
-      loadIdList( m_DpsChallengeOfficerDat, m_DpsChallengeOfficerIdList );
+      loadIdList( getDpsChallengeOfficerDat(), m_DpsChallengeOfficerIdList );
    return m_DpsChallengeOfficerIdList;
 }
 const std::set< uint32_t >& getDpsChallengeTransientIdList()
 {
    if( m_DpsChallengeTransientIdList.size() == 0 )
-      loadIdList( m_DpsChallengeTransientDat, m_DpsChallengeTransientIdList );
+      loadIdList( getDpsChallengeTransientDat(), m_DpsChallengeTransientIdList );
    return m_DpsChallengeTransientIdList;
 }
 const std::set< uint32_t >& getEmjAddonIdList()
 {
    if( m_EmjAddonIdList.size() == 0 )
-      loadIdList( m_EmjAddonDat, m_EmjAddonIdList );
+      loadIdList( getEmjAddonDat(), m_EmjAddonIdList );
    return m_EmjAddonIdList;
 }
 const std::set< uint32_t >& getEmjDaniIdList()
 {
    if( m_EmjDaniIdList.size() == 0 )
-      loadIdList( m_EmjDaniDat, m_EmjDaniIdList );
+      loadIdList( getEmjDaniDat(), m_EmjDaniIdList );
    return m_EmjDaniIdList;
 }
 const std::set< uint32_t >& getEmoteIdList()
 {
    if( m_EmoteIdList.size() == 0 )
-      loadIdList( m_EmoteDat, m_EmoteIdList );
+      loadIdList( getEmoteDat(), m_EmoteIdList );
    return m_EmoteIdList;
 }
 const std::set< uint32_t >& getEmoteCategoryIdList()
 {
    if( m_EmoteCategoryIdList.size() == 0 )
-      loadIdList( m_EmoteCategoryDat, m_EmoteCategoryIdList );
+      loadIdList( getEmoteCategoryDat(), m_EmoteCategoryIdList );
    return m_EmoteCategoryIdList;
 }
 const std::set< uint32_t >& getENpcBaseIdList()
 {
    if( m_ENpcBaseIdList.size() == 0 )
-      loadIdList( m_ENpcBaseDat, m_ENpcBaseIdList );
+      loadIdList( getENpcBaseDat(), m_ENpcBaseIdList );
    return m_ENpcBaseIdList;
 }
 const std::set< uint32_t >& getENpcDressUpIdList()
 {
    if( m_ENpcDressUpIdList.size() == 0 )
-      loadIdList( m_ENpcDressUpDat, m_ENpcDressUpIdList );
+      loadIdList( getENpcDressUpDat(), m_ENpcDressUpIdList );
    return m_ENpcDressUpIdList;
 }
 const std::set< uint32_t >& getENpcDressUpDressIdList()
 {
    if( m_ENpcDressUpDressIdList.size() == 0 )
-      loadIdList( m_ENpcDressUpDressDat, m_ENpcDressUpDressIdList );
+      loadIdList( getENpcDressUpDressDat(), m_ENpcDressUpDressIdList );
    return m_ENpcDressUpDressIdList;
 }
 const std::set< uint32_t >& getENpcResidentIdList()
 {
    if( m_ENpcResidentIdList.size() == 0 )
-      loadIdList( m_ENpcResidentDat, m_ENpcResidentIdList );
+      loadIdList( getENpcResidentDat(), m_ENpcResidentIdList );
    return m_ENpcResidentIdList;
 }
 const std::set< uint32_t >& getEObjIdList()
 {
    if( m_EObjIdList.size() == 0 )
-      loadIdList( m_EObjDat, m_EObjIdList );
+      loadIdList( getEObjDat(), m_EObjIdList );
    return m_EObjIdList;
 }
 const std::set< uint32_t >& getEObjNameIdList()
 {
    if( m_EObjNameIdList.size() == 0 )
-      loadIdList( m_EObjNameDat, m_EObjNameIdList );
+      loadIdList( getEObjNameDat(), m_EObjNameIdList );
    return m_EObjNameIdList;
 }
 const std::set< uint32_t >& getEquipRaceCategoryIdList()
 {
    if( m_EquipRaceCategoryIdList.size() == 0 )
-      loadIdList( m_EquipRaceCategoryDat, m_EquipRaceCategoryIdList );
+      loadIdList( getEquipRaceCategoryDat(), m_EquipRaceCategoryIdList );
    return m_EquipRaceCategoryIdList;
 }
 const std::set< uint32_t >& getEquipSlotCategoryIdList()
 {
    if( m_EquipSlotCategoryIdList.size() == 0 )
-      loadIdList( m_EquipSlotCategoryDat, m_EquipSlotCategoryIdList );
+      loadIdList( getEquipSlotCategoryDat(), m_EquipSlotCategoryIdList );
    return m_EquipSlotCategoryIdList;
 }
 const std::set< uint32_t >& getEurekaAetherItemIdList()
 {
    if( m_EurekaAetherItemIdList.size() == 0 )
-      loadIdList( m_EurekaAetherItemDat, m_EurekaAetherItemIdList );
+      loadIdList( getEurekaAetherItemDat(), m_EurekaAetherItemIdList );
    return m_EurekaAetherItemIdList;
 }
 const std::set< uint32_t >& getEurekaAethernetIdList()
 {
    if( m_EurekaAethernetIdList.size() == 0 )
-      loadIdList( m_EurekaAethernetDat, m_EurekaAethernetIdList );
+      loadIdList( getEurekaAethernetDat(), m_EurekaAethernetIdList );
    return m_EurekaAethernetIdList;
 }
 const std::set< uint32_t >& getEurekaGrowDataIdList()
 {
    if( m_EurekaGrowDataIdList.size() == 0 )
-      loadIdList( m_EurekaGrowDataDat, m_EurekaGrowDataIdList );
+      loadIdList( getEurekaGrowDataDat(), m_EurekaGrowDataIdList );
    return m_EurekaGrowDataIdList;
 }
 const std::set< uint32_t >& getEurekaLogosMixerProbabilityIdList()
 {
    if( m_EurekaLogosMixerProbabilityIdList.size() == 0 )
-      loadIdList( m_EurekaLogosMixerProbabilityDat, m_EurekaLogosMixerProbabilityIdList );
+      loadIdList( getEurekaLogosMixerProbabilityDat(), m_EurekaLogosMixerProbabilityIdList );
    return m_EurekaLogosMixerProbabilityIdList;
 }
 const std::set< uint32_t >& getEurekaMagiaActionIdList()
 {
    if( m_EurekaMagiaActionIdList.size() == 0 )
-      loadIdList( m_EurekaMagiaActionDat, m_EurekaMagiaActionIdList );
+      loadIdList( getEurekaMagiaActionDat(), m_EurekaMagiaActionIdList );
    return m_EurekaMagiaActionIdList;
 }
 const std::set< uint32_t >& getEurekaMagiciteItemIdList()
 {
    if( m_EurekaMagiciteItemIdList.size() == 0 )
-      loadIdList( m_EurekaMagiciteItemDat, m_EurekaMagiciteItemIdList );
+      loadIdList( getEurekaMagiciteItemDat(), m_EurekaMagiciteItemIdList );
    return m_EurekaMagiciteItemIdList;
 }
 const std::set< uint32_t >& getEurekaMagiciteItemTypeIdList()
 {
    if( m_EurekaMagiciteItemTypeIdList.size() == 0 )
-      loadIdList( m_EurekaMagiciteItemTypeDat, m_EurekaMagiciteItemTypeIdList );
+      loadIdList( getEurekaMagiciteItemTypeDat(), m_EurekaMagiciteItemTypeIdList );
    return m_EurekaMagiciteItemTypeIdList;
 }
 const std::set< uint32_t >& getEurekaSphereElementAdjustIdList()
 {
    if( m_EurekaSphereElementAdjustIdList.size() == 0 )
-      loadIdList( m_EurekaSphereElementAdjustDat, m_EurekaSphereElementAdjustIdList );
+      loadIdList( getEurekaSphereElementAdjustDat(), m_EurekaSphereElementAdjustIdList );
    return m_EurekaSphereElementAdjustIdList;
 }
 const std::set< uint32_t >& getEventActionIdList()
 {
    if( m_EventActionIdList.size() == 0 )
-      loadIdList( m_EventActionDat, m_EventActionIdList );
+      loadIdList( getEventActionDat(), m_EventActionIdList );
    return m_EventActionIdList;
 }
 const std::set< uint32_t >& getEventIconPriorityIdList()
 {
    if( m_EventIconPriorityIdList.size() == 0 )
-      loadIdList( m_EventIconPriorityDat, m_EventIconPriorityIdList );
+      loadIdList( getEventIconPriorityDat(), m_EventIconPriorityIdList );
    return m_EventIconPriorityIdList;
 }
 const std::set< uint32_t >& getEventIconTypeIdList()
 {
    if( m_EventIconTypeIdList.size() == 0 )
-      loadIdList( m_EventIconTypeDat, m_EventIconTypeIdList );
+      loadIdList( getEventIconTypeDat(), m_EventIconTypeIdList );
    return m_EventIconTypeIdList;
 }
 const std::set< uint32_t >& getEventItemIdList()
 {
    if( m_EventItemIdList.size() == 0 )
-      loadIdList( m_EventItemDat, m_EventItemIdList );
+      loadIdList( getEventItemDat(), m_EventItemIdList );
    return m_EventItemIdList;
 }
 const std::set< uint32_t >& getEventItemCastTimelineIdList()
 {
    if( m_EventItemCastTimelineIdList.size() == 0 )
-      loadIdList( m_EventItemCastTimelineDat, m_EventItemCastTimelineIdList );
+      loadIdList( getEventItemCastTimelineDat(), m_EventItemCastTimelineIdList );
    return m_EventItemCastTimelineIdList;
 }
 const std::set< uint32_t >& getEventItemHelpIdList()
 {
    if( m_EventItemHelpIdList.size() == 0 )
-      loadIdList( m_EventItemHelpDat, m_EventItemHelpIdList );
+      loadIdList( getEventItemHelpDat(), m_EventItemHelpIdList );
    return m_EventItemHelpIdList;
 }
 const std::set< uint32_t >& getEventItemTimelineIdList()
 {
    if( m_EventItemTimelineIdList.size() == 0 )
-      loadIdList( m_EventItemTimelineDat, m_EventItemTimelineIdList );
+      loadIdList( getEventItemTimelineDat(), m_EventItemTimelineIdList );
    return m_EventItemTimelineIdList;
 }
 const std::set< uint32_t >& getExportedSGIdList()
 {
    if( m_ExportedSGIdList.size() == 0 )
-      loadIdList( m_ExportedSGDat, m_ExportedSGIdList );
+      loadIdList( getExportedSGDat(), m_ExportedSGIdList );
    return m_ExportedSGIdList;
 }
 const std::set< uint32_t >& getExVersionIdList()
 {
    if( m_ExVersionIdList.size() == 0 )
-      loadIdList( m_ExVersionDat, m_ExVersionIdList );
+      loadIdList( getExVersionDat(), m_ExVersionIdList );
    return m_ExVersionIdList;
 }
 const std::set< uint32_t >& getFateIdList()
 {
    if( m_FateIdList.size() == 0 )
-      loadIdList( m_FateDat, m_FateIdList );
+      loadIdList( getFateDat(), m_FateIdList );
    return m_FateIdList;
 }
 const std::set< uint32_t >& getFCActivityIdList()
 {
    if( m_FCActivityIdList.size() == 0 )
-      loadIdList( m_FCActivityDat, m_FCActivityIdList );
+      loadIdList( getFCActivityDat(), m_FCActivityIdList );
    return m_FCActivityIdList;
 }
 const std::set< uint32_t >& getFCActivityCategoryIdList()
 {
    if( m_FCActivityCategoryIdList.size() == 0 )
-      loadIdList( m_FCActivityCategoryDat, m_FCActivityCategoryIdList );
+      loadIdList( getFCActivityCategoryDat(), m_FCActivityCategoryIdList );
    return m_FCActivityCategoryIdList;
 }
 const std::set< uint32_t >& getFCAuthorityIdList()
 {
    if( m_FCAuthorityIdList.size() == 0 )
-      loadIdList( m_FCAuthorityDat, m_FCAuthorityIdList );
+      loadIdList( getFCAuthorityDat(), m_FCAuthorityIdList );
    return m_FCAuthorityIdList;
 }
 const std::set< uint32_t >& getFCAuthorityCategoryIdList()
 {
    if( m_FCAuthorityCategoryIdList.size() == 0 )
-      loadIdList( m_FCAuthorityCategoryDat, m_FCAuthorityCategoryIdList );
+      loadIdList( getFCAuthorityCategoryDat(), m_FCAuthorityCategoryIdList );
    return m_FCAuthorityCategoryIdList;
 }
 const std::set< uint32_t >& getFCChestNameIdList()
 {
    if( m_FCChestNameIdList.size() == 0 )
-      loadIdList( m_FCChestNameDat, m_FCChestNameIdList );
+      loadIdList( getFCChestNameDat(), m_FCChestNameIdList );
    return m_FCChestNameIdList;
 }
 const std::set< uint32_t >& getFccShopIdList()
 {
    if( m_FccShopIdList.size() == 0 )
-      loadIdList( m_FccShopDat, m_FccShopIdList );
+      loadIdList( getFccShopDat(), m_FccShopIdList );
    return m_FccShopIdList;
 }
 const std::set< uint32_t >& getFCHierarchyIdList()
 {
    if( m_FCHierarchyIdList.size() == 0 )
-      loadIdList( m_FCHierarchyDat, m_FCHierarchyIdList );
+      loadIdList( getFCHierarchyDat(), m_FCHierarchyIdList );
    return m_FCHierarchyIdList;
 }
 const std::set< uint32_t >& getFCProfileIdList()
 {
    if( m_FCProfileIdList.size() == 0 )
-      loadIdList( m_FCProfileDat, m_FCProfileIdList );
+      loadIdList( getFCProfileDat(), m_FCProfileIdList );
    return m_FCProfileIdList;
 }
 const std::set< uint32_t >& getFCReputationIdList()
 {
    if( m_FCReputationIdList.size() == 0 )
-      loadIdList( m_FCReputationDat, m_FCReputationIdList );
+      loadIdList( getFCReputationDat(), m_FCReputationIdList );
    return m_FCReputationIdList;
 }
 const std::set< uint32_t >& getFCRightsIdList()
 {
    if( m_FCRightsIdList.size() == 0 )
-      loadIdList( m_FCRightsDat, m_FCRightsIdList );
+      loadIdList( getFCRightsDat(), m_FCRightsIdList );
    return m_FCRightsIdList;
 }
 const std::set< uint32_t >& getFestivalIdList()
 {
    if( m_FestivalIdList.size() == 0 )
-      loadIdList( m_FestivalDat, m_FestivalIdList );
+      loadIdList( getFestivalDat(), m_FestivalIdList );
    return m_FestivalIdList;
 }
 const std::set< uint32_t >& getFieldMarkerIdList()
 {
    if( m_FieldMarkerIdList.size() == 0 )
-      loadIdList( m_FieldMarkerDat, m_FieldMarkerIdList );
+      loadIdList( getFieldMarkerDat(), m_FieldMarkerIdList );
    return m_FieldMarkerIdList;
 }
 const std::set< uint32_t >& getFishingRecordTypeIdList()
 {
    if( m_FishingRecordTypeIdList.size() == 0 )
-      loadIdList( m_FishingRecordTypeDat, m_FishingRecordTypeIdList );
+      loadIdList( getFishingRecordTypeDat(), m_FishingRecordTypeIdList );
    return m_FishingRecordTypeIdList;
 }
 const std::set< uint32_t >& getFishingRecordTypeTransientIdList()
 {
    if( m_FishingRecordTypeTransientIdList.size() == 0 )
-      loadIdList( m_FishingRecordTypeTransientDat, m_FishingRecordTypeTransientIdList );
+      loadIdList( getFishingRecordTypeTransientDat(), m_FishingRecordTypeTransientIdList );
    return m_FishingRecordTypeTransientIdList;
 }
 const std::set< uint32_t >& getFishingSpotIdList()
 {
    if( m_FishingSpotIdList.size() == 0 )
-      loadIdList( m_FishingSpotDat, m_FishingSpotIdList );
+      loadIdList( getFishingSpotDat(), m_FishingSpotIdList );
    return m_FishingSpotIdList;
 }
 const std::set< uint32_t >& getFishParameterIdList()
 {
    if( m_FishParameterIdList.size() == 0 )
-      loadIdList( m_FishParameterDat, m_FishParameterIdList );
+      loadIdList( getFishParameterDat(), m_FishParameterIdList );
    return m_FishParameterIdList;
 }
 const std::set< uint32_t >& getFrontline03IdList()
 {
    if( m_Frontline03IdList.size() == 0 )
-      loadIdList( m_Frontline03Dat, m_Frontline03IdList );
+      loadIdList( getFrontline03Dat(), m_Frontline03IdList );
    return m_Frontline03IdList;
 }
 const std::set< uint32_t >& getFrontline04IdList()
 {
    if( m_Frontline04IdList.size() == 0 )
-      loadIdList( m_Frontline04Dat, m_Frontline04IdList );
+      loadIdList( getFrontline04Dat(), m_Frontline04IdList );
    return m_Frontline04IdList;
 }
 const std::set< uint32_t >& getGardeningSeedIdList()
 {
    if( m_GardeningSeedIdList.size() == 0 )
-      loadIdList( m_GardeningSeedDat, m_GardeningSeedIdList );
+      loadIdList( getGardeningSeedDat(), m_GardeningSeedIdList );
    return m_GardeningSeedIdList;
 }
 const std::set< uint32_t >& getGatheringConditionIdList()
 {
    if( m_GatheringConditionIdList.size() == 0 )
-      loadIdList( m_GatheringConditionDat, m_GatheringConditionIdList );
+      loadIdList( getGatheringConditionDat(), m_GatheringConditionIdList );
    return m_GatheringConditionIdList;
 }
 const std::set< uint32_t >& getGatheringExpIdList()
 {
    if( m_GatheringExpIdList.size() == 0 )
-      loadIdList( m_GatheringExpDat, m_GatheringExpIdList );
+      loadIdList( getGatheringExpDat(), m_GatheringExpIdList );
    return m_GatheringExpIdList;
 }
 const std::set< uint32_t >& getGatheringItemIdList()
 {
    if( m_GatheringItemIdList.size() == 0 )
-      loadIdList( m_GatheringItemDat, m_GatheringItemIdList );
+      loadIdList( getGatheringItemDat(), m_GatheringItemIdList );
    return m_GatheringItemIdList;
 }
 const std::set< uint32_t >& getGatheringItemLevelConvertTableIdList()
 {
    if( m_GatheringItemLevelConvertTableIdList.size() == 0 )
-      loadIdList( m_GatheringItemLevelConvertTableDat, m_GatheringItemLevelConvertTableIdList );
+      loadIdList( getGatheringItemLevelConvertTableDat(), m_GatheringItemLevelConvertTableIdList );
    return m_GatheringItemLevelConvertTableIdList;
 }
 const std::set< uint32_t >& getGatheringItemPointIdList()
 {
    if( m_GatheringItemPointIdList.size() == 0 )
-      loadIdList( m_GatheringItemPointDat, m_GatheringItemPointIdList );
+      loadIdList( getGatheringItemPointDat(), m_GatheringItemPointIdList );
    return m_GatheringItemPointIdList;
 }
 const std::set< uint32_t >& getGatheringLeveIdList()
 {
    if( m_GatheringLeveIdList.size() == 0 )
-      loadIdList( m_GatheringLeveDat, m_GatheringLeveIdList );
+      loadIdList( getGatheringLeveDat(), m_GatheringLeveIdList );
    return m_GatheringLeveIdList;
 }
 const std::set< uint32_t >& getGatheringLeveRouteIdList()
 {
    if( m_GatheringLeveRouteIdList.size() == 0 )
-      loadIdList( m_GatheringLeveRouteDat, m_GatheringLeveRouteIdList );
+      loadIdList( getGatheringLeveRouteDat(), m_GatheringLeveRouteIdList );
    return m_GatheringLeveRouteIdList;
 }
 const std::set< uint32_t >& getGatheringNotebookListIdList()
 {
    if( m_GatheringNotebookListIdList.size() == 0 )
-      loadIdList( m_GatheringNotebookListDat, m_GatheringNotebookListIdList );
+      loadIdList( getGatheringNotebookListDat(), m_GatheringNotebookListIdList );
    return m_GatheringNotebookListIdList;
 }
 const std::set< uint32_t >& getGatheringPointIdList()
 {
    if( m_GatheringPointIdList.size() == 0 )
-      loadIdList( m_GatheringPointDat, m_GatheringPointIdList );
+      loadIdList( getGatheringPointDat(), m_GatheringPointIdList );
    return m_GatheringPointIdList;
 }
 const std::set< uint32_t >& getGatheringPointBaseIdList()
 {
    if( m_GatheringPointBaseIdList.size() == 0 )
-      loadIdList( m_GatheringPointBaseDat, m_GatheringPointBaseIdList );
+      loadIdList( getGatheringPointBaseDat(), m_GatheringPointBaseIdList );
    return m_GatheringPointBaseIdList;
 }
 const std::set< uint32_t >& getGatheringPointBonusIdList()
 {
    if( m_GatheringPointBonusIdList.size() == 0 )
-      loadIdList( m_GatheringPointBonusDat, m_GatheringPointBonusIdList );
+      loadIdList( getGatheringPointBonusDat(), m_GatheringPointBonusIdList );
    return m_GatheringPointBonusIdList;
 }
 const std::set< uint32_t >& getGatheringPointBonusTypeIdList()
 {
    if( m_GatheringPointBonusTypeIdList.size() == 0 )
-      loadIdList( m_GatheringPointBonusTypeDat, m_GatheringPointBonusTypeIdList );
+      loadIdList( getGatheringPointBonusTypeDat(), m_GatheringPointBonusTypeIdList );
    return m_GatheringPointBonusTypeIdList;
 }
 const std::set< uint32_t >& getGatheringPointNameIdList()
 {
    if( m_GatheringPointNameIdList.size() == 0 )
-      loadIdList( m_GatheringPointNameDat, m_GatheringPointNameIdList );
+      loadIdList( getGatheringPointNameDat(), m_GatheringPointNameIdList );
    return m_GatheringPointNameIdList;
 }
 const std::set< uint32_t >& getGatheringSubCategoryIdList()
 {
    if( m_GatheringSubCategoryIdList.size() == 0 )
-      loadIdList( m_GatheringSubCategoryDat, m_GatheringSubCategoryIdList );
+      loadIdList( getGatheringSubCategoryDat(), m_GatheringSubCategoryIdList );
    return m_GatheringSubCategoryIdList;
 }
 const std::set< uint32_t >& getGatheringTypeIdList()
 {
    if( m_GatheringTypeIdList.size() == 0 )
-      loadIdList( m_GatheringTypeDat, m_GatheringTypeIdList );
+      loadIdList( getGatheringTypeDat(), m_GatheringTypeIdList );
    return m_GatheringTypeIdList;
 }
 const std::set< uint32_t >& getGcArmyCaptureTacticsIdList()
 {
    if( m_GcArmyCaptureTacticsIdList.size() == 0 )
-      loadIdList( m_GcArmyCaptureTacticsDat, m_GcArmyCaptureTacticsIdList );
+      loadIdList( getGcArmyCaptureTacticsDat(), m_GcArmyCaptureTacticsIdList );
    return m_GcArmyCaptureTacticsIdList;
 }
 const std::set< uint32_t >& getGcArmyExpeditionIdList()
 {
    if( m_GcArmyExpeditionIdList.size() == 0 )
-      loadIdList( m_GcArmyExpeditionDat, m_GcArmyExpeditionIdList );
+      loadIdList( getGcArmyExpeditionDat(), m_GcArmyExpeditionIdList );
    return m_GcArmyExpeditionIdList;
 }
 const std::set< uint32_t >& getGcArmyExpeditionMemberBonusIdList()
 {
    if( m_GcArmyExpeditionMemberBonusIdList.size() == 0 )
-      loadIdList( m_GcArmyExpeditionMemberBonusDat, m_GcArmyExpeditionMemberBonusIdList );
+      loadIdList( getGcArmyExpeditionMemberBonusDat(), m_GcArmyExpeditionMemberBonusIdList );
    return m_GcArmyExpeditionMemberBonusIdList;
 }
 const std::set< uint32_t >& getGcArmyExpeditionTypeIdList()
 {
    if( m_GcArmyExpeditionTypeIdList.size() == 0 )
-      loadIdList( m_GcArmyExpeditionTypeDat, m_GcArmyExpeditionTypeIdList );
+      loadIdList( getGcArmyExpeditionTypeDat(), m_GcArmyExpeditionTypeIdList );
    return m_GcArmyExpeditionTypeIdList;
 }
 const std::set< uint32_t >& getGcArmyMemberGrowIdList()
 {
    if( m_GcArmyMemberGrowIdList.size() == 0 )
-      loadIdList( m_GcArmyMemberGrowDat, m_GcArmyMemberGrowIdList );
+      loadIdList( getGcArmyMemberGrowDat(), m_GcArmyMemberGrowIdList );
    return m_GcArmyMemberGrowIdList;
 }
 const std::set< uint32_t >& getGcArmyTrainingIdList()
 {
    if( m_GcArmyTrainingIdList.size() == 0 )
-      loadIdList( m_GcArmyTrainingDat, m_GcArmyTrainingIdList );
+      loadIdList( getGcArmyTrainingDat(), m_GcArmyTrainingIdList );
    return m_GcArmyTrainingIdList;
 }
 const std::set< uint32_t >& getGCRankGridaniaFemaleTextIdList()
 {
    if( m_GCRankGridaniaFemaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankGridaniaFemaleTextDat, m_GCRankGridaniaFemaleTextIdList );
+      loadIdList( getGCRankGridaniaFemaleTextDat(), m_GCRankGridaniaFemaleTextIdList );
    return m_GCRankGridaniaFemaleTextIdList;
 }
 const std::set< uint32_t >& getGCRankGridaniaMaleTextIdList()
 {
    if( m_GCRankGridaniaMaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankGridaniaMaleTextDat, m_GCRankGridaniaMaleTextIdList );
+      loadIdList( getGCRankGridaniaMaleTextDat(), m_GCRankGridaniaMaleTextIdList );
    return m_GCRankGridaniaMaleTextIdList;
 }
 const std::set< uint32_t >& getGCRankLimsaFemaleTextIdList()
 {
    if( m_GCRankLimsaFemaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankLimsaFemaleTextDat, m_GCRankLimsaFemaleTextIdList );
+      loadIdList( getGCRankLimsaFemaleTextDat(), m_GCRankLimsaFemaleTextIdList );
    return m_GCRankLimsaFemaleTextIdList;
 }
 const std::set< uint32_t >& getGCRankLimsaMaleTextIdList()
 {
    if( m_GCRankLimsaMaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankLimsaMaleTextDat, m_GCRankLimsaMaleTextIdList );
+      loadIdList( getGCRankLimsaMaleTextDat(), m_GCRankLimsaMaleTextIdList );
    return m_GCRankLimsaMaleTextIdList;
 }
 const std::set< uint32_t >& getGCRankUldahFemaleTextIdList()
 {
    if( m_GCRankUldahFemaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankUldahFemaleTextDat, m_GCRankUldahFemaleTextIdList );
+      loadIdList( getGCRankUldahFemaleTextDat(), m_GCRankUldahFemaleTextIdList );
    return m_GCRankUldahFemaleTextIdList;
 }
 const std::set< uint32_t >& getGCRankUldahMaleTextIdList()
 {
    if( m_GCRankUldahMaleTextIdList.size() == 0 )
-      loadIdList( m_GCRankUldahMaleTextDat, m_GCRankUldahMaleTextIdList );
+      loadIdList( getGCRankUldahMaleTextDat(), m_GCRankUldahMaleTextIdList );
    return m_GCRankUldahMaleTextIdList;
 }
 const std::set< uint32_t >& getGCScripShopCategoryIdList()
 {
    if( m_GCScripShopCategoryIdList.size() == 0 )
-      loadIdList( m_GCScripShopCategoryDat, m_GCScripShopCategoryIdList );
+      loadIdList( getGCScripShopCategoryDat(), m_GCScripShopCategoryIdList );
    return m_GCScripShopCategoryIdList;
 }
 const std::set< uint32_t >& getGCScripShopItemIdList()
 {
    if( m_GCScripShopItemIdList.size() == 0 )
-      loadIdList( m_GCScripShopItemDat, m_GCScripShopItemIdList );
+      loadIdList( getGCScripShopItemDat(), m_GCScripShopItemIdList );
    return m_GCScripShopItemIdList;
 }
 const std::set< uint32_t >& getGCShopIdList()
 {
    if( m_GCShopIdList.size() == 0 )
-      loadIdList( m_GCShopDat, m_GCShopIdList );
+      loadIdList( getGCShopDat(), m_GCShopIdList );
    return m_GCShopIdList;
 }
 const std::set< uint32_t >& getGCShopItemCategoryIdList()
 {
    if( m_GCShopItemCategoryIdList.size() == 0 )
-      loadIdList( m_GCShopItemCategoryDat, m_GCShopItemCategoryIdList );
+      loadIdList( getGCShopItemCategoryDat(), m_GCShopItemCategoryIdList );
    return m_GCShopItemCategoryIdList;
 }
 const std::set< uint32_t >& getGCSupplyDutyIdList()
 {
    if( m_GCSupplyDutyIdList.size() == 0 )
-      loadIdList( m_GCSupplyDutyDat, m_GCSupplyDutyIdList );
+      loadIdList( getGCSupplyDutyDat(), m_GCSupplyDutyIdList );
    return m_GCSupplyDutyIdList;
 }
 const std::set< uint32_t >& getGCSupplyDutyRewardIdList()
 {
    if( m_GCSupplyDutyRewardIdList.size() == 0 )
-      loadIdList( m_GCSupplyDutyRewardDat, m_GCSupplyDutyRewardIdList );
+      loadIdList( getGCSupplyDutyRewardDat(), m_GCSupplyDutyRewardIdList );
    return m_GCSupplyDutyRewardIdList;
 }
 const std::set< uint32_t >& getGeneralActionIdList()
 {
    if( m_GeneralActionIdList.size() == 0 )
-      loadIdList( m_GeneralActionDat, m_GeneralActionIdList );
+      loadIdList( getGeneralActionDat(), m_GeneralActionIdList );
    return m_GeneralActionIdList;
 }
 const std::set< uint32_t >& getGFATEIdList()
 {
    if( m_GFATEIdList.size() == 0 )
-      loadIdList( m_GFATEDat, m_GFATEIdList );
+      loadIdList( getGFATEDat(), m_GFATEIdList );
    return m_GFATEIdList;
 }
 const std::set< uint32_t >& getGFateClimbing2IdList()
 {
    if( m_GFateClimbing2IdList.size() == 0 )
-      loadIdList( m_GFateClimbing2Dat, m_GFateClimbing2IdList );
+      loadIdList( getGFateClimbing2Dat(), m_GFateClimbing2IdList );
    return m_GFateClimbing2IdList;
 }
 const std::set< uint32_t >& getGFateClimbing2ContentIdList()
 {
    if( m_GFateClimbing2ContentIdList.size() == 0 )
-      loadIdList( m_GFateClimbing2ContentDat, m_GFateClimbing2ContentIdList );
+      loadIdList( getGFateClimbing2ContentDat(), m_GFateClimbing2ContentIdList );
    return m_GFateClimbing2ContentIdList;
 }
 const std::set< uint32_t >& getGFateClimbing2TotemTypeIdList()
 {
    if( m_GFateClimbing2TotemTypeIdList.size() == 0 )
-      loadIdList( m_GFateClimbing2TotemTypeDat, m_GFateClimbing2TotemTypeIdList );
+      loadIdList( getGFateClimbing2TotemTypeDat(), m_GFateClimbing2TotemTypeIdList );
    return m_GFateClimbing2TotemTypeIdList;
 }
 const std::set< uint32_t >& getGFateRideShootingIdList()
 {
    if( m_GFateRideShootingIdList.size() == 0 )
-      loadIdList( m_GFateRideShootingDat, m_GFateRideShootingIdList );
+      loadIdList( getGFateRideShootingDat(), m_GFateRideShootingIdList );
    return m_GFateRideShootingIdList;
 }
 const std::set< uint32_t >& getGilShopIdList()
 {
    if( m_GilShopIdList.size() == 0 )
-      loadIdList( m_GilShopDat, m_GilShopIdList );
+      loadIdList( getGilShopDat(), m_GilShopIdList );
    return m_GilShopIdList;
 }
 const std::set< uint32_t >& getGilShopItemIdList()
 {
    if( m_GilShopItemIdList.size() == 0 )
-      loadIdList( m_GilShopItemDat, m_GilShopItemIdList );
+      loadIdList( getGilShopItemDat(), m_GilShopItemIdList );
    return m_GilShopItemIdList;
 }
 const std::set< uint32_t >& getGoldSaucerArcadeMachineIdList()
 {
    if( m_GoldSaucerArcadeMachineIdList.size() == 0 )
-      loadIdList( m_GoldSaucerArcadeMachineDat, m_GoldSaucerArcadeMachineIdList );
+      loadIdList( getGoldSaucerArcadeMachineDat(), m_GoldSaucerArcadeMachineIdList );
    return m_GoldSaucerArcadeMachineIdList;
 }
 const std::set< uint32_t >& getGoldSaucerTextDataIdList()
 {
    if( m_GoldSaucerTextDataIdList.size() == 0 )
-      loadIdList( m_GoldSaucerTextDataDat, m_GoldSaucerTextDataIdList );
+      loadIdList( getGoldSaucerTextDataDat(), m_GoldSaucerTextDataIdList );
    return m_GoldSaucerTextDataIdList;
 }
 const std::set< uint32_t >& getGrandCompanyIdList()
 {
    if( m_GrandCompanyIdList.size() == 0 )
-      loadIdList( m_GrandCompanyDat, m_GrandCompanyIdList );
+      loadIdList( getGrandCompanyDat(), m_GrandCompanyIdList );
    return m_GrandCompanyIdList;
 }
 const std::set< uint32_t >& getGrandCompanyRankIdList()
 {
    if( m_GrandCompanyRankIdList.size() == 0 )
-      loadIdList( m_GrandCompanyRankDat, m_GrandCompanyRankIdList );
+      loadIdList( getGrandCompanyRankDat(), m_GrandCompanyRankIdList );
    return m_GrandCompanyRankIdList;
 }
 const std::set< uint32_t >& getGuardianDeityIdList()
 {
    if( m_GuardianDeityIdList.size() == 0 )
-      loadIdList( m_GuardianDeityDat, m_GuardianDeityIdList );
+      loadIdList( getGuardianDeityDat(), m_GuardianDeityIdList );
    return m_GuardianDeityIdList;
 }
 const std::set< uint32_t >& getGuildleveAssignmentIdList()
 {
    if( m_GuildleveAssignmentIdList.size() == 0 )
-      loadIdList( m_GuildleveAssignmentDat, m_GuildleveAssignmentIdList );
+      loadIdList( getGuildleveAssignmentDat(), m_GuildleveAssignmentIdList );
    return m_GuildleveAssignmentIdList;
 }
 const std::set< uint32_t >& getGuildleveAssignmentCategoryIdList()
 {
    if( m_GuildleveAssignmentCategoryIdList.size() == 0 )
-      loadIdList( m_GuildleveAssignmentCategoryDat, m_GuildleveAssignmentCategoryIdList );
+      loadIdList( getGuildleveAssignmentCategoryDat(), m_GuildleveAssignmentCategoryIdList );
    return m_GuildleveAssignmentCategoryIdList;
 }
 const std::set< uint32_t >& getGuildOrderGuideIdList()
 {
    if( m_GuildOrderGuideIdList.size() == 0 )
-      loadIdList( m_GuildOrderGuideDat, m_GuildOrderGuideIdList );
+      loadIdList( getGuildOrderGuideDat(), m_GuildOrderGuideIdList );
    return m_GuildOrderGuideIdList;
 }
 const std::set< uint32_t >& getGuildOrderOfficerIdList()
 {
    if( m_GuildOrderOfficerIdList.size() == 0 )
-      loadIdList( m_GuildOrderOfficerDat, m_GuildOrderOfficerIdList );
+      loadIdList( getGuildOrderOfficerDat(), m_GuildOrderOfficerIdList );
    return m_GuildOrderOfficerIdList;
 }
 const std::set< uint32_t >& getHairMakeTypeIdList()
 {
    if( m_HairMakeTypeIdList.size() == 0 )
-      loadIdList( m_HairMakeTypeDat, m_HairMakeTypeIdList );
+      loadIdList( getHairMakeTypeDat(), m_HairMakeTypeIdList );
    return m_HairMakeTypeIdList;
 }
 const std::set< uint32_t >& getHouseRetainerPoseIdList()
 {
    if( m_HouseRetainerPoseIdList.size() == 0 )
-      loadIdList( m_HouseRetainerPoseDat, m_HouseRetainerPoseIdList );
+      loadIdList( getHouseRetainerPoseDat(), m_HouseRetainerPoseIdList );
    return m_HouseRetainerPoseIdList;
 }
 const std::set< uint32_t >& getHousingAethernetIdList()
 {
    if( m_HousingAethernetIdList.size() == 0 )
-      loadIdList( m_HousingAethernetDat, m_HousingAethernetIdList );
+      loadIdList( getHousingAethernetDat(), m_HousingAethernetIdList );
    return m_HousingAethernetIdList;
 }
 const std::set< uint32_t >& getHousingAppealIdList()
 {
    if( m_HousingAppealIdList.size() == 0 )
-      loadIdList( m_HousingAppealDat, m_HousingAppealIdList );
+      loadIdList( getHousingAppealDat(), m_HousingAppealIdList );
    return m_HousingAppealIdList;
 }
 const std::set< uint32_t >& getHousingEmploymentNpcListIdList()
 {
    if( m_HousingEmploymentNpcListIdList.size() == 0 )
-      loadIdList( m_HousingEmploymentNpcListDat, m_HousingEmploymentNpcListIdList );
+      loadIdList( getHousingEmploymentNpcListDat(), m_HousingEmploymentNpcListIdList );
    return m_HousingEmploymentNpcListIdList;
 }
 const std::set< uint32_t >& getHousingEmploymentNpcRaceIdList()
 {
    if( m_HousingEmploymentNpcRaceIdList.size() == 0 )
-      loadIdList( m_HousingEmploymentNpcRaceDat, m_HousingEmploymentNpcRaceIdList );
+      loadIdList( getHousingEmploymentNpcRaceDat(), m_HousingEmploymentNpcRaceIdList );
    return m_HousingEmploymentNpcRaceIdList;
 }
 const std::set< uint32_t >& getHousingExteriorIdList()
 {
    if( m_HousingExteriorIdList.size() == 0 )
-      loadIdList( m_HousingExteriorDat, m_HousingExteriorIdList );
+      loadIdList( getHousingExteriorDat(), m_HousingExteriorIdList );
    return m_HousingExteriorIdList;
 }
 const std::set< uint32_t >& getHousingFurnitureIdList()
 {
    if( m_HousingFurnitureIdList.size() == 0 )
-      loadIdList( m_HousingFurnitureDat, m_HousingFurnitureIdList );
+      loadIdList( getHousingFurnitureDat(), m_HousingFurnitureIdList );
    return m_HousingFurnitureIdList;
 }
 const std::set< uint32_t >& getHousingLandSetIdList()
 {
    if( m_HousingLandSetIdList.size() == 0 )
-      loadIdList( m_HousingLandSetDat, m_HousingLandSetIdList );
+      loadIdList( getHousingLandSetDat(), m_HousingLandSetIdList );
    return m_HousingLandSetIdList;
 }
 const std::set< uint32_t >& getHousingMapMarkerInfoIdList()
 {
    if( m_HousingMapMarkerInfoIdList.size() == 0 )
-      loadIdList( m_HousingMapMarkerInfoDat, m_HousingMapMarkerInfoIdList );
+      loadIdList( getHousingMapMarkerInfoDat(), m_HousingMapMarkerInfoIdList );
    return m_HousingMapMarkerInfoIdList;
 }
 const std::set< uint32_t >& getHousingMerchantPoseIdList()
 {
    if( m_HousingMerchantPoseIdList.size() == 0 )
-      loadIdList( m_HousingMerchantPoseDat, m_HousingMerchantPoseIdList );
+      loadIdList( getHousingMerchantPoseDat(), m_HousingMerchantPoseIdList );
    return m_HousingMerchantPoseIdList;
 }
 const std::set< uint32_t >& getHousingPlacementIdList()
 {
    if( m_HousingPlacementIdList.size() == 0 )
-      loadIdList( m_HousingPlacementDat, m_HousingPlacementIdList );
+      loadIdList( getHousingPlacementDat(), m_HousingPlacementIdList );
    return m_HousingPlacementIdList;
 }
 const std::set< uint32_t >& getHousingPresetIdList()
 {
    if( m_HousingPresetIdList.size() == 0 )
-      loadIdList( m_HousingPresetDat, m_HousingPresetIdList );
+      loadIdList( getHousingPresetDat(), m_HousingPresetIdList );
    return m_HousingPresetIdList;
 }
 const std::set< uint32_t >& getHousingUnitedExteriorIdList()
 {
    if( m_HousingUnitedExteriorIdList.size() == 0 )
-      loadIdList( m_HousingUnitedExteriorDat, m_HousingUnitedExteriorIdList );
+      loadIdList( getHousingUnitedExteriorDat(), m_HousingUnitedExteriorIdList );
    return m_HousingUnitedExteriorIdList;
 }
 const std::set< uint32_t >& getHousingYardObjectIdList()
 {
    if( m_HousingYardObjectIdList.size() == 0 )
-      loadIdList( m_HousingYardObjectDat, m_HousingYardObjectIdList );
+      loadIdList( getHousingYardObjectDat(), m_HousingYardObjectIdList );
    return m_HousingYardObjectIdList;
 }
 const std::set< uint32_t >& getHowToIdList()
 {
    if( m_HowToIdList.size() == 0 )
-      loadIdList( m_HowToDat, m_HowToIdList );
+      loadIdList( getHowToDat(), m_HowToIdList );
    return m_HowToIdList;
 }
 const std::set< uint32_t >& getHowToCategoryIdList()
 {
    if( m_HowToCategoryIdList.size() == 0 )
-      loadIdList( m_HowToCategoryDat, m_HowToCategoryIdList );
+      loadIdList( getHowToCategoryDat(), m_HowToCategoryIdList );
    return m_HowToCategoryIdList;
 }
 const std::set< uint32_t >& getHowToPageIdList()
 {
    if( m_HowToPageIdList.size() == 0 )
-      loadIdList( m_HowToPageDat, m_HowToPageIdList );
+      loadIdList( getHowToPageDat(), m_HowToPageIdList );
    return m_HowToPageIdList;
 }
 const std::set< uint32_t >& getInstanceContentIdList()
 {
    if( m_InstanceContentIdList.size() == 0 )
-      loadIdList( m_InstanceContentDat, m_InstanceContentIdList );
+      loadIdList( getInstanceContentDat(), m_InstanceContentIdList );
    return m_InstanceContentIdList;
 }
 const std::set< uint32_t >& getInstanceContentBuffIdList()
 {
    if( m_InstanceContentBuffIdList.size() == 0 )
-      loadIdList( m_InstanceContentBuffDat, m_InstanceContentBuffIdList );
+      loadIdList( getInstanceContentBuffDat(), m_InstanceContentBuffIdList );
    return m_InstanceContentBuffIdList;
 }
 const std::set< uint32_t >& getInstanceContentCSBonusIdList()
 {
    if( m_InstanceContentCSBonusIdList.size() == 0 )
-      loadIdList( m_InstanceContentCSBonusDat, m_InstanceContentCSBonusIdList );
+      loadIdList( getInstanceContentCSBonusDat(), m_InstanceContentCSBonusIdList );
    return m_InstanceContentCSBonusIdList;
 }
 const std::set< uint32_t >& getInstanceContentGuideIdList()
 {
    if( m_InstanceContentGuideIdList.size() == 0 )
-      loadIdList( m_InstanceContentGuideDat, m_InstanceContentGuideIdList );
+      loadIdList( getInstanceContentGuideDat(), m_InstanceContentGuideIdList );
    return m_InstanceContentGuideIdList;
 }
 const std::set< uint32_t >& getInstanceContentTextDataIdList()
 {
    if( m_InstanceContentTextDataIdList.size() == 0 )
-      loadIdList( m_InstanceContentTextDataDat, m_InstanceContentTextDataIdList );
+      loadIdList( getInstanceContentTextDataDat(), m_InstanceContentTextDataIdList );
    return m_InstanceContentTextDataIdList;
 }
 const std::set< uint32_t >& getItemIdList()
 {
    if( m_ItemIdList.size() == 0 )
-      loadIdList( m_ItemDat, m_ItemIdList );
+      loadIdList( getItemDat(), m_ItemIdList );
    return m_ItemIdList;
 }
 const std::set< uint32_t >& getItemActionIdList()
 {
    if( m_ItemActionIdList.size() == 0 )
-      loadIdList( m_ItemActionDat, m_ItemActionIdList );
+      loadIdList( getItemActionDat(), m_ItemActionIdList );
    return m_ItemActionIdList;
 }
 const std::set< uint32_t >& getItemFoodIdList()
 {
    if( m_ItemFoodIdList.size() == 0 )
-      loadIdList( m_ItemFoodDat, m_ItemFoodIdList );
+      loadIdList( getItemFoodDat(), m_ItemFoodIdList );
    return m_ItemFoodIdList;
 }
 const std::set< uint32_t >& getItemLevelIdList()
 {
    if( m_ItemLevelIdList.size() == 0 )
-      loadIdList( m_ItemLevelDat, m_ItemLevelIdList );
+      loadIdList( getItemLevelDat(), m_ItemLevelIdList );
    return m_ItemLevelIdList;
 }
 const std::set< uint32_t >& getItemSearchCategoryIdList()
 {
    if( m_ItemSearchCategoryIdList.size() == 0 )
-      loadIdList( m_ItemSearchCategoryDat, m_ItemSearchCategoryIdList );
+      loadIdList( getItemSearchCategoryDat(), m_ItemSearchCategoryIdList );
    return m_ItemSearchCategoryIdList;
 }
 const std::set< uint32_t >& getItemSeriesIdList()
 {
    if( m_ItemSeriesIdList.size() == 0 )
-      loadIdList( m_ItemSeriesDat, m_ItemSeriesIdList );
+      loadIdList( getItemSeriesDat(), m_ItemSeriesIdList );
    return m_ItemSeriesIdList;
 }
 const std::set< uint32_t >& getItemSpecialBonusIdList()
 {
    if( m_ItemSpecialBonusIdList.size() == 0 )
-      loadIdList( m_ItemSpecialBonusDat, m_ItemSpecialBonusIdList );
+      loadIdList( getItemSpecialBonusDat(), m_ItemSpecialBonusIdList );
    return m_ItemSpecialBonusIdList;
 }
 const std::set< uint32_t >& getItemUICategoryIdList()
 {
    if( m_ItemUICategoryIdList.size() == 0 )
-      loadIdList( m_ItemUICategoryDat, m_ItemUICategoryIdList );
+      loadIdList( getItemUICategoryDat(), m_ItemUICategoryIdList );
    return m_ItemUICategoryIdList;
 }
 const std::set< uint32_t >& getJournalCategoryIdList()
 {
    if( m_JournalCategoryIdList.size() == 0 )
-      loadIdList( m_JournalCategoryDat, m_JournalCategoryIdList );
+      loadIdList( getJournalCategoryDat(), m_JournalCategoryIdList );
    return m_JournalCategoryIdList;
 }
 const std::set< uint32_t >& getJournalGenreIdList()
 {
    if( m_JournalGenreIdList.size() == 0 )
-      loadIdList( m_JournalGenreDat, m_JournalGenreIdList );
+      loadIdList( getJournalGenreDat(), m_JournalGenreIdList );
    return m_JournalGenreIdList;
 }
 const std::set< uint32_t >& getJournalSectionIdList()
 {
    if( m_JournalSectionIdList.size() == 0 )
-      loadIdList( m_JournalSectionDat, m_JournalSectionIdList );
+      loadIdList( getJournalSectionDat(), m_JournalSectionIdList );
    return m_JournalSectionIdList;
 }
 const std::set< uint32_t >& getLeveIdList()
 {
    if( m_LeveIdList.size() == 0 )
-      loadIdList( m_LeveDat, m_LeveIdList );
+      loadIdList( getLeveDat(), m_LeveIdList );
    return m_LeveIdList;
 }
 const std::set< uint32_t >& getLeveAssignmentTypeIdList()
 {
    if( m_LeveAssignmentTypeIdList.size() == 0 )
-      loadIdList( m_LeveAssignmentTypeDat, m_LeveAssignmentTypeIdList );
+      loadIdList( getLeveAssignmentTypeDat(), m_LeveAssignmentTypeIdList );
    return m_LeveAssignmentTypeIdList;
 }
 const std::set< uint32_t >& getLeveClientIdList()
 {
    if( m_LeveClientIdList.size() == 0 )
-      loadIdList( m_LeveClientDat, m_LeveClientIdList );
+      loadIdList( getLeveClientDat(), m_LeveClientIdList );
    return m_LeveClientIdList;
 }
 const std::set< uint32_t >& getLevelIdList()
 {
    if( m_LevelIdList.size() == 0 )
-      loadIdList( m_LevelDat, m_LevelIdList );
+      loadIdList( getLevelDat(), m_LevelIdList );
    return m_LevelIdList;
 }
 const std::set< uint32_t >& getLeveRewardItemIdList()
 {
    if( m_LeveRewardItemIdList.size() == 0 )
-      loadIdList( m_LeveRewardItemDat, m_LeveRewardItemIdList );
+      loadIdList( getLeveRewardItemDat(), m_LeveRewardItemIdList );
    return m_LeveRewardItemIdList;
 }
 const std::set< uint32_t >& getLeveRewardItemGroupIdList()
 {
    if( m_LeveRewardItemGroupIdList.size() == 0 )
-      loadIdList( m_LeveRewardItemGroupDat, m_LeveRewardItemGroupIdList );
+      loadIdList( getLeveRewardItemGroupDat(), m_LeveRewardItemGroupIdList );
    return m_LeveRewardItemGroupIdList;
 }
 const std::set< uint32_t >& getLeveVfxIdList()
 {
    if( m_LeveVfxIdList.size() == 0 )
-      loadIdList( m_LeveVfxDat, m_LeveVfxIdList );
+      loadIdList( getLeveVfxDat(), m_LeveVfxIdList );
    return m_LeveVfxIdList;
 }
 const std::set< uint32_t >& getLogFilterIdList()
 {
    if( m_LogFilterIdList.size() == 0 )
-      loadIdList( m_LogFilterDat, m_LogFilterIdList );
+      loadIdList( getLogFilterDat(), m_LogFilterIdList );
    return m_LogFilterIdList;
 }
 const std::set< uint32_t >& getLogKindIdList()
 {
    if( m_LogKindIdList.size() == 0 )
-      loadIdList( m_LogKindDat, m_LogKindIdList );
+      loadIdList( getLogKindDat(), m_LogKindIdList );
    return m_LogKindIdList;
 }
 const std::set< uint32_t >& getLogKindCategoryTextIdList()
 {
    if( m_LogKindCategoryTextIdList.size() == 0 )
-      loadIdList( m_LogKindCategoryTextDat, m_LogKindCategoryTextIdList );
+      loadIdList( getLogKindCategoryTextDat(), m_LogKindCategoryTextIdList );
    return m_LogKindCategoryTextIdList;
 }
 const std::set< uint32_t >& getLogMessageIdList()
 {
    if( m_LogMessageIdList.size() == 0 )
-      loadIdList( m_LogMessageDat, m_LogMessageIdList );
+      loadIdList( getLogMessageDat(), m_LogMessageIdList );
    return m_LogMessageIdList;
 }
 const std::set< uint32_t >& getLotteryExchangeShopIdList()
 {
    if( m_LotteryExchangeShopIdList.size() == 0 )
-      loadIdList( m_LotteryExchangeShopDat, m_LotteryExchangeShopIdList );
+      loadIdList( getLotteryExchangeShopDat(), m_LotteryExchangeShopIdList );
    return m_LotteryExchangeShopIdList;
 }
 const std::set< uint32_t >& getMacroIconIdList()
 {
    if( m_MacroIconIdList.size() == 0 )
-      loadIdList( m_MacroIconDat, m_MacroIconIdList );
+      loadIdList( getMacroIconDat(), m_MacroIconIdList );
    return m_MacroIconIdList;
 }
 const std::set< uint32_t >& getMacroIconRedirectOldIdList()
 {
    if( m_MacroIconRedirectOldIdList.size() == 0 )
-      loadIdList( m_MacroIconRedirectOldDat, m_MacroIconRedirectOldIdList );
+      loadIdList( getMacroIconRedirectOldDat(), m_MacroIconRedirectOldIdList );
    return m_MacroIconRedirectOldIdList;
 }
 const std::set< uint32_t >& getMainCommandIdList()
 {
    if( m_MainCommandIdList.size() == 0 )
-      loadIdList( m_MainCommandDat, m_MainCommandIdList );
+      loadIdList( getMainCommandDat(), m_MainCommandIdList );
    return m_MainCommandIdList;
 }
 const std::set< uint32_t >& getMainCommandCategoryIdList()
 {
    if( m_MainCommandCategoryIdList.size() == 0 )
-      loadIdList( m_MainCommandCategoryDat, m_MainCommandCategoryIdList );
+      loadIdList( getMainCommandCategoryDat(), m_MainCommandCategoryIdList );
    return m_MainCommandCategoryIdList;
 }
 const std::set< uint32_t >& getManeuversArmorIdList()
 {
    if( m_ManeuversArmorIdList.size() == 0 )
-      loadIdList( m_ManeuversArmorDat, m_ManeuversArmorIdList );
+      loadIdList( getManeuversArmorDat(), m_ManeuversArmorIdList );
    return m_ManeuversArmorIdList;
 }
 const std::set< uint32_t >& getMapIdList()
 {
    if( m_MapIdList.size() == 0 )
-      loadIdList( m_MapDat, m_MapIdList );
+      loadIdList( getMapDat(), m_MapIdList );
    return m_MapIdList;
 }
 const std::set< uint32_t >& getMapMarkerIdList()
 {
    if( m_MapMarkerIdList.size() == 0 )
-      loadIdList( m_MapMarkerDat, m_MapMarkerIdList );
+      loadIdList( getMapMarkerDat(), m_MapMarkerIdList );
    return m_MapMarkerIdList;
 }
 const std::set< uint32_t >& getMapMarkerRegionIdList()
 {
    if( m_MapMarkerRegionIdList.size() == 0 )
-      loadIdList( m_MapMarkerRegionDat, m_MapMarkerRegionIdList );
+      loadIdList( getMapMarkerRegionDat(), m_MapMarkerRegionIdList );
    return m_MapMarkerRegionIdList;
 }
 const std::set< uint32_t >& getMapSymbolIdList()
 {
    if( m_MapSymbolIdList.size() == 0 )
-      loadIdList( m_MapSymbolDat, m_MapSymbolIdList );
+      loadIdList( getMapSymbolDat(), m_MapSymbolIdList );
    return m_MapSymbolIdList;
 }
 const std::set< uint32_t >& getMarkerIdList()
 {
    if( m_MarkerIdList.size() == 0 )
-      loadIdList( m_MarkerDat, m_MarkerIdList );
+      loadIdList( getMarkerDat(), m_MarkerIdList );
    return m_MarkerIdList;
 }
 const std::set< uint32_t >& getMasterpieceSupplyDutyIdList()
 {
    if( m_MasterpieceSupplyDutyIdList.size() == 0 )
-      loadIdList( m_MasterpieceSupplyDutyDat, m_MasterpieceSupplyDutyIdList );
+      loadIdList( getMasterpieceSupplyDutyDat(), m_MasterpieceSupplyDutyIdList );
    return m_MasterpieceSupplyDutyIdList;
 }
 const std::set< uint32_t >& getMasterpieceSupplyMultiplierIdList()
 {
    if( m_MasterpieceSupplyMultiplierIdList.size() == 0 )
-      loadIdList( m_MasterpieceSupplyMultiplierDat, m_MasterpieceSupplyMultiplierIdList );
+      loadIdList( getMasterpieceSupplyMultiplierDat(), m_MasterpieceSupplyMultiplierIdList );
    return m_MasterpieceSupplyMultiplierIdList;
 }
 const std::set< uint32_t >& getMateriaIdList()
 {
    if( m_MateriaIdList.size() == 0 )
-      loadIdList( m_MateriaDat, m_MateriaIdList );
+      loadIdList( getMateriaDat(), m_MateriaIdList );
    return m_MateriaIdList;
 }
 const std::set< uint32_t >& getMiniGameRAIdList()
 {
    if( m_MiniGameRAIdList.size() == 0 )
-      loadIdList( m_MiniGameRADat, m_MiniGameRAIdList );
+      loadIdList( getMiniGameRADat(), m_MiniGameRAIdList );
    return m_MiniGameRAIdList;
 }
 const std::set< uint32_t >& getMinionRaceIdList()
 {
    if( m_MinionRaceIdList.size() == 0 )
-      loadIdList( m_MinionRaceDat, m_MinionRaceIdList );
+      loadIdList( getMinionRaceDat(), m_MinionRaceIdList );
    return m_MinionRaceIdList;
 }
 const std::set< uint32_t >& getMinionRulesIdList()
 {
    if( m_MinionRulesIdList.size() == 0 )
-      loadIdList( m_MinionRulesDat, m_MinionRulesIdList );
+      loadIdList( getMinionRulesDat(), m_MinionRulesIdList );
    return m_MinionRulesIdList;
 }
 const std::set< uint32_t >& getMinionSkillTypeIdList()
 {
    if( m_MinionSkillTypeIdList.size() == 0 )
-      loadIdList( m_MinionSkillTypeDat, m_MinionSkillTypeIdList );
+      loadIdList( getMinionSkillTypeDat(), m_MinionSkillTypeIdList );
    return m_MinionSkillTypeIdList;
 }
 const std::set< uint32_t >& getMobHuntOrderTypeIdList()
 {
    if( m_MobHuntOrderTypeIdList.size() == 0 )
-      loadIdList( m_MobHuntOrderTypeDat, m_MobHuntOrderTypeIdList );
+      loadIdList( getMobHuntOrderTypeDat(), m_MobHuntOrderTypeIdList );
    return m_MobHuntOrderTypeIdList;
 }
 const std::set< uint32_t >& getMobHuntTargetIdList()
 {
    if( m_MobHuntTargetIdList.size() == 0 )
-      loadIdList( m_MobHuntTargetDat, m_MobHuntTargetIdList );
+      loadIdList( getMobHuntTargetDat(), m_MobHuntTargetIdList );
    return m_MobHuntTargetIdList;
 }
 const std::set< uint32_t >& getModelCharaIdList()
 {
    if( m_ModelCharaIdList.size() == 0 )
-      loadIdList( m_ModelCharaDat, m_ModelCharaIdList );
+      loadIdList( getModelCharaDat(), m_ModelCharaIdList );
    return m_ModelCharaIdList;
 }
 const std::set< uint32_t >& getModelSkeletonIdList()
 {
    if( m_ModelSkeletonIdList.size() == 0 )
-      loadIdList( m_ModelSkeletonDat, m_ModelSkeletonIdList );
+      loadIdList( getModelSkeletonDat(), m_ModelSkeletonIdList );
    return m_ModelSkeletonIdList;
 }
 const std::set< uint32_t >& getModelStateIdList()
 {
    if( m_ModelStateIdList.size() == 0 )
-      loadIdList( m_ModelStateDat, m_ModelStateIdList );
+      loadIdList( getModelStateDat(), m_ModelStateIdList );
    return m_ModelStateIdList;
 }
 const std::set< uint32_t >& getMonsterNoteIdList()
 {
    if( m_MonsterNoteIdList.size() == 0 )
-      loadIdList( m_MonsterNoteDat, m_MonsterNoteIdList );
+      loadIdList( getMonsterNoteDat(), m_MonsterNoteIdList );
    return m_MonsterNoteIdList;
 }
 const std::set< uint32_t >& getMonsterNoteTargetIdList()
 {
    if( m_MonsterNoteTargetIdList.size() == 0 )
-      loadIdList( m_MonsterNoteTargetDat, m_MonsterNoteTargetIdList );
+      loadIdList( getMonsterNoteTargetDat(), m_MonsterNoteTargetIdList );
    return m_MonsterNoteTargetIdList;
 }
 const std::set< uint32_t >& getMountIdList()
 {
    if( m_MountIdList.size() == 0 )
-      loadIdList( m_MountDat, m_MountIdList );
+      loadIdList( getMountDat(), m_MountIdList );
    return m_MountIdList;
 }
 const std::set< uint32_t >& getMountActionIdList()
 {
    if( m_MountActionIdList.size() == 0 )
-      loadIdList( m_MountActionDat, m_MountActionIdList );
+      loadIdList( getMountActionDat(), m_MountActionIdList );
    return m_MountActionIdList;
 }
 const std::set< uint32_t >& getMountCustomizeIdList()
 {
    if( m_MountCustomizeIdList.size() == 0 )
-      loadIdList( m_MountCustomizeDat, m_MountCustomizeIdList );
+      loadIdList( getMountCustomizeDat(), m_MountCustomizeIdList );
    return m_MountCustomizeIdList;
 }
 const std::set< uint32_t >& getMountFlyingConditionIdList()
 {
    if( m_MountFlyingConditionIdList.size() == 0 )
-      loadIdList( m_MountFlyingConditionDat, m_MountFlyingConditionIdList );
+      loadIdList( getMountFlyingConditionDat(), m_MountFlyingConditionIdList );
    return m_MountFlyingConditionIdList;
 }
 const std::set< uint32_t >& getMountSpeedIdList()
 {
    if( m_MountSpeedIdList.size() == 0 )
-      loadIdList( m_MountSpeedDat, m_MountSpeedIdList );
+      loadIdList( getMountSpeedDat(), m_MountSpeedIdList );
    return m_MountSpeedIdList;
 }
 const std::set< uint32_t >& getMountTransientIdList()
 {
    if( m_MountTransientIdList.size() == 0 )
-      loadIdList( m_MountTransientDat, m_MountTransientIdList );
+      loadIdList( getMountTransientDat(), m_MountTransientIdList );
    return m_MountTransientIdList;
 }
 const std::set< uint32_t >& getMoveTimelineIdList()
 {
    if( m_MoveTimelineIdList.size() == 0 )
-      loadIdList( m_MoveTimelineDat, m_MoveTimelineIdList );
+      loadIdList( getMoveTimelineDat(), m_MoveTimelineIdList );
    return m_MoveTimelineIdList;
 }
 const std::set< uint32_t >& getMoveVfxIdList()
 {
    if( m_MoveVfxIdList.size() == 0 )
-      loadIdList( m_MoveVfxDat, m_MoveVfxIdList );
+      loadIdList( getMoveVfxDat(), m_MoveVfxIdList );
    return m_MoveVfxIdList;
 }
 const std::set< uint32_t >& getNotebookDivisionIdList()
 {
    if( m_NotebookDivisionIdList.size() == 0 )
-      loadIdList( m_NotebookDivisionDat, m_NotebookDivisionIdList );
+      loadIdList( getNotebookDivisionDat(), m_NotebookDivisionIdList );
    return m_NotebookDivisionIdList;
 }
 const std::set< uint32_t >& getNotebookDivisionCategoryIdList()
 {
    if( m_NotebookDivisionCategoryIdList.size() == 0 )
-      loadIdList( m_NotebookDivisionCategoryDat, m_NotebookDivisionCategoryIdList );
+      loadIdList( getNotebookDivisionCategoryDat(), m_NotebookDivisionCategoryIdList );
    return m_NotebookDivisionCategoryIdList;
 }
 const std::set< uint32_t >& getNpcEquipIdList()
 {
    if( m_NpcEquipIdList.size() == 0 )
-      loadIdList( m_NpcEquipDat, m_NpcEquipIdList );
+      loadIdList( getNpcEquipDat(), m_NpcEquipIdList );
    return m_NpcEquipIdList;
 }
 const std::set< uint32_t >& getNpcYellIdList()
 {
    if( m_NpcYellIdList.size() == 0 )
-      loadIdList( m_NpcYellDat, m_NpcYellIdList );
+      loadIdList( getNpcYellDat(), m_NpcYellIdList );
    return m_NpcYellIdList;
 }
 const std::set< uint32_t >& getOmenIdList()
 {
    if( m_OmenIdList.size() == 0 )
-      loadIdList( m_OmenDat, m_OmenIdList );
+      loadIdList( getOmenDat(), m_OmenIdList );
    return m_OmenIdList;
 }
 const std::set< uint32_t >& getOnlineStatusIdList()
 {
    if( m_OnlineStatusIdList.size() == 0 )
-      loadIdList( m_OnlineStatusDat, m_OnlineStatusIdList );
+      loadIdList( getOnlineStatusDat(), m_OnlineStatusIdList );
    return m_OnlineStatusIdList;
 }
 const std::set< uint32_t >& getOpeningIdList()
 {
    if( m_OpeningIdList.size() == 0 )
-      loadIdList( m_OpeningDat, m_OpeningIdList );
+      loadIdList( getOpeningDat(), m_OpeningIdList );
    return m_OpeningIdList;
 }
 const std::set< uint32_t >& getOrchestrionIdList()
 {
    if( m_OrchestrionIdList.size() == 0 )
-      loadIdList( m_OrchestrionDat, m_OrchestrionIdList );
+      loadIdList( getOrchestrionDat(), m_OrchestrionIdList );
    return m_OrchestrionIdList;
 }
 const std::set< uint32_t >& getOrchestrionCategoryIdList()
 {
    if( m_OrchestrionCategoryIdList.size() == 0 )
-      loadIdList( m_OrchestrionCategoryDat, m_OrchestrionCategoryIdList );
+      loadIdList( getOrchestrionCategoryDat(), m_OrchestrionCategoryIdList );
    return m_OrchestrionCategoryIdList;
 }
 const std::set< uint32_t >& getOrchestrionPathIdList()
 {
    if( m_OrchestrionPathIdList.size() == 0 )
-      loadIdList( m_OrchestrionPathDat, m_OrchestrionPathIdList );
+      loadIdList( getOrchestrionPathDat(), m_OrchestrionPathIdList );
    return m_OrchestrionPathIdList;
 }
 const std::set< uint32_t >& getOrchestrionUiparamIdList()
 {
    if( m_OrchestrionUiparamIdList.size() == 0 )
-      loadIdList( m_OrchestrionUiparamDat, m_OrchestrionUiparamIdList );
+      loadIdList( getOrchestrionUiparamDat(), m_OrchestrionUiparamIdList );
    return m_OrchestrionUiparamIdList;
 }
 const std::set< uint32_t >& getParamGrowIdList()
 {
    if( m_ParamGrowIdList.size() == 0 )
-      loadIdList( m_ParamGrowDat, m_ParamGrowIdList );
+      loadIdList( getParamGrowDat(), m_ParamGrowIdList );
    return m_ParamGrowIdList;
 }
 const std::set< uint32_t >& getPartyContentIdList()
 {
    if( m_PartyContentIdList.size() == 0 )
-      loadIdList( m_PartyContentDat, m_PartyContentIdList );
+      loadIdList( getPartyContentDat(), m_PartyContentIdList );
    return m_PartyContentIdList;
 }
 const std::set< uint32_t >& getPartyContentCutsceneIdList()
 {
    if( m_PartyContentCutsceneIdList.size() == 0 )
-      loadIdList( m_PartyContentCutsceneDat, m_PartyContentCutsceneIdList );
+      loadIdList( getPartyContentCutsceneDat(), m_PartyContentCutsceneIdList );
    return m_PartyContentCutsceneIdList;
 }
 const std::set< uint32_t >& getPartyContentTextDataIdList()
 {
    if( m_PartyContentTextDataIdList.size() == 0 )
-      loadIdList( m_PartyContentTextDataDat, m_PartyContentTextDataIdList );
+      loadIdList( getPartyContentTextDataDat(), m_PartyContentTextDataIdList );
    return m_PartyContentTextDataIdList;
 }
 const std::set< uint32_t >& getPerformIdList()
 {
    if( m_PerformIdList.size() == 0 )
-      loadIdList( m_PerformDat, m_PerformIdList );
+      loadIdList( getPerformDat(), m_PerformIdList );
    return m_PerformIdList;
 }
 const std::set< uint32_t >& getPerformTransientIdList()
 {
    if( m_PerformTransientIdList.size() == 0 )
-      loadIdList( m_PerformTransientDat, m_PerformTransientIdList );
+      loadIdList( getPerformTransientDat(), m_PerformTransientIdList );
    return m_PerformTransientIdList;
 }
 const std::set< uint32_t >& getPetIdList()
 {
    if( m_PetIdList.size() == 0 )
-      loadIdList( m_PetDat, m_PetIdList );
+      loadIdList( getPetDat(), m_PetIdList );
    return m_PetIdList;
 }
 const std::set< uint32_t >& getPetActionIdList()
 {
    if( m_PetActionIdList.size() == 0 )
-      loadIdList( m_PetActionDat, m_PetActionIdList );
+      loadIdList( getPetActionDat(), m_PetActionIdList );
    return m_PetActionIdList;
 }
 const std::set< uint32_t >& getPictureIdList()
 {
    if( m_PictureIdList.size() == 0 )
-      loadIdList( m_PictureDat, m_PictureIdList );
+      loadIdList( getPictureDat(), m_PictureIdList );
    return m_PictureIdList;
 }
 const std::set< uint32_t >& getPlaceNameIdList()
 {
    if( m_PlaceNameIdList.size() == 0 )
-      loadIdList( m_PlaceNameDat, m_PlaceNameIdList );
+      loadIdList( getPlaceNameDat(), m_PlaceNameIdList );
    return m_PlaceNameIdList;
 }
 const std::set< uint32_t >& getPlantPotFlowerSeedIdList()
 {
    if( m_PlantPotFlowerSeedIdList.size() == 0 )
-      loadIdList( m_PlantPotFlowerSeedDat, m_PlantPotFlowerSeedIdList );
+      loadIdList( getPlantPotFlowerSeedDat(), m_PlantPotFlowerSeedIdList );
    return m_PlantPotFlowerSeedIdList;
 }
 const std::set< uint32_t >& getPreHandlerIdList()
 {
    if( m_PreHandlerIdList.size() == 0 )
-      loadIdList( m_PreHandlerDat, m_PreHandlerIdList );
+      loadIdList( getPreHandlerDat(), m_PreHandlerIdList );
    return m_PreHandlerIdList;
 }
 const std::set< uint32_t >& getPublicContentIdList()
 {
    if( m_PublicContentIdList.size() == 0 )
-      loadIdList( m_PublicContentDat, m_PublicContentIdList );
+      loadIdList( getPublicContentDat(), m_PublicContentIdList );
    return m_PublicContentIdList;
 }
 const std::set< uint32_t >& getPublicContentCutsceneIdList()
 {
    if( m_PublicContentCutsceneIdList.size() == 0 )
-      loadIdList( m_PublicContentCutsceneDat, m_PublicContentCutsceneIdList );
+      loadIdList( getPublicContentCutsceneDat(), m_PublicContentCutsceneIdList );
    return m_PublicContentCutsceneIdList;
 }
 const std::set< uint32_t >& getPublicContentTextDataIdList()
 {
    if( m_PublicContentTextDataIdList.size() == 0 )
-      loadIdList( m_PublicContentTextDataDat, m_PublicContentTextDataIdList );
+      loadIdList( getPublicContentTextDataDat(), m_PublicContentTextDataIdList );
    return m_PublicContentTextDataIdList;
 }
 const std::set< uint32_t >& getPvPActionIdList()
 {
    if( m_PvPActionIdList.size() == 0 )
-      loadIdList( m_PvPActionDat, m_PvPActionIdList );
+      loadIdList( getPvPActionDat(), m_PvPActionIdList );
    return m_PvPActionIdList;
 }
 const std::set< uint32_t >& getPvPActionSortIdList()
 {
    if( m_PvPActionSortIdList.size() == 0 )
-      loadIdList( m_PvPActionSortDat, m_PvPActionSortIdList );
+      loadIdList( getPvPActionSortDat(), m_PvPActionSortIdList );
    return m_PvPActionSortIdList;
 }
 const std::set< uint32_t >& getPvPRankIdList()
 {
    if( m_PvPRankIdList.size() == 0 )
-      loadIdList( m_PvPRankDat, m_PvPRankIdList );
+      loadIdList( getPvPRankDat(), m_PvPRankIdList );
    return m_PvPRankIdList;
 }
 const std::set< uint32_t >& getPvPSelectTraitIdList()
 {
    if( m_PvPSelectTraitIdList.size() == 0 )
-      loadIdList( m_PvPSelectTraitDat, m_PvPSelectTraitIdList );
+      loadIdList( getPvPSelectTraitDat(), m_PvPSelectTraitIdList );
    return m_PvPSelectTraitIdList;
 }
 const std::set< uint32_t >& getPvPTraitIdList()
 {
    if( m_PvPTraitIdList.size() == 0 )
-      loadIdList( m_PvPTraitDat, m_PvPTraitIdList );
+      loadIdList( getPvPTraitDat(), m_PvPTraitIdList );
    return m_PvPTraitIdList;
 }
 const std::set< uint32_t >& getQuestIdList()
 {
    if( m_QuestIdList.size() == 0 )
-      loadIdList( m_QuestDat, m_QuestIdList );
+      loadIdList( getQuestDat(), m_QuestIdList );
    return m_QuestIdList;
 }
 const std::set< uint32_t >& getQuestBattleIdList()
 {
    if( m_QuestBattleIdList.size() == 0 )
-      loadIdList( m_QuestBattleDat, m_QuestBattleIdList );
+      loadIdList( getQuestBattleDat(), m_QuestBattleIdList );
    return m_QuestBattleIdList;
 }
 const std::set< uint32_t >& getQuestClassJobRewardIdList()
 {
    if( m_QuestClassJobRewardIdList.size() == 0 )
-      loadIdList( m_QuestClassJobRewardDat, m_QuestClassJobRewardIdList );
+      loadIdList( getQuestClassJobRewardDat(), m_QuestClassJobRewardIdList );
    return m_QuestClassJobRewardIdList;
 }
 const std::set< uint32_t >& getQuestClassJobSupplyIdList()
 {
    if( m_QuestClassJobSupplyIdList.size() == 0 )
-      loadIdList( m_QuestClassJobSupplyDat, m_QuestClassJobSupplyIdList );
+      loadIdList( getQuestClassJobSupplyDat(), m_QuestClassJobSupplyIdList );
    return m_QuestClassJobSupplyIdList;
 }
 const std::set< uint32_t >& getQuestRepeatFlagIdList()
 {
    if( m_QuestRepeatFlagIdList.size() == 0 )
-      loadIdList( m_QuestRepeatFlagDat, m_QuestRepeatFlagIdList );
+      loadIdList( getQuestRepeatFlagDat(), m_QuestRepeatFlagIdList );
    return m_QuestRepeatFlagIdList;
 }
 const std::set< uint32_t >& getQuestRewardOtherIdList()
 {
    if( m_QuestRewardOtherIdList.size() == 0 )
-      loadIdList( m_QuestRewardOtherDat, m_QuestRewardOtherIdList );
+      loadIdList( getQuestRewardOtherDat(), m_QuestRewardOtherIdList );
    return m_QuestRewardOtherIdList;
 }
 const std::set< uint32_t >& getQuickChatIdList()
 {
    if( m_QuickChatIdList.size() == 0 )
-      loadIdList( m_QuickChatDat, m_QuickChatIdList );
+      loadIdList( getQuickChatDat(), m_QuickChatIdList );
    return m_QuickChatIdList;
 }
 const std::set< uint32_t >& getQuickChatTransientIdList()
 {
    if( m_QuickChatTransientIdList.size() == 0 )
-      loadIdList( m_QuickChatTransientDat, m_QuickChatTransientIdList );
+      loadIdList( getQuickChatTransientDat(), m_QuickChatTransientIdList );
    return m_QuickChatTransientIdList;
 }
 const std::set< uint32_t >& getRaceIdList()
 {
    if( m_RaceIdList.size() == 0 )
-      loadIdList( m_RaceDat, m_RaceIdList );
+      loadIdList( getRaceDat(), m_RaceIdList );
    return m_RaceIdList;
 }
 const std::set< uint32_t >& getRacingChocoboItemIdList()
 {
    if( m_RacingChocoboItemIdList.size() == 0 )
-      loadIdList( m_RacingChocoboItemDat, m_RacingChocoboItemIdList );
+      loadIdList( getRacingChocoboItemDat(), m_RacingChocoboItemIdList );
    return m_RacingChocoboItemIdList;
 }
 const std::set< uint32_t >& getRacingChocoboNameIdList()
 {
    if( m_RacingChocoboNameIdList.size() == 0 )
-      loadIdList( m_RacingChocoboNameDat, m_RacingChocoboNameIdList );
+      loadIdList( getRacingChocoboNameDat(), m_RacingChocoboNameIdList );
    return m_RacingChocoboNameIdList;
 }
 const std::set< uint32_t >& getRacingChocoboNameCategoryIdList()
 {
    if( m_RacingChocoboNameCategoryIdList.size() == 0 )
-      loadIdList( m_RacingChocoboNameCategoryDat, m_RacingChocoboNameCategoryIdList );
+      loadIdList( getRacingChocoboNameCategoryDat(), m_RacingChocoboNameCategoryIdList );
    return m_RacingChocoboNameCategoryIdList;
 }
 const std::set< uint32_t >& getRacingChocoboNameInfoIdList()
 {
    if( m_RacingChocoboNameInfoIdList.size() == 0 )
-      loadIdList( m_RacingChocoboNameInfoDat, m_RacingChocoboNameInfoIdList );
+      loadIdList( getRacingChocoboNameInfoDat(), m_RacingChocoboNameInfoIdList );
    return m_RacingChocoboNameInfoIdList;
 }
 const std::set< uint32_t >& getRacingChocoboParamIdList()
 {
    if( m_RacingChocoboParamIdList.size() == 0 )
-      loadIdList( m_RacingChocoboParamDat, m_RacingChocoboParamIdList );
+      loadIdList( getRacingChocoboParamDat(), m_RacingChocoboParamIdList );
    return m_RacingChocoboParamIdList;
 }
 const std::set< uint32_t >& getRecastNavimeshIdList()
 {
    if( m_RecastNavimeshIdList.size() == 0 )
-      loadIdList( m_RecastNavimeshDat, m_RecastNavimeshIdList );
+      loadIdList( getRecastNavimeshDat(), m_RecastNavimeshIdList );
    return m_RecastNavimeshIdList;
 }
 const std::set< uint32_t >& getRecipeIdList()
 {
    if( m_RecipeIdList.size() == 0 )
-      loadIdList( m_RecipeDat, m_RecipeIdList );
+      loadIdList( getRecipeDat(), m_RecipeIdList );
    return m_RecipeIdList;
 }
 const std::set< uint32_t >& getRecipeElementIdList()
 {
    if( m_RecipeElementIdList.size() == 0 )
-      loadIdList( m_RecipeElementDat, m_RecipeElementIdList );
+      loadIdList( getRecipeElementDat(), m_RecipeElementIdList );
    return m_RecipeElementIdList;
 }
 const std::set< uint32_t >& getRecipeLevelTableIdList()
 {
    if( m_RecipeLevelTableIdList.size() == 0 )
-      loadIdList( m_RecipeLevelTableDat, m_RecipeLevelTableIdList );
+      loadIdList( getRecipeLevelTableDat(), m_RecipeLevelTableIdList );
    return m_RecipeLevelTableIdList;
 }
 const std::set< uint32_t >& getRecipeNotebookListIdList()
 {
    if( m_RecipeNotebookListIdList.size() == 0 )
-      loadIdList( m_RecipeNotebookListDat, m_RecipeNotebookListIdList );
+      loadIdList( getRecipeNotebookListDat(), m_RecipeNotebookListIdList );
    return m_RecipeNotebookListIdList;
 }
 const std::set< uint32_t >& getRecommendContentsIdList()
 {
    if( m_RecommendContentsIdList.size() == 0 )
-      loadIdList( m_RecommendContentsDat, m_RecommendContentsIdList );
+      loadIdList( getRecommendContentsDat(), m_RecommendContentsIdList );
    return m_RecommendContentsIdList;
 }
 const std::set< uint32_t >& getRelicIdList()
 {
    if( m_RelicIdList.size() == 0 )
-      loadIdList( m_RelicDat, m_RelicIdList );
+      loadIdList( getRelicDat(), m_RelicIdList );
    return m_RelicIdList;
 }
 const std::set< uint32_t >& getRelic3IdList()
 {
    if( m_Relic3IdList.size() == 0 )
-      loadIdList( m_Relic3Dat, m_Relic3IdList );
+      loadIdList( getRelic3Dat(), m_Relic3IdList );
    return m_Relic3IdList;
 }
 const std::set< uint32_t >& getRelicItemIdList()
 {
    if( m_RelicItemIdList.size() == 0 )
-      loadIdList( m_RelicItemDat, m_RelicItemIdList );
+      loadIdList( getRelicItemDat(), m_RelicItemIdList );
    return m_RelicItemIdList;
 }
 const std::set< uint32_t >& getRelicNoteIdList()
 {
    if( m_RelicNoteIdList.size() == 0 )
-      loadIdList( m_RelicNoteDat, m_RelicNoteIdList );
+      loadIdList( getRelicNoteDat(), m_RelicNoteIdList );
    return m_RelicNoteIdList;
 }
 const std::set< uint32_t >& getRelicNoteCategoryIdList()
 {
    if( m_RelicNoteCategoryIdList.size() == 0 )
-      loadIdList( m_RelicNoteCategoryDat, m_RelicNoteCategoryIdList );
+      loadIdList( getRelicNoteCategoryDat(), m_RelicNoteCategoryIdList );
    return m_RelicNoteCategoryIdList;
 }
 const std::set< uint32_t >& getResidentIdList()
 {
    if( m_ResidentIdList.size() == 0 )
-      loadIdList( m_ResidentDat, m_ResidentIdList );
+      loadIdList( getResidentDat(), m_ResidentIdList );
    return m_ResidentIdList;
 }
 const std::set< uint32_t >& getRetainerTaskIdList()
 {
    if( m_RetainerTaskIdList.size() == 0 )
-      loadIdList( m_RetainerTaskDat, m_RetainerTaskIdList );
+      loadIdList( getRetainerTaskDat(), m_RetainerTaskIdList );
    return m_RetainerTaskIdList;
 }
 const std::set< uint32_t >& getRetainerTaskLvRangeIdList()
 {
    if( m_RetainerTaskLvRangeIdList.size() == 0 )
-      loadIdList( m_RetainerTaskLvRangeDat, m_RetainerTaskLvRangeIdList );
+      loadIdList( getRetainerTaskLvRangeDat(), m_RetainerTaskLvRangeIdList );
    return m_RetainerTaskLvRangeIdList;
 }
 const std::set< uint32_t >& getRetainerTaskNormalIdList()
 {
    if( m_RetainerTaskNormalIdList.size() == 0 )
-      loadIdList( m_RetainerTaskNormalDat, m_RetainerTaskNormalIdList );
+      loadIdList( getRetainerTaskNormalDat(), m_RetainerTaskNormalIdList );
    return m_RetainerTaskNormalIdList;
 }
 const std::set< uint32_t >& getRetainerTaskParameterIdList()
 {
    if( m_RetainerTaskParameterIdList.size() == 0 )
-      loadIdList( m_RetainerTaskParameterDat, m_RetainerTaskParameterIdList );
+      loadIdList( getRetainerTaskParameterDat(), m_RetainerTaskParameterIdList );
    return m_RetainerTaskParameterIdList;
 }
 const std::set< uint32_t >& getRetainerTaskRandomIdList()
 {
    if( m_RetainerTaskRandomIdList.size() == 0 )
-      loadIdList( m_RetainerTaskRandomDat, m_RetainerTaskRandomIdList );
+      loadIdList( getRetainerTaskRandomDat(), m_RetainerTaskRandomIdList );
    return m_RetainerTaskRandomIdList;
 }
 const std::set< uint32_t >& getRPParameterIdList()
 {
    if( m_RPParameterIdList.size() == 0 )
-      loadIdList( m_RPParameterDat, m_RPParameterIdList );
+      loadIdList( getRPParameterDat(), m_RPParameterIdList );
    return m_RPParameterIdList;
 }
 const std::set< uint32_t >& getSalvageIdList()
 {
    if( m_SalvageIdList.size() == 0 )
-      loadIdList( m_SalvageDat, m_SalvageIdList );
+      loadIdList( getSalvageDat(), m_SalvageIdList );
    return m_SalvageIdList;
 }
 const std::set< uint32_t >& getSatisfactionNpcIdList()
 {
    if( m_SatisfactionNpcIdList.size() == 0 )
-      loadIdList( m_SatisfactionNpcDat, m_SatisfactionNpcIdList );
+      loadIdList( getSatisfactionNpcDat(), m_SatisfactionNpcIdList );
    return m_SatisfactionNpcIdList;
 }
 const std::set< uint32_t >& getSatisfactionSupplyIdList()
 {
    if( m_SatisfactionSupplyIdList.size() == 0 )
-      loadIdList( m_SatisfactionSupplyDat, m_SatisfactionSupplyIdList );
+      loadIdList( getSatisfactionSupplyDat(), m_SatisfactionSupplyIdList );
    return m_SatisfactionSupplyIdList;
 }
 const std::set< uint32_t >& getSatisfactionSupplyRewardIdList()
 {
    if( m_SatisfactionSupplyRewardIdList.size() == 0 )
-      loadIdList( m_SatisfactionSupplyRewardDat, m_SatisfactionSupplyRewardIdList );
+      loadIdList( getSatisfactionSupplyRewardDat(), m_SatisfactionSupplyRewardIdList );
    return m_SatisfactionSupplyRewardIdList;
 }
 const std::set< uint32_t >& getScenarioTreeIdList()
 {
    if( m_ScenarioTreeIdList.size() == 0 )
-      loadIdList( m_ScenarioTreeDat, m_ScenarioTreeIdList );
+      loadIdList( getScenarioTreeDat(), m_ScenarioTreeIdList );
    return m_ScenarioTreeIdList;
 }
 const std::set< uint32_t >& getScenarioTreeTipsIdList()
 {
    if( m_ScenarioTreeTipsIdList.size() == 0 )
-      loadIdList( m_ScenarioTreeTipsDat, m_ScenarioTreeTipsIdList );
+      loadIdList( getScenarioTreeTipsDat(), m_ScenarioTreeTipsIdList );
    return m_ScenarioTreeTipsIdList;
 }
 const std::set< uint32_t >& getScenarioTreeTipsClassQuestIdList()
 {
    if( m_ScenarioTreeTipsClassQuestIdList.size() == 0 )
-      loadIdList( m_ScenarioTreeTipsClassQuestDat, m_ScenarioTreeTipsClassQuestIdList );
+      loadIdList( getScenarioTreeTipsClassQuestDat(), m_ScenarioTreeTipsClassQuestIdList );
    return m_ScenarioTreeTipsClassQuestIdList;
 }
 const std::set< uint32_t >& getScenarioTreeTipsQuestIdList()
 {
    if( m_ScenarioTreeTipsQuestIdList.size() == 0 )
-      loadIdList( m_ScenarioTreeTipsQuestDat, m_ScenarioTreeTipsQuestIdList );
+      loadIdList( getScenarioTreeTipsQuestDat(), m_ScenarioTreeTipsQuestIdList );
    return m_ScenarioTreeTipsQuestIdList;
 }
 const std::set< uint32_t >& getScenarioTypeIdList()
 {
    if( m_ScenarioTypeIdList.size() == 0 )
-      loadIdList( m_ScenarioTypeDat, m_ScenarioTypeIdList );
+      loadIdList( getScenarioTypeDat(), m_ScenarioTypeIdList );
    return m_ScenarioTypeIdList;
 }
 const std::set< uint32_t >& getScreenImageIdList()
 {
    if( m_ScreenImageIdList.size() == 0 )
-      loadIdList( m_ScreenImageDat, m_ScreenImageIdList );
+      loadIdList( getScreenImageDat(), m_ScreenImageIdList );
    return m_ScreenImageIdList;
 }
 const std::set< uint32_t >& getSecretRecipeBookIdList()
 {
    if( m_SecretRecipeBookIdList.size() == 0 )
-      loadIdList( m_SecretRecipeBookDat, m_SecretRecipeBookIdList );
+      loadIdList( getSecretRecipeBookDat(), m_SecretRecipeBookIdList );
    return m_SecretRecipeBookIdList;
 }
 const std::set< uint32_t >& getSkyIsland2MissionIdList()
 {
    if( m_SkyIsland2MissionIdList.size() == 0 )
-      loadIdList( m_SkyIsland2MissionDat, m_SkyIsland2MissionIdList );
+      loadIdList( getSkyIsland2MissionDat(), m_SkyIsland2MissionIdList );
    return m_SkyIsland2MissionIdList;
 }
 const std::set< uint32_t >& getSkyIsland2MissionDetailIdList()
 {
    if( m_SkyIsland2MissionDetailIdList.size() == 0 )
-      loadIdList( m_SkyIsland2MissionDetailDat, m_SkyIsland2MissionDetailIdList );
+      loadIdList( getSkyIsland2MissionDetailDat(), m_SkyIsland2MissionDetailIdList );
    return m_SkyIsland2MissionDetailIdList;
 }
 const std::set< uint32_t >& getSkyIsland2MissionTypeIdList()
 {
    if( m_SkyIsland2MissionTypeIdList.size() == 0 )
-      loadIdList( m_SkyIsland2MissionTypeDat, m_SkyIsland2MissionTypeIdList );
+      loadIdList( getSkyIsland2MissionTypeDat(), m_SkyIsland2MissionTypeIdList );
    return m_SkyIsland2MissionTypeIdList;
 }
 const std::set< uint32_t >& getSkyIsland2RangeTypeIdList()
 {
    if( m_SkyIsland2RangeTypeIdList.size() == 0 )
-      loadIdList( m_SkyIsland2RangeTypeDat, m_SkyIsland2RangeTypeIdList );
+      loadIdList( getSkyIsland2RangeTypeDat(), m_SkyIsland2RangeTypeIdList );
    return m_SkyIsland2RangeTypeIdList;
 }
 const std::set< uint32_t >& getSpearfishingItemIdList()
 {
    if( m_SpearfishingItemIdList.size() == 0 )
-      loadIdList( m_SpearfishingItemDat, m_SpearfishingItemIdList );
+      loadIdList( getSpearfishingItemDat(), m_SpearfishingItemIdList );
    return m_SpearfishingItemIdList;
 }
 const std::set< uint32_t >& getSpearfishingNotebookIdList()
 {
    if( m_SpearfishingNotebookIdList.size() == 0 )
-      loadIdList( m_SpearfishingNotebookDat, m_SpearfishingNotebookIdList );
+      loadIdList( getSpearfishingNotebookDat(), m_SpearfishingNotebookIdList );
    return m_SpearfishingNotebookIdList;
 }
 const std::set< uint32_t >& getSpearfishingRecordPageIdList()
 {
    if( m_SpearfishingRecordPageIdList.size() == 0 )
-      loadIdList( m_SpearfishingRecordPageDat, m_SpearfishingRecordPageIdList );
+      loadIdList( getSpearfishingRecordPageDat(), m_SpearfishingRecordPageIdList );
    return m_SpearfishingRecordPageIdList;
 }
 const std::set< uint32_t >& getSpecialShopIdList()
 {
    if( m_SpecialShopIdList.size() == 0 )
-      loadIdList( m_SpecialShopDat, m_SpecialShopIdList );
+      loadIdList( getSpecialShopDat(), m_SpecialShopIdList );
    return m_SpecialShopIdList;
 }
 const std::set< uint32_t >& getSpecialShopItemCategoryIdList()
 {
    if( m_SpecialShopItemCategoryIdList.size() == 0 )
-      loadIdList( m_SpecialShopItemCategoryDat, m_SpecialShopItemCategoryIdList );
+      loadIdList( getSpecialShopItemCategoryDat(), m_SpecialShopItemCategoryIdList );
    return m_SpecialShopItemCategoryIdList;
 }
 const std::set< uint32_t >& getStainIdList()
 {
    if( m_StainIdList.size() == 0 )
-      loadIdList( m_StainDat, m_StainIdList );
+      loadIdList( getStainDat(), m_StainIdList );
    return m_StainIdList;
 }
 const std::set< uint32_t >& getStainTransientIdList()
 {
    if( m_StainTransientIdList.size() == 0 )
-      loadIdList( m_StainTransientDat, m_StainTransientIdList );
+      loadIdList( getStainTransientDat(), m_StainTransientIdList );
    return m_StainTransientIdList;
 }
 const std::set< uint32_t >& getStatusIdList()
 {
    if( m_StatusIdList.size() == 0 )
-      loadIdList( m_StatusDat, m_StatusIdList );
+      loadIdList( getStatusDat(), m_StatusIdList );
    return m_StatusIdList;
 }
 const std::set< uint32_t >& getStatusHitEffectIdList()
 {
    if( m_StatusHitEffectIdList.size() == 0 )
-      loadIdList( m_StatusHitEffectDat, m_StatusHitEffectIdList );
+      loadIdList( getStatusHitEffectDat(), m_StatusHitEffectIdList );
    return m_StatusHitEffectIdList;
 }
 const std::set< uint32_t >& getStatusLoopVFXIdList()
 {
    if( m_StatusLoopVFXIdList.size() == 0 )
-      loadIdList( m_StatusLoopVFXDat, m_StatusLoopVFXIdList );
+      loadIdList( getStatusLoopVFXDat(), m_StatusLoopVFXIdList );
    return m_StatusLoopVFXIdList;
 }
 const std::set< uint32_t >& getStoryIdList()
 {
    if( m_StoryIdList.size() == 0 )
-      loadIdList( m_StoryDat, m_StoryIdList );
+      loadIdList( getStoryDat(), m_StoryIdList );
    return m_StoryIdList;
 }
 const std::set< uint32_t >& getSubmarineExplorationIdList()
 {
    if( m_SubmarineExplorationIdList.size() == 0 )
-      loadIdList( m_SubmarineExplorationDat, m_SubmarineExplorationIdList );
+      loadIdList( getSubmarineExplorationDat(), m_SubmarineExplorationIdList );
    return m_SubmarineExplorationIdList;
 }
 const std::set< uint32_t >& getSubmarinePartIdList()
 {
    if( m_SubmarinePartIdList.size() == 0 )
-      loadIdList( m_SubmarinePartDat, m_SubmarinePartIdList );
+      loadIdList( getSubmarinePartDat(), m_SubmarinePartIdList );
    return m_SubmarinePartIdList;
 }
 const std::set< uint32_t >& getSubmarineRankIdList()
 {
    if( m_SubmarineRankIdList.size() == 0 )
-      loadIdList( m_SubmarineRankDat, m_SubmarineRankIdList );
+      loadIdList( getSubmarineRankDat(), m_SubmarineRankIdList );
    return m_SubmarineRankIdList;
 }
 const std::set< uint32_t >& getSwitchTalkIdList()
 {
    if( m_SwitchTalkIdList.size() == 0 )
-      loadIdList( m_SwitchTalkDat, m_SwitchTalkIdList );
+      loadIdList( getSwitchTalkDat(), m_SwitchTalkIdList );
    return m_SwitchTalkIdList;
 }
 const std::set< uint32_t >& getTerritoryTypeIdList()
 {
    if( m_TerritoryTypeIdList.size() == 0 )
-      loadIdList( m_TerritoryTypeDat, m_TerritoryTypeIdList );
+      loadIdList( getTerritoryTypeDat(), m_TerritoryTypeIdList );
    return m_TerritoryTypeIdList;
 }
 const std::set< uint32_t >& getTextCommandIdList()
 {
    if( m_TextCommandIdList.size() == 0 )
-      loadIdList( m_TextCommandDat, m_TextCommandIdList );
+      loadIdList( getTextCommandDat(), m_TextCommandIdList );
    return m_TextCommandIdList;
 }
 const std::set< uint32_t >& getTitleIdList()
 {
    if( m_TitleIdList.size() == 0 )
-      loadIdList( m_TitleDat, m_TitleIdList );
+      loadIdList( getTitleDat(), m_TitleIdList );
    return m_TitleIdList;
 }
 const std::set< uint32_t >& getTomestonesIdList()
 {
    if( m_TomestonesIdList.size() == 0 )
-      loadIdList( m_TomestonesDat, m_TomestonesIdList );
+      loadIdList( getTomestonesDat(), m_TomestonesIdList );
    return m_TomestonesIdList;
 }
 const std::set< uint32_t >& getTomestonesItemIdList()
 {
    if( m_TomestonesItemIdList.size() == 0 )
-      loadIdList( m_TomestonesItemDat, m_TomestonesItemIdList );
+      loadIdList( getTomestonesItemDat(), m_TomestonesItemIdList );
    return m_TomestonesItemIdList;
 }
 const std::set< uint32_t >& getTopicSelectIdList()
 {
    if( m_TopicSelectIdList.size() == 0 )
-      loadIdList( m_TopicSelectDat, m_TopicSelectIdList );
+      loadIdList( getTopicSelectDat(), m_TopicSelectIdList );
    return m_TopicSelectIdList;
 }
 const std::set< uint32_t >& getTownIdList()
 {
    if( m_TownIdList.size() == 0 )
-      loadIdList( m_TownDat, m_TownIdList );
+      loadIdList( getTownDat(), m_TownIdList );
    return m_TownIdList;
 }
 const std::set< uint32_t >& getTraitIdList()
 {
    if( m_TraitIdList.size() == 0 )
-      loadIdList( m_TraitDat, m_TraitIdList );
+      loadIdList( getTraitDat(), m_TraitIdList );
    return m_TraitIdList;
 }
 const std::set< uint32_t >& getTraitRecastIdList()
 {
    if( m_TraitRecastIdList.size() == 0 )
-      loadIdList( m_TraitRecastDat, m_TraitRecastIdList );
+      loadIdList( getTraitRecastDat(), m_TraitRecastIdList );
    return m_TraitRecastIdList;
 }
 const std::set< uint32_t >& getTraitTransientIdList()
 {
    if( m_TraitTransientIdList.size() == 0 )
-      loadIdList( m_TraitTransientDat, m_TraitTransientIdList );
+      loadIdList( getTraitTransientDat(), m_TraitTransientIdList );
    return m_TraitTransientIdList;
 }
 const std::set< uint32_t >& getTransformationIdList()
 {
    if( m_TransformationIdList.size() == 0 )
-      loadIdList( m_TransformationDat, m_TransformationIdList );
+      loadIdList( getTransformationDat(), m_TransformationIdList );
    return m_TransformationIdList;
 }
 const std::set< uint32_t >& getTreasureIdList()
 {
    if( m_TreasureIdList.size() == 0 )
-      loadIdList( m_TreasureDat, m_TreasureIdList );
+      loadIdList( getTreasureDat(), m_TreasureIdList );
    return m_TreasureIdList;
 }
 const std::set< uint32_t >& getTreasureHuntRankIdList()
 {
    if( m_TreasureHuntRankIdList.size() == 0 )
-      loadIdList( m_TreasureHuntRankDat, m_TreasureHuntRankIdList );
+      loadIdList( getTreasureHuntRankDat(), m_TreasureHuntRankIdList );
    return m_TreasureHuntRankIdList;
 }
 const std::set< uint32_t >& getTreasureSpotIdList()
 {
    if( m_TreasureSpotIdList.size() == 0 )
-      loadIdList( m_TreasureSpotDat, m_TreasureSpotIdList );
+      loadIdList( getTreasureSpotDat(), m_TreasureSpotIdList );
    return m_TreasureSpotIdList;
 }
 const std::set< uint32_t >& getTribeIdList()
 {
    if( m_TribeIdList.size() == 0 )
-      loadIdList( m_TribeDat, m_TribeIdList );
+      loadIdList( getTribeDat(), m_TribeIdList );
    return m_TribeIdList;
 }
 const std::set< uint32_t >& getTripleTriadIdList()
 {
    if( m_TripleTriadIdList.size() == 0 )
-      loadIdList( m_TripleTriadDat, m_TripleTriadIdList );
+      loadIdList( getTripleTriadDat(), m_TripleTriadIdList );
    return m_TripleTriadIdList;
 }
 const std::set< uint32_t >& getTripleTriadCardIdList()
 {
    if( m_TripleTriadCardIdList.size() == 0 )
-      loadIdList( m_TripleTriadCardDat, m_TripleTriadCardIdList );
+      loadIdList( getTripleTriadCardDat(), m_TripleTriadCardIdList );
    return m_TripleTriadCardIdList;
 }
 const std::set< uint32_t >& getTripleTriadCardRarityIdList()
 {
    if( m_TripleTriadCardRarityIdList.size() == 0 )
-      loadIdList( m_TripleTriadCardRarityDat, m_TripleTriadCardRarityIdList );
+      loadIdList( getTripleTriadCardRarityDat(), m_TripleTriadCardRarityIdList );
    return m_TripleTriadCardRarityIdList;
 }
 const std::set< uint32_t >& getTripleTriadCardResidentIdList()
 {
    if( m_TripleTriadCardResidentIdList.size() == 0 )
-      loadIdList( m_TripleTriadCardResidentDat, m_TripleTriadCardResidentIdList );
+      loadIdList( getTripleTriadCardResidentDat(), m_TripleTriadCardResidentIdList );
    return m_TripleTriadCardResidentIdList;
 }
 const std::set< uint32_t >& getTripleTriadCardTypeIdList()
 {
    if( m_TripleTriadCardTypeIdList.size() == 0 )
-      loadIdList( m_TripleTriadCardTypeDat, m_TripleTriadCardTypeIdList );
+      loadIdList( getTripleTriadCardTypeDat(), m_TripleTriadCardTypeIdList );
    return m_TripleTriadCardTypeIdList;
 }
 const std::set< uint32_t >& getTripleTriadCompetitionIdList()
 {
    if( m_TripleTriadCompetitionIdList.size() == 0 )
-      loadIdList( m_TripleTriadCompetitionDat, m_TripleTriadCompetitionIdList );
+      loadIdList( getTripleTriadCompetitionDat(), m_TripleTriadCompetitionIdList );
    return m_TripleTriadCompetitionIdList;
 }
 const std::set< uint32_t >& getTripleTriadRuleIdList()
 {
    if( m_TripleTriadRuleIdList.size() == 0 )
-      loadIdList( m_TripleTriadRuleDat, m_TripleTriadRuleIdList );
+      loadIdList( getTripleTriadRuleDat(), m_TripleTriadRuleIdList );
    return m_TripleTriadRuleIdList;
 }
 const std::set< uint32_t >& getTutorialIdList()
 {
    if( m_TutorialIdList.size() == 0 )
-      loadIdList( m_TutorialDat, m_TutorialIdList );
+      loadIdList( getTutorialDat(), m_TutorialIdList );
    return m_TutorialIdList;
 }
 const std::set< uint32_t >& getTutorialDPSIdList()
 {
    if( m_TutorialDPSIdList.size() == 0 )
-      loadIdList( m_TutorialDPSDat, m_TutorialDPSIdList );
+      loadIdList( getTutorialDPSDat(), m_TutorialDPSIdList );
    return m_TutorialDPSIdList;
 }
 const std::set< uint32_t >& getTutorialHealerIdList()
 {
    if( m_TutorialHealerIdList.size() == 0 )
-      loadIdList( m_TutorialHealerDat, m_TutorialHealerIdList );
+      loadIdList( getTutorialHealerDat(), m_TutorialHealerIdList );
    return m_TutorialHealerIdList;
 }
 const std::set< uint32_t >& getTutorialTankIdList()
 {
    if( m_TutorialTankIdList.size() == 0 )
-      loadIdList( m_TutorialTankDat, m_TutorialTankIdList );
+      loadIdList( getTutorialTankDat(), m_TutorialTankIdList );
    return m_TutorialTankIdList;
 }
 const std::set< uint32_t >& getUIColorIdList()
 {
    if( m_UIColorIdList.size() == 0 )
-      loadIdList( m_UIColorDat, m_UIColorIdList );
+      loadIdList( getUIColorDat(), m_UIColorIdList );
    return m_UIColorIdList;
 }
 const std::set< uint32_t >& getVaseFlowerIdList()
 {
    if( m_VaseFlowerIdList.size() == 0 )
-      loadIdList( m_VaseFlowerDat, m_VaseFlowerIdList );
+      loadIdList( getVaseFlowerDat(), m_VaseFlowerIdList );
    return m_VaseFlowerIdList;
 }
 const std::set< uint32_t >& getVFXIdList()
 {
    if( m_VFXIdList.size() == 0 )
-      loadIdList( m_VFXDat, m_VFXIdList );
+      loadIdList( getVFXDat(), m_VFXIdList );
    return m_VFXIdList;
 }
 const std::set< uint32_t >& getWarpIdList()
 {
    if( m_WarpIdList.size() == 0 )
-      loadIdList( m_WarpDat, m_WarpIdList );
+      loadIdList( getWarpDat(), m_WarpIdList );
    return m_WarpIdList;
 }
 const std::set< uint32_t >& getWarpConditionIdList()
 {
    if( m_WarpConditionIdList.size() == 0 )
-      loadIdList( m_WarpConditionDat, m_WarpConditionIdList );
+      loadIdList( getWarpConditionDat(), m_WarpConditionIdList );
    return m_WarpConditionIdList;
 }
 const std::set< uint32_t >& getWarpLogicIdList()
 {
    if( m_WarpLogicIdList.size() == 0 )
-      loadIdList( m_WarpLogicDat, m_WarpLogicIdList );
+      loadIdList( getWarpLogicDat(), m_WarpLogicIdList );
    return m_WarpLogicIdList;
 }
 const std::set< uint32_t >& getWeatherIdList()
 {
    if( m_WeatherIdList.size() == 0 )
-      loadIdList( m_WeatherDat, m_WeatherIdList );
+      loadIdList( getWeatherDat(), m_WeatherIdList );
    return m_WeatherIdList;
 }
 const std::set< uint32_t >& getWeatherGroupIdList()
 {
    if( m_WeatherGroupIdList.size() == 0 )
-      loadIdList( m_WeatherGroupDat, m_WeatherGroupIdList );
+      loadIdList( getWeatherGroupDat(), m_WeatherGroupIdList );
    return m_WeatherGroupIdList;
 }
 const std::set< uint32_t >& getWeatherRateIdList()
 {
    if( m_WeatherRateIdList.size() == 0 )
-      loadIdList( m_WeatherRateDat, m_WeatherRateIdList );
+      loadIdList( getWeatherRateDat(), m_WeatherRateIdList );
    return m_WeatherRateIdList;
 }
 const std::set< uint32_t >& getWeatherReportReplaceIdList()
 {
    if( m_WeatherReportReplaceIdList.size() == 0 )
-      loadIdList( m_WeatherReportReplaceDat, m_WeatherReportReplaceIdList );
+      loadIdList( getWeatherReportReplaceDat(), m_WeatherReportReplaceIdList );
    return m_WeatherReportReplaceIdList;
 }
 const std::set< uint32_t >& getWeddingBGMIdList()
 {
    if( m_WeddingBGMIdList.size() == 0 )
-      loadIdList( m_WeddingBGMDat, m_WeddingBGMIdList );
+      loadIdList( getWeddingBGMDat(), m_WeddingBGMIdList );
    return m_WeddingBGMIdList;
 }
 const std::set< uint32_t >& getWeeklyBingoOrderDataIdList()
 {
    if( m_WeeklyBingoOrderDataIdList.size() == 0 )
-      loadIdList( m_WeeklyBingoOrderDataDat, m_WeeklyBingoOrderDataIdList );
+      loadIdList( getWeeklyBingoOrderDataDat(), m_WeeklyBingoOrderDataIdList );
    return m_WeeklyBingoOrderDataIdList;
 }
 const std::set< uint32_t >& getWeeklyBingoRewardDataIdList()
 {
    if( m_WeeklyBingoRewardDataIdList.size() == 0 )
-      loadIdList( m_WeeklyBingoRewardDataDat, m_WeeklyBingoRewardDataIdList );
+      loadIdList( getWeeklyBingoRewardDataDat(), m_WeeklyBingoRewardDataIdList );
    return m_WeeklyBingoRewardDataIdList;
 }
 const std::set< uint32_t >& getWeeklyBingoTextIdList()
 {
    if( m_WeeklyBingoTextIdList.size() == 0 )
-      loadIdList( m_WeeklyBingoTextDat, m_WeeklyBingoTextIdList );
+      loadIdList( getWeeklyBingoTextDat(), m_WeeklyBingoTextIdList );
    return m_WeeklyBingoTextIdList;
 }
 const std::set< uint32_t >& getWeeklyLotBonusIdList()
 {
    if( m_WeeklyLotBonusIdList.size() == 0 )
-      loadIdList( m_WeeklyLotBonusDat, m_WeeklyLotBonusIdList );
+      loadIdList( getWeeklyLotBonusDat(), m_WeeklyLotBonusIdList );
    return m_WeeklyLotBonusIdList;
 }
 const std::set< uint32_t >& getWorldIdList()
 {
    if( m_WorldIdList.size() == 0 )
-      loadIdList( m_WorldDat, m_WorldIdList );
+      loadIdList( getWorldDat(), m_WorldIdList );
    return m_WorldIdList;
 }
 const std::set< uint32_t >& getWorldDCGroupTypeIdList()
 {
    if( m_WorldDCGroupTypeIdList.size() == 0 )
-      loadIdList( m_WorldDCGroupTypeDat, m_WorldDCGroupTypeIdList );
+      loadIdList( getWorldDCGroupTypeDat(), m_WorldDCGroupTypeIdList );
    return m_WorldDCGroupTypeIdList;
 }
 const std::set< uint32_t >& getYKWIdList()
 {
    if( m_YKWIdList.size() == 0 )
-      loadIdList( m_YKWDat, m_YKWIdList );
+      loadIdList( getYKWDat(), m_YKWIdList );
    return m_YKWIdList;
 }
 const std::set< uint32_t >& getZoneSharedGroupIdList()
 {
    if( m_ZoneSharedGroupIdList.size() == 0 )
-      loadIdList( m_ZoneSharedGroupDat, m_ZoneSharedGroupIdList );
+      loadIdList( getZoneSharedGroupDat(), m_ZoneSharedGroupIdList );
    return m_ZoneSharedGroupIdList;
 }
 
@@ -0,0 +1,371 @@
+#include "ExdSnapshot.h"
+
+#include <bparse.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <experimental/filesystem>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::experimental::filesystem;
+
+namespace
+{
+  // "SXSN"
+  const uint32_t SnapshotMagic = 0x4E535853;
+
+  std::shared_ptr< const char > mapFile( const std::string& path, std::size_t& size )
+  {
+#ifdef _WIN32
+    auto hFile = CreateFileA( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr );
+    if( hFile == INVALID_HANDLE_VALUE )
+      return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if( !GetFileSizeEx( hFile, &fileSize ) || fileSize.QuadPart == 0 )
+    {
+      CloseHandle( hFile );
+      return nullptr;
+    }
+
+    auto hMapping = CreateFileMappingA( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+    CloseHandle( hFile );
+    if( !hMapping )
+      return nullptr;
+
+    // the view keeps the mapping alive on its own
+    auto pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+    CloseHandle( hMapping );
+    if( !pView )
+      return nullptr;
+
+    size = static_cast< std::size_t >( fileSize.QuadPart );
+    return std::shared_ptr< const char >( static_cast< const char* >( pView ),
+                                          []( const char* p ) { UnmapViewOfFile( p ); } );
+#else
+    auto fd = ::open( path.c_str(), O_RDONLY );
+    if( fd < 0 )
+      return nullptr;
+
+    struct stat st;
+    if( fstat( fd, &st ) != 0 || st.st_size == 0 )
+    {
+      ::close( fd );
+      return nullptr;
+    }
+
+    auto mappedSize = static_cast< std::size_t >( st.st_size );
+    auto pMap = mmap( nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0 );
+    ::close( fd );
+    if( pMap == MAP_FAILED )
+      return nullptr;
+
+    size = mappedSize;
+    return std::shared_ptr< const char >( static_cast< const char* >( pMap ),
+                                          [ mappedSize ]( const char* p ) { munmap( const_cast< char* >( p ), mappedSize ); } );
+#endif
+  }
+
+  // a record is its big endian size and sub-row count followed by that many bytes
+  uint32_t getRecordSize( const char* pRecord )
+  {
+    uint32_t size;
+    std::memcpy( &size, pRecord, sizeof( size ) );
+    return 6 + xiv::utils::bparse::byteswap( size );
+  }
+
+  // generations of the snapshot at path, newest first
+  std::vector< std::pair< uint32_t, fs::path > > findGenerations( const std::string& path )
+  {
+    std::vector< std::pair< uint32_t, fs::path > > generations;
+
+    fs::path basePath( path );
+    auto dir = basePath.parent_path();
+    if( dir.empty() )
+      dir = ".";
+    auto prefix = basePath.filename().string() + ".";
+
+    std::error_code e;
+    for( fs::directory_iterator it( dir, e ), end; !e && it != end; it.increment( e ) )
+    {
+      auto name = it->path().filename().string();
+      if( name.size() <= prefix.size() || name.compare( 0, prefix.size(), prefix ) != 0 )
+        continue;
+
+      auto suffix = name.substr( prefix.size() );
+      if( suffix.size() > 9 || suffix.find_first_not_of( "0123456789" ) != std::string::npos )
+        continue;
+
+      generations.emplace_back( static_cast< uint32_t >( std::stoul( suffix ) ), it->path() );
+    }
+
+    std::sort( generations.begin(), generations.end(),
+               []( const auto& lhs, const auto& rhs ) { return lhs.first > rhs.first; } );
+    return generations;
+  }
+
+  template< class T >
+  void append( std::vector< char >& out, const T& value )
+  {
+    auto pValue = reinterpret_cast< const char* >( &value );
+    out.insert( out.end(), pValue, pValue + sizeof( T ) );
+  }
+
+  template< class T >
+  void writeAt( std::vector< char >& out, uint64_t offset, const T& value )
+  {
+    std::memcpy( &out[ offset ], &value, sizeof( T ) );
+  }
+}
+
+bool Sapphire::Data::ExdSnapshot::open( const std::string& path, const std::string& gameVersion,
+                                        xiv::exd::Language language )
+{
+  for( auto& generation : findGenerations( path ) )
+  {
+    if( openFile( generation.second.string(), gameVersion, language ) )
+      return true;
+  }
+
+  return false;
+}
+
+bool Sapphire::Data::ExdSnapshot::openFile( const std::string& file, const std::string& gameVersion,
+                                            xiv::exd::Language language )
+{
+  std::size_t size = 0;
+  auto memory = mapFile( file, size );
+  if( !memory || size < sizeof( Header ) )
+    return false;
+
+  auto pBase = memory.get();
+  Header header;
+  std::memcpy( &header, pBase, sizeof( header ) );
+
+  if( header.magic != SnapshotMagic || header.version != Version || header.size != size ||
+      header.language != language ||
+      std::string( header.gameVersion, strnlen( header.gameVersion, sizeof( header.gameVersion ) ) ) != gameVersion )
+    return false;
+
+  uint64_t sheetsEnd = sizeof( Header ) + static_cast< uint64_t >( header.sheetCount ) * sizeof( Sheet );
+  if( sheetsEnd > size || header.stringsOffset < sheetsEnd || header.stringsOffset > size )
+    return false;
+
+  std::unordered_map< std::string, const Sheet* > sheets;
+  auto pSheets = reinterpret_cast< const Sheet* >( pBase + sizeof( Header ) );
+  for( uint32_t i = 0; i < header.sheetCount; ++i )
+  {
+    auto& sheet = pSheets[ i ];
+
+    auto nameOffset = header.stringsOffset + sheet.nameOffset;
+    auto columnsEnd = sheet.columnsOffset + static_cast< uint64_t >( sheet.columnCount ) * sizeof( xiv::exd::ExhMember );
+    auto rowsEnd = sheet.rowsOffset + static_cast< uint64_t >( sheet.rowCount ) * sizeof( Row );
+    if( nameOffset >= size || columnsEnd > size || rowsEnd > size ||
+        sheet.rowsOffset % alignof( Row ) != 0 || sheet.columnsOffset % alignof( xiv::exd::ExhMember ) != 0 )
+      return false;
+
+    auto pName = pBase + nameOffset;
+    sheets.emplace( std::string( pName, strnlen( pName, size - nameOffset ) ), &sheet );
+  }
+
+  m_memory = memory;
+  m_size = size;
+  m_sheets = std::move( sheets );
+  return true;
+}
+
+bool Sapphire::Data::ExdSnapshot::getSheet( const std::string& name, xiv::exd::Language language,
+                                            xiv::exd::Exd& out ) const
+{
+  auto it = m_sheets.find( name );
+  if( it == m_sheets.end() || it->second->language != language )
+    return false;
+
+  auto& sheet = *it->second;
+  auto pBase = m_memory.get();
+
+  auto pColumns = reinterpret_cast< const xiv::exd::ExhMember* >( pBase + sheet.columnsOffset );
+  std::vector< xiv::exd::ExhMember > columns( pColumns, pColumns + sheet.columnCount );
+
+  xiv::exd::ExhHeader exhHeader{};
+  exhHeader.data_offset = sheet.dataOffset;
+  exhHeader.field_count = static_cast< uint16_t >( sheet.columnCount );
+  exhHeader.language_count = 1;
+  exhHeader.variant = sheet.variant;
+
+  auto pExh = std::make_shared< xiv::exd::Exh >( exhHeader, columns,
+                                                 std::vector< xiv::exd::Language >{ language } );
+
+  // rows are sorted by id, so every insert goes to the end of the map
+  std::map< uint32_t, xiv::exd::ExdCacheEntry > records;
+  auto pRows = reinterpret_cast< const Row* >( pBase + sheet.rowsOffset );
+  for( uint32_t i = 0; i < sheet.rowCount; ++i )
+  {
+    auto& row = pRows[ i ];
+    if( row.recordOffset + 6 > m_size || row.recordOffset + getRecordSize( pBase + row.recordOffset ) > m_size )
+      return false;
+
+    records.emplace_hint( records.end(), row.id, xiv::exd::ExdCacheEntry{ pBase + row.recordOffset } );
+  }
+
+  out = xiv::exd::Exd( pExh, m_memory, records );
+  return true;
+}
+
+void Sapphire::Data::ExdSnapshot::getSheets( const std::set< std::string >& skip, std::deque< xiv::exd::Exd >& data,
+                                             std::vector< Source >& out ) const
+{
+  for( auto& entry : m_sheets )
+  {
+    if( skip.count( entry.first ) )
+      continue;
+
+    auto language = static_cast< xiv::exd::Language >( entry.second->language );
+
+    data.emplace_back();
+    if( !getSheet( entry.first, language, data.back() ) )
+    {
+      data.pop_back();
+      continue;
+    }
+
+    out.push_back( { entry.first, language, &data.back() } );
+  }
+}
+
+std::size_t Sapphire::Data::ExdSnapshot::getSheetCount() const
+{
+  return m_sheets.size();
+}
+
+bool Sapphire::Data::ExdSnapshot::write( const std::string& path, const std::string& gameVersion,
+                                         xiv::exd::Language language, const std::vector< Source >& sheets )
+{
+  if( gameVersion.size() >= sizeof( Header::gameVersion ) )
+    return false;
+
+  std::vector< char > out( sizeof( Header ) + sheets.size() * sizeof( Sheet ) );
+
+  std::vector< Sheet > entries( sheets.size() );
+
+  auto stringsOffset = out.size();
+  for( std::size_t i = 0; i < sheets.size(); ++i )
+  {
+    entries[ i ].nameOffset = static_cast< uint32_t >( out.size() - stringsOffset );
+    out.insert( out.end(), sheets[ i ].name.begin(), sheets[ i ].name.end() );
+    out.push_back( '\0' );
+  }
+
+  for( std::size_t i = 0; i < sheets.size(); ++i )
+  {
+    auto& exh = sheets[ i ].pData->get_exh();
+    auto& entry = entries[ i ];
+
+    entry.language = sheets[ i ].language;
+    entry.dataOffset = exh.get_header().data_offset;
+    entry.variant = exh.get_header().variant;
+    entry.columnCount = static_cast< uint32_t >( exh.get_exh_members().size() );
+
+    out.resize( ( out.size() + 7 ) & ~std::size_t( 7 ) );
+    entry.columnsOffset = out.size();
+    for( auto& column : exh.get_exh_members() )
+      append( out, column );
+  }
+
+  // rows first, the record offsets are filled in once the records are placed behind them
+  for( std::size_t i = 0; i < sheets.size(); ++i )
+  {
+    auto& records = sheets[ i ].pData->get_records();
+    auto& entry = entries[ i ];
+
+    out.resize( ( out.size() + 7 ) & ~std::size_t( 7 ) );
+    entry.rowCount = static_cast< uint32_t >( records.size() );
+    entry.rowsOffset = out.size();
+    out.resize( out.size() + records.size() * sizeof( Row ) );
+  }
+
+  for( std::size_t i = 0; i < sheets.size(); ++i )
+  {
+    auto rowOffset = entries[ i ].rowsOffset;
+    for( auto& record : sheets[ i ].pData->get_records() )
+    {
+      Row row{};
+      row.id = record.first;
+      row.recordOffset = out.size();
+      writeAt( out, rowOffset, row );
+      rowOffset += sizeof( Row );
+
+      out.insert( out.end(), record.second.record, record.second.record + getRecordSize( record.second.record ) );
+    }
+  }
+
+  for( std::size_t i = 0; i < sheets.size(); ++i )
+    writeAt( out, sizeof( Header ) + i * sizeof( Sheet ), entries[ i ] );
+
+  Header header{};
+  header.magic = SnapshotMagic;
+  header.version = Version;
+  std::memcpy( header.gameVersion, gameVersion.data(), gameVersion.size() );
+  header.language = language;
+  header.sheetCount = static_cast< uint32_t >( sheets.size() );
+  header.stringsOffset = stringsOffset;
+  header.size = out.size();
+  writeAt( out, 0, header );
+
+  std::error_code e;
+  auto parent = fs::path( path ).parent_path();
+  if( !parent.empty() )
+    fs::create_directories( parent, e );
+
+  // a new generation never replaces a file that is still mapped, windows refuses to rename over those
+  auto generations = findGenerations( path );
+  auto generation = generations.empty() ? 0 : generations.front().first + 1;
+
+  // written under a temporary name so a crash never leaves a partial snapshot behind
+  auto tmpPath = path + ".tmp";
+  {
+    std::ofstream file( tmpPath, std::ios::binary | std::ios::trunc );
+    if( !file.good() )
+      return false;
+
+    file.write( out.data(), static_cast< std::streamsize >( out.size() ) );
+    if( !file.good() )
+      return false;
+  }
+
+  fs::rename( tmpPath, path + "." + std::to_string( generation ), e );
+  if( e )
+    return false;
+
+  // the generation mapped by this process can't be removed on windows, it goes with a later write
+  for( auto& old : generations )
+    fs::remove( old.second, e );
+
+  return true;
+}
+
+std::string Sapphire::Data::ExdSnapshot::readGameVersion( const std::string& dataPath )
+{
+  // dataPath is the sqpack folder, the version file sits in the game folder above it
+  fs::path sqpackPath( dataPath );
+  if( sqpackPath.filename().empty() || sqpackPath.filename() == "." )
+    sqpackPath = sqpackPath.parent_path();
+
+  std::ifstream file( sqpackPath.parent_path() / "ffxivgame.ver" );
+  std::string version;
+  if( !std::getline( file, version ) )
+    return "";
+
+  version.erase( version.find_last_not_of( " \r\n\t" ) + 1 );
+  return version;
+}
@@ -0,0 +1,115 @@
+#ifndef SAPPHIRE_EXDSNAPSHOT_H
+#define SAPPHIRE_EXDSNAPSHOT_H
+
+#include <Exd.h>
+#include <Exh.h>
+#include <ExdCat.h>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Data
+{
+
+  /*!
+   * @brief Decoded exd sheets of one game version in a single file that is mapped instead of read
+   *
+   * Holds the column layout and the raw, already inflated rows of every sheet it was written with.
+   * Sheets built from it point straight into the mapping, so opening one costs an index walk
+   * instead of a sqpack lookup and inflating its pages.
+   *
+   * Every write goes to a new file <path>.<generation> and the newest valid generation is mapped,
+   * so a snapshot that is still mapped is never written over.
+   *
+   * Layout, little endian: Header, then per sheet a Sheet entry, the strings of the sheet names,
+   * the columns of every sheet as xiv::exd::ExhMember, the rows of every sheet as Row sorted by id,
+   * and the records the rows point to, copied as they are in the exd pages.
+   */
+  class ExdSnapshot
+  {
+  public:
+    // bump whenever the layout changes, older files are rebuilt
+    static const uint32_t Version = 1;
+
+    struct Header
+    {
+      uint32_t magic;
+      uint32_t version;
+      char gameVersion[ 32 ];
+      uint16_t language;
+      uint16_t unused;
+      uint32_t sheetCount;
+      uint64_t stringsOffset;
+      uint64_t size;
+    };
+
+    struct Sheet
+    {
+      uint32_t nameOffset;
+      uint16_t language;
+      uint16_t dataOffset;
+      uint8_t variant;
+      uint8_t unused[ 3 ];
+      uint32_t columnCount;
+      uint32_t rowCount;
+      uint32_t unused1;
+      uint64_t columnsOffset;
+      uint64_t rowsOffset;
+    };
+
+    struct Row
+    {
+      uint32_t id;
+      uint32_t unused;
+      uint64_t recordOffset;
+    };
+
+    // an opened sheet that goes into the snapshot
+    struct Source
+    {
+      std::string name;
+      xiv::exd::Language language;
+      const xiv::exd::Exd* pData;
+    };
+
+    /*!
+     * @brief Maps the newest generation of the snapshot
+     * @return false if none is there that is intact and was written for the game version and language
+     */
+    bool open( const std::string& path, const std::string& gameVersion, xiv::exd::Language language );
+
+    /*! builds the sheet from the mapping, false if it is not part of the snapshot */
+    bool getSheet( const std::string& name, xiv::exd::Language language, xiv::exd::Exd& out ) const;
+
+    /*!
+     * @brief Builds every sheet of the snapshot that is not in skip, to carry it over into the next one
+     * @param data receives the built sheets, the sources point into it
+     */
+    void getSheets( const std::set< std::string >& skip, std::deque< xiv::exd::Exd >& data,
+                    std::vector< Source >& out ) const;
+
+    std::size_t getSheetCount() const;
+
+    /*! writes the sheets as the next generation of path and removes the older ones that are not in use */
+    static bool write( const std::string& path, const std::string& gameVersion, xiv::exd::Language language,
+                       const std::vector< Source >& sheets );
+
+    /*! the version in ffxivgame.ver next to the sqpack folder, empty if there is none */
+    static std::string readGameVersion( const std::string& dataPath );
+
+  private:
+    bool openFile( const std::string& file, const std::string& gameVersion, xiv::exd::Language language );
+
+    std::shared_ptr< const char > m_memory;
+    std::size_t m_size;
+    std::unordered_map< std::string, const Sheet* > m_sheets;
+  };
+
+}
+
+#endif
@@ -0,0 +1,334 @@
+#include "Metrics.h"
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include <experimental/filesystem>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace fs = std::experimental::filesystem;
+
+namespace Sapphire::Metrics
+{
+
+  std::size_t getThreadShard()
+  {
+    static std::atomic< std::size_t > nextShard{ 0 };
+    thread_local std::size_t shard = nextShard.fetch_add( 1, std::memory_order_relaxed );
+    return shard;
+  }
+
+  static uint32_t log2Floor( uint64_t value )
+  {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64( &index, value );
+    return static_cast< uint32_t >( index );
+#else
+    return 63 - static_cast< uint32_t >( __builtin_clzll( value ) );
+#endif
+  }
+
+  uint32_t Histogram::getBucketIndex( uint64_t value )
+  {
+    if( value < SubBucketCount )
+      return static_cast< uint32_t >( value );
+
+    auto exponent = log2Floor( value );
+    auto subBucket = static_cast< uint32_t >( value >> ( exponent - SubBucketBits ) ) & ( SubBucketCount - 1 );
+
+    return ( exponent - SubBucketBits + 1 ) * SubBucketCount + subBucket;
+  }
+
+  uint64_t Histogram::getBucketUpperBound( uint32_t index )
+  {
+    if( index < SubBucketCount )
+      return index;
+
+    auto exponent = index / SubBucketCount + SubBucketBits - 1;
+    auto subBucket = index & ( SubBucketCount - 1 );
+    auto shift = exponent - SubBucketBits;
+
+    auto lower = static_cast< uint64_t >( SubBucketCount + subBucket ) << shift;
+    return lower + ( ( uint64_t( 1 ) << shift ) - 1 );
+  }
+
+  std::array< uint64_t, Histogram::BucketCount > Histogram::collectBuckets() const
+  {
+    std::array< uint64_t, BucketCount > buckets{};
+
+    for( auto& shard : m_shards )
+    {
+      for( uint32_t i = 0; i < BucketCount; ++i )
+        buckets[ i ] += shard.buckets[ i ].load( std::memory_order_relaxed );
+    }
+
+    return buckets;
+  }
+
+  uint64_t Histogram::getCount() const
+  {
+    uint64_t count = 0;
+    for( auto& shard : m_shards )
+      count += shard.count.load( std::memory_order_relaxed );
+    return count;
+  }
+
+  uint64_t Histogram::getSum() const
+  {
+    uint64_t sum = 0;
+    for( auto& shard : m_shards )
+      sum += shard.sum.load( std::memory_order_relaxed );
+    return sum;
+  }
+
+  uint64_t Histogram::getPercentile( double percentile ) const
+  {
+    auto buckets = collectBuckets();
+
+    uint64_t total = 0;
+    for( auto count : buckets )
+      total += count;
+
+    if( total == 0 )
+      return 0;
+
+    auto target = static_cast< uint64_t >( percentile * static_cast< double >( total ) );
+    if( target == 0 )
+      target = 1;
+
+    uint64_t seen = 0;
+    for( uint32_t i = 0; i < BucketCount; ++i )
+    {
+      seen += buckets[ i ];
+      if( seen >= target )
+        return getBucketUpperBound( i );
+    }
+
+    return getBucketUpperBound( BucketCount - 1 );
+  }
+
+  std::array< uint64_t, 64 > Histogram::getPowerOfTwoBuckets() const
+  {
+    auto buckets = collectBuckets();
+
+    std::array< uint64_t, 64 > result{};
+
+    // buckets never straddle a power of two, so every bucket falls entirely below or above 2^n
+    uint32_t bucket = 0;
+    uint64_t cumulative = 0;
+    for( uint32_t n = 0; n < 64; ++n )
+    {
+      auto limit = uint64_t( 1 ) << n;
+      while( bucket < BucketCount && getBucketUpperBound( bucket ) < limit )
+        cumulative += buckets[ bucket++ ];
+
+      result[ n ] = cumulative;
+    }
+
+    return result;
+  }
+
+  void Histogram::reset()
+  {
+    for( auto& shard : m_shards )
+    {
+      for( auto& bucket : shard.buckets )
+        bucket.store( 0, std::memory_order_relaxed );
+      shard.count.store( 0, std::memory_order_relaxed );
+      shard.sum.store( 0, std::memory_order_relaxed );
+    }
+  }
+
+  std::mutex& Registry::getMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  std::map< std::string, Registry::Family >& Registry::getFamilies()
+  {
+    static std::map< std::string, Family > families;
+    return families;
+  }
+
+  std::atomic< bool >& Registry::getExporterRunning()
+  {
+    static std::atomic< bool > running{ false };
+    return running;
+  }
+
+  Registry::Family& Registry::getFamily( const std::string& name, Type type, const std::string& help )
+  {
+    auto& families = getFamilies();
+
+    auto it = families.find( name );
+    if( it == families.end() )
+    {
+      it = families.emplace( name, Family() ).first;
+      it->second.type = type;
+    }
+
+    if( it->second.help.empty() )
+      it->second.help = help;
+
+    return it->second;
+  }
+
+  Counter& Registry::counter( const std::string& name, const std::string& labels, const std::string& help )
+  {
+    std::lock_guard< std::mutex > lock( getMutex() );
+
+    auto& entry = getFamily( name, Type::Counter, help ).counters[ labels ];
+    if( !entry )
+      entry = std::make_unique< Counter >();
+
+    return *entry;
+  }
+
+  Gauge& Registry::gauge( const std::string& name, const std::string& labels, const std::string& help )
+  {
+    std::lock_guard< std::mutex > lock( getMutex() );
+
+    auto& entry = getFamily( name, Type::Gauge, help ).gauges[ labels ];
+    if( !entry )
+      entry = std::make_unique< Gauge >();
+
+    return *entry;
+  }
+
+  Histogram& Registry::histogram( const std::string& name, const std::string& labels, const std::string& help )
+  {
+    std::lock_guard< std::mutex > lock( getMutex() );
+
+    auto& entry = getFamily( name, Type::Histogram, help ).histograms[ labels ];
+    if( !entry )
+      entry = std::make_unique< Histogram >();
+
+    return *entry;
+  }
+
+  static std::string formatLabels( const std::string& labels, const std::string& extra = "" )
+  {
+    if( labels.empty() && extra.empty() )
+      return "";
+
+    if( labels.empty() )
+      return "{" + extra + "}";
+
+    if( extra.empty() )
+      return "{" + labels + "}";
+
+    return "{" + labels + "," + extra + "}";
+  }
+
+  void Registry::writePrometheus( std::ostream& out )
+  {
+    std::lock_guard< std::mutex > lock( getMutex() );
+
+    for( auto& entry : getFamilies() )
+    {
+      auto& name = entry.first;
+      auto& family = entry.second;
+
+      if( !family.help.empty() )
+        out << "# HELP " << name << " " << family.help << "\n";
+
+      switch( family.type )
+      {
+        case Type::Counter:
+        {
+          out << "# TYPE " << name << " counter\n";
+          for( auto& counter : family.counters )
+            out << name << formatLabels( counter.first ) << " " << counter.second->get() << "\n";
+          break;
+        }
+        case Type::Gauge:
+        {
+          out << "# TYPE " << name << " gauge\n";
+          for( auto& gauge : family.gauges )
+            out << name << formatLabels( gauge.first ) << " " << gauge.second->get() << "\n";
+          break;
+        }
+        case Type::Histogram:
+        {
+          out << "# TYPE " << name << " histogram\n";
+          for( auto& histogram : family.histograms )
+          {
+            auto count = histogram.second->getCount();
+            auto buckets = histogram.second->getPowerOfTwoBuckets();
+
+            // buckets up to 2^20 are always emitted, past that only up to the largest value recorded so far,
+            // so the bucket set can grow between scrapes but never shrinks
+            for( uint32_t n = 1; n < 64; ++n )
+            {
+              auto le = std::to_string( ( uint64_t( 1 ) << n ) - 1 );
+              out << name << "_bucket" << formatLabels( histogram.first, "le=\"" + le + "\"" )
+                  << " " << buckets[ n ] << "\n";
+
+              if( n >= 20 && buckets[ n ] == count )
+                break;
+            }
+
+            out << name << "_bucket" << formatLabels( histogram.first, "le=\"+Inf\"" ) << " " << count << "\n";
+            out << name << "_sum" << formatLabels( histogram.first ) << " " << histogram.second->getSum() << "\n";
+            out << name << "_count" << formatLabels( histogram.first ) << " " << count << "\n";
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  bool Registry::writeFile( const std::string& path )
+  {
+    auto tmpPath = path + ".tmp";
+
+    {
+      std::ofstream out( tmpPath, std::ios::trunc );
+      if( !out.good() )
+        return false;
+
+      writePrometheus( out );
+    }
+
+    // rename does not replace an existing file on windows
+    std::remove( path.c_str() );
+    return std::rename( tmpPath.c_str(), path.c_str() ) == 0;
+  }
+
+  void Registry::startExporter( const std::string& path, uint32_t interval )
+  {
+    if( interval == 0 || getExporterRunning().exchange( true ) )
+      return;
+
+    auto directory = fs::path( path ).parent_path();
+    if( !directory.empty() )
+    {
+      std::error_code ec;
+      fs::create_directories( directory, ec );
+    }
+
+    // detached, the exporter only ever touches the registry which lives until the process exits
+    std::thread( [ path, interval ]()
+    {
+      while( getExporterRunning() )
+      {
+        writeFile( path );
+
+        for( uint32_t i = 0; i < interval * 10 && getExporterRunning(); ++i )
+          std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+      }
+    } ).detach();
+  }
+
+  void Registry::stopExporter()
+  {
+    getExporterRunning() = false;
+  }
+
+}
@@ -0,0 +1,218 @@
+#ifndef SAPPHIRE_METRICS_H
+#define SAPPHIRE_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace Sapphire::Metrics
+{
+
+  /*!
+   * @brief Returns the shard a thread writes to, assigned round robin on first use
+   */
+  std::size_t getThreadShard();
+
+  /*!
+   * @brief Monotonically increasing value, sharded per thread so concurrent writers never share a cache line
+   */
+  class Counter
+  {
+  public:
+    static constexpr std::size_t ShardCount = 16;
+
+    void inc( uint64_t value = 1 )
+    {
+      m_shards[ getThreadShard() & ( ShardCount - 1 ) ].value.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    uint64_t get() const
+    {
+      uint64_t total = 0;
+      for( auto& shard : m_shards )
+        total += shard.value.load( std::memory_order_relaxed );
+      return total;
+    }
+
+  private:
+    struct alignas( 64 ) Shard
+    {
+      std::atomic< uint64_t > value{ 0 };
+    };
+
+    std::array< Shard, ShardCount > m_shards;
+  };
+
+  /*!
+   * @brief Value that can go up and down, set by a single owner most of the time
+   */
+  class Gauge
+  {
+  public:
+    void set( int64_t value )
+    {
+      m_value.store( value, std::memory_order_relaxed );
+    }
+
+    void add( int64_t value )
+    {
+      m_value.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    int64_t get() const
+    {
+      return m_value.load( std::memory_order_relaxed );
+    }
+
+  private:
+    std::atomic< int64_t > m_value{ 0 };
+  };
+
+  /*!
+   * @brief Log-linear histogram, every power of two is split into 8 linear sub buckets
+   *
+   * This keeps the relative error of recorded values below 12.5% over the whole 64bit range with a fixed
+   * amount of buckets, the same idea HdrHistogram uses. Values are usually microseconds.
+   */
+  class Histogram
+  {
+  public:
+    static constexpr uint32_t SubBucketBits = 3;
+    static constexpr uint32_t SubBucketCount = 1 << SubBucketBits;
+    static constexpr uint32_t BucketCount = ( 64 - SubBucketBits + 1 ) * SubBucketCount;
+    static constexpr std::size_t ShardCount = 4;
+
+    void record( uint64_t value )
+    {
+      auto& shard = m_shards[ getThreadShard() & ( ShardCount - 1 ) ];
+      shard.buckets[ getBucketIndex( value ) ].fetch_add( 1, std::memory_order_relaxed );
+      shard.count.fetch_add( 1, std::memory_order_relaxed );
+      shard.sum.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    uint64_t getCount() const;
+
+    uint64_t getSum() const;
+
+    /*!
+     * @brief Approximates the value below which the given fraction of recorded values falls
+     * @param percentile 0.0 - 1.0
+     * @return upper bound of the bucket the percentile falls into
+     */
+    uint64_t getPercentile( double percentile ) const;
+
+    /*!
+     * @brief Returns the cumulative count of values < 2^n for every n in 0 - 63
+     */
+    std::array< uint64_t, 64 > getPowerOfTwoBuckets() const;
+
+    void reset();
+
+    static uint32_t getBucketIndex( uint64_t value );
+
+    static uint64_t getBucketUpperBound( uint32_t index );
+
+  private:
+    struct alignas( 64 ) Shard
+    {
+      std::array< std::atomic< uint64_t >, BucketCount > buckets{};
+      std::atomic< uint64_t > count{ 0 };
+      std::atomic< uint64_t > sum{ 0 };
+    };
+
+    std::array< uint64_t, BucketCount > collectBuckets() const;
+
+    std::array< Shard, ShardCount > m_shards;
+  };
+
+  /*!
+   * @brief Measures the lifetime of the object and records it in microseconds into a histogram
+   */
+  class ScopedTimer
+  {
+  public:
+    explicit ScopedTimer( Histogram& histogram ) :
+      m_histogram( histogram ),
+      m_start( std::chrono::steady_clock::now() )
+    {
+    }
+
+    ~ScopedTimer()
+    {
+      auto elapsed = std::chrono::steady_clock::now() - m_start;
+      m_histogram.record( static_cast< uint64_t >(
+        std::chrono::duration_cast< std::chrono::microseconds >( elapsed ).count() ) );
+    }
+
+  private:
+    Histogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  /*!
+   * @brief Process wide metric registry
+   *
+   * Metrics are created on first access and live until the process exits, so the returned references can be
+   * cached by callers. Looking a metric up takes a lock, hot paths should keep the reference around instead.
+   * Labels are passed preformatted in prometheus syntax, eg: opcode="0x0194"
+   */
+  class Registry
+  {
+  public:
+    static Counter& counter( const std::string& name, const std::string& labels = "", const std::string& help = "" );
+
+    static Gauge& gauge( const std::string& name, const std::string& labels = "", const std::string& help = "" );
+
+    static Histogram& histogram( const std::string& name, const std::string& labels = "",
+                                 const std::string& help = "" );
+
+    /*!
+     * @brief Writes all metrics in the prometheus text exposition format
+     */
+    static void writePrometheus( std::ostream& out );
+
+    /*!
+     * @brief Starts a background thread writing all metrics to path every interval seconds
+     *
+     * The file is written to a temporary file first and renamed, so a collector
+     * (eg. the node_exporter textfile collector) never reads a partial file.
+     */
+    static void startExporter( const std::string& path, uint32_t interval );
+
+    static void stopExporter();
+
+  private:
+    enum class Type
+    {
+      Counter,
+      Gauge,
+      Histogram
+    };
+
+    struct Family
+    {
+      Type type;
+      std::string help;
+      std::map< std::string, std::unique_ptr< Counter > > counters;
+      std::map< std::string, std::unique_ptr< Gauge > > gauges;
+      std::map< std::string, std::unique_ptr< Histogram > > histograms;
+    };
+
+    static Family& getFamily( const std::string& name, Type type, const std::string& help );
+
+    static bool writeFile( const std::string& path );
+
+    // function local statics, metrics may be registered from other static initializers
+    static std::mutex& getMutex();
+    static std::map< std::string, Family >& getFamilies();
+    static std::atomic< bool >& getExporterRunning();
+  };
+
+}
+
+#endif //SAPPHIRE_METRICS_H
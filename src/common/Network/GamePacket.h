@@ -101,6 +101,25 @@ namespace Sapphire::Network::Packets
       return {};
     }
 
+    /**
+    * @brief Writes the same bytes as getData, without the temporary vector.
+    * @param out Has to have room for getSize() bytes.
+    */
+    virtual void writeData( uint8_t* out ) const
+    {
+      auto data = getData();
+      if( !data.empty() )
+        memcpy( out, data.data(), data.size() );
+    }
+
+    /**
+    * @brief Gets the amount of segments this packet adds to a packet container.
+    */
+    virtual uint32_t getSegmentCount() const
+    {
+      return 1;
+    }
+
   protected:
     /** The segment header */
     FFXIVARR_PACKET_SEGMENT_HEADER m_segHdr;
@@ -125,6 +144,15 @@ namespace Sapphire::Network::Packets
       return m_segmentType;
     }
 
+    /**
+    * @brief Gets the ipc opcode of this packet.
+    * @return The opcode, 0 if this is not an ipc packet.
+    */
+    virtual uint16_t getIpcOpcode() const
+    {
+      return 0;
+    }
+
     /**
     * @brief Sets the source actor id for this packet.
     * @param actorId The source actor id.
@@ -231,11 +259,26 @@ namespace Sapphire::Network::Packets
       return data;
     }
 
+    void writeData( uint8_t* out ) const override
+    {
+      auto segmentHeaderSize = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER );
+      auto ipcHeaderSize = sizeof( FFXIVARR_IPC_HEADER );
+
+      memcpy( out, &m_segHdr, segmentHeaderSize );
+      memcpy( out + segmentHeaderSize, &m_ipcHdr, ipcHeaderSize );
+      memcpy( out + segmentHeaderSize + ipcHeaderSize, &m_data, sizeof( m_data ) );
+    }
+
     T1 ipcType() override
     {
       return static_cast< T1 >( m_data._ServerIpcType );
     };
 
+    uint16_t getIpcOpcode() const override
+    {
+      return static_cast< uint16_t >( m_ipcHdr.type );
+    }
+
     /** Gets a reference to the underlying IPC data structure. */
     T& data()
     {
@@ -310,6 +353,14 @@ namespace Sapphire::Network::Packets
       return data;
     }
 
+    uint16_t getIpcOpcode() const override
+    {
+      if( m_segHdr.type != SEGMENTTYPE_IPC || m_data.size() < sizeof( FFXIVARR_IPC_HEADER ) )
+        return 0;
+
+      return *reinterpret_cast< const uint16_t* >( &m_data[ 0x02 ] );
+    }
+
     /** Gets a reference to the underlying IPC data structure. */
     std::vector< uint8_t >& data()
     {
@@ -329,6 +380,48 @@ namespace Sapphire::Network::Packets
     std::vector< uint8_t > m_data;
   };
 
+  /**
+  * @brief A run of already written segments, sent as they are.
+  *
+  * The segments are a slice of a buffer that is shared with whoever wrote them, so queueing
+  * a bundle copies nothing. The segment header of the bundle itself is never sent, its size
+  * is the size of the slice.
+  */
+  class FFXIVBundlePacket :
+    public FFXIVPacketBase
+  {
+  public:
+    FFXIVBundlePacket( std::shared_ptr< const std::vector< uint8_t > > pBuffer, std::size_t offset,
+                       std::size_t size, uint32_t segmentCount ) :
+      m_pBuffer( std::move( pBuffer ) ),
+      m_offset( offset ),
+      m_segmentCount( segmentCount )
+    {
+      m_segHdr.size = static_cast< uint32_t >( size );
+    }
+
+    std::vector< uint8_t > getData() const override
+    {
+      auto pBegin = m_pBuffer->data() + m_offset;
+      return std::vector< uint8_t >( pBegin, pBegin + m_segHdr.size );
+    }
+
+    void writeData( uint8_t* out ) const override
+    {
+      memcpy( out, m_pBuffer->data() + m_offset, m_segHdr.size );
+    }
+
+    uint32_t getSegmentCount() const override
+    {
+      return m_segmentCount;
+    }
+
+  private:
+    std::shared_ptr< const std::vector< uint8_t > > m_pBuffer;
+    std::size_t m_offset;
+    uint32_t m_segmentCount;
+  };
+
 }
 
 #endif
\ No newline at end of file
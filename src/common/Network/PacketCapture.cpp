@@ -0,0 +1,142 @@
+#include "PacketCapture.h"
+#include "GamePacketParser.h"
+
+#include <Util/Util.h>
+
+#include <cstring>
+
+using namespace Sapphire;
+
+namespace
+{
+  // buffered records are written out once this many bytes or seconds have accumulated
+  constexpr std::size_t FlushSize = 64 * 1024;
+  constexpr uint64_t FlushIntervalMs = 5000;
+}
+
+Network::Packets::PacketCaptureWriter::~PacketCaptureWriter()
+{
+  close();
+}
+
+bool Network::Packets::PacketCaptureWriter::open( const std::string& path, uint32_t sessionId,
+                                                  uint16_t connectionType )
+{
+  close();
+
+  m_file.open( path, std::ios::binary | std::ios::trunc );
+  if( !m_file.is_open() )
+    return false;
+
+  m_startTime = Common::Util::getTimeMs();
+  m_lastFlush = m_startTime;
+
+  PacketCaptureHeader header{};
+  header.magic = PacketCaptureMagic;
+  header.version = PacketCaptureVersion;
+  header.connectionType = connectionType;
+  header.sessionId = sessionId;
+  header.startTime = m_startTime;
+  m_file.write( reinterpret_cast< const char* >( &header ), sizeof( header ) );
+
+  m_buffer.reserve( FlushSize + 1024 );
+
+  return m_file.good();
+}
+
+void Network::Packets::PacketCaptureWriter::write( uint64_t timeMs, const FFXIVARR_PACKET_RAW& packet )
+{
+  if( !m_file.is_open() )
+    return;
+
+  const auto headerSize = sizeof( FFXIVARR_PACKET_SEGMENT_HEADER );
+  if( packet.segHdr.size < headerSize || packet.data.size() < packet.segHdr.size - headerSize )
+    return;
+
+  auto offsetMs = static_cast< uint32_t >( timeMs > m_startTime ? timeMs - m_startTime : 0 );
+
+  auto pos = m_buffer.size();
+  m_buffer.resize( pos + sizeof( offsetMs ) + packet.segHdr.size );
+  memcpy( &m_buffer[ pos ], &offsetMs, sizeof( offsetMs ) );
+  memcpy( &m_buffer[ pos + sizeof( offsetMs ) ], &packet.segHdr, headerSize );
+  memcpy( &m_buffer[ pos + sizeof( offsetMs ) + headerSize ], packet.data.data(), packet.segHdr.size - headerSize );
+
+  if( m_buffer.size() >= FlushSize || timeMs - m_lastFlush >= FlushIntervalMs )
+  {
+    flush();
+    m_lastFlush = timeMs;
+  }
+}
+
+void Network::Packets::PacketCaptureWriter::flush()
+{
+  if( !m_file.is_open() || m_buffer.empty() )
+    return;
+
+  m_file.write( reinterpret_cast< const char* >( m_buffer.data() ), m_buffer.size() );
+  m_file.flush();
+  m_buffer.clear();
+}
+
+void Network::Packets::PacketCaptureWriter::close()
+{
+  if( !m_file.is_open() )
+    return;
+
+  flush();
+  m_file.close();
+}
+
+bool Network::Packets::PacketCaptureWriter::isOpen() const
+{
+  return m_file.is_open();
+}
+
+bool Network::Packets::loadPacketCapture( const std::string& path, PacketCaptureHeader& header,
+                                          std::vector< PacketCaptureRecord >& records )
+{
+  std::ifstream file( path, std::ios::binary | std::ios::ate );
+  if( !file.is_open() )
+    return false;
+
+  auto size = static_cast< std::size_t >( file.tellg() );
+  file.seekg( 0 );
+
+  std::vector< uint8_t > data( size );
+  if( !file.read( reinterpret_cast< char* >( data.data() ), size ) )
+    return false;
+
+  if( size < sizeof( PacketCaptureHeader ) )
+    return false;
+
+  memcpy( &header, data.data(), sizeof( PacketCaptureHeader ) );
+  if( header.magic != PacketCaptureMagic || header.version != PacketCaptureVersion )
+    return false;
+
+  records.clear();
+
+  // a capture of a crashed server can end in the middle of a record, everything before it is still usable
+  auto offset = sizeof( PacketCaptureHeader );
+  while( size - offset >= sizeof( uint32_t ) + sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) )
+  {
+    PacketCaptureRecord record;
+    memcpy( &record.offsetMs, &data[ offset ], sizeof( uint32_t ) );
+
+    FFXIVARR_PACKET_SEGMENT_HEADER segmentHeader{};
+    memcpy( &segmentHeader, &data[ offset + sizeof( uint32_t ) ], sizeof( segmentHeader ) );
+
+    if( !checkSegmentHeader( segmentHeader ) || segmentHeader.size < sizeof( segmentHeader ) )
+      return false;
+
+    if( size - offset - sizeof( uint32_t ) < segmentHeader.size )
+      break;
+
+    auto segmentStart = data.begin() + offset + sizeof( uint32_t );
+    record.segment.assign( segmentStart, segmentStart + segmentHeader.size );
+    records.push_back( std::move( record ) );
+
+    offset += sizeof( uint32_t ) + segmentHeader.size;
+  }
+
+  return true;
+}
@@ -0,0 +1,83 @@
+#ifndef SAPPHIRE_PACKETCAPTURE_H
+#define SAPPHIRE_PACKETCAPTURE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "CommonNetwork.h"
+
+namespace Sapphire::Network::Packets
+{
+
+  /*!
+   * @brief Header at the start of every capture file
+   *
+   * A capture holds the inbound game packets of a single session. The header is followed by records of
+   * a uint32_t offset in milliseconds since startTime and the packet segment, segment header included.
+   */
+  struct PacketCaptureHeader
+  {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t connectionType;
+    uint32_t sessionId;
+    uint32_t reserved;
+    // unix time in milliseconds the capture was started at
+    uint64_t startTime;
+  };
+
+  struct PacketCaptureRecord
+  {
+    uint32_t offsetMs;
+    // segment header and segment data, exactly as received
+    std::vector< uint8_t > segment;
+  };
+
+  constexpr uint32_t PacketCaptureMagic = 0x50414353; // "SCAP"
+  constexpr uint16_t PacketCaptureVersion = 1;
+
+  /*!
+   * @brief Appends the packets of a session to a capture file
+   *
+   * Records are buffered in memory and written out in blocks, so capturing stays cheap enough to
+   * leave enabled on a live server.
+   */
+  class PacketCaptureWriter
+  {
+  public:
+    PacketCaptureWriter() = default;
+
+    ~PacketCaptureWriter();
+
+    bool open( const std::string& path, uint32_t sessionId, uint16_t connectionType );
+
+    /*!
+     * @param timeMs time the packet was handled at, as returned by Util::getTimeMs
+     */
+    void write( uint64_t timeMs, const FFXIVARR_PACKET_RAW& packet );
+
+    void flush();
+
+    void close();
+
+    bool isOpen() const;
+
+  private:
+    std::ofstream m_file;
+    uint64_t m_startTime{ 0 };
+    uint64_t m_lastFlush{ 0 };
+    std::vector< uint8_t > m_buffer;
+  };
+
+  /*!
+   * @brief Reads a whole capture file
+   * @return false if the file could not be read or is not a capture
+   */
+  bool loadPacketCapture( const std::string& path, PacketCaptureHeader& header,
+                          std::vector< PacketCaptureRecord >& records );
+
+}
+
+#endif // SAPPHIRE_PACKETCAPTURE_H
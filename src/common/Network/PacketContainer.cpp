@@ -27,7 +27,7 @@ void Network::Packets::PacketContainer::addPacket( Network::Packets::FFXIVPacket
   m_entryList.push_back( entry );
 
   m_ipcHdr.size += static_cast< uint32_t >( entry->getSize() );
-  m_ipcHdr.count++;
+  m_ipcHdr.count += entry->getSegmentCount();
 }
 
 void Network::Packets::PacketContainer::fillSendBuffer( std::vector< uint8_t >& sendBuffer )
@@ -60,8 +60,7 @@ void Network::Packets::PacketContainer::fillSendBuffer( std::vector< uint8_t >&
       pPacket->setTargetActor( m_segmentTargetOverride );
     }
 
-    auto data = pPacket->getData();
-    memcpy( &tempBuffer[ 0 ] + sizeof( FFXIVARR_PACKET_HEADER ) + offset, &data[ 0 ], pPacket->getSize() );
+    pPacket->writeData( &tempBuffer[ 0 ] + sizeof( FFXIVARR_PACKET_HEADER ) + offset );
     offset += pPacket->getSize();
   }
 
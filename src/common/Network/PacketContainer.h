@@ -12,6 +12,10 @@ namespace Sapphire::Network::Packets
 {
 
   using FFXIVPacketBasePtr = std::shared_ptr< FFXIVPacketBase >;
+
+  // a container is sent as soon as the packets in it pass this many bytes
+  constexpr uint32_t MaxContainerSize = 10000;
+
   class PacketContainer
   {
   public:
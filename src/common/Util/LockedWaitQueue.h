@@ -35,6 +35,13 @@ namespace Sapphire::Common::Util
       m_condition.notify_one();
     }
 
+    std::size_t size()
+    {
+      std::lock_guard< std::mutex > lock( m_queueLock );
+
+      return m_queue.size();
+    }
+
     bool empty()
     {
       std::lock_guard< std::mutex > lock( m_queueLock );
@@ -0,0 +1,200 @@
+#ifndef SAPPHIRE_SHARDEDMAP_H
+#define SAPPHIRE_SHARDEDMAP_H
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Common::Util
+{
+
+  /*!
+   * @brief Hash map split into a fixed number of independently locked shards.
+   *
+   * Lookups only take a shared lock on the shard owning the key, so readers on different
+   * threads never contend on a single global mutex. Writers lock exclusively, but only their shard.
+   * Iteration is done on a snapshot so callers never hold a lock while running their own logic.
+   */
+  template< typename Key, typename Value, std::size_t ShardCount = 16, typename Hash = std::hash< Key > >
+  class ShardedMap
+  {
+  public:
+    static_assert( ShardCount > 0 && ( ShardCount & ( ShardCount - 1 ) ) == 0,
+                   "ShardCount must be a power of two" );
+
+    ShardedMap() :
+      m_size( 0 )
+    {
+    }
+
+    /*!
+     * @brief Inserts value for key if no entry exists yet
+     * @return true if the value was inserted, false if the key was already present
+     */
+    bool insert( const Key& key, const Value& value )
+    {
+      auto& shard = getShard( key );
+      std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+      if( !shard.map.emplace( key, value ).second )
+        return false;
+
+      ++m_size;
+      return true;
+    }
+
+    /*!
+     * @brief Inserts or overwrites the value stored for key
+     */
+    void set( const Key& key, const Value& value )
+    {
+      auto& shard = getShard( key );
+      std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+      auto res = shard.map.insert_or_assign( key, value );
+      if( res.second )
+        ++m_size;
+    }
+
+    /*!
+     * @brief Looks up key and copies the stored value into out
+     * @return true if the key was found
+     */
+    bool find( const Key& key, Value& out ) const
+    {
+      auto& shard = getShard( key );
+      std::shared_lock< std::shared_mutex > lock( shard.mutex );
+
+      auto it = shard.map.find( key );
+      if( it == shard.map.end() )
+        return false;
+
+      out = it->second;
+      return true;
+    }
+
+    /*!
+     * @brief Returns the value stored for key or a default constructed value
+     */
+    Value get( const Key& key ) const
+    {
+      Value value{};
+      find( key, value );
+      return value;
+    }
+
+    bool contains( const Key& key ) const
+    {
+      auto& shard = getShard( key );
+      std::shared_lock< std::shared_mutex > lock( shard.mutex );
+      return shard.map.find( key ) != shard.map.end();
+    }
+
+    /*!
+     * @brief Removes key from the map
+     * @return true if an entry was removed
+     */
+    bool erase( const Key& key )
+    {
+      auto& shard = getShard( key );
+      std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+      if( shard.map.erase( key ) == 0 )
+        return false;
+
+      --m_size;
+      return true;
+    }
+
+    /*!
+     * @brief Removes key only if it still maps to value
+     * @return true if an entry was removed
+     */
+    bool eraseIf( const Key& key, const Value& value )
+    {
+      auto& shard = getShard( key );
+      std::unique_lock< std::shared_mutex > lock( shard.mutex );
+
+      auto it = shard.map.find( key );
+      if( it == shard.map.end() || !( it->second == value ) )
+        return false;
+
+      shard.map.erase( it );
+      --m_size;
+      return true;
+    }
+
+    /*!
+     * @brief Copies all values into a vector, locking one shard at a time
+     */
+    std::vector< Value > snapshot() const
+    {
+      std::vector< Value > values;
+      values.reserve( size() );
+
+      for( auto& shard : m_shards )
+      {
+        std::shared_lock< std::shared_mutex > lock( shard.mutex );
+        for( auto& entry : shard.map )
+          values.push_back( entry.second );
+      }
+
+      return values;
+    }
+
+    void clear()
+    {
+      for( auto& shard : m_shards )
+      {
+        std::unique_lock< std::shared_mutex > lock( shard.mutex );
+        m_size -= shard.map.size();
+        shard.map.clear();
+      }
+    }
+
+    std::size_t size() const
+    {
+      return m_size.load( std::memory_order_relaxed );
+    }
+
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+  private:
+    struct Shard
+    {
+      mutable std::shared_mutex mutex;
+      std::unordered_map< Key, Value, Hash > map;
+    };
+
+    Shard& getShard( const Key& key )
+    {
+      return m_shards[ shardIndex( key ) ];
+    }
+
+    const Shard& getShard( const Key& key ) const
+    {
+      return m_shards[ shardIndex( key ) ];
+    }
+
+    std::size_t shardIndex( const Key& key ) const
+    {
+      // mix the hash a bit, std::hash for integers is the identity on most implementations
+      auto hash = Hash{}( key );
+      hash ^= hash >> 16;
+      return hash & ( ShardCount - 1 );
+    }
+
+    std::array< Shard, ShardCount > m_shards;
+    std::atomic< std::size_t > m_size;
+  };
+
+}
+
+#endif //SAPPHIRE_SHARDEDMAP_H
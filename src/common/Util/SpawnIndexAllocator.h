@@ -67,6 +67,16 @@ namespace Sapphire::Common::Util
       m_actorIdToAllocatedMap.clear();
     }
 
+    bool isActorSpawned( ActorIdType actorId ) const
+    {
+      return m_actorIdToAllocatedMap.find( actorId ) != m_actorIdToAllocatedMap.end();
+    }
+
+    std::size_t getFreeSpawnIndexCount() const
+    {
+      return m_availableIds.size();
+    }
+
     bool isSpawnIndexValid( T spawnIndex )
     {
       return spawnIndex != getAllocFailId();
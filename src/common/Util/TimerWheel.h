@@ -0,0 +1,180 @@
+#ifndef SAPPHIRE_TIMERWHEEL_H
+#define SAPPHIRE_TIMERWHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Sapphire::Common::Util
+{
+
+  /*!
+   * @brief Hierarchical timer wheel
+   *
+   * Timers are bucketed by due time into 4 levels of 64 slots each. Advancing the wheel only touches
+   * the slots that became due, so the cost of an update does not depend on the amount of pending timers.
+   * Timers further out than the wheel can represent are parked in the last slot of the top level and
+   * re-inserted when it gets cascaded.
+   */
+  template< typename T >
+  class TimerWheel
+  {
+  public:
+    static constexpr uint32_t SlotBits = 6;
+    static constexpr uint32_t SlotCount = 1 << SlotBits;
+    static constexpr uint32_t LevelCount = 4;
+
+    explicit TimerWheel( uint32_t resolutionMs = 50, uint64_t startTimeMs = 0 ) :
+      m_resolution( resolutionMs == 0 ? 1 : resolutionMs ),
+      m_currentTick( startTimeMs / ( resolutionMs == 0 ? 1 : resolutionMs ) ),
+      m_size( 0 )
+    {
+    }
+
+    /*!
+     * @brief Schedules payload to fire once the wheel is advanced to or past dueTimeMs
+     */
+    void schedule( uint64_t dueTimeMs, T payload )
+    {
+      // round up, a timer should never fire before it is due
+      auto dueTick = ( dueTimeMs + m_resolution - 1 ) / m_resolution;
+      insert( dueTick, std::move( payload ) );
+      ++m_size;
+    }
+
+    /*!
+     * @brief Advances the wheel to nowMs, calling callback( T& ) for every timer that became due
+     *
+     * The callback may schedule new timers, those are never fired in the same call.
+     */
+    template< typename Callback >
+    void advance( uint64_t nowMs, Callback&& callback )
+    {
+      auto targetTick = nowMs / m_resolution;
+
+      if( !m_due.empty() )
+        fire( m_due, callback );
+
+      while( m_currentTick < targetTick )
+      {
+        ++m_currentTick;
+
+        // cascade higher levels down whenever a lower level completed a full rotation
+        for( uint32_t level = 1; level < LevelCount; ++level )
+        {
+          if( ( m_currentTick & ( ( uint64_t( 1 ) << ( level * SlotBits ) ) - 1 ) ) != 0 )
+            break;
+
+          auto& slot = m_levels[ level ][ getSlotIndex( m_currentTick, level ) ];
+          if( slot.empty() )
+            continue;
+
+          std::vector< Entry > entries;
+          entries.swap( slot );
+          for( auto& entry : entries )
+          {
+            // due right now, fire it with this tick instead of deferring it to the next advance
+            if( entry.first <= m_currentTick )
+              m_levels[ 0 ][ getSlotIndex( m_currentTick, 0 ) ].push_back( std::move( entry ) );
+            else
+              insert( entry.first, std::move( entry.second ) );
+          }
+        }
+
+        auto& slot = m_levels[ 0 ][ getSlotIndex( m_currentTick, 0 ) ];
+        if( !slot.empty() )
+          fire( slot, callback );
+
+        // nothing left to do, skip straight to the target
+        if( m_size == 0 )
+        {
+          m_currentTick = targetTick;
+          break;
+        }
+      }
+    }
+
+    std::size_t size() const
+    {
+      return m_size;
+    }
+
+    bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    void clear()
+    {
+      for( auto& level : m_levels )
+        for( auto& slot : level )
+          slot.clear();
+      m_due.clear();
+      m_size = 0;
+    }
+
+  private:
+    using Entry = std::pair< uint64_t, T >;
+
+    static uint32_t getSlotIndex( uint64_t tick, uint32_t level )
+    {
+      return static_cast< uint32_t >( tick >> ( level * SlotBits ) ) & ( SlotCount - 1 );
+    }
+
+    void insert( uint64_t dueTick, T&& payload )
+    {
+      if( dueTick <= m_currentTick )
+      {
+        m_due.emplace_back( dueTick, std::move( payload ) );
+        return;
+      }
+
+      auto delta = dueTick - m_currentTick;
+
+      for( uint32_t level = 0; level < LevelCount; ++level )
+      {
+        if( delta < ( uint64_t( 1 ) << ( ( level + 1 ) * SlotBits ) ) )
+        {
+          m_levels[ level ][ getSlotIndex( dueTick, level ) ].emplace_back( dueTick, std::move( payload ) );
+          return;
+        }
+      }
+
+      // out of range, park it in the slot that is cascaded last and let it travel down from there
+      auto parkTick = m_currentTick + ( uint64_t( 1 ) << ( LevelCount * SlotBits ) ) - 1;
+      m_levels[ LevelCount - 1 ][ getSlotIndex( parkTick, LevelCount - 1 ) ].emplace_back( dueTick,
+                                                                                            std::move( payload ) );
+    }
+
+    template< typename Callback >
+    void fire( std::vector< Entry >& slot, Callback& callback )
+    {
+      std::vector< Entry > entries;
+      entries.swap( slot );
+
+      for( auto& entry : entries )
+      {
+        // parked timers may come back before they are due, put them back into the wheel
+        if( entry.first > m_currentTick )
+        {
+          insert( entry.first, std::move( entry.second ) );
+          continue;
+        }
+
+        --m_size;
+        callback( entry.second );
+      }
+    }
+
+    uint32_t m_resolution;
+    uint64_t m_currentTick;
+    std::size_t m_size;
+
+    std::array< std::array< std::vector< Entry >, SlotCount >, LevelCount > m_levels;
+    std::vector< Entry > m_due;
+  };
+
+}
+
+#endif //SAPPHIRE_TIMERWHEEL_H
@@ -0,0 +1,9 @@
+#include "Version.h"
+
+namespace Sapphire::Version
+{
+
+  const std::string GIT_HASH = "9c6dc4771296a966cf5dc047f7fa86007b03d8d9";
+  const std::string VERSION = "heads/master";
+
+} /* Sapphire::Version */
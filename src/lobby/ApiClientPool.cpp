@@ -0,0 +1,232 @@
+#include "ApiClientPool.h"
+
+#include <chrono>
+#include <thread>
+
+#include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
+
+using namespace Sapphire;
+
+namespace
+{
+  // the api closes keep-alive sockets after 5 seconds without a request (timeout_request in server_http.hpp),
+  // a socket idle for longer than this is dropped before use instead of failing a request that can't be retried
+  constexpr auto MaxKeepAliveIdle = std::chrono::milliseconds( 4000 );
+}
+
+Lobby::ApiClientPool::ApiClientPool() :
+  m_retries( 0 ),
+  m_retryBackoffMs( 0 )
+{
+}
+
+Lobby::ApiClientPool::~ApiClientPool()
+{
+  for( auto& pClient : m_clients )
+    pClient->client->close();
+}
+
+void Lobby::ApiClientPool::init( const std::string& host, uint32_t poolSize, uint32_t timeout,
+                                 uint32_t retries, uint32_t retryBackoffMs )
+{
+  std::lock_guard< std::mutex > lock( m_poolMutex );
+
+  m_host = host;
+  m_retries = retries;
+  m_retryBackoffMs = retryBackoffMs;
+
+  if( poolSize == 0 )
+    poolSize = 1;
+
+  m_clients.clear();
+  m_freeClients.clear();
+
+  for( uint32_t i = 0; i < poolSize; ++i )
+  {
+    auto pClient = std::make_unique< PooledClient >();
+    pClient->client = std::make_unique< HttpClient >( m_host );
+    pClient->client->config.timeout = timeout;
+
+    m_freeClients.push_back( pClient.get() );
+    m_clients.push_back( std::move( pClient ) );
+  }
+
+  m_poolStats = PoolStats();
+  m_poolStats.size = poolSize;
+}
+
+Lobby::ApiClientPool::PooledClient* Lobby::ApiClientPool::acquire()
+{
+  std::unique_lock< std::mutex > lock( m_poolMutex );
+
+  if( m_freeClients.empty() )
+  {
+    m_poolStats.waits++;
+    m_poolCv.wait( lock, [ this ] { return !m_freeClients.empty(); } );
+  }
+
+  auto pClient = m_freeClients.back();
+  m_freeClients.pop_back();
+
+  m_poolStats.inUse++;
+  if( m_poolStats.inUse > m_poolStats.maxInUse )
+    m_poolStats.maxInUse = m_poolStats.inUse;
+
+  static auto& inUse = Metrics::Registry::gauge( "lobby_api_pool_in_use", "", "Api connections currently in use" );
+  inUse.set( m_poolStats.inUse );
+
+  return pClient;
+}
+
+void Lobby::ApiClientPool::release( PooledClient* pClient )
+{
+  {
+    std::lock_guard< std::mutex > lock( m_poolMutex );
+    m_freeClients.push_back( pClient );
+    m_poolStats.inUse--;
+  }
+  m_poolCv.notify_one();
+}
+
+bool Lobby::ApiClientPool::isConnectError( const std::system_error& e )
+{
+  auto& code = e.code();
+  return code == std::errc::connection_refused || code == std::errc::host_unreachable ||
+         code == std::errc::network_unreachable || code == std::errc::address_not_available ||
+         code.category() == asio::error::get_netdb_category();
+}
+
+Lobby::HttpResponse Lobby::ApiClientPool::request( const std::string& endpoint, const std::string& path,
+                                                   const std::string& data, bool retrySafe )
+{
+  auto start = std::chrono::steady_clock::now();
+
+  auto pClient = acquire();
+
+  HttpResponse r;
+  uint32_t attempt = 0;
+  auto backoff = m_retryBackoffMs;
+
+  while( true )
+  {
+    bool connectError = false;
+    std::string error;
+
+    // only a connection the api is known to still hold open is reused
+    if( pClient->connected && std::chrono::steady_clock::now() - pClient->lastUsed >= MaxKeepAliveIdle )
+    {
+      pClient->client->close();
+      pClient->connected = false;
+    }
+
+    try
+    {
+      auto reused = pClient->connected;
+
+      r = pClient->client->request( "POST", path, data );
+      pClient->connected = true;
+      pClient->lastUsed = std::chrono::steady_clock::now();
+
+      if( reused )
+      {
+        std::lock_guard< std::mutex > lock( m_poolMutex );
+        m_poolStats.connectsSaved++;
+      }
+      break;
+    }
+    catch( std::system_error& e )
+    {
+      connectError = isConnectError( e );
+      error = e.what();
+    }
+    catch( std::exception& e )
+    {
+      error = e.what();
+    }
+
+    // the connection is in an unknown state after a failure, start over on a fresh socket
+    pClient->client->close();
+    pClient->connected = false;
+    r = nullptr;
+
+    if( attempt >= m_retries )
+    {
+      Logger::error( "{0} failed, Api is not reachable: {1}", endpoint, error );
+      break;
+    }
+
+    // the api may have applied the request before it failed on our side
+    if( !retrySafe && !connectError )
+    {
+      Logger::error( "{0} failed and is not safe to retry: {1}", endpoint, error );
+      break;
+    }
+
+    Logger::debug( "{0} failed, retrying in {1}ms: {2}", endpoint, backoff, error );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( backoff ) );
+    backoff *= 2;
+    attempt++;
+  }
+
+  release( pClient );
+
+  auto timeUs = std::chrono::duration_cast< std::chrono::microseconds >(
+    std::chrono::steady_clock::now() - start ).count();
+
+  recordRequest( endpoint, static_cast< uint64_t >( timeUs ), attempt, r == nullptr );
+
+  return r;
+}
+
+void Lobby::ApiClientPool::recordRequest( const std::string& endpoint, uint64_t timeUs, uint32_t retries, bool failed )
+{
+  std::lock_guard< std::mutex > lock( m_statsMutex );
+
+  Metrics::Registry::histogram( "lobby_api_request_us", "endpoint=\"" + endpoint + "\"",
+                                "Api request time including retries in microseconds" ).record( timeUs );
+  if( failed )
+    Metrics::Registry::counter( "lobby_api_failures_total", "endpoint=\"" + endpoint + "\"",
+                                "Api requests that failed after all retries" ).inc();
+
+  auto& stats = m_endpointStats[ endpoint ];
+  stats.requests++;
+  stats.retries += retries;
+  stats.totalTimeUs += timeUs;
+
+  if( failed )
+    stats.failures++;
+
+  if( timeUs > stats.maxTimeUs )
+    stats.maxTimeUs = timeUs;
+}
+
+std::map< std::string, Lobby::ApiClientPool::EndpointStats > Lobby::ApiClientPool::getEndpointStats()
+{
+  std::lock_guard< std::mutex > lock( m_statsMutex );
+  return m_endpointStats;
+}
+
+Lobby::ApiClientPool::PoolStats Lobby::ApiClientPool::getPoolStats()
+{
+  std::lock_guard< std::mutex > lock( m_poolMutex );
+  return m_poolStats;
+}
+
+void Lobby::ApiClientPool::logStats()
+{
+  auto poolStats = getPoolStats();
+
+  Logger::info( "Api pool: {0} connections, {1} in use, {2} max in use, {3} waits, {4} reused connections",
+                poolStats.size, poolStats.inUse, poolStats.maxInUse, poolStats.waits, poolStats.connectsSaved );
+
+  for( auto& entry : getEndpointStats() )
+  {
+    auto& stats = entry.second;
+    auto avg = stats.requests > 0 ? stats.totalTimeUs / stats.requests : 0;
+
+    Logger::info( "Api {0}: {1} requests, {2} failed, {3} retries, avg {4}us, max {5}us",
+                  entry.first, stats.requests, stats.failures, stats.retries, avg, stats.maxTimeUs );
+  }
+}
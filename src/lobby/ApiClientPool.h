@@ -0,0 +1,117 @@
+#ifndef _APICLIENTPOOL_H_
+#define _APICLIENTPOOL_H_
+
+#include <chrono>
+#include <string>
+#include <map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <system_error>
+
+#include "client_http.hpp"
+
+namespace Sapphire::Lobby
+{
+
+  using HttpClient = SimpleWeb::Client< SimpleWeb::HTTP >;
+  using HttpResponse = std::shared_ptr< SimpleWeb::ClientBase< SimpleWeb::HTTP >::Response >;
+
+  /*!
+   * @brief Pool of keep-alive http clients used to talk to the api server.
+   *
+   * Every client keeps its socket open between requests, so only the first request
+   * on a client pays for the tcp handshake. A socket is reconnected once it was idle
+   * for close to the keep-alive timeout of the api. Requests from different lobby threads run
+   * concurrently on different clients. Failed requests are retried with a backoff on a
+   * fresh connection, requests that change data on the api only if the connection could
+   * not be set up, so a request the api already applied is never sent twice.
+   */
+  class ApiClientPool
+  {
+  public:
+    struct EndpointStats
+    {
+      uint64_t requests{ 0 };
+      uint64_t failures{ 0 };
+      uint64_t retries{ 0 };
+      uint64_t totalTimeUs{ 0 };
+      uint64_t maxTimeUs{ 0 };
+    };
+
+    struct PoolStats
+    {
+      uint32_t size{ 0 };
+      uint32_t inUse{ 0 };
+      uint32_t maxInUse{ 0 };
+      uint64_t waits{ 0 };
+      uint64_t connectsSaved{ 0 };
+    };
+
+    ApiClientPool();
+
+    ~ApiClientPool();
+
+    /*!
+     * @brief Sets up the pool, has to be called before the first request
+     * @param host host:port of the api server
+     * @param poolSize number of persistent connections
+     * @param timeout request timeout in seconds, 0 for none
+     * @param retries number of retries after the first failed attempt
+     * @param retryBackoffMs delay before the first retry, doubled for every further retry
+     */
+    void init( const std::string& host, uint32_t poolSize, uint32_t timeout, uint32_t retries, uint32_t retryBackoffMs );
+
+    /*!
+     * @brief Sends a POST to the api
+     * @param retrySafe true if sending the request twice does no harm, otherwise it is only retried
+     * when the connection could not be established
+     * @return the response, nullptr if every attempt failed
+     */
+    HttpResponse request( const std::string& endpoint, const std::string& path, const std::string& data,
+                          bool retrySafe );
+
+    std::map< std::string, EndpointStats > getEndpointStats();
+
+    PoolStats getPoolStats();
+
+    void logStats();
+
+  private:
+    struct PooledClient
+    {
+      std::unique_ptr< HttpClient > client;
+      // true once the client got a response, the socket is then reused for the next request
+      bool connected{ false };
+      // end of the last response, sockets idle for too long are closed by the api
+      std::chrono::steady_clock::time_point lastUsed;
+    };
+
+    PooledClient* acquire();
+
+    void release( PooledClient* pClient );
+
+    /*! true if the error happened before anything was sent to the api */
+    static bool isConnectError( const std::system_error& e );
+
+    void recordRequest( const std::string& endpoint, uint64_t timeUs, uint32_t retries, bool failed );
+
+    std::string m_host;
+    uint32_t m_retries;
+    uint32_t m_retryBackoffMs;
+
+    std::vector< std::unique_ptr< PooledClient > > m_clients;
+    std::vector< PooledClient* > m_freeClients;
+    std::mutex m_poolMutex;
+    std::condition_variable m_poolCv;
+
+    PoolStats m_poolStats;
+
+    std::mutex m_statsMutex;
+    std::map< std::string, EndpointStats > m_endpointStats;
+  };
+
+}
+
+#endif
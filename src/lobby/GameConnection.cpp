@@ -17,6 +17,8 @@
 
 #include "Forwards.h"
 
+#include <future>
+
 using namespace Sapphire;
 using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
@@ -105,7 +107,7 @@ Lobby::GameConnection::sendError( uint64_t sequence, uint32_t errorcode, uint16_
   errorPacket->data().error_id = errorcode;
   errorPacket->data().message_id = messageId;
 
-  LobbyPacketContainer pRP( m_encKey );
+  LobbyPacketContainer pRP( &m_blowFish );
   pRP.addPacket( errorPacket );
   sendPacket( pRP );
 }
@@ -116,7 +118,7 @@ void Lobby::GameConnection::getCharList( FFXIVARR_PACKET_RAW& packet, uint32_t t
   Logger::info( "Sequence [{0}]", sequence );
 
   Logger::info( "[{0}] ReqCharList", m_pSession->getAccountID() );
-  LobbyPacketContainer pRP( m_encKey );
+  LobbyPacketContainer pRP( &m_blowFish );
 
   auto serverListPacket = makeLobbyPacket< FFXIVIpcServerList >( tmpId );
   serverListPacket->data().seq = 1;
@@ -187,7 +189,7 @@ void Lobby::GameConnection::getCharList( FFXIVARR_PACKET_RAW& packet, uint32_t t
       charListPacket->data().counter = ( i * 4 ) + 1;
       charListPacket->data().unknown4 = 128;
     }
-    LobbyPacketContainer pRP( m_encKey );
+    LobbyPacketContainer pRP( &m_blowFish );
     pRP.addPacket( charListPacket );
     sendPacket( pRP );
 
@@ -223,7 +225,7 @@ void Lobby::GameConnection::enterWorld( FFXIVARR_PACKET_RAW& packet, uint32_t tm
 
   Logger::info( "[{0}] Logging in as {1} ({2})", m_pSession->getAccountID(), logInCharName, logInCharId );
 
-  LobbyPacketContainer pRP( m_encKey );
+  LobbyPacketContainer pRP( &m_blowFish );
 
   auto enterWorldPacket = makeLobbyPacket< FFXIVIpcEnterWorld >( tmpId );
   enterWorldPacket->data().contentId = lookupId;
@@ -261,7 +263,7 @@ bool Lobby::GameConnection::sendServiceAccountList( FFXIVARR_PACKET_RAW& packet,
     serviceIdInfoPacket->data().u2 = 0x99;
     serviceIdInfoPacket->data().serviceAccount[ 0 ].id = 0x002E4A2B;
 
-    LobbyPacketContainer pRP( m_encKey );
+    LobbyPacketContainer pRP( &m_blowFish );
     pRP.addPacket( serviceIdInfoPacket );
     sendPacket( pRP );
   }
@@ -285,8 +287,10 @@ bool Lobby::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW& packet, uin
   Logger::info( "[{0}] ReqCharCreate", m_pSession->getAccountID() );
 
   std::string name;
-  uint32_t newId = g_restConnector.getNextCharId();
+  // both ids are independent, fetch them on separate api connections at the same time
+  auto nextIdRequest = std::async( std::launch::async, [] { return g_restConnector.getNextCharId(); } );
   uint64_t newContentId = g_restConnector.getNextContentId();
+  uint32_t newId = nextIdRequest.get();
 
   if( type == 1 ) //Character creation name check
   {
@@ -294,7 +298,7 @@ bool Lobby::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW& packet, uin
 
     Logger::info( "[{0}] Type 1: {1}", m_pSession->getAccountID(), name );
 
-    LobbyPacketContainer pRP( m_encKey );
+    LobbyPacketContainer pRP( &m_blowFish );
 
     m_pSession->newCharName = name;
 
@@ -325,7 +329,7 @@ bool Lobby::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW& packet, uin
     if( g_restConnector.createCharacter( ( char* ) m_pSession->getSessionId(), m_pSession->newCharName, charDetails ) !=
         -1 )
     {
-      LobbyPacketContainer pRP( m_encKey );
+      LobbyPacketContainer pRP( &m_blowFish );
 
       auto charCreatePacket = makeLobbyPacket< FFXIVIpcCharCreate >( tmpId );
       charCreatePacket->data().content_id = newContentId;
@@ -367,7 +371,7 @@ bool Lobby::GameConnection::createOrModifyChar( FFXIVARR_PACKET_RAW& packet, uin
       charCreatePacket->data().unknown_7 = 1;
       charCreatePacket->data().unknown_8 = 1;
 
-      LobbyPacketContainer pRP( m_encKey );
+      LobbyPacketContainer pRP( &m_blowFish );
       pRP.addPacket( charCreatePacket );
       sendPacket( pRP );
     }
@@ -457,6 +461,7 @@ void Lobby::GameConnection::generateEncryptionKey( uint32_t key, const std::stri
   m_baseKey[ 9 ] = 0x11;
   memcpy( ( char* ) m_baseKey + 0x0C, keyPhrase.c_str(), keyPhrase.size() );
   Common::Util::md5( m_baseKey, m_encKey, 0x2C );
+  m_blowFish.initialize( m_encKey, 0x10 );
 }
 
 void Lobby::GameConnection::handlePackets( const Network::Packets::FFXIVARR_PACKET_HEADER& ipcHeader,
@@ -468,10 +473,8 @@ void Lobby::GameConnection::handlePackets( const Network::Packets::FFXIVARR_PACK
 
     if( m_bEncryptionInitialized && inPacket.segHdr.type == 3 )
     {
-      BlowFish blowfish;
-      blowfish.initialize( m_encKey, 0x10 );
-      blowfish.Decode( ( uint8_t* ) ( &inPacket.data[ 0 ] ), ( uint8_t* ) ( &inPacket.data[ 0 ] ),
-                       ( inPacket.data.size() ) - 0x10 );
+      m_blowFish.Decode( ( uint8_t* ) ( &inPacket.data[ 0 ] ), ( uint8_t* ) ( &inPacket.data[ 0 ] ),
+                         ( inPacket.data.size() ) - 0x10 );
     }
 
     switch( inPacket.segHdr.type )
@@ -485,9 +488,7 @@ void Lobby::GameConnection::handlePackets( const Network::Packets::FFXIVARR_PACK
         auto pe1 = std::make_shared< FFXIVRawPacket >( 0x0A, 0x290, 0, 0 );
         *reinterpret_cast< uint32_t* >( &pe1->data()[ 0 ] ) = 0xE0003C2A;
 
-        BlowFish blowfish;
-        blowfish.initialize( m_encKey, 0x10 );
-        blowfish.Encode( &pe1->data()[ 0 ], &pe1->data()[ 0 ], 0x280 );
+        m_blowFish.Encode( &pe1->data()[ 0 ], &pe1->data()[ 0 ], 0x280 );
 
         sendSinglePacket( pe1 );
         break;
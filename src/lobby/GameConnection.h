@@ -7,6 +7,7 @@
 
 #include <Network/PacketContainer.h>
 #include <Util/LockedQueue.h>
+#include <Crypt/blowfish.h>
 
 #include <asio.hpp>
 #include <map>
@@ -27,6 +28,9 @@ namespace Sapphire::Lobby
     // encryption key
     uint8_t m_encKey[0x10];
 
+    // cipher for m_encKey, the key schedule is only run once the key is exchanged
+    BlowFish m_blowFish;
+
     // base key, the encryption key is generated from this
     uint8_t m_baseKey[0x2C];
 
@@ -8,12 +8,12 @@ using namespace Sapphire;
 using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 
-LobbyPacketContainer::LobbyPacketContainer( uint8_t* encKey )
+LobbyPacketContainer::LobbyPacketContainer( BlowFish* pBlowFish )
 {
   memset( &m_header, 0, sizeof( Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER ) );
   m_header.size = sizeof( Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER );
 
-  m_encKey = encKey;
+  m_pBlowFish = pBlowFish;
 
   memset( m_dataBuf, 0, 0x1570 );
 }
@@ -28,12 +28,8 @@ void LobbyPacketContainer::addPacket( FFXIVPacketBasePtr pEntry )
   memcpy( m_dataBuf + m_header.size, &pEntry->getData()[ 0 ], pEntry->getSize() );
 
   // encryption key is set, we want to encrypt this packet
-  if( m_encKey != nullptr )
-  {
-    BlowFish blowfish;
-    blowfish.initialize( m_encKey, 0x10 );
-    blowfish.Encode( m_dataBuf + m_header.size + 0x10, m_dataBuf + m_header.size + 0x10, pEntry->getSize() - 0x10 );
-  }
+  if( m_pBlowFish != nullptr )
+    m_pBlowFish->Encode( m_dataBuf + m_header.size + 0x10, m_dataBuf + m_header.size + 0x10, pEntry->getSize() - 0x10 );
 
   m_header.size += pEntry->getSize();
   m_header.count++;
@@ -9,6 +9,8 @@
 
 #include "Forwards.h"
 
+class BlowFish;
+
 namespace Sapphire::Network::Packets
 {
 
@@ -17,7 +19,8 @@ namespace Sapphire::Network::Packets
   class LobbyPacketContainer
   {
   public:
-    LobbyPacketContainer( uint8_t* encKey = nullptr );
+    /*! packets are encrypted with pBlowFish if set, it has to outlive the container */
+    LobbyPacketContainer( BlowFish* pBlowFish = nullptr );
 
     ~LobbyPacketContainer();
 
@@ -30,7 +33,7 @@ namespace Sapphire::Network::Packets
   private:
     Sapphire::Network::Packets::FFXIVARR_PACKET_HEADER m_header;
 
-    uint8_t* m_encKey;
+    BlowFish* m_pBlowFish;
 
     std::vector< FFXIVPacketBasePtr > m_entryList;
 
@@ -22,30 +22,28 @@ Lobby::RestConnector::~RestConnector()
 
 }
 
-HttpResponse Lobby::RestConnector::requestApi( std::string endpoint, std::string data )
+void Lobby::RestConnector::init( uint32_t poolSize, uint32_t timeout, uint32_t retries, uint32_t retryBackoffMs )
 {
-  HttpClient client( restHost );
+  m_apiPool.init( restHost, poolSize, timeout, retries, retryBackoffMs );
+}
 
+Lobby::HttpResponse Lobby::RestConnector::requestApi( std::string endpoint, std::string data, bool retrySafe )
+{
   std::string reqstr = "/sapphire-api/lobby/" + endpoint;
 
-  HttpResponse r;
-  try
-  {
-    r = client.request( "POST", reqstr, data );
-  }
-  catch( std::exception& e )
-  {
-    Logger::error( "{0} failed, Api is not reachable: {1}", endpoint, e.what() );
-    return nullptr;
-  }
-  return r;
+  return m_apiPool.request( endpoint, reqstr, data, retrySafe );
+}
+
+Lobby::ApiClientPool& Lobby::RestConnector::getApiPool()
+{
+  return m_apiPool;
 }
 
 Lobby::LobbySessionPtr Lobby::RestConnector::getSession( char* sId )
 {
   std::string json_string = "{\"sId\": \"" + std::string( sId ) + "\",\"secret\": \"" + serverSecret + "\"}";
 
-  HttpResponse r = requestApi( "checkSession", json_string );
+  HttpResponse r = requestApi( "checkSession", json_string, true );
 
   if( r == nullptr )
     return nullptr;
@@ -87,7 +85,7 @@ bool Lobby::RestConnector::checkNameTaken( std::string name )
 {
   std::string json_string = "{\"name\": \"" + name + "\",\"secret\": \"" + serverSecret + "\"}";
 
-  HttpResponse r = requestApi( "checkNameTaken", json_string );
+  HttpResponse r = requestApi( "checkNameTaken", json_string, true );
 
   if( r == nullptr )
     return true;
@@ -121,7 +119,7 @@ uint32_t Lobby::RestConnector::getNextCharId()
 {
   std::string json_string = "{\"secret\": \"" + serverSecret + "\"}";
 
-  HttpResponse r = requestApi( "getNextCharId", json_string );
+  HttpResponse r = requestApi( "getNextCharId", json_string, false );
 
   if( r == nullptr )
     return -1;
@@ -160,7 +158,7 @@ uint64_t Lobby::RestConnector::getNextContentId()
 {
   std::string json_string = "{\"secret\": \"" + serverSecret + "\"}";
 
-  HttpResponse r = requestApi( "getNextContentId", json_string );
+  HttpResponse r = requestApi( "getNextContentId", json_string, false );
 
   if( r == nullptr )
     return -1;
@@ -199,7 +197,7 @@ CharList Lobby::RestConnector::getCharList( char* sId )
 {
   std::string json_string = "{\"sId\": \"" + std::string( sId, 56 ) + "\",\"secret\": \"" + serverSecret + "\"}";
 
-  HttpResponse r = requestApi( "getCharacterList", json_string );
+  HttpResponse r = requestApi( "getCharacterList", json_string, true );
 
   CharList list;
   if( r == nullptr )
@@ -256,7 +254,7 @@ bool Lobby::RestConnector::deleteCharacter( char* sId, std::string name )
   std::string json_string =
     "{\"sId\": \"" + std::string( sId, 56 ) + "\",\"secret\": \"" + serverSecret + "\",\"name\": \"" + name + "\"}";
 
-  HttpResponse r = requestApi( "deleteCharacter", json_string );
+  HttpResponse r = requestApi( "deleteCharacter", json_string, false );
 
   if( r == nullptr )
     return false;
@@ -291,7 +289,7 @@ int Lobby::RestConnector::createCharacter( char* sId, std::string name, std::str
     "{\"sId\": \"" + std::string( sId, 56 ) + "\",\"secret\": \"" + serverSecret + "\",\"name\": \"" + name +
     "\",\"infoJson\": \"" + Common::Util::base64Encode( ( uint8_t* ) infoJson.c_str(), infoJson.length() ) + "\"}";
 
-  HttpResponse r = requestApi( "createCharacter", json_string );
+  HttpResponse r = requestApi( "createCharacter", json_string, false );
 
   if( r == nullptr )
     return -1;
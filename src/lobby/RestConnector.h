@@ -4,12 +4,9 @@
 #include <string>
 #include <map>
 
-#include "client_http.hpp"
+#include "ApiClientPool.h"
 #include "Forwards.h"
 
-using HttpClient = SimpleWeb::Client< SimpleWeb::HTTP >;
-using HttpResponse = std::shared_ptr< SimpleWeb::ClientBase< SimpleWeb::HTTP >::Response >;
-
 namespace Sapphire
 {
   class Session;
@@ -26,7 +23,10 @@ namespace Sapphire::Lobby
 
     ~RestConnector();
 
-    HttpResponse requestApi( std::string endpoint, std::string data );
+    void init( uint32_t poolSize, uint32_t timeout, uint32_t retries, uint32_t retryBackoffMs );
+
+    /*! retrySafe: the api call only reads, see ApiClientPool::request */
+    HttpResponse requestApi( std::string endpoint, std::string data, bool retrySafe );
 
     LobbySessionPtr getSession( char* sId );
 
@@ -42,9 +42,14 @@ namespace Sapphire::Lobby
 
     uint64_t getNextContentId();
 
+    ApiClientPool& getApiPool();
+
     std::string serverSecret;
     std::string restHost;
 
+  private:
+    ApiClientPool m_apiPool;
+
   };
 }
 
@@ -8,6 +8,7 @@
 
 #include <Version.h>
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <Config/ConfigMgr.h>
 
 #include "Framework.h"
@@ -20,6 +21,8 @@
 #include <Forwards.h>
 
 #include <thread>
+#include <mutex>
+#include <condition_variable>
 
 using namespace Sapphire;
 
@@ -65,6 +68,8 @@ namespace Sapphire::Lobby
 
     Logger::setLogLevel( m_config.global.general.logLevel );
 
+    Metrics::Registry::startExporter( m_config.global.metrics.path + "/lobby.prom", m_config.global.metrics.interval );
+
     auto pFw = make_Framework();
     auto hive = Network::make_Hive();
     Network::addServerToHive< GameConnection >( m_ip, m_port, hive, pFw );
@@ -75,10 +80,36 @@ namespace Sapphire::Lobby
 
     threadGroup.emplace_back( std::bind( &Sapphire::Network::Hive::run, hive.get() ) );
 
+    // logs the api pool stats until the hive stopped
+    std::mutex statsMutex;
+    std::condition_variable statsCv;
+    bool stopStats = false;
+    std::thread statsThread;
+
+    if( m_config.api.statsInterval > 0 )
+    {
+      auto interval = m_config.api.statsInterval;
+      statsThread = std::thread( [ interval, &statsMutex, &statsCv, &stopStats ]()
+      {
+        std::unique_lock< std::mutex > lock( statsMutex );
+        while( !statsCv.wait_for( lock, std::chrono::seconds( interval ), [ &stopStats ] { return stopStats; } ) )
+          g_restConnector.getApiPool().logStats();
+      } );
+    }
+
     for( auto& thread : threadGroup )
       if( thread.joinable() )
         thread.join();
 
+    {
+      std::lock_guard< std::mutex > lock( statsMutex );
+      stopStats = true;
+    }
+    statsCv.notify_all();
+
+    if( statsThread.joinable() )
+      statsThread.join();
+
   }
 
   bool ServerLobby::loadSettings( int32_t argc, char* argv[] )
@@ -112,6 +143,12 @@ namespace Sapphire::Lobby
     m_config.network.listenIp = m_pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
     m_config.network.listenPort = m_pConfig->getValue< uint16_t >( "Network", "ListenPort", 54994 );
 
+    m_config.api.poolSize = m_pConfig->getValue< uint32_t >( "Api", "PoolSize", 4 );
+    m_config.api.timeout = m_pConfig->getValue< uint32_t >( "Api", "Timeout", 5 );
+    m_config.api.retries = m_pConfig->getValue< uint32_t >( "Api", "Retries", 2 );
+    m_config.api.retryBackoff = m_pConfig->getValue< uint32_t >( "Api", "RetryBackoff", 50 );
+    m_config.api.statsInterval = m_pConfig->getValue< uint32_t >( "Api", "StatsInterval", 0 );
+
     std::vector< std::string > args( argv + 1, argv + argc );
     for( size_t i = 0; i + 1 < args.size(); i += 2 )
     {
@@ -158,6 +195,8 @@ namespace Sapphire::Lobby
     g_restConnector.restHost = m_config.global.network.restHost + ":" +
                                std::to_string( m_config.global.network.restPort );
     g_restConnector.serverSecret = m_config.global.general.serverSecret;
+    g_restConnector.init( m_config.api.poolSize, m_config.api.timeout,
+                          m_config.api.retries, m_config.api.retryBackoff );
 
     return true;
   }
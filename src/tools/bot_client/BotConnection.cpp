@@ -0,0 +1,498 @@
+#include "BotConnection.h"
+
+#include <Logging/Logger.h>
+#include <Util/Util.h>
+#include <Network/GamePacketParser.h>
+#include <Network/PacketContainer.h>
+#include <Network/PacketDef/Zone/ClientZoneDef.h>
+#include <Network/PacketDef/Zone/ServerZoneDef.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+using namespace Sapphire;
+using namespace Sapphire::Network::Packets;
+
+namespace
+{
+  template< class T >
+  using ClientZonePacket = FFXIVIpcPacket< T, ClientZoneIpcType >;
+
+  // connection type of the zone channel in the packet header
+  constexpr uint16_t ZoneConnectionType = 1;
+
+  // segments a single packet may hold are capped by the world server
+  constexpr std::size_t MaxReplayBatch = 200;
+
+  // ipc packets without a payload definition, only the opcode matters to the server
+  FFXIVPacketBasePtr makeIpcPacket( uint16_t opcode, uint32_t actorId, uint32_t payloadSize = 0x10 )
+  {
+    auto pPacket = std::make_shared< FFXIVRawPacket >( SEGMENTTYPE_IPC, static_cast< uint32_t >(
+                                                         sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) +
+                                                         sizeof( FFXIVARR_IPC_HEADER ) + payloadSize ),
+                                                       actorId, actorId );
+    FFXIVARR_IPC_HEADER ipcHeader{};
+    ipcHeader.reserved = 0x14;
+    ipcHeader.type = opcode;
+    ipcHeader.timestamp = Common::Util::getTimeSeconds();
+    memcpy( &pPacket->data()[ 0 ], &ipcHeader, sizeof( FFXIVARR_IPC_HEADER ) );
+    return pPacket;
+  }
+
+  uint64_t getTimeUs()
+  {
+    using namespace std::chrono;
+    return static_cast< uint64_t >(
+      duration_cast< microseconds >( steady_clock::now().time_since_epoch() ).count() );
+  }
+}
+
+BotClient::BotMetrics::BotMetrics() :
+  loginTime( Metrics::Registry::histogram( "bot_login_us", "", "Time from connecting until the zone was initialized" ) ),
+  pingTime( Metrics::Registry::histogram( "bot_ping_us", "", "Round trip time of ping packets" ) ),
+  actionTime( Metrics::Registry::histogram( "bot_action_us", "", "Time from using an action until its cast or effect arrived" ) ),
+  inventoryTime( Metrics::Registry::histogram( "bot_inventory_us", "", "Round trip time of inventory operations" ) ),
+  packetsOut( Metrics::Registry::counter( "bot_packets_out_total", "", "Packet segments sent by bots" ) ),
+  packetsIn( Metrics::Registry::counter( "bot_packets_in_total", "", "Packet segments received by bots" ) ),
+  bytesOut( Metrics::Registry::counter( "bot_bytes_out_total", "", "Bytes sent by bots" ) ),
+  bytesIn( Metrics::Registry::counter( "bot_bytes_in_total", "", "Bytes received by bots" ) ),
+  chatIn( Metrics::Registry::counter( "bot_chat_in_total", "", "Chat messages of other players received by bots" ) ),
+  botsConnected( Metrics::Registry::gauge( "bot_connected", "", "Bots with an open connection" ) ),
+  botsReady( Metrics::Registry::gauge( "bot_ready", "", "Bots that finished loading into the zone" ) ),
+  botsFailed( Metrics::Registry::counter( "bot_failed_total", "", "Bots that lost their connection" ) ),
+  botsReplayed( Metrics::Registry::counter( "bot_replayed_total", "", "Bots that sent their whole capture" ) )
+{
+}
+
+BotClient::BotConnection::BotConnection( Network::HivePtr pHive, FrameworkPtr pFw, uint32_t characterId,
+                                         const BotConfig& config, BotMetrics& metrics ) :
+  Connection( pHive, pFw ),
+  m_characterId( characterId ),
+  m_config( config ),
+  m_metrics( metrics ),
+  m_state( State::Connecting ),
+  m_rng( characterId ),
+  m_home{ 0.f, 0.f, 0.f },
+  m_walkAngle( 0.f ),
+  m_connectTime( getTimeUs() ),
+  m_nextPing( 0 ),
+  m_nextActivity( 0 ),
+  m_pingSent( 0 ),
+  m_actionSent( 0 ),
+  m_inventorySent( 0 ),
+  m_inventorySequence( 0 ),
+  m_chatCount( 0 ),
+  m_zoneInitialized( false ),
+  m_pReplay( nullptr ),
+  m_replayPos( 0 ),
+  m_replayStart( 0 )
+{
+}
+
+void BotClient::BotConnection::setReplay( const std::vector< PacketCaptureRecord >* pRecords )
+{
+  m_pReplay = pRecords;
+  m_replayPos = 0;
+}
+
+BotClient::BotConnection::State BotClient::BotConnection::getState() const
+{
+  return m_state;
+}
+
+void BotClient::BotConnection::setState( State state )
+{
+  if( m_state == state )
+    return;
+
+  if( state == State::Ready )
+    m_metrics.botsReady.add( 1 );
+  else if( m_state == State::Ready )
+    m_metrics.botsReady.add( -1 );
+
+  if( state == State::WaitingSession )
+    m_metrics.botsConnected.add( 1 );
+  else if( state == State::Disconnected && m_state != State::Connecting )
+    m_metrics.botsConnected.add( -1 );
+
+  m_state = state;
+}
+
+void BotClient::BotConnection::onConnect( const std::string& host, uint16_t port )
+{
+  setState( State::WaitingSession );
+
+  // the session id is sent as a decimal string, the world server uses it as the character id
+  auto pInit = std::make_shared< FFXIVRawPacket >( SEGMENTTYPE_SESSIONINIT, 0x18 + 0x40, 0, 0 );
+  auto idStr = std::to_string( m_characterId );
+  memcpy( &pInit->data()[ 4 ], idStr.c_str(), idStr.size() );
+
+  queuePacket( pInit );
+  flushPackets();
+}
+
+void BotClient::BotConnection::onError( const asio::error_code& error )
+{
+  if( m_state == State::Disconnected )
+    return;
+
+  Logger::debug( "Bot#{0} error: {1}", m_characterId, error.message() );
+
+  m_metrics.botsFailed.inc();
+  setState( State::Disconnected );
+}
+
+void BotClient::BotConnection::onDisconnect()
+{
+  setState( State::Disconnected );
+}
+
+void BotClient::BotConnection::onRecv( std::vector< uint8_t >& buffer )
+{
+  m_metrics.bytesIn.inc( buffer.size() );
+  m_recvBuffer.insert( m_recvBuffer.end(), buffer.begin(), buffer.end() );
+
+  std::size_t offset = 0;
+  while( true )
+  {
+    FFXIVARR_PACKET_HEADER header{};
+    auto result = getHeader( m_recvBuffer, static_cast< uint32_t >( offset ), header );
+
+    if( result == Incomplete )
+      break;
+
+    if( result == Malformed || header.size < sizeof( FFXIVARR_PACKET_HEADER ) || header.isCompressed )
+    {
+      Logger::error( "Bot#{0} received a malformed packet, disconnecting", m_characterId );
+      m_metrics.botsFailed.inc();
+      disconnect();
+      return;
+    }
+
+    if( m_recvBuffer.size() - offset < header.size )
+      break;
+
+    // segments are handled in place, copying every packet out would dominate with thousands of bots
+    auto segmentOffset = offset + sizeof( FFXIVARR_PACKET_HEADER );
+    auto end = offset + header.size;
+    for( uint32_t i = 0; i < header.count; ++i )
+    {
+      FFXIVARR_PACKET_SEGMENT_HEADER segmentHeader{};
+      if( getSegmentHeader( m_recvBuffer, static_cast< uint32_t >( segmentOffset ), segmentHeader ) != Success ||
+          !checkSegmentHeader( segmentHeader ) ||
+          segmentHeader.size < sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) ||
+          segmentOffset + segmentHeader.size > end )
+      {
+        Logger::error( "Bot#{0} received a malformed segment, disconnecting", m_characterId );
+        m_metrics.botsFailed.inc();
+        disconnect();
+        return;
+      }
+
+      handleSegment( segmentHeader.type, &m_recvBuffer[ segmentOffset + sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) ],
+                     static_cast< uint32_t >( segmentHeader.size - sizeof( FFXIVARR_PACKET_SEGMENT_HEADER ) ) );
+
+      segmentOffset += segmentHeader.size;
+    }
+
+    m_metrics.packetsIn.inc( header.count );
+    offset = end;
+  }
+
+  m_recvBuffer.erase( m_recvBuffer.begin(), m_recvBuffer.begin() + offset );
+}
+
+void BotClient::BotConnection::handleSegment( uint16_t segmentType, const uint8_t* pData, uint32_t size )
+{
+  switch( segmentType )
+  {
+    case SEGMENTTYPE_IPC:
+    {
+      if( size < sizeof( FFXIVARR_IPC_HEADER ) )
+        return;
+
+      FFXIVARR_IPC_HEADER ipcHeader{};
+      memcpy( &ipcHeader, pData, sizeof( FFXIVARR_IPC_HEADER ) );
+
+      handleZoneIpc( ipcHeader.type, pData + sizeof( FFXIVARR_IPC_HEADER ),
+                     static_cast< uint32_t >( size - sizeof( FFXIVARR_IPC_HEADER ) ) );
+      break;
+    }
+
+    // the world server confirms the session with this segment, the client initializes the zone next
+    case 0x02:
+    {
+      if( m_state != State::WaitingSession )
+        return;
+
+      // a capture starts with the init sent by the real client
+      if( m_pReplay )
+      {
+        setState( State::Replaying );
+        m_replayStart = Common::Util::getTimeMs();
+        break;
+      }
+
+      setState( State::WaitingZone );
+      queuePacket( makeIpcPacket( InitHandler, m_characterId ) );
+      flushPackets();
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void BotClient::BotConnection::handleZoneIpc( uint16_t opcode, const uint8_t* pData, uint32_t size )
+{
+  auto now = getTimeUs();
+
+  switch( opcode )
+  {
+    case InitZone:
+    {
+      Server::FFXIVIpcInitZone initZone{};
+      memcpy( &initZone, pData, std::min< std::size_t >( size, sizeof( initZone ) ) );
+      m_home = initZone.pos;
+
+      if( !m_zoneInitialized )
+      {
+        m_metrics.loginTime.record( now - m_connectTime );
+        m_zoneInitialized = true;
+      }
+
+      if( m_state != State::WaitingZone )
+        return;
+
+      queuePacket( makeIpcPacket( FinishLoadingHandler, m_characterId ) );
+      flushPackets();
+
+      setState( State::Ready );
+      break;
+    }
+
+    case Ping:
+    {
+      if( m_pingSent == 0 )
+        return;
+
+      m_metrics.pingTime.record( now - m_pingSent );
+      m_pingSent = 0;
+      break;
+    }
+
+    case ActorCast:
+    case Effect:
+    {
+      if( m_actionSent == 0 )
+        return;
+
+      m_metrics.actionTime.record( now - m_actionSent );
+      m_actionSent = 0;
+      break;
+    }
+
+    case InventoryActionAck:
+    {
+      if( m_inventorySent == 0 )
+        return;
+
+      m_metrics.inventoryTime.record( now - m_inventorySent );
+      m_inventorySent = 0;
+      break;
+    }
+
+    case Chat:
+    {
+      m_metrics.chatIn.inc();
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+void BotClient::BotConnection::queuePacket( FFXIVPacketBasePtr pPacket )
+{
+  m_outPackets.push_back( std::move( pPacket ) );
+}
+
+void BotClient::BotConnection::flushPackets()
+{
+  if( m_outPackets.empty() || m_state == State::Disconnected )
+    return;
+
+  // everything queued during one update goes out as a single packet
+  PacketContainer container;
+  container.m_ipcHdr.connectionType = ZoneConnectionType;
+  for( auto& pPacket : m_outPackets )
+    container.addPacket( pPacket );
+
+  container.fillSendBuffer( m_sendBuffer );
+  send( m_sendBuffer );
+
+  m_metrics.packetsOut.inc( m_outPackets.size() );
+  m_metrics.bytesOut.inc( m_sendBuffer.size() );
+  m_outPackets.clear();
+}
+
+void BotClient::BotConnection::update( uint64_t tickCount )
+{
+  if( m_state == State::Replaying )
+  {
+    replay( tickCount );
+    flushPackets();
+    return;
+  }
+
+  if( m_state != State::Ready )
+    return;
+
+  if( tickCount >= m_nextPing )
+  {
+    sendPing( tickCount );
+    m_nextPing = tickCount + m_config.pingIntervalMs;
+  }
+
+  // bots done with their capture only keep the session alive
+  if( m_pReplay )
+  {
+    flushPackets();
+    return;
+  }
+
+  if( tickCount >= m_nextActivity )
+  {
+    auto totalWeight = m_config.walkWeight + m_config.chatWeight + m_config.actionWeight + m_config.inventoryWeight;
+    auto roll = totalWeight > 0 ? std::uniform_int_distribution< uint32_t >( 0, totalWeight - 1 )( m_rng ) : 0;
+
+    if( totalWeight == 0 )
+    {
+      // idle bots only ping
+    }
+    else if( roll < m_config.walkWeight )
+      walk();
+    else if( roll < m_config.walkWeight + m_config.chatWeight )
+      chat();
+    else if( roll < m_config.walkWeight + m_config.chatWeight + m_config.actionWeight )
+      useAction( tickCount );
+    else
+      moveInventoryItem();
+
+    // spread the bots out over the think time so they do not all act in the same tick
+    auto jitter = std::uniform_int_distribution< uint32_t >( 0, m_config.thinkTimeMs / 2 )( m_rng );
+    m_nextActivity = tickCount + m_config.thinkTimeMs / 2 + jitter * 2;
+  }
+
+  flushPackets();
+}
+
+void BotClient::BotConnection::replay( uint64_t tickCount )
+{
+  auto elapsed = tickCount - m_replayStart;
+
+  std::size_t batch = 0;
+  while( m_replayPos < m_pReplay->size() && batch < MaxReplayBatch )
+  {
+    auto& record = ( *m_pReplay )[ m_replayPos ];
+    if( m_config.replaySpeed > 0.f && record.offsetMs / m_config.replaySpeed > elapsed )
+      break;
+
+    auto pPacket = std::make_shared< FFXIVRawPacket >( reinterpret_cast< char* >(
+                                                         const_cast< uint8_t* >( record.segment.data() ) ),
+                                                       static_cast< uint16_t >( record.segment.size() ) );
+    // the capture may belong to another character when ids are remapped
+    pPacket->setSourceActor( m_characterId );
+    pPacket->setTargetActor( m_characterId );
+
+    // answers to captured requests are timed the same way as scripted ones
+    switch( pPacket->getIpcOpcode() )
+    {
+      case PingHandler:
+        m_pingSent = getTimeUs();
+        break;
+      case SkillHandler:
+        m_actionSent = getTimeUs();
+        break;
+      case InventoryModifyHandler:
+        m_inventorySent = getTimeUs();
+        break;
+      default:
+        break;
+    }
+
+    queuePacket( pPacket );
+    m_replayPos++;
+    batch++;
+  }
+
+  if( m_replayPos == m_pReplay->size() )
+  {
+    m_metrics.botsReplayed.inc();
+    m_nextPing = tickCount + m_config.pingIntervalMs;
+    setState( State::Ready );
+  }
+}
+
+void BotClient::BotConnection::sendPing( uint64_t tickCount )
+{
+  auto pPing = std::make_shared< ClientZonePacket< Client::FFXIVIpcPingHandler > >( m_characterId );
+  pPing->data().timestamp = static_cast< uint32_t >( tickCount );
+  queuePacket( pPing );
+
+  m_pingSent = getTimeUs();
+}
+
+void BotClient::BotConnection::walk()
+{
+  // bots walk in circles around the position they logged in at
+  m_walkAngle += 0.2f;
+
+  auto pPosition = std::make_shared< ClientZonePacket< Client::FFXIVIpcUpdatePosition > >( m_characterId );
+  pPosition->data().rotation = m_walkAngle;
+  pPosition->data().position.x = m_home.x + std::cos( m_walkAngle ) * m_config.walkRadius;
+  pPosition->data().position.y = m_home.y;
+  pPosition->data().position.z = m_home.z + std::sin( m_walkAngle ) * m_config.walkRadius;
+  queuePacket( pPosition );
+}
+
+void BotClient::BotConnection::chat()
+{
+  auto pChat = std::make_shared< ClientZonePacket< Client::FFXIVIpcChatHandler > >( m_characterId );
+  pChat->data().sourceId = m_characterId;
+  pChat->data().chatType = Common::ChatType::Say;
+
+  auto message = "bot " + std::to_string( m_characterId ) + " message " + std::to_string( m_chatCount++ );
+  strncpy( pChat->data().message, message.c_str(), sizeof( pChat->data().message ) - 1 );
+  queuePacket( pChat );
+}
+
+void BotClient::BotConnection::useAction( uint64_t tickCount )
+{
+  auto pAction = std::make_shared< ClientZonePacket< Client::FFXIVIpcSkillHandler > >( m_characterId );
+  pAction->data().type = 1;
+  pAction->data().actionId = m_config.actionId;
+  pAction->data().sequence = static_cast< uint16_t >( tickCount );
+  pAction->data().targetId = m_characterId;
+  queuePacket( pAction );
+
+  m_actionSent = getTimeUs();
+}
+
+void BotClient::BotConnection::moveInventoryItem()
+{
+  // swapping the first two slots of the first bag back and forth keeps the inventory unchanged over time
+  auto pModify = std::make_shared< ClientZonePacket< Client::FFXIVIpcInventoryModifyHandler > >( m_characterId );
+  pModify->data().seq = ++m_inventorySequence;
+  pModify->data().action = Common::InventoryOperation::Swap;
+  pModify->data().fromContainer = Common::Bag0;
+  pModify->data().fromSlot = 0;
+  pModify->data().toContainer = Common::Bag0;
+  pModify->data().toSlot = 1;
+  queuePacket( pModify );
+
+  m_inventorySent = getTimeUs();
+}
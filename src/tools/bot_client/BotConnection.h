@@ -0,0 +1,176 @@
+#ifndef SAPPHIRE_BOTCONNECTION_H
+#define SAPPHIRE_BOTCONNECTION_H
+
+#include <Common.h>
+#include <Network/Connection.h>
+#include <Network/GamePacket.h>
+#include <Network/PacketCapture.h>
+#include <Metrics/Metrics.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Sapphire::BotClient
+{
+
+  struct BotConfig
+  {
+    std::string host = "127.0.0.1";
+    uint16_t port = 54992;
+    // bots log in with consecutive character ids starting at firstCharacterId, the characters have to exist
+    uint32_t firstCharacterId = 1;
+    uint32_t botCount = 100;
+    uint32_t threadCount = 4;
+    uint32_t durationSec = 60;
+    // bots connected per second, thousands of simultaneous logins would only measure the database
+    uint32_t rampPerSec = 50;
+    uint32_t tickMs = 50;
+    uint32_t pingIntervalMs = 5000;
+    // time between two activities of a bot
+    uint32_t thinkTimeMs = 1000;
+    float walkRadius = 10.f;
+    uint32_t actionId = 9;
+
+    // relative weights of the activities a bot picks from
+    uint32_t walkWeight = 6;
+    uint32_t chatWeight = 1;
+    uint32_t actionWeight = 2;
+    uint32_t inventoryWeight = 1;
+
+    // folder of packet captures to replay instead of running the script, one bot per capture
+    std::string replayPath;
+    // 1 replays in real time, 0 sends every packet as fast as possible
+    float replaySpeed = 1.f;
+    // log in with consecutive ids starting at firstCharacterId instead of the captured session ids
+    bool remapIds = false;
+  };
+
+  /*!
+   * @brief Metrics shared by every bot, looked up once so bots never touch the registry lock
+   */
+  struct BotMetrics
+  {
+    BotMetrics();
+
+    Metrics::Histogram& loginTime;
+    Metrics::Histogram& pingTime;
+    Metrics::Histogram& actionTime;
+    Metrics::Histogram& inventoryTime;
+
+    Metrics::Counter& packetsOut;
+    Metrics::Counter& packetsIn;
+    Metrics::Counter& bytesOut;
+    Metrics::Counter& bytesIn;
+    Metrics::Counter& chatIn;
+
+    Metrics::Gauge& botsConnected;
+    Metrics::Gauge& botsReady;
+    Metrics::Counter& botsFailed;
+    Metrics::Counter& botsReplayed;
+  };
+
+  /*!
+   * @brief A scripted client speaking the zone protocol
+   *
+   * Logs in with a session id, finishes loading and then walks, chats, uses actions and moves
+   * inventory items at random. With a replay set, the bot sends the packets of a capture instead and
+   * only keeps its session alive afterwards. Everything but the socket io is driven from update(), which
+   * has to be called from the thread polling the hive of the connection.
+   */
+  class BotConnection : public Network::Connection
+  {
+  public:
+    enum class State
+    {
+      Connecting,
+      WaitingSession,
+      WaitingZone,
+      Replaying,
+      Ready,
+      Disconnected
+    };
+
+    BotConnection( Network::HivePtr pHive, FrameworkPtr pFw, uint32_t characterId,
+                   const BotConfig& config, BotMetrics& metrics );
+
+    ~BotConnection() override = default;
+
+    /*!
+     * @brief Replays the given records after logging in, they have to outlive the bot
+     */
+    void setReplay( const std::vector< Network::Packets::PacketCaptureRecord >* pRecords );
+
+    void update( uint64_t tickCount );
+
+    State getState() const;
+
+  private:
+    void onConnect( const std::string& host, uint16_t port ) override;
+
+    void onRecv( std::vector< uint8_t >& buffer ) override;
+
+    void onError( const asio::error_code& error ) override;
+
+    void onDisconnect() override;
+
+    void handleSegment( uint16_t segmentType, const uint8_t* pData, uint32_t size );
+
+    void handleZoneIpc( uint16_t opcode, const uint8_t* pData, uint32_t size );
+
+    void queuePacket( Network::Packets::FFXIVPacketBasePtr pPacket );
+
+    void flushPackets();
+
+    void replay( uint64_t tickCount );
+
+    void sendPing( uint64_t tickCount );
+
+    void walk();
+
+    void chat();
+
+    void useAction( uint64_t tickCount );
+
+    void moveInventoryItem();
+
+    void setState( State state );
+
+    uint32_t m_characterId;
+    const BotConfig& m_config;
+    BotMetrics& m_metrics;
+    State m_state;
+
+    std::mt19937 m_rng;
+
+    std::vector< uint8_t > m_recvBuffer;
+    std::vector< Network::Packets::FFXIVPacketBasePtr > m_outPackets;
+    std::vector< uint8_t > m_sendBuffer;
+
+    Common::FFXIVARR_POSITION3 m_home;
+    float m_walkAngle;
+
+    uint64_t m_connectTime;
+    uint64_t m_nextPing;
+    uint64_t m_nextActivity;
+
+    // send time of the request currently waiting for an answer, 0 if none is pending
+    uint64_t m_pingSent;
+    uint64_t m_actionSent;
+    uint64_t m_inventorySent;
+
+    uint32_t m_inventorySequence;
+    uint32_t m_chatCount;
+
+    bool m_zoneInitialized;
+
+    const std::vector< Network::Packets::PacketCaptureRecord >* m_pReplay;
+    std::size_t m_replayPos;
+    uint64_t m_replayStart;
+  };
+
+  using BotConnectionPtr = std::shared_ptr< BotConnection >;
+
+}
+
+#endif // SAPPHIRE_BOTCONNECTION_H
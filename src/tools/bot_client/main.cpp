@@ -0,0 +1,301 @@
+#include <algorithm>
+#include <chrono>
+#include <experimental/filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Common.h>
+#include <Framework.h>
+#include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
+#include <Network/Hive.h>
+#include <Util/Util.h>
+
+#include "BotConnection.h"
+
+using namespace Sapphire;
+using namespace Sapphire::BotClient;
+
+namespace fs = std::experimental::filesystem;
+
+struct BotSpec
+{
+  uint32_t characterId;
+  // capture replayed by the bot, nullptr runs the script
+  const std::vector< Network::Packets::PacketCaptureRecord >* pReplay;
+};
+
+struct ClientThread
+{
+  Network::HivePtr pHive;
+  // indices into the bot list, a bot is only ever touched by the thread owning it
+  std::vector< uint32_t > botIndices;
+  std::vector< BotConnectionPtr > bots;
+};
+
+bool loadCaptures( const BotConfig& cfg, std::vector< std::vector< Network::Packets::PacketCaptureRecord > >& captures,
+                   std::vector< BotSpec >& specs )
+{
+  if( !fs::is_directory( cfg.replayPath ) )
+  {
+    Logger::error( "Replay folder {0} does not exist", cfg.replayPath );
+    return false;
+  }
+
+  std::vector< fs::path > files;
+  for( auto& entry : fs::directory_iterator( cfg.replayPath ) )
+  {
+    if( entry.path().extension() == ".scap" )
+      files.push_back( entry.path() );
+  }
+  std::sort( files.begin(), files.end() );
+
+  // the vector is sized up front, bots keep pointers into it
+  captures.resize( files.size() );
+
+  for( std::size_t i = 0; i < files.size(); ++i )
+  {
+    Network::Packets::PacketCaptureHeader header{};
+    if( !Network::Packets::loadPacketCapture( files[ i ].string(), header, captures[ i ] ) )
+    {
+      Logger::error( "Unable to read capture {0}", files[ i ].string() );
+      return false;
+    }
+
+    auto characterId = cfg.remapIds ? cfg.firstCharacterId + static_cast< uint32_t >( specs.size() ) : header.sessionId;
+    specs.push_back( { characterId, &captures[ i ] } );
+
+    Logger::info( "Loaded {0} packets of session#{1} from {2}", captures[ i ].size(), header.sessionId,
+                  files[ i ].filename().string() );
+  }
+
+  if( specs.empty() )
+  {
+    Logger::error( "No captures found in {0}", cfg.replayPath );
+    return false;
+  }
+
+  return true;
+}
+
+bool parseArgs( const std::vector< std::string >& args, BotConfig& cfg, std::string& metricsPath )
+{
+  if( args.size() % 2 != 0 )
+  {
+    Logger::error( "Missing value for {0}", args.back() );
+    return false;
+  }
+
+  for( std::size_t i = 0; i < args.size(); i += 2 )
+  {
+    auto& arg = args[ i ];
+    auto& value = args[ i + 1 ];
+
+    if( arg == "--host" )
+      cfg.host = value;
+    else if( arg == "--port" )
+      cfg.port = static_cast< uint16_t >( std::stoul( value ) );
+    else if( arg == "--first-id" )
+      cfg.firstCharacterId = std::stoul( value );
+    else if( arg == "--bots" )
+      cfg.botCount = std::stoul( value );
+    else if( arg == "--threads" )
+      cfg.threadCount = std::stoul( value );
+    else if( arg == "--duration" )
+      cfg.durationSec = std::stoul( value );
+    else if( arg == "--ramp" )
+      cfg.rampPerSec = std::stoul( value );
+    else if( arg == "--tick" )
+      cfg.tickMs = std::stoul( value );
+    else if( arg == "--ping" )
+      cfg.pingIntervalMs = std::stoul( value );
+    else if( arg == "--think" )
+      cfg.thinkTimeMs = std::stoul( value );
+    else if( arg == "--radius" )
+      cfg.walkRadius = std::stof( value );
+    else if( arg == "--action" )
+      cfg.actionId = std::stoul( value );
+    else if( arg == "--walk" )
+      cfg.walkWeight = std::stoul( value );
+    else if( arg == "--chat" )
+      cfg.chatWeight = std::stoul( value );
+    else if( arg == "--use-action" )
+      cfg.actionWeight = std::stoul( value );
+    else if( arg == "--inventory" )
+      cfg.inventoryWeight = std::stoul( value );
+    else if( arg == "--replay" )
+      cfg.replayPath = value;
+    else if( arg == "--speed" )
+      cfg.replaySpeed = std::stof( value );
+    else if( arg == "--remap" )
+      cfg.remapIds = value == "1";
+    else if( arg == "--metrics" )
+      metricsPath = value;
+    else
+    {
+      Logger::error( "Unknown argument {0}", arg );
+      return false;
+    }
+  }
+
+  if( cfg.botCount == 0 || cfg.threadCount == 0 || cfg.rampPerSec == 0 || cfg.tickMs == 0 )
+  {
+    Logger::error( "--bots, --threads, --ramp and --tick have to be greater than 0" );
+    return false;
+  }
+
+  return true;
+}
+
+void runClientThread( ClientThread& thread, const BotConfig& cfg, const std::vector< BotSpec >& specs,
+                      BotMetrics& metrics, FrameworkPtr pFw,
+                      std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end )
+{
+  std::size_t nextBot = 0;
+
+  while( std::chrono::steady_clock::now() < end )
+  {
+    auto tickStart = std::chrono::steady_clock::now();
+    auto elapsedMs = std::chrono::duration_cast< std::chrono::milliseconds >( tickStart - start ).count();
+
+    // bots are started in the order of their index, which spreads the ramp evenly over all threads
+    while( nextBot < thread.botIndices.size() &&
+           static_cast< uint64_t >( thread.botIndices[ nextBot ] ) * 1000 <
+             static_cast< uint64_t >( elapsedMs ) * cfg.rampPerSec )
+    {
+      auto& spec = specs[ thread.botIndices[ nextBot ] ];
+      auto characterId = spec.characterId;
+      auto pBot = std::make_shared< BotConnection >( thread.pHive, pFw, characterId, cfg, metrics );
+      if( spec.pReplay )
+        pBot->setReplay( spec.pReplay );
+      try
+      {
+        pBot->connect( cfg.host, cfg.port );
+      }
+      catch( std::exception& e )
+      {
+        Logger::error( "Bot#{0} could not connect: {1}", characterId, e.what() );
+        metrics.botsFailed.inc();
+      }
+      thread.bots.push_back( pBot );
+      nextBot++;
+    }
+
+    thread.pHive->poll();
+
+    auto tickCount = Common::Util::getTimeMs();
+    for( auto& pBot : thread.bots )
+      pBot->update( tickCount );
+
+    thread.pHive->poll();
+
+    auto tickTime = std::chrono::steady_clock::now() - tickStart;
+    auto tickDuration = std::chrono::milliseconds( cfg.tickMs );
+    if( tickTime < tickDuration )
+      std::this_thread::sleep_for( tickDuration - tickTime );
+  }
+
+  for( auto& pBot : thread.bots )
+  {
+    if( pBot->getState() != BotConnection::State::Disconnected )
+      pBot->disconnect();
+  }
+
+  thread.pHive->poll();
+}
+
+void printHistogram( const std::string& name, const Metrics::Histogram& histogram )
+{
+  Logger::info( "{0}: {1} samples, p50 {2:.2f}ms, p90 {3:.2f}ms, p99 {4:.2f}ms", name, histogram.getCount(),
+                histogram.getPercentile( 0.5 ) / 1000.0, histogram.getPercentile( 0.9 ) / 1000.0,
+                histogram.getPercentile( 0.99 ) / 1000.0 );
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/bot_client" );
+
+  std::vector< std::string > argVec( argv + 1, argv + argc );
+
+  BotConfig cfg;
+  std::string metricsPath;
+  if( !parseArgs( argVec, cfg, metricsPath ) )
+  {
+    Logger::info( "Usage: bot_client [--host ip] [--port n] [--first-id characterId] [--bots n] [--threads n] "
+                  "[--duration sec] [--ramp bots/sec] [--tick ms] [--ping ms] [--think ms] [--radius yalms] "
+                  "[--action actionId] [--walk weight] [--chat weight] [--use-action weight] [--inventory weight] "
+                  "[--replay captureFolder] [--speed factor] [--remap 0|1] [--metrics file.prom]" );
+    return 1;
+  }
+
+  Logger::setLogLevel( 2 );
+
+  if( !metricsPath.empty() )
+    Metrics::Registry::startExporter( metricsPath, 1 );
+
+  auto pFw = std::make_shared< Framework >();
+  BotMetrics metrics;
+
+  std::vector< std::vector< Network::Packets::PacketCaptureRecord > > captures;
+  std::vector< BotSpec > specs;
+  if( !cfg.replayPath.empty() )
+  {
+    if( !loadCaptures( cfg, captures, specs ) )
+      return 1;
+  }
+  else
+  {
+    for( uint32_t i = 0; i < cfg.botCount; ++i )
+      specs.push_back( { cfg.firstCharacterId + i, nullptr } );
+  }
+
+  std::vector< ClientThread > threads( std::min< std::size_t >( cfg.threadCount, specs.size() ) );
+  for( auto& thread : threads )
+    thread.pHive = std::make_shared< Network::Hive >();
+
+  for( uint32_t i = 0; i < specs.size(); ++i )
+    threads[ i % threads.size() ].botIndices.push_back( i );
+
+  Logger::info( "Starting {0} {1} on {2} threads against {3}:{4}", specs.size(),
+                cfg.replayPath.empty() ? "scripted bots" : "replays", threads.size(), cfg.host, cfg.port );
+
+  auto start = std::chrono::steady_clock::now();
+  auto end = start + std::chrono::seconds( cfg.durationSec );
+
+  std::vector< std::thread > workers;
+  for( auto& thread : threads )
+    workers.emplace_back( runClientThread, std::ref( thread ), std::cref( cfg ), std::cref( specs ), std::ref( metrics ),
+                         pFw, start, end );
+
+  // progress report, the totals of the run are printed once all threads are done
+  while( std::chrono::steady_clock::now() < end )
+  {
+    std::this_thread::sleep_for( std::chrono::seconds( 5 ) );
+    Logger::info( "{0} bots connected, {1} ready, {2} failed", metrics.botsConnected.get(),
+                  metrics.botsReady.get(), metrics.botsFailed.get() );
+  }
+
+  for( auto& worker : workers )
+    worker.join();
+
+  auto elapsedSec = std::chrono::duration_cast< std::chrono::milliseconds >(
+    std::chrono::steady_clock::now() - start ).count() / 1000.0;
+
+  Logger::info( "Ran for {0:.1f}s, {1} bots failed, {2} replays finished", elapsedSec, metrics.botsFailed.get(),
+                metrics.botsReplayed.get() );
+  Logger::info( "out: {0:.0f} packets/s, {1:.1f} KiB/s", metrics.packetsOut.get() / elapsedSec,
+                metrics.bytesOut.get() / elapsedSec / 1024.0 );
+  Logger::info( "in: {0:.0f} packets/s, {1:.1f} KiB/s, {2} chat messages", metrics.packetsIn.get() / elapsedSec,
+                metrics.bytesIn.get() / elapsedSec / 1024.0, metrics.chatIn.get() );
+
+  printHistogram( "login", metrics.loginTime );
+  printHistogram( "ping", metrics.pingTime );
+  printHistogram( "action", metrics.actionTime );
+  printHistogram( "inventory", metrics.inventoryTime );
+
+  if( !metricsPath.empty() )
+    Metrics::Registry::stopExporter();
+
+  return 0;
+}
@@ -0,0 +1,401 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <Common.h>
+#include <Framework.h>
+#include <Logging/Logger.h>
+#include <Config/ConfigMgr.h>
+#include <Database/DatabaseDef.h>
+#include <Exd/ExdDataGenerated.h>
+#include <Metrics/Metrics.h>
+#include <Util/Util.h>
+
+#include "ServerMgr.h"
+#include "Actor/Player.h"
+#include "Actor/BNpc.h"
+#include "Actor/BNpcTemplate.h"
+#include "Territory/Zone.h"
+#include "Inventory/Item.h"
+#include "Script/ScriptMgr.h"
+#include "Manager/ActionMgr.h"
+#include "Manager/CombatDataMgr.h"
+#include "Manager/ItemMgr.h"
+#include "Manager/RNGMgr.h"
+#include "Manager/TerritoryMgr.h"
+#include "Math/CalcStats.h"
+
+using namespace Sapphire;
+using namespace Sapphire::World;
+
+// every allocation made by the process, used to report allocations per action
+static std::atomic< uint64_t > g_allocations{ 0 };
+
+void* operator new( std::size_t size )
+{
+  g_allocations.fetch_add( 1, std::memory_order_relaxed );
+
+  if( auto ptr = std::malloc( size == 0 ? 1 : size ) )
+    return ptr;
+
+  throw std::bad_alloc();
+}
+
+void operator delete( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+struct SimConfig
+{
+  uint32_t players = 100;
+  uint32_t bNpcs = 100;
+  uint32_t durationSec = 30;
+  uint32_t tickMs = 0;
+  uint32_t gcdMs = 2500;
+  uint16_t territoryTypeId = 134;
+  uint8_t classJob = static_cast< uint8_t >( Common::ClassJob::Gladiator );
+  uint8_t level = 70;
+  uint32_t weaponId = 1601;
+  uint32_t bNpcHp = 10000000;
+  std::vector< uint32_t > rotation{ 9, 15, 21 };
+  bool loadScripts = false;
+  uint32_t autoAttacks = 0;
+};
+
+struct SimPlayer
+{
+  Entity::PlayerPtr pPlayer;
+  uint64_t targetId;
+  uint32_t rotationStep;
+  uint64_t nextActionTime;
+};
+
+std::vector< uint32_t > parseIdList( const std::string& value )
+{
+  std::vector< uint32_t > ids;
+  std::stringstream ss( value );
+  std::string id;
+
+  while( std::getline( ss, id, ',' ) )
+  {
+    if( !id.empty() )
+      ids.push_back( static_cast< uint32_t >( std::stoul( id ) ) );
+  }
+
+  return ids;
+}
+
+/*!
+ * @brief CalcStats::calculateAutoAttackDamage as it was before the derived stat cache, every formula per hit
+ */
+float uncachedAutoAttackDamage( const Entity::Chara& chara )
+{
+  auto pot = Math::CalcStats::autoAttackPotency( chara );
+  auto aa = Math::CalcStats::autoAttack( chara );
+  auto ap = Math::CalcStats::getPrimaryAttackPower( chara );
+  auto det = Math::CalcStats::determination( chara );
+  auto ten = Math::CalcStats::tenacity( chara );
+
+  Logger::debug( "auto attack: pot: {} aa: {} ap: {} det: {} ten: {}", pot, aa, ap, det, ten );
+
+  auto factor = std::floor( pot * aa * ap * det * ten );
+
+  return std::floor( factor * Math::CalcStats::speed( chara ) );
+}
+
+bool parseArgs( const std::vector< std::string >& args, SimConfig& cfg )
+{
+  for( std::size_t i = 0; i + 1 < args.size(); i += 2 )
+  {
+    auto& arg = args[ i ];
+    auto& value = args[ i + 1 ];
+
+    if( arg == "--players" )
+      cfg.players = std::stoul( value );
+    else if( arg == "--bnpcs" )
+      cfg.bNpcs = std::stoul( value );
+    else if( arg == "--duration" )
+      cfg.durationSec = std::stoul( value );
+    else if( arg == "--tick" )
+      cfg.tickMs = std::stoul( value );
+    else if( arg == "--gcd" )
+      cfg.gcdMs = std::stoul( value );
+    else if( arg == "--territory" )
+      cfg.territoryTypeId = static_cast< uint16_t >( std::stoul( value ) );
+    else if( arg == "--class" )
+      cfg.classJob = static_cast< uint8_t >( std::stoul( value ) );
+    else if( arg == "--level" )
+      cfg.level = static_cast< uint8_t >( std::stoul( value ) );
+    else if( arg == "--weapon" )
+      cfg.weaponId = std::stoul( value );
+    else if( arg == "--bnpc-hp" )
+      cfg.bNpcHp = std::stoul( value );
+    else if( arg == "--rotation" )
+      cfg.rotation = parseIdList( value );
+    else if( arg == "--scripts" )
+      cfg.loadScripts = value == "1";
+    else if( arg == "--auto-attacks" )
+      cfg.autoAttacks = std::stoul( value );
+    else
+    {
+      Logger::error( "Unknown argument {0}", arg );
+      return false;
+    }
+  }
+
+  if( args.size() % 2 != 0 )
+  {
+    Logger::error( "Missing value for {0}", args.back() );
+    return false;
+  }
+
+  if( cfg.players == 0 || cfg.bNpcs == 0 || cfg.rotation.empty() )
+  {
+    Logger::error( "At least one player, one bnpc and one rotation action are required" );
+    return false;
+  }
+
+  return true;
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/combat_sim" );
+
+  std::vector< std::string > argVec( argv + 1, argv + argc );
+
+  SimConfig cfg;
+  if( !parseArgs( argVec, cfg ) )
+  {
+    Logger::info( "Usage: combat_sim [--players n] [--bnpcs n] [--duration sec] [--tick ms] [--gcd ms] "
+                  "[--territory id] [--class id] [--level n] [--weapon itemId] [--bnpc-hp n] "
+                  "[--rotation id,id,...] [--scripts 0|1] [--auto-attacks n]" );
+    return 1;
+  }
+
+  auto pFw = make_Framework();
+
+  // settings are shared with the world server, only the data path and script path are of interest here
+  pFw->set< Common::ConfigMgr >( std::make_shared< Common::ConfigMgr >() );
+  auto pServerMgr = std::make_shared< ServerMgr >( "world.ini", pFw );
+  pFw->set< ServerMgr >( pServerMgr );
+  if( !pServerMgr->loadSettings( 0, nullptr ) )
+    return 1;
+
+  // warnings only, the simulation would otherwise flood the log with debug output
+  Logger::setLogLevel( 3 );
+
+  auto pExdData = std::make_shared< Data::ExdDataGenerated >();
+  if( !pExdData->init( pServerMgr->getConfig().global.general.dataPath ) )
+  {
+    Logger::fatal( "Error setting up generated EXD data. Make sure that DataPath is set correctly in global.ini" );
+    return 1;
+  }
+  pFw->set< Data::ExdDataGenerated >( pExdData );
+
+  auto pCombatDataMgr = std::make_shared< Manager::CombatDataMgr >( pFw );
+  if( !pCombatDataMgr->init() )
+  {
+    Logger::fatal( "Unable to build combat data!" );
+    return 1;
+  }
+  pFw->set< Manager::CombatDataMgr >( pCombatDataMgr );
+
+  // the pool is never opened and runs offline, anything the simulation would persist is dropped
+  pFw->set< Db::DbWorkerPool< Db::ZoneDbConnection > >( std::make_shared< Db::DbWorkerPool< Db::ZoneDbConnection > >() );
+
+  pFw->set< Manager::ItemMgr >( std::make_shared< Manager::ItemMgr >( pFw ) );
+  pFw->set< Manager::RNGMgr >( std::make_shared< Manager::RNGMgr >( pFw ) );
+  pFw->set< Manager::TerritoryMgr >( std::make_shared< Manager::TerritoryMgr >( pFw ) );
+
+  auto pScriptMgr = std::make_shared< Scripting::ScriptMgr >( pFw );
+  pFw->set< Scripting::ScriptMgr >( pScriptMgr );
+  if( cfg.loadScripts && !pScriptMgr->init() )
+    return 1;
+
+  auto pActionMgr = std::make_shared< Manager::ActionMgr >( pFw );
+  pFw->set< Manager::ActionMgr >( pActionMgr );
+
+  auto pTeri = pExdData->get< Data::TerritoryType >( cfg.territoryTypeId );
+  if( !pTeri )
+  {
+    Logger::fatal( "TerritoryType#{0} does not exist", cfg.territoryTypeId );
+    return 1;
+  }
+
+  if( !pFw->get< Manager::ItemMgr >()->getItemInfo( cfg.weaponId ) )
+  {
+    Logger::fatal( "Item#{0} does not exist, pass a weapon for the class with --weapon", cfg.weaponId );
+    return 1;
+  }
+
+  std::unordered_map< uint32_t, const Manager::CombatActionData* > actionData;
+  for( auto actionId : cfg.rotation )
+  {
+    auto pAction = pCombatDataMgr->getAction( actionId );
+    if( !pAction )
+    {
+      Logger::fatal( "Action#{0} does not exist", actionId );
+      return 1;
+    }
+    actionData[ actionId ] = pAction;
+  }
+
+  // any valid base works, the simulated bnpcs never move
+  auto& bNpcBaseIds = pExdData->getBNpcBaseIdList();
+  auto bNpcBaseId = *bNpcBaseIds.upper_bound( 0 );
+
+  auto pZone = make_Zone( cfg.territoryTypeId, 1, pTeri->name, "combat_sim", pFw );
+
+  auto pTemplate = Entity::make_BNpcTemplate( 1, bNpcBaseId, 1, 0, 0, 0, 0, 0, 0, 0 );
+
+  std::vector< Entity::BNpcPtr > bNpcs;
+  for( uint32_t i = 0; i < cfg.bNpcs; ++i )
+  {
+    // groups are spread out so in range sets stay realistic instead of everyone seeing everyone
+    auto x = static_cast< float >( i % 32 ) * 8.f;
+    auto z = static_cast< float >( i / 32 ) * 8.f;
+
+    auto pBNpc = Entity::make_BNpc( pZone->getNextActorId(), pTemplate, x, 0.f, z, 0.f,
+                                    cfg.level, cfg.bNpcHp, pZone, pFw );
+    pZone->pushActor( pBNpc );
+    bNpcs.push_back( pBNpc );
+  }
+
+  std::vector< SimPlayer > players;
+  for( uint32_t i = 0; i < cfg.players; ++i )
+  {
+    auto pTarget = bNpcs[ i % bNpcs.size() ];
+
+    auto pPlayer = Entity::make_Player( pFw );
+    pPlayer->setId( 0x10000000 + i );
+    pPlayer->initInventory();
+    pPlayer->setLookAt( Common::CharaLook::Race, 1 );
+    pPlayer->setLookAt( Common::CharaLook::Tribe, 1 );
+    pPlayer->setClassJob( static_cast< Common::ClassJob >( cfg.classJob ) );
+    pPlayer->setLevel( cfg.level );
+
+    auto pWeapon = make_Item( 0x10000000 + i, cfg.weaponId, pFw );
+    pPlayer->updateContainer( Common::GearSet0, Common::GearSetSlot::MainHand, pWeapon );
+
+    pPlayer->calculateStats();
+    pPlayer->resetHp();
+    pPlayer->resetMp();
+    pPlayer->setTp( 1000 );
+
+    auto pos = pTarget->getPos();
+    pos.x += 1.f;
+    pPlayer->setPos( pos, false );
+    pPlayer->setCurrentZone( pZone );
+    pZone->pushActor( pPlayer );
+
+    pPlayer->setTargetId( pTarget->getId() );
+    pPlayer->setStance( Common::Stance::Active );
+    pPlayer->setAutoattack( true );
+
+    players.push_back( { pPlayer, pTarget->getId(), i, 0 } );
+  }
+
+  // auto attack damage with the derived stats cached, and with the per hit formulas used before the cache
+  if( cfg.autoAttacks > 0 )
+  {
+    auto& pPlayer = players.front().pPlayer;
+    double damage = 0.0;
+
+    auto benchStart = std::chrono::steady_clock::now();
+    for( uint32_t i = 0; i < cfg.autoAttacks; ++i )
+      damage += Math::CalcStats::calculateAutoAttackDamage( *pPlayer );
+    auto cachedNs = std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - benchStart ).count();
+
+    benchStart = std::chrono::steady_clock::now();
+    for( uint32_t i = 0; i < cfg.autoAttacks; ++i )
+      damage += uncachedAutoAttackDamage( *pPlayer );
+    auto uncachedNs = std::chrono::duration_cast< std::chrono::nanoseconds >(
+      std::chrono::steady_clock::now() - benchStart ).count();
+
+    Logger::warn( "{0} auto attacks: {1:.1f}ms cached, {2:.1f}ms recalculated ({3:.1f}ns vs {4:.1f}ns per hit, "
+                  "checksum {5:.0f})", cfg.autoAttacks, cachedNs / 1e6, uncachedNs / 1e6,
+                  static_cast< double >( cachedNs ) / cfg.autoAttacks,
+                  static_cast< double >( uncachedNs ) / cfg.autoAttacks, damage );
+  }
+
+  Logger::warn( "Simulating {0} players against {1} bnpcs in {2} for {3}s",
+                cfg.players, cfg.bNpcs, pTeri->name, cfg.durationSec );
+
+  Metrics::Histogram tickTime;
+  uint64_t maxTickUs = 0;
+  uint64_t ticks = 0;
+  uint64_t actions = 0;
+  uint64_t actionAllocations = 0;
+
+  auto allocationsStart = g_allocations.load( std::memory_order_relaxed );
+  auto simStart = std::chrono::steady_clock::now();
+  auto simEnd = simStart + std::chrono::seconds( cfg.durationSec );
+
+  while( std::chrono::steady_clock::now() < simEnd )
+  {
+    auto tickStart = std::chrono::steady_clock::now();
+    auto tickCount = Common::Util::getTimeMs();
+
+    pZone->update( tickCount );
+
+    for( auto& simPlayer : players )
+    {
+      auto& pPlayer = simPlayer.pPlayer;
+
+      if( !pPlayer->getCurrentAction() && tickCount >= simPlayer.nextActionTime )
+      {
+        auto actionId = cfg.rotation[ simPlayer.rotationStep++ % cfg.rotation.size() ];
+
+        auto allocations = g_allocations.load( std::memory_order_relaxed );
+        pActionMgr->handleTargetedPlayerAction( *pPlayer, actionId, *actionData[ actionId ], simPlayer.targetId );
+        actionAllocations += g_allocations.load( std::memory_order_relaxed ) - allocations;
+
+        actions++;
+        simPlayer.nextActionTime = tickCount + cfg.gcdMs;
+      }
+
+      pPlayer->update( tickCount );
+    }
+
+    auto tickUs = static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+      std::chrono::steady_clock::now() - tickStart ).count() );
+
+    tickTime.record( tickUs );
+    if( tickUs > maxTickUs )
+      maxTickUs = tickUs;
+    ticks++;
+
+    if( cfg.tickMs > 0 && tickUs < cfg.tickMs * 1000 )
+      std::this_thread::sleep_for( std::chrono::microseconds( cfg.tickMs * 1000 - tickUs ) );
+  }
+
+  auto elapsedMs = static_cast< double >( std::chrono::duration_cast< std::chrono::milliseconds >(
+    std::chrono::steady_clock::now() - simStart ).count() );
+  auto totalAllocations = g_allocations.load( std::memory_order_relaxed ) - allocationsStart;
+
+  Logger::warn( "{0} ticks in {1}ms, {2} actions ({3:.1f}/s)",
+                ticks, elapsedMs, actions, actions * 1000.0 / elapsedMs );
+  Logger::warn( "allocations: {0:.1f} per action, {1:.1f} per tick",
+                actions > 0 ? static_cast< double >( actionAllocations ) / actions : 0.0,
+                ticks > 0 ? static_cast< double >( totalAllocations ) / ticks : 0.0 );
+  Logger::warn( "tick time: p50 {0}us, p90 {1}us, p99 {2}us, max {3}us",
+                tickTime.getPercentile( 0.5 ), tickTime.getPercentile( 0.9 ),
+                tickTime.getPercentile( 0.99 ), maxTickUs );
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Common.h>
+#include <Crypt/blowfish.h>
+#include <Logging/Logger.h>
+
+using namespace Sapphire;
+
+struct BenchConfig
+{
+  // 0x280 is the size of the lobby packets sent during login
+  uint32_t packetSize = 0x280;
+  uint32_t packetCount = 100000;
+};
+
+bool parseArgs( const std::vector< std::string >& args, BenchConfig& cfg )
+{
+  if( args.size() % 2 != 0 )
+  {
+    Logger::error( "Missing value for {0}", args.back() );
+    return false;
+  }
+
+  for( std::size_t i = 0; i < args.size(); i += 2 )
+  {
+    auto& arg = args[ i ];
+    auto& value = args[ i + 1 ];
+
+    if( arg == "--size" )
+      cfg.packetSize = std::stoul( value );
+    else if( arg == "--packets" )
+      cfg.packetCount = std::stoul( value );
+    else
+    {
+      Logger::error( "Unknown argument {0}", arg );
+      return false;
+    }
+  }
+
+  if( cfg.packetSize == 0 || cfg.packetSize % 8 != 0 || cfg.packetCount == 0 )
+  {
+    Logger::error( "--size has to be a multiple of 8 and --packets greater than 0" );
+    return false;
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Runs func once per packet over the same buffer and prints the throughput
+ * @return the buffer after the last run, to compare the output of the variants
+ */
+std::vector< uint8_t > runBench( const std::string& name, const BenchConfig& cfg, const std::vector< uint8_t >& input,
+                                 const std::function< void( uint8_t*, uint32_t ) >& func )
+{
+  std::vector< uint8_t > buffer;
+
+  auto start = std::chrono::steady_clock::now();
+  for( uint32_t i = 0; i < cfg.packetCount; ++i )
+  {
+    buffer = input;
+    func( buffer.data(), cfg.packetSize );
+  }
+  auto elapsed = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+
+  auto megabytes = static_cast< double >( cfg.packetSize ) * cfg.packetCount / ( 1024.0 * 1024.0 );
+  Logger::info( "{0:<32} {1:>10.0f} packets/s {2:>10.1f} MiB/s", name, cfg.packetCount / elapsed, megabytes / elapsed );
+
+  return buffer;
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/crypt_bench" );
+
+  BenchConfig cfg;
+  std::vector< std::string > argVec( argv + 1, argv + argc );
+  if( !parseArgs( argVec, cfg ) )
+  {
+    Logger::info( "Usage: crypt_bench [--size bytes] [--packets n]" );
+    return 1;
+  }
+
+  std::mt19937 rng( 1 );
+  std::uniform_int_distribution< uint32_t > byteDist( 0, 255 );
+
+  uint8_t key[ 0x10 ];
+  for( auto& byte : key )
+    byte = static_cast< uint8_t >( byteDist( rng ) );
+
+  std::vector< uint8_t > input( cfg.packetSize );
+  for( auto& byte : input )
+    byte = static_cast< uint8_t >( byteDist( rng ) );
+
+  Logger::info( "Encrypting {0} packets of {1} bytes", cfg.packetCount, cfg.packetSize );
+
+  // what the lobby did before, a fresh key schedule for every packet
+  auto perPacket = runBench( "key schedule per packet", cfg, input, [ & ]( uint8_t* pData, uint32_t size )
+  {
+    BlowFish blowfish;
+    blowfish.initialize( key, 0x10 );
+    blowfish.Encode( pData, pData, size );
+  } );
+
+  BlowFish cached( key, 0x10 );
+
+  auto singleBlock = runBench( "cached, one block at a time", cfg, input, [ & ]( uint8_t* pData, uint32_t size )
+  {
+    for( uint32_t offset = 0; offset < size; offset += 8 )
+      cached.Encode( pData + offset, pData + offset, 8 );
+  } );
+
+  auto interleaved = runBench( "cached, interleaved", cfg, input, [ & ]( uint8_t* pData, uint32_t size )
+  {
+    cached.Encode( pData, pData, size );
+  } );
+
+  auto decoded = runBench( "cached, interleaved decode", cfg, interleaved, [ & ]( uint8_t* pData, uint32_t size )
+  {
+    cached.Decode( pData, pData, size );
+  } );
+
+  if( perPacket != singleBlock || perPacket != interleaved || decoded != input )
+  {
+    Logger::error( "Output of the variants differs" );
+    return 1;
+  }
+
+  return 0;
+}
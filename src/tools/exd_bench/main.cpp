@@ -0,0 +1,293 @@
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Exd.h>
+#include <Exh.h>
+#include <bparse.h>
+
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+
+using namespace Sapphire;
+
+struct BenchConfig
+{
+  // sqpack folder, the sheets are built in memory if it is empty
+  std::string dataPath;
+  uint32_t rows = 5000;
+  uint32_t columns = 100;
+  // columns a generated struct maps, spread evenly over the row
+  uint32_t mappedColumns = 20;
+  uint32_t passes = 20;
+};
+
+bool parseArgs( const std::vector< std::string >& args, BenchConfig& cfg )
+{
+  if( args.size() % 2 != 0 )
+  {
+    Logger::error( "Missing value for {0}", args.back() );
+    return false;
+  }
+
+  for( std::size_t i = 0; i < args.size(); i += 2 )
+  {
+    auto& arg = args[ i ];
+    auto& value = args[ i + 1 ];
+
+    if( arg == "--data" )
+      cfg.dataPath = value;
+    else if( arg == "--rows" )
+      cfg.rows = std::stoul( value );
+    else if( arg == "--columns" )
+      cfg.columns = std::stoul( value );
+    else if( arg == "--mapped" )
+      cfg.mappedColumns = std::stoul( value );
+    else if( arg == "--passes" )
+      cfg.passes = std::stoul( value );
+    else
+    {
+      Logger::error( "Unknown argument {0}", arg );
+      return false;
+    }
+  }
+
+  if( cfg.rows == 0 || cfg.columns == 0 || cfg.mappedColumns == 0 || cfg.mappedColumns > cfg.columns ||
+      cfg.passes == 0 )
+  {
+    Logger::error( "--rows, --columns, --mapped and --passes have to be greater than 0, --mapped at most --columns" );
+    return false;
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Runs func passes times and prints the rows decoded per second
+ * @return the rows per second
+ */
+double runBench( const std::string& name, uint32_t passes, std::size_t rowCount, const std::function< void() >& func )
+{
+  auto start = std::chrono::steady_clock::now();
+  for( uint32_t i = 0; i < passes; ++i )
+    func();
+  auto elapsed = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+
+  auto rowsPerSecond = static_cast< double >( rowCount ) * passes / elapsed;
+  Logger::info( "{0:<40} {1:>12.0f} rows/s", name, rowsPerSecond );
+  return rowsPerSecond;
+}
+
+/*!
+ * @brief A sheet with a column layout like the big game sheets, every fifth column a string
+ */
+struct SyntheticSheet
+{
+  std::shared_ptr< std::vector< char > > memory;
+  xiv::exd::Exd exd;
+
+  explicit SyntheticSheet( const BenchConfig& cfg )
+  {
+    std::vector< xiv::exd::ExhMember > members( cfg.columns );
+    uint16_t dataOffset = 0;
+    for( uint32_t i = 0; i < cfg.columns; ++i )
+    {
+      static const xiv::exd::DataType types[] = { xiv::exd::DataType::string, xiv::exd::DataType::uint32,
+                                                  xiv::exd::DataType::uint16, xiv::exd::DataType::int8,
+                                                  static_cast< xiv::exd::DataType >( 0x1A ) };
+      members[ i ].type = types[ i % 5 ];
+      members[ i ].offset = dataOffset;
+      dataOffset += 4;
+    }
+
+    xiv::exd::ExhHeader header{};
+    header.data_offset = dataOffset;
+    header.field_count = static_cast< uint16_t >( cfg.columns );
+    header.language_count = 1;
+    header.variant = 1;
+
+    auto pExh = std::make_shared< xiv::exd::Exh >( header, members,
+                                                   std::vector< xiv::exd::Language >{ xiv::exd::Language::none } );
+
+    std::mt19937 rng( 1 );
+    std::vector< std::size_t > recordOffsets;
+    memory = std::make_shared< std::vector< char > >();
+    auto& out = *memory;
+
+    for( uint32_t row = 0; row < cfg.rows; ++row )
+    {
+      std::vector< char > data( dataOffset );
+      std::string strings;
+      for( uint32_t i = 0; i < cfg.columns; ++i )
+      {
+        uint32_t value = rng();
+        if( members[ i ].type == xiv::exd::DataType::string )
+        {
+          value = static_cast< uint32_t >( strings.size() );
+          strings += "column " + std::to_string( i ) + " of row " + std::to_string( row );
+          strings.push_back( '\0' );
+        }
+        value = xiv::utils::bparse::byteswap( value );
+        std::memcpy( &data[ members[ i ].offset ], &value, sizeof( value ) );
+      }
+
+      auto size = xiv::utils::bparse::byteswap( static_cast< uint32_t >( data.size() + strings.size() ) );
+      uint16_t subRows = xiv::utils::bparse::byteswap( static_cast< uint16_t >( 1 ) );
+
+      recordOffsets.push_back( out.size() );
+      out.insert( out.end(), reinterpret_cast< char* >( &size ), reinterpret_cast< char* >( &size ) + 4 );
+      out.insert( out.end(), reinterpret_cast< char* >( &subRows ), reinterpret_cast< char* >( &subRows ) + 2 );
+      out.insert( out.end(), data.begin(), data.end() );
+      out.insert( out.end(), strings.begin(), strings.end() );
+    }
+
+    std::map< uint32_t, xiv::exd::ExdCacheEntry > records;
+    for( uint32_t row = 0; row < cfg.rows; ++row )
+      records.emplace( row, xiv::exd::ExdCacheEntry{ &out[ recordOffsets[ row ] ] } );
+
+    exd = xiv::exd::Exd( pExh, memory, records );
+  }
+};
+
+// values of the mapped columns, compared between the variants
+struct MappedRow
+{
+  std::vector< std::string > strings;
+  std::vector< uint32_t > values;
+};
+
+void pickField( const xiv::exd::Field& field, MappedRow& out )
+{
+  if( auto pString = std::get_if< std::string >( &field ) )
+    out.strings.push_back( *pString );
+  else if( auto pUInt32 = std::get_if< uint32_t >( &field ) )
+    out.values.push_back( *pUInt32 );
+  else if( auto pUInt16 = std::get_if< uint16_t >( &field ) )
+    out.values.push_back( *pUInt16 );
+  else if( auto pInt8 = std::get_if< int8_t >( &field ) )
+    out.values.push_back( static_cast< uint32_t >( *pInt8 ) );
+  else
+    out.values.push_back( std::get< bool >( field ) ? 1 : 0 );
+}
+
+bool benchSynthetic( const BenchConfig& cfg )
+{
+  SyntheticSheet sheet( cfg );
+
+  std::vector< uint32_t > mapped;
+  // shifted by one per column so every column type is mapped
+  for( uint32_t i = 0; i < cfg.mappedColumns; ++i )
+    mapped.push_back( ( i * cfg.columns / cfg.mappedColumns + i ) % cfg.columns );
+
+  Logger::info( "Decoding {0} of {1} columns of {2} in-memory rows, {3} passes",
+                cfg.mappedColumns, cfg.columns, cfg.rows, cfg.passes );
+
+  std::vector< MappedRow > fullDecode( cfg.rows );
+  std::vector< MappedRow > perColumn( cfg.rows );
+
+  // what the generated constructors did before, every column into a variant vector, then the mapped ones picked out
+  auto before = runBench( "get_row, then mapped columns", cfg.passes, cfg.rows, [ & ]()
+  {
+    for( uint32_t row = 0; row < cfg.rows; ++row )
+    {
+      auto fields = sheet.exd.get_row( row );
+      auto& out = fullDecode[ row ];
+      out = MappedRow();
+      for( auto index : mapped )
+        pickField( fields.at( index ), out );
+    }
+  } );
+
+  auto after = runBench( "get_row_data, get_field per column", cfg.passes, cfg.rows, [ & ]()
+  {
+    for( uint32_t row = 0; row < cfg.rows; ++row )
+    {
+      auto data = sheet.exd.get_row_data( row );
+      auto& out = perColumn[ row ];
+      out = MappedRow();
+      for( auto index : mapped )
+        pickField( sheet.exd.get_field( data, index ), out );
+    }
+  } );
+
+  Logger::info( "Speedup {0:.1f}x", after / before );
+
+  for( uint32_t row = 0; row < cfg.rows; ++row )
+  {
+    if( fullDecode[ row ].strings != perColumn[ row ].strings || fullDecode[ row ].values != perColumn[ row ].values )
+    {
+      Logger::error( "Output of the variants differs in row {0}", row );
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*!
+ * @brief Compares decoding every column of a row to building the generated struct of the row
+ *
+ * The generated constructors used to decode every column before picking theirs, so the full decode alone
+ * is a lower bound of what building a struct cost before.
+ */
+template< typename T >
+void benchSheet( Data::ExdDataGenerated& exdData, const std::string& name, xiv::exd::Exd& sheet,
+                 const std::set< uint32_t >& ids, uint32_t passes )
+{
+  Logger::info( "{0}: {1} rows, {2} columns", name, ids.size(), sheet.get_exh().get_exh_members().size() );
+
+  auto before = runBench( "  get_row, every column", passes, ids.size(), [ & ]()
+  {
+    for( auto id : ids )
+      sheet.get_row( id );
+  } );
+
+  auto after = runBench( "  generated struct", passes, ids.size(), [ & ]()
+  {
+    for( auto id : ids )
+      exdData.get< T >( id );
+  } );
+
+  Logger::info( "  Speedup at least {0:.1f}x", after / before );
+}
+
+bool benchGameData( const BenchConfig& cfg )
+{
+  Data::ExdDataGenerated exdData;
+  if( !exdData.init( cfg.dataPath ) )
+  {
+    Logger::error( "Error setting up EXD data from {0}", cfg.dataPath );
+    return false;
+  }
+
+  benchSheet< Data::Action >( exdData, "Action", exdData.getActionDat(), exdData.getActionIdList(), cfg.passes );
+  benchSheet< Data::Item >( exdData, "Item", exdData.getItemDat(), exdData.getItemIdList(), cfg.passes );
+  benchSheet< Data::Quest >( exdData, "Quest", exdData.getQuestDat(), exdData.getQuestIdList(), cfg.passes );
+  benchSheet< Data::BNpcBase >( exdData, "BNpcBase", exdData.getBNpcBaseDat(), exdData.getBNpcBaseIdList(),
+                                cfg.passes );
+  benchSheet< Data::TerritoryType >( exdData, "TerritoryType", exdData.getTerritoryTypeDat(),
+                                     exdData.getTerritoryTypeIdList(), cfg.passes );
+
+  return true;
+}
+
+int main( int argc, char* argv[] )
+{
+  Logger::init( "log/exd_bench" );
+
+  BenchConfig cfg;
+  std::vector< std::string > argVec( argv + 1, argv + argc );
+  if( !parseArgs( argVec, cfg ) )
+  {
+    Logger::info( "Usage: exd_bench [--data sqpack] [--rows n] [--columns n] [--mapped n] [--passes n]" );
+    return 1;
+  }
+
+  if( cfg.dataPath.empty() )
+    return benchSynthetic( cfg ) ? 0 : 1;
+
+  return benchGameData( cfg ) ? 0 : 1;
+}
@@ -54,9 +54,24 @@ std::string datLocation( "C:\\SquareEnix\\FINAL FANTASY XIV - A Realm Reborn\\ga
 std::map< uint8_t, std::string > g_typeMap;
 
 
+// sheets with text in more than one language are opened in the language of the profile
+std::string getSheetLanguage( const std::string& exd )
+{
+  auto& cat = g_exdData.m_exd_data->get_category( exd );
+  auto exh = cat.get_header();
+
+  if( exh.get_languages().size() > 1 )
+    return "xiv::exd::Language::en";
+  return "xiv::exd::Language::none";
+}
+
 std::string generateDatAccessDecl( const std::string& exd )
 {
-  return "     xiv::exd::Exd m_" + exd + "Dat;\n";
+  return "     ExdSheet m_" + exd + "Dat;\n"
+         "     xiv::exd::Exd& get" + exd + "Dat()\n"
+         "     {\n"
+         "       return getSheet( m_" + exd + "Dat, \"" + exd + "\", " + getSheetLanguage( exd ) + " );\n"
+         "     }\n";
 }
 
 std::string generateIdListDecl( const std::string& exd )
@@ -74,8 +89,8 @@ std::string generateIdListGetter( const std::string& exd )
   std::string IdListGetter = "const std::set< uint32_t >& get" + exd + "IdList()\n"
                                                                        "{\n"
                                                                        "   if( m_" + exd + "IdList.size() == 0 )\n"
-                                                                                           "      loadIdList( m_" +
-                             exd + "Dat, m_" + exd + "IdList );\n"
+                                                                                           "      loadIdList( get" +
+                             exd + "Dat(), m_" + exd + "IdList );\n"
                                                      "   return m_" + exd + "IdList;\n"
                                                                             "}\n";
   return IdListGetter;
@@ -83,15 +98,7 @@ std::string generateIdListGetter( const std::string& exd )
 
 std::string generateSetDatAccessCall( const std::string& exd )
 {
-  auto& cat = g_exdData.m_exd_data->get_category( exd );
-  auto exh = cat.get_header();
-
-  std::string lang = "xiv::exd::Language::none";
-  auto langs = exh.get_languages();
-  if( langs.size() > 1 )
-    lang = "xiv::exd::Language::en";
-
-  return "    m_" + exd + "Dat = setupDatAccess( \"" + exd + "\", " + lang + " );\n";
+  return "    m_sheetOpeners[ \"" + exd + "\" ] = [ this ]() { get" + exd + "Dat(); };\n";
 }
 
 std::string generateDirectGetterDef()
@@ -273,13 +280,15 @@ std::string generateConstructorsDecl( const std::string& exd )
   {
     result += "\nSapphire::Data::" + exd + "::" + exd + "( uint32_t row_id, uint32_t subRow, Sapphire::Data::ExdDataGenerated* exdData )\n";
     result += "{\n";
-    result += indent + "auto row = exdData->m_" + exd + "Dat.get_row( row_id, subRow );\n";
+    result += indent + "auto& sheet = exdData->get" + exd + "Dat();\n";
+    result += indent + "auto row = sheet.get_row_data( row_id, subRow );\n";
   }
   else
   {
     result += "\nSapphire::Data::" + exd + "::" + exd + "( uint32_t row_id, Sapphire::Data::ExdDataGenerated* exdData )\n";
     result += "{\n";
-    result += indent + "auto row = exdData->m_" + exd + "Dat.get_row( row_id );\n";
+    result += indent + "auto& sheet = exdData->get" + exd + "Dat();\n";
+    result += indent + "auto row = sheet.get_row_data( row_id );\n";
   }
   for( auto member : exhMem )
   {
@@ -291,11 +300,11 @@ std::string generateConstructorsDecl( const std::string& exd )
     if( indexToTarget.find( count ) != indexToTarget.end() )
       result += indent + indexToNameMap[ count ] + " = std::make_shared< " + indexToTarget[ count ] +
                 ">( exdData->getField< " +
-                indexToTypeMap[ count ] + " >( row, " + std::to_string( count ) + " ), exdData );\n";
+                indexToTypeMap[ count ] + " >( sheet, row, " + std::to_string( count ) + " ), exdData );\n";
     else
     {
       if( indexIsArrayMap.find( count ) == indexIsArrayMap.end() )
-        result += indent + indexToNameMap[ count ] + " = exdData->getField< " + indexToTypeMap[ count ] + " >( row, " +
+        result += indent + indexToNameMap[ count ] + " = exdData->getField< " + indexToTypeMap[ count ] + " >( sheet, row, " +
                   std::to_string( count ) + " );\n";
       else
       {
@@ -305,7 +314,7 @@ std::string generateConstructorsDecl( const std::string& exd )
         {
 
           result += indent + indexToNameMap[ count ] + ".push_back( exdData->getField< " + indexToTypeMap[ count ] +
-                    " >( row, " + std::to_string( count + i ) + " ) );\n";
+                    " >( sheet, row, " + std::to_string( count + i ) + " ) );\n";
 
         }
 
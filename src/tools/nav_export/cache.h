@@ -2,6 +2,7 @@
 #define CACHE_H
 
 #include <any>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -32,7 +33,10 @@ public:
 
     auto it = m_sgbCache.find( filepath );
     if( it != m_sgbCache.end() )
+    {
+      addDependency( filepath );
       return it->second;
+    }
 
     auto pFile = loadFile< SGB_FILE >( filepath );
     m_sgbCache[ filepath ] = pFile;
@@ -45,7 +49,10 @@ public:
 
     auto it = m_lgbCache.find( filepath );
     if( it != m_lgbCache.end() )
+    {
+      addDependency( filepath );
       return it->second;
+    }
 
     auto pFile = loadFile< LGB_FILE >( filepath );
     m_lgbCache[ filepath ] = pFile;
@@ -58,13 +65,65 @@ public:
 
     auto it = m_pcbCache.find( filepath );
     if( it != m_pcbCache.end() )
+    {
+      addDependency( filepath );
       return it->second;
+    }
 
     auto pFile = loadFile< PCB_FILE >( filepath );
     m_pcbCache[ filepath ] = pFile;
     return pFile;
   }
 
+  // raw data of a file, for the ones which are parsed directly
+  std::vector< char > getFile( const std::string& filepath )
+  {
+    std::scoped_lock lock( m_mutex );
+    auto buf = getFileBuffer( filepath );
+    addDependency( filepath, m_fileHashes[ filepath ] );
+    return buf;
+  }
+
+  // content hash of a file without parsing it, missing files all share the hash of no data
+  uint64_t getFileHash( const std::string& filepath )
+  {
+    std::scoped_lock lock( m_mutex );
+
+    auto it = m_fileHashes.find( filepath );
+    if( it != m_fileHashes.end() )
+      return it->second;
+
+    getFileBuffer( filepath );
+    return m_fileHashes[ filepath ];
+  }
+
+  static uint64_t hashBuffer( const std::vector< char >& buf )
+  {
+    // fnv-1a
+    uint64_t hash = 0xcbf29ce484222325;
+    for( auto c : buf )
+    {
+      hash ^= static_cast< uint8_t >( c );
+      hash *= 0x100000001b3;
+    }
+    return hash;
+  }
+
+  // records every file requested from here on along with its hash, until takeDependencies is called
+  void beginDependencies()
+  {
+    std::scoped_lock lock( m_mutex );
+    m_dependencies.clear();
+    m_trackDependencies = true;
+  }
+
+  std::map< std::string, uint64_t > takeDependencies()
+  {
+    std::scoped_lock lock( m_mutex );
+    m_trackDependencies = false;
+    return std::move( m_dependencies );
+  }
+
   void purge()
   {
     std::scoped_lock lock( m_mutex );
@@ -72,6 +131,27 @@ public:
   }
 
 private:
+  void addDependency( const std::string& filepath )
+  {
+    if( !m_trackDependencies )
+      return;
+
+    // a file only ends up in one of the parsed caches after it was read, so its hash is known
+    auto it = m_fileHashes.find( filepath );
+    if( it == m_fileHashes.end() )
+    {
+      getFileBuffer( filepath );
+      it = m_fileHashes.find( filepath );
+    }
+    addDependency( filepath, it->second );
+  }
+
+  void addDependency( const std::string& filepath, uint64_t hash )
+  {
+    if( m_trackDependencies )
+      m_dependencies[ filepath ] = hash;
+  }
+
   void _purge()
   {
     m_lgbCache.clear();
@@ -82,7 +162,9 @@ private:
   template< typename T >
   std::shared_ptr< T > loadFile( const std::string& filepath )
   {
+    // the file is read once, the dependency is recorded from the hash of that read
     auto buf = getFileBuffer( filepath );
+    addDependency( filepath, m_fileHashes[ filepath ] );
     if( !buf.empty() )
     {
       try
@@ -115,11 +197,13 @@ private:
       auto pFile = m_pData->getFile( filepath );
       auto& sections = pFile->get_data_sections();
       auto& section = sections.at( 0 );
+      m_fileHashes[ filepath ] = hashBuffer( section );
       return section;
     }
     catch( std::exception& e )
     {
       std::vector< char > empty;
+      m_fileHashes[ filepath ] = hashBuffer( empty );
       return empty;
     }
   }
@@ -130,6 +214,11 @@ private:
   std::map< std::string, std::shared_ptr< SGB_FILE > > m_sgbCache;
   std::map< std::string, std::shared_ptr< PCB_FILE > > m_pcbCache;
   int m_totalFiles{0};
+
+  // kept across purges, hashing is what tells the export cache whether a zone changed
+  std::map< std::string, uint64_t > m_fileHashes;
+  std::map< std::string, uint64_t > m_dependencies;
+  bool m_trackDependencies{ false };
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef EXPORTCACHE_H
+#define EXPORTCACHE_H
+
+#include <cstdint>
+#include <experimental/filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "cache.h"
+#include "exporter.h"
+
+// Remembers which game files every exported zone was built from, by content hash.
+// A zone whose files all still hash the same, exported by the same exporter version,
+// keeps its .obj/.nav from the last run instead of being parsed and exported again.
+class ExportCache
+{
+public:
+  // bump whenever the exported geometry or navmesh changes, invalidates every zone
+  static const uint32_t Version = 1;
+
+  ExportCache( std::shared_ptr< Cache > pCache, const std::string& exportDir ) :
+    m_pCache( pCache ),
+    m_exportDir( exportDir ),
+    m_cacheDir( exportDir + "/.cache" )
+  {
+  }
+
+  bool isZoneUpToDate( const std::string& zoneName, int exportFileTypes ) const
+  {
+    std::ifstream in( getManifestPath( zoneName ) );
+    if( !in.good() )
+      return false;
+
+    uint32_t version = 0;
+    int fileTypes = 0;
+    std::string line;
+
+    if( !std::getline( in, line ) || !( std::istringstream( line ) >> version ) || version != Version )
+      return false;
+    if( !std::getline( in, line ) || !( std::istringstream( line ) >> fileTypes ) ||
+        ( fileTypes & exportFileTypes ) != exportFileTypes )
+      return false;
+
+    std::error_code e;
+    auto outputName = m_exportDir + "/" + zoneName + "/" + zoneName;
+    if( ( exportFileTypes & ExportFileType::WavefrontObj ) && !std::experimental::filesystem::exists( outputName + ".obj", e ) )
+      return false;
+    if( ( exportFileTypes & ExportFileType::Navmesh ) && !std::experimental::filesystem::exists( outputName + ".nav", e ) )
+      return false;
+
+    // "<hash> <path>" per file the zone was built from
+    bool hasFiles = false;
+    while( std::getline( in, line ) )
+    {
+      auto pos = line.find( ' ' );
+      if( pos == std::string::npos )
+        return false;
+
+      auto hash = std::stoull( line.substr( 0, pos ), nullptr, 16 );
+      if( m_pCache->getFileHash( line.substr( pos + 1 ) ) != hash )
+        return false;
+
+      hasFiles = true;
+    }
+
+    return hasFiles;
+  }
+
+  // only call once every output of the zone was written, can be called from the export threads
+  void storeZone( const std::string& zoneName, int exportFileTypes,
+                  const std::map< std::string, uint64_t >& dependencies ) const
+  {
+    std::error_code e;
+    std::experimental::filesystem::create_directories( m_cacheDir, e );
+
+    // written under a temporary name so an interrupted run never leaves a partial manifest behind
+    auto path = getManifestPath( zoneName );
+    auto tmpPath = path + ".tmp";
+    {
+      std::ofstream out( tmpPath, std::ios::trunc );
+      if( !out.good() )
+        return;
+
+      out << Version << '\n' << exportFileTypes << '\n';
+      for( const auto& dependency : dependencies )
+        out << std::hex << dependency.second << std::dec << ' ' << dependency.first << '\n';
+
+      if( !out.good() )
+        return;
+    }
+
+    std::experimental::filesystem::rename( tmpPath, path, e );
+  }
+
+  // drops the manifest, the zone will be exported again on the next run
+  void invalidateZone( const std::string& zoneName ) const
+  {
+    std::error_code e;
+    std::experimental::filesystem::remove( getManifestPath( zoneName ), e );
+  }
+
+private:
+  std::string getManifestPath( const std::string& zoneName ) const
+  {
+    return m_cacheDir + "/" + zoneName + ".manifest";
+  }
+
+  std::shared_ptr< Cache > m_pCache;
+  std::string m_exportDir;
+  std::string m_cacheDir;
+};
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef EXPORTMGR_H
 #define EXPORTMGR_H
 
+#include <functional>
+
 #include "exporter.h"
 #include "navmesh_exporter.h"
 #include "obj_exporter.h"
@@ -28,15 +30,22 @@ public:
     m_threadpool.addWorkers( maxJobs );
   }
 
-  void exportZone(const ExportedZone& zone, ExportFileType exportFileTypes)
+  // onExported runs on the export thread once every requested file of the zone was written
+  void exportZone( const ExportedZone& zone, ExportFileType exportFileTypes,
+                   std::function< void() > onExported = nullptr )
   {
-    m_threadpool.queue( [zone, exportFileTypes]()
+    m_threadpool.queue( [zone, exportFileTypes, onExported]()
     {
+      bool success = true;
+
       if( exportFileTypes & ExportFileType::WavefrontObj )
-        ObjExporter::exportZone( zone );
+        success &= !ObjExporter::exportZone( zone ).empty();
 
       if( exportFileTypes & ExportFileType::Navmesh )
-        NavmeshExporter::exportZone( zone );
+        success &= NavmeshExporter::exportZone( zone );
+
+      if( success && onExported )
+        onExported();
     } );
   }
 
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <algorithm>
 #include <cstdint>
 #include <string>
 #include <iostream>
@@ -18,9 +19,11 @@
 #include "exportmgr.h"
 
 #include "cache.h"
+#include "exportcache.h"
 #include "pcb.h"
 #include "lgb.h"
 #include "sgb.h"
+#include "transform.h"
 
 #include <GameData.h>
 #include <File.h>
@@ -149,6 +152,110 @@ std::string zoneNameToPath( const std::string& name )
 }
 
 int totalModels = 0;
+
+// --bench-transform, runs the old per vertex rotation matrices next to the precomposed transforms
+bool benchTransform = false;
+
+struct TransformBench
+{
+  std::chrono::nanoseconds legacy{};
+  std::chrono::nanoseconds batched{};
+  float maxError = 0.f;
+  size_t vertexCount = 0;
+};
+
+TransformBench zoneTransformBench;
+TransformBench totalTransformBench;
+
+// how vertices were transformed before, kept as reference for the benchmark
+void legacyTransform( vec3& v, const vec3* scale, const vec3* rotation, const vec3* translation,
+                      const SGB_MODEL_ENTRY* pSgbEntry )
+{
+  if( pSgbEntry )
+  {
+    v.x *= pSgbEntry->header.scale.x;
+    v.y *= pSgbEntry->header.scale.y;
+    v.z *= pSgbEntry->header.scale.z;
+
+    v = v * matrix4::rotateX( pSgbEntry->header.rotation.x );
+    v = v * matrix4::rotateY( pSgbEntry->header.rotation.y );
+    v = v * matrix4::rotateZ( pSgbEntry->header.rotation.z );
+
+    v.x += pSgbEntry->header.translation.x;
+    v.y += pSgbEntry->header.translation.y;
+    v.z += pSgbEntry->header.translation.z;
+  }
+
+  if( scale )
+  {
+    v.x *= scale->x;
+    v.y *= scale->y;
+    v.z *= scale->z;
+
+    v = v * matrix4::rotateX( rotation->x );
+    v = v * matrix4::rotateY( rotation->y );
+    v = v * matrix4::rotateZ( rotation->z );
+
+    v.x += translation->x;
+    v.y += translation->y;
+    v.z += translation->z;
+  }
+}
+
+void benchLegacyTransform( const PCB_BLOCK_ENTRY& entry, const ExportedMesh& mesh, const vec3* scale,
+                           const vec3* rotation, const vec3* translation, const SGB_MODEL_ENTRY* pSgbEntry )
+{
+  static std::vector< float > verts;
+  verts.resize( mesh.verts.size() );
+
+  float x_base = abs( float( entry.header.x1 - entry.header.x ) );
+  float y_base = abs( float( entry.header.y1 - entry.header.y ) );
+  float z_base = abs( float( entry.header.z1 - entry.header.z ) );
+
+  auto start = std::chrono::steady_clock::now();
+
+  int i = 0;
+  for( auto& vertex : entry.data.vertices )
+  {
+    vec3 v( vertex.x, vertex.y, vertex.z );
+    legacyTransform( v, scale, rotation, translation, pSgbEntry );
+
+    verts[ i++ ] = v.x;
+    verts[ i++ ] = v.y;
+    verts[ i++ ] = v.z;
+  }
+
+  for( const auto& link : entry.data.vertices_i16 )
+  {
+    vec3 v( float( link.x ) / 0xFFFF, float( link.y ) / 0xFFFF, float( link.z ) / 0xFFFF );
+
+    v.x = v.x * x_base + entry.header.x;
+    v.y = v.y * y_base + entry.header.y;
+    v.z = v.z * z_base + entry.header.z;
+
+    legacyTransform( v, scale, rotation, translation, pSgbEntry );
+
+    verts[ i++ ] = v.x;
+    verts[ i++ ] = v.y;
+    verts[ i++ ] = v.z;
+  }
+
+  zoneTransformBench.legacy += std::chrono::steady_clock::now() - start;
+  zoneTransformBench.vertexCount += verts.size() / 3;
+
+  for( size_t j = 0; j < verts.size(); ++j )
+    zoneTransformBench.maxError = std::max( zoneTransformBench.maxError, std::abs( verts[ j ] - mesh.verts[ j ] ) );
+}
+
+void printTransformBench( const std::string& name, const TransformBench& bench )
+{
+  auto legacyMs = std::chrono::duration< double, std::milli >( bench.legacy ).count();
+  auto batchedMs = std::chrono::duration< double, std::milli >( bench.batched ).count();
+
+  printf( "[Bench] %s: %zu verts, legacy %.2f ms, batched %.2f ms (%.1fx), max error %g\n", name.c_str(),
+          bench.vertexCount, legacyMs, batchedMs, batchedMs > 0 ? legacyMs / batchedMs : 0.0, bench.maxError );
+}
+
 void buildModelEntry( std::shared_ptr< PCB_FILE > pPcbFile, ExportedGroup& exportedGroup,
                          const std::string& name, const std::string& groupName,
                          const vec3* scale = nullptr,
@@ -158,6 +265,14 @@ void buildModelEntry( std::shared_ptr< PCB_FILE > pPcbFile, ExportedGroup& expor
 {
   auto& pcb_file = *pPcbFile.get();
 
+  // sgb entry transform first, then the instance one, composed once for every vertex of the model
+  auto transform = affine3::identity();
+  if( pSgbEntry )
+    transform = affine3::fromTransform( pSgbEntry->header.scale, pSgbEntry->header.rotation,
+                                        pSgbEntry->header.translation );
+  if( scale )
+    transform = affine3::fromTransform( *scale, *rotation, *translation ) * transform;
+
   ExportedModel model;
   model.name = name + "_" + std::to_string( totalModels++ );
   model.meshes.resize( pcb_file.entries.size() );
@@ -165,76 +280,41 @@ void buildModelEntry( std::shared_ptr< PCB_FILE > pPcbFile, ExportedGroup& expor
   uint32_t meshCount = 0;
   for( const auto& entry : pcb_file.entries )
   {
-    ExportedMesh mesh;
-
-    mesh.verts.resize( ( entry.header.num_vertices + entry.header.num_v16 ) * 3 );
-    mesh.indices.resize( entry.header.num_indices * 3 );
-
-    float x_base = abs( float( entry.header.x1 - entry.header.x ) );
-    float y_base = abs( float( entry.header.y1 - entry.header.y ) );
-    float z_base = abs( float( entry.header.z1 - entry.header.z ) );
+    // filled in place, the buffers are moved into the group along with the model
+    auto& mesh = model.meshes[ meshCount++ ];
 
-    auto makeTranslation = [ & ]( vec3& v )
-    {
-      if( pSgbEntry )
-      {
-        v.x *= pSgbEntry->header.scale.x;
-        v.y *= pSgbEntry->header.scale.y;
-        v.z *= pSgbEntry->header.scale.z;
-
-        v = v * matrix4::rotateX( pSgbEntry->header.rotation.x );
-        v = v * matrix4::rotateY( pSgbEntry->header.rotation.y );
-        v = v * matrix4::rotateZ( pSgbEntry->header.rotation.z );
-
-        v.x += pSgbEntry->header.translation.x;
-        v.y += pSgbEntry->header.translation.y;
-        v.z += pSgbEntry->header.translation.z;
-      }
+    auto numVerts = entry.data.vertices.size();
+    auto numV16 = entry.data.vertices_i16.size();
 
-      if( scale )
-      {
-        v.x *= scale->x;
-        v.y *= scale->y;
-        v.z *= scale->z;
+    mesh.verts.resize( ( numVerts + numV16 ) * 3 );
+    mesh.indices.resize( entry.header.num_indices * 3 );
 
-        v = v * matrix4::rotateX( rotation->x );
-        v = v * matrix4::rotateY( rotation->y );
-        v = v * matrix4::rotateZ( rotation->z );
+    auto start = std::chrono::steady_clock::now();
 
-        v.x += translation->x;
-        v.y += translation->y;
-        v.z += translation->z;
-      }
-
-    };
-    int verts = 0;
-    int indices = 0;
+    if( numVerts )
+      transformVertices( transform, reinterpret_cast< const float* >( entry.data.vertices.data() ),
+                         mesh.verts.data(), numVerts );
 
-    for( auto& vertex : entry.data.vertices )
+    if( numV16 )
     {
-      vec3 v( vertex.x, vertex.y, vertex.z );
-      makeTranslation( v );
-
-      mesh.verts[ verts++ ] = v.x;
-      mesh.verts[ verts++ ] = v.y;
-      mesh.verts[ verts++ ] = v.z;
+      // i16 vertices are quantized to the bounding box of the entry, dequantizing is just another scale and offset
+      vec3 boxScale( abs( float( entry.header.x1 - entry.header.x ) ) / 0xFFFF,
+                     abs( float( entry.header.y1 - entry.header.y ) ) / 0xFFFF,
+                     abs( float( entry.header.z1 - entry.header.z ) ) / 0xFFFF );
+      vec3 boxOrigin( entry.header.x, entry.header.y, entry.header.z );
+
+      transformVertices( transform * affine3::scaleOffset( boxScale, boxOrigin ),
+                         reinterpret_cast< const uint16_t* >( entry.data.vertices_i16.data() ),
+                         mesh.verts.data() + numVerts * 3, numV16 );
     }
 
-    for( const auto& link : entry.data.vertices_i16 )
+    if( benchTransform )
     {
-      vec3 v( float( link.x ) / 0xFFFF, float( link.y ) / 0xFFFF, float( link.z ) / 0xFFFF );
-
-      v.x = v.x * x_base + entry.header.x;
-      v.y = v.y * y_base + entry.header.y;
-      v.z = v.z * z_base + entry.header.z;
-
-      makeTranslation( v );
-
-      mesh.verts[ verts++ ] = v.x;
-      mesh.verts[ verts++ ] = v.y;
-      mesh.verts[ verts++ ] = v.z;
+      zoneTransformBench.batched += std::chrono::steady_clock::now() - start;
+      benchLegacyTransform( entry, mesh, scale, rotation, translation, pSgbEntry );
     }
 
+    int indices = 0;
     for( const auto& index : entry.data.indices )
     {
       mesh.indices[ indices++ ] = index.index[ 0 ];
@@ -242,9 +322,8 @@ void buildModelEntry( std::shared_ptr< PCB_FILE > pPcbFile, ExportedGroup& expor
       mesh.indices[ indices++ ] = index.index[ 2 ];
       // std::cout << std::to_string( index.unknown[0] )<< " " << std::to_string( index.unknown[1] )<< " " << std::to_string( index.unknown[2]) << std::endl;
     }
-    model.meshes[ meshCount++ ] = mesh;
   }
-  exportedGroup.models[model.name] = model;
+  exportedGroup.models[ model.name ] = std::move( model );
 }
 
 bool pcbTransformModel( const std::string& fileName, const vec3* scale, const vec3* rotation,
@@ -319,6 +398,12 @@ int main( int argc, char* argv[] )
   if( argc > 1 )
     gamePath = std::string( argv[ 1 ] );
 
+  // builds the export structs of every zone with both transform paths and prints the timings, nothing is exported
+  benchTransform = std::find( argVec.begin(), argVec.end(), "--bench-transform" ) != argVec.end();
+
+  // exports every zone again, even the ones whose game files did not change since the last run
+  bool noCache = std::find( argVec.begin(), argVec.end(), "--no-cache" ) != argVec.end();
+
   try
   {
     initExd( gamePath );
@@ -326,10 +411,11 @@ int main( int argc, char* argv[] )
   }
   catch( std::exception& e )
   {
-    printf( "Unable to initialise EXD!\n Usage: nav_export \"path/to/FINAL FANTASY XIV - A REALM REBORN/game/sqpack\"\n" );
+    printf( "Unable to initialise EXD!\n Usage: nav_export \"path/to/FINAL FANTASY XIV - A REALM REBORN/game/sqpack\" [--bench-transform] [--no-cache]\n" );
     return -1;
   }
   ExportMgr exportMgr( nJobs );
+  auto pExportCache = std::make_shared< ExportCache >( pCache, fs::current_path().string() + "/pcb_export" );
   zoneNameToPath( zoneName );
 
   if( dumpAllZones )
@@ -357,6 +443,15 @@ int main( int argc, char* argv[] )
       exportedZone.name = zoneNameShort;
       exportedTeriMap[ zonePath ] = zoneNameShort;
 
+      if( !noCache && !benchTransform && pExportCache->isZoneUpToDate( zoneNameShort, exportFileType ) )
+      {
+        printf( "[Cache] %s is unchanged since the last export, skipping\n", zoneName.c_str() );
+        continue;
+      }
+
+      // any file read from here on is part of what the zone was built from
+      pCache->beginDependencies();
+
       std::string listPcbPath( zonePath + "/collision/list.pcb" );
       std::string bgLgbPath( zonePath + "/level/bg.lgb" );
       std::string planmapLgbPath( zonePath + "/level/planmap.lgb" );
@@ -365,16 +460,13 @@ int main( int argc, char* argv[] )
       std::vector< char > section1;
       std::vector< char > section2;
 
-      const xiv::dat::Cat& test = gameData->getCategory( "bg" );
-
-      auto test_file = gameData->getFile( bgLgbPath );
-      section = test_file->access_data_sections().at( 0 );
-
-      auto planmap_file = gameData->getFile( planmapLgbPath );
-      section2 = planmap_file->access_data_sections().at( 0 );
-
-      auto test_file1 = gameData->getFile( listPcbPath );
-      section1 = test_file1->access_data_sections().at( 0 );
+      for( auto file : { std::make_pair( &section, &bgLgbPath ), std::make_pair( &section2, &planmapLgbPath ),
+                         std::make_pair( &section1, &listPcbPath ) } )
+      {
+        *file.first = pCache->getFile( *file.second );
+        if( file.first->empty() )
+          throw std::runtime_error( "Unable to read " + *file.second );
+      }
 
       std::vector< std::string > stringList;
 
@@ -475,7 +567,26 @@ int main( int argc, char* argv[] )
           exportedZone.groups.emplace( group.name, exportedGroup );
         }
       }
-      exportMgr.exportZone( exportedZone, static_cast< ExportFileType >( exportFileType ) );
+      if( benchTransform )
+      {
+        printTransformBench( zoneNameShort, zoneTransformBench );
+
+        totalTransformBench.legacy += zoneTransformBench.legacy;
+        totalTransformBench.batched += zoneTransformBench.batched;
+        totalTransformBench.vertexCount += zoneTransformBench.vertexCount;
+        totalTransformBench.maxError = std::max( totalTransformBench.maxError, zoneTransformBench.maxError );
+        zoneTransformBench = TransformBench();
+      }
+      else
+      {
+        // the manifest is only replaced once the new files are written, a failed export is retried next run
+        pExportCache->invalidateZone( zoneNameShort );
+        exportMgr.exportZone( exportedZone, static_cast< ExportFileType >( exportFileType ),
+                              [ pExportCache, zoneNameShort, exportFileType, dependencies = pCache->takeDependencies() ]()
+                              {
+                                pExportCache->storeZone( zoneNameShort, exportFileType, dependencies );
+                              } );
+      }
       exportedZone.groups.clear();
 
       printf( "Built export struct for %s in %lu seconds \n",
@@ -498,6 +609,9 @@ int main( int argc, char* argv[] )
   exportMgr.waitForTasks();
   std::cout << "\n\n\n";
 
+  if( benchTransform )
+    printTransformBench( "all zones", totalTransformBench );
+
   printf( "Finished all tasks in %lu seconds\n",
             std::chrono::duration_cast< std::chrono::seconds >( std::chrono::high_resolution_clock::now() - startTime ).count() );
 
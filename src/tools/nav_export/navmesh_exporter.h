@@ -19,7 +19,7 @@ namespace fs = std::experimental::filesystem;
 class NavmeshExporter
 {
 public:
-  static void exportZone( const ExportedZone& zone )
+  static bool exportZone( const ExportedZone& zone )
   {
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -38,13 +38,16 @@ public:
     if( !gen.init( objName ) )
     {
       printf( "[Navmesh] failed to init TiledNavmeshGenerator for file '%s'\n", zone.name.c_str() );
-      return;
+      return false;
     }
 
+    // only tiles whose geometry changed since the last export are rebuilt
+    gen.loadPreviousNavmesh( zone.name );
+
     if( !gen.buildNavmesh() )
     {
       printf( "[Navmesh] Failed to build navmesh for '%s'\n", zone.name.c_str() );
-      return;
+      return false;
     }
 
     gen.saveNavmesh( zone.name );
@@ -53,6 +56,7 @@ public:
     auto end = std::chrono::high_resolution_clock::now();
     printf( "[Navmesh] Finished exporting %s in %lu ms\n", zone.name.c_str(),
             std::chrono::duration_cast< std::chrono::milliseconds >( end - start ).count() );
+    return true;
   }
 
 };
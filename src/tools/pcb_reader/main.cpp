@@ -21,6 +21,7 @@
 #include "pcb.h"
 #include "lgb.h"
 #include "sgb.h"
+#include "transform.h"
 
 #include <GameData.h>
 #include <File.h>
@@ -306,6 +307,14 @@ int main( int argc, char* argv[] )
         
         auto& pcb_file = *pPcbFile.get();
 
+        // sgb entry transform first, then the instance one, composed once for every vertex of the model
+        auto transform = affine3::identity();
+        if( pSgbEntry )
+          transform = affine3::fromTransform( pSgbEntry->header.scale, pSgbEntry->header.rotation,
+                                              pSgbEntry->header.translation );
+        if( scale )
+          transform = affine3::fromTransform( *scale, *rotation, *translation ) * transform;
+
         ExportedModel model;
         model.name = name + "_" + std::to_string( totalModels++ );
         model.meshes.resize( pcb_file.entries.size() );
@@ -313,76 +322,33 @@ int main( int argc, char* argv[] )
         uint32_t meshCount = 0;
         for( const auto& entry : pcb_file.entries )
         {
-          ExportedMesh mesh;
-
-          mesh.verts.resize( ( entry.header.num_vertices + entry.header.num_v16 ) * 3 );
-          mesh.indices.resize( entry.header.num_indices * 3 );
-
-          float x_base = abs( float( entry.header.x1 - entry.header.x ) );
-          float y_base = abs( float( entry.header.y1 - entry.header.y ) );
-          float z_base = abs( float( entry.header.z1 - entry.header.z ) );
-
-          auto makeTranslation = [ & ]( vec3& v )
-          {
-            if( pSgbEntry )
-            {
-              v.x *= pSgbEntry->header.scale.x;
-              v.y *= pSgbEntry->header.scale.y;
-              v.z *= pSgbEntry->header.scale.z;
-
-              v = v * matrix4::rotateX( pSgbEntry->header.rotation.x );
-              v = v * matrix4::rotateY( pSgbEntry->header.rotation.y );
-              v = v * matrix4::rotateZ( pSgbEntry->header.rotation.z );
-
-              v.x += pSgbEntry->header.translation.x;
-              v.y += pSgbEntry->header.translation.y;
-              v.z += pSgbEntry->header.translation.z;
-            }
-
-            if( scale )
-            {
-              v.x *= scale->x;
-              v.y *= scale->y;
-              v.z *= scale->z;
+          // filled in place, the buffers are moved into the group along with the model
+          auto& mesh = model.meshes[ meshCount++ ];
 
-              v = v * matrix4::rotateX( rotation->x );
-              v = v * matrix4::rotateY( rotation->y );
-              v = v * matrix4::rotateZ( rotation->z );
+          auto numVerts = entry.data.vertices.size();
+          auto numV16 = entry.data.vertices_i16.size();
 
-              v.x += translation->x;
-              v.y += translation->y;
-              v.z += translation->z;
-            }
+          mesh.verts.resize( ( numVerts + numV16 ) * 3 );
+          mesh.indices.resize( entry.header.num_indices * 3 );
 
-          };
-          int verts = 0;
-          int indices = 0;
+          if( numVerts )
+            transformVertices( transform, reinterpret_cast< const float* >( entry.data.vertices.data() ),
+                               mesh.verts.data(), numVerts );
 
-          for( auto& vertex : entry.data.vertices )
+          if( numV16 )
           {
-            vec3 v( vertex.x, vertex.y, vertex.z );
-            makeTranslation( v );
-
-            mesh.verts[ verts++ ] = v.x;
-            mesh.verts[ verts++ ] = v.y;
-            mesh.verts[ verts++ ] = v.z;
-          }
-
-          for( const auto& link : entry.data.vertices_i16 )
-          {
-            vec3 v( float( link.x ) / 0xFFFF, float( link.y ) / 0xFFFF, float( link.z ) / 0xFFFF );
-
-            v.x = v.x * x_base + entry.header.x;
-            v.y = v.y * y_base + entry.header.y;
-            v.z = v.z * z_base + entry.header.z;
-
-            makeTranslation( v );
-
-            mesh.verts[ verts++ ] = v.x;
-            mesh.verts[ verts++ ] = v.y;
-            mesh.verts[ verts++ ] = v.z;
+            // i16 vertices are quantized to the bounding box of the entry, dequantizing is just another scale and offset
+            vec3 boxScale( abs( float( entry.header.x1 - entry.header.x ) ) / 0xFFFF,
+                           abs( float( entry.header.y1 - entry.header.y ) ) / 0xFFFF,
+                           abs( float( entry.header.z1 - entry.header.z ) ) / 0xFFFF );
+            vec3 boxOrigin( entry.header.x, entry.header.y, entry.header.z );
+
+            transformVertices( transform * affine3::scaleOffset( boxScale, boxOrigin ),
+                               reinterpret_cast< const uint16_t* >( entry.data.vertices_i16.data() ),
+                               mesh.verts.data() + numVerts * 3, numV16 );
           }
 
+          int indices = 0;
           for( const auto& index : entry.data.indices )
           {
             mesh.indices[ indices++ ] = index.index[ 0 ];
@@ -391,9 +357,8 @@ int main( int argc, char* argv[] )
             // std::cout << std::to_string( index.unknown[0] )<< " " << std::to_string( index.unknown[1] )<< " " << std::to_string( index.unknown[2]) << std::endl;
           }
           max_index += entry.data.vertices.size() + entry.data.vertices_i16.size();
-          model.meshes[ meshCount++ ] = mesh;
         }
-        exportedGroup.models[model.name] = model;
+        exportedGroup.models[ model.name ] = std::move( model );
       };
       ExportedGroup exportedTerrainGroup;
       exportedTerrainGroup.name = zoneName + "_terrain";
@@ -1,8 +1,12 @@
 #include "TiledNavmeshGenerator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <experimental/filesystem>
 #include <cstring>
+#include <thread>
 
+#include <recastnavigation/Detour/Include/DetourAlloc.h>
 #include <recastnavigation/Detour/Include/DetourNavMeshBuilder.h>
 
 namespace fs = std::experimental::filesystem;
@@ -32,14 +36,56 @@ inline unsigned int ilog2( uint32_t v )
   return r;
 }
 
+// fnv-1a, only has to be stable between runs of the exporter
+inline uint64_t hashBytes( uint64_t hash, const void* data, size_t size )
+{
+  auto bytes = static_cast< const uint8_t* >( data );
+  for( size_t i = 0; i < size; ++i )
+  {
+    hash ^= bytes[ i ];
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+TiledNavmeshGenerator::TileBuildContext::TileBuildContext() :
+  // ignore logging/bullshit/etc
+  ctx( false ),
+  solid( nullptr ),
+  chf( nullptr ),
+  cset( nullptr ),
+  pmesh( nullptr ),
+  dmesh( nullptr ),
+  tileTriCount( 0 )
+{
+  memset( &cfg, 0, sizeof( cfg ) );
+}
+
+TiledNavmeshGenerator::TileBuildContext::~TileBuildContext()
+{
+  reset();
+}
+
+void TiledNavmeshGenerator::TileBuildContext::reset()
+{
+  rcFreeHeightField( solid );
+  rcFreeCompactHeightfield( chf );
+  rcFreeContourSet( cset );
+  rcFreePolyMesh( pmesh );
+  rcFreePolyMeshDetail( dmesh );
+
+  solid = nullptr;
+  chf = nullptr;
+  cset = nullptr;
+  pmesh = nullptr;
+  dmesh = nullptr;
+}
+
 bool TiledNavmeshGenerator::init( const std::string& path )
 {
   if( !fs::exists( path ) )
     throw std::runtime_error( "what" );
 
-  // ignore logging/bullshit/etc
-  m_ctx = new rcContext( false );
-
   printf( "[Navmesh] loading obj: %s\n", path.substr( path.find( "pcb_export" ) - 1 ).c_str() );
 
   m_mesh = new rcMeshLoaderObj;
@@ -68,12 +114,12 @@ bool TiledNavmeshGenerator::init( const std::string& path )
   rcCalcGridSize( m_meshBMin, m_meshBMax, m_cellSize, &gw, &gh );
 
   auto ts = static_cast< uint32_t >( m_tileSize );
-  const uint32_t tw = ( gw + ts - 1 ) / ts;
-  const uint32_t th = ( gh + ts - 1 ) / ts;
+  m_tilesX = ( gw + ts - 1 ) / ts;
+  m_tilesY = ( gh + ts - 1 ) / ts;
 
-  printf( "[Navmesh]  - Tiles %d x %d\n", tw, th );
+  printf( "[Navmesh]  - Tiles %d x %d\n", m_tilesX, m_tilesY );
 
-  int tileBits = rcMin( ( int ) ilog2( nextPow2( tw * th ) ), 14 );
+  int tileBits = rcMin( ( int ) ilog2( nextPow2( m_tilesX * m_tilesY ) ), 14 );
   if( tileBits > 14 )
     tileBits = 14;
   int polyBits = 22 - tileBits;
@@ -90,19 +136,197 @@ TiledNavmeshGenerator::~TiledNavmeshGenerator()
   delete m_mesh;
   delete m_chunkyMesh;
 
-  if( m_triareas )
-    delete[] m_triareas;
-  delete m_ctx;
-
-  rcFreeContourSet( m_cset );
-  rcFreeHeightField( m_solid );
-  rcFreeCompactHeightfield(m_chf);
-  rcFreePolyMesh( m_pmesh );
-  rcFreePolyMeshDetail( m_dmesh );
+  freePreviousTiles();
   dtFreeNavMesh( m_navMesh );
   dtFreeNavMeshQuery( m_navQuery );
 }
 
+void TiledNavmeshGenerator::getNavmeshParams( dtNavMeshParams& params ) const
+{
+  memset( &params, 0, sizeof( params ) );
+  rcVcopy( params.orig, m_meshBMin );
+  params.tileWidth = m_tileSize * m_cellSize;
+  params.tileHeight = m_tileSize * m_cellSize;
+  params.maxTiles = m_maxTiles;
+  params.maxPolys = m_maxPolysPerTile;
+}
+
+void TiledNavmeshGenerator::getTileBounds( int tx, int ty, float* bmin, float* bmax ) const
+{
+  const float tcs = m_tileSize * m_cellSize;
+
+  bmin[ 0 ] = m_meshBMin[ 0 ] + tx * tcs;
+  bmin[ 1 ] = m_meshBMin[ 1 ];
+  bmin[ 2 ] = m_meshBMin[ 2 ] + ty * tcs;
+
+  bmax[ 0 ] = m_meshBMin[ 0 ] + ( tx + 1 ) * tcs;
+  bmax[ 1 ] = m_meshBMax[ 1 ];
+  bmax[ 2 ] = m_meshBMin[ 2 ] + ( ty + 1 ) * tcs;
+}
+
+int TiledNavmeshGenerator::getTileChunks( const float* bmin, const float* bmax, int* chunkIds, int maxChunks ) const
+{
+  float tbmin[ 2 ];
+  float tbmax[ 2 ];
+  tbmin[ 0 ] = bmin[ 0 ];
+  tbmin[ 1 ] = bmin[ 2 ];
+  tbmax[ 0 ] = bmax[ 0 ];
+  tbmax[ 1 ] = bmax[ 2 ];
+
+  return rcGetChunksOverlappingRect( m_chunkyMesh, tbmin, tbmax, chunkIds, maxChunks );
+}
+
+uint64_t TiledNavmeshGenerator::hashTileInput( int tx, int ty ) const
+{
+  uint64_t hash = 0xcbf29ce484222325;
+
+  // everything buildTileMesh reads besides the triangles
+  const float options[] = { m_tileSize, m_cellSize, m_cellHeight, m_agentMaxSlope, m_agentHeight, m_agentMaxClimb,
+                            m_agentRadius, m_regionMinSize, m_regionMergeSize, m_edgeMaxLen, m_edgeMaxError,
+                            m_vertsPerPoly, m_detailSampleDist, m_detailSampleMaxError };
+  hash = hashBytes( hash, options, sizeof( options ) );
+  hash = hashBytes( hash, &m_partitionType, sizeof( m_partitionType ) );
+
+  float bmin[ 3 ];
+  float bmax[ 3 ];
+  getTileBounds( tx, ty, bmin, bmax );
+  hash = hashBytes( hash, bmin, sizeof( bmin ) );
+  hash = hashBytes( hash, bmax, sizeof( bmax ) );
+
+  // same border buildTileMesh rasterizes, triangles in it change the tile too
+  const float border = ( static_cast< int >( ceilf( m_agentRadius / m_cellSize ) ) + 3 ) * m_cellSize;
+  bmin[ 0 ] -= border;
+  bmin[ 2 ] -= border;
+  bmax[ 0 ] += border;
+  bmax[ 2 ] += border;
+
+  int cid[512];
+  const int ncid = getTileChunks( bmin, bmax, cid, 512 );
+
+  const float* verts = m_mesh->getVerts();
+  for( int i = 0; i < ncid; ++i )
+  {
+    const rcChunkyTriMeshNode& node = m_chunkyMesh->nodes[ cid[ i ] ];
+    const int* ctris = &m_chunkyMesh->tris[ node.i * 3 ];
+
+    for( int j = 0; j < node.n * 3; ++j )
+      hash = hashBytes( hash, &verts[ ctris[ j ] * 3 ], sizeof( float ) * 3 );
+  }
+
+  return hash;
+}
+
+void TiledNavmeshGenerator::freePreviousTiles()
+{
+  for( auto& tile : m_prevTiles )
+    dtFree( tile.data );
+
+  m_prevTiles.clear();
+  m_prevTileHashes.clear();
+}
+
+bool TiledNavmeshGenerator::loadPreviousNavmesh( const std::string& name )
+{
+  assert( m_mesh );
+
+  freePreviousTiles();
+
+  auto dir = fs::current_path().string() + "/pcb_export/" + name + "/";
+  auto fileName = dir + name + ".nav";
+  auto hashFileName = dir + name + ".navhash";
+
+  std::error_code e;
+  if( !fs::exists( fileName, e ) || !fs::exists( hashFileName, e ) )
+    return false;
+
+  const int tileCount = m_tilesX * m_tilesY;
+
+  FILE* fp = fopen( hashFileName.c_str(), "rb" );
+  if( !fp )
+    return false;
+
+  TileHashHeader hashHeader{};
+  if( fread( &hashHeader, sizeof( hashHeader ), 1, fp ) != 1 ||
+      hashHeader.magic != TILEHASH_MAGIC || hashHeader.version != TILEHASH_VERSION ||
+      hashHeader.tilesX != m_tilesX || hashHeader.tilesY != m_tilesY )
+  {
+    // the grid changed, every tile has to be rebuilt anyway
+    fclose( fp );
+    return false;
+  }
+
+  m_prevTileHashes.resize( tileCount );
+  bool ok = fread( m_prevTileHashes.data(), sizeof( uint64_t ), tileCount, fp ) == static_cast< size_t >( tileCount );
+  fclose( fp );
+
+  if( !ok )
+  {
+    m_prevTileHashes.clear();
+    return false;
+  }
+
+  fp = fopen( fileName.c_str(), "rb" );
+  if( !fp )
+  {
+    m_prevTileHashes.clear();
+    return false;
+  }
+
+  dtNavMeshParams params;
+  getNavmeshParams( params );
+
+  NavMeshSetHeader header{};
+  ok = fread( &header, sizeof( header ), 1, fp ) == 1 &&
+       header.magic == NAVMESHSET_MAGIC && header.version == NAVMESHSET_VERSION &&
+       memcmp( &header.params, &params, sizeof( params ) ) == 0;
+
+  m_prevTiles.resize( tileCount );
+
+  for( int i = 0; ok && i < header.numTiles; ++i )
+  {
+    NavMeshTileHeader tileHeader{};
+    if( fread( &tileHeader, sizeof( tileHeader ), 1, fp ) != 1 ||
+        tileHeader.dataSize < static_cast< int >( sizeof( dtMeshHeader ) ) )
+    {
+      ok = false;
+      break;
+    }
+
+    auto data = static_cast< unsigned char* >( dtAlloc( tileHeader.dataSize, DT_ALLOC_PERM ) );
+    if( !data || fread( data, tileHeader.dataSize, 1, fp ) != 1 )
+    {
+      dtFree( data );
+      ok = false;
+      break;
+    }
+
+    auto meshHeader = reinterpret_cast< const dtMeshHeader* >( data );
+    if( meshHeader->x < 0 || meshHeader->x >= m_tilesX || meshHeader->y < 0 || meshHeader->y >= m_tilesY )
+    {
+      dtFree( data );
+      ok = false;
+      break;
+    }
+
+    auto& tile = m_prevTiles[ meshHeader->y * m_tilesX + meshHeader->x ];
+    dtFree( tile.data );
+    tile.data = data;
+    tile.dataSize = tileHeader.dataSize;
+  }
+
+  fclose( fp );
+
+  if( !ok )
+  {
+    printf( "[Navmesh] Ignoring previous navmesh '%s', rebuilding all tiles\n",
+            fileName.substr( fileName.find( "pcb_export" ) - 1 ).c_str() );
+    freePreviousTiles();
+    return false;
+  }
+
+  return true;
+}
+
 void TiledNavmeshGenerator::saveNavmesh( const std::string& name )
 {
   assert( m_navMesh );
@@ -112,6 +336,7 @@ void TiledNavmeshGenerator::saveNavmesh( const std::string& name )
 
   auto dir = fs::current_path().string() + "/pcb_export/" + name + "/";
   auto fileName = dir + name + ".nav";
+  auto hashFileName = dir + name + ".navhash";
 
   fs::create_directories( dir );
 
@@ -124,42 +349,65 @@ void TiledNavmeshGenerator::saveNavmesh( const std::string& name )
   header.magic = NAVMESHSET_MAGIC;
   header.version = NAVMESHSET_VERSION;
   header.numTiles = 0;
-  for( int i = 0; i < mesh->getMaxTiles(); ++i )
+  for( int y = 0; y < m_tilesY; ++y )
   {
-    auto tile = mesh->getTile( i );
-    if( !tile || !tile->header || !tile->dataSize )
-      continue;
+    for( int x = 0; x < m_tilesX; ++x )
+    {
+      auto tile = mesh->getTileAt( x, y, 0 );
+      if( !tile || !tile->header || !tile->dataSize )
+        continue;
 
-    header.numTiles++;
+      header.numTiles++;
+    }
   }
 
   memcpy( &header.params, mesh->getParams(), sizeof( dtNavMeshParams ) );
   fwrite( &header, sizeof( NavMeshSetHeader ), 1, fp );
 
-  // Store tiles.
-  for( int i = 0; i < mesh->getMaxTiles(); ++i )
+  // Store tiles in y/x order so the file only changes where the geometry did, independent of build order.
+  for( int y = 0; y < m_tilesY; ++y )
   {
-    auto tile = mesh->getTile( i );
-    if( !tile || !tile->header || !tile->dataSize )
-      continue;
+    for( int x = 0; x < m_tilesX; ++x )
+    {
+      auto tile = mesh->getTileAt( x, y, 0 );
+      if( !tile || !tile->header || !tile->dataSize )
+        continue;
 
-    NavMeshTileHeader tileHeader;
-    tileHeader.tileRef = mesh->getTileRef( tile );
-    tileHeader.dataSize = tile->dataSize;
-    fwrite( &tileHeader, sizeof( tileHeader ), 1, fp );
+      NavMeshTileHeader tileHeader;
+      tileHeader.tileRef = mesh->getTileRef( tile );
+      tileHeader.dataSize = tile->dataSize;
+      fwrite( &tileHeader, sizeof( tileHeader ), 1, fp );
 
-    fwrite( tile->data, tile->dataSize, 1, fp );
+      fwrite( tile->data, tile->dataSize, 1, fp );
+    }
   }
 
   fclose( fp );
 
+  // the hashes have to match the tiles written above, so only store them after a successful build
+  if( m_tileHashes.size() == static_cast< size_t >( m_tilesX * m_tilesY ) )
+  {
+    fp = fopen( hashFileName.c_str(), "wb" );
+    if( fp )
+    {
+      TileHashHeader hashHeader;
+      hashHeader.magic = TILEHASH_MAGIC;
+      hashHeader.version = TILEHASH_VERSION;
+      hashHeader.tilesX = m_tilesX;
+      hashHeader.tilesY = m_tilesY;
+      fwrite( &hashHeader, sizeof( hashHeader ), 1, fp );
+      fwrite( m_tileHashes.data(), sizeof( uint64_t ), m_tileHashes.size(), fp );
+      fclose( fp );
+    }
+  }
+
   auto pos = fileName.find( "pcb_export" );
   fileName = fileName.substr( pos - 1 );
 
   printf( "[Navmesh] Saved navmesh to '%s'\n", fileName.c_str() );
 }
 
-bool TiledNavmeshGenerator::buildNavmesh()
+bool TiledNavmeshGenerator::buildNavmesh( unsigned int threadCount )
 {
   assert( m_mesh );
 
@@ -170,12 +418,8 @@ bool TiledNavmeshGenerator::buildNavmesh()
     return false;
   }
 
-  dtNavMeshParams params{};
-  rcVcopy( params.orig, m_meshBMin );
-  params.tileWidth = m_tileSize * m_cellSize;
-  params.tileHeight = m_tileSize * m_cellSize;
-  params.maxTiles = m_maxTiles;
-  params.maxPolys = m_maxPolysPerTile;
+  dtNavMeshParams params;
+  getNavmeshParams( params );
 
   dtStatus status;
 
@@ -196,75 +440,112 @@ bool TiledNavmeshGenerator::buildNavmesh()
     return false;
   }
 
-  // todo: duplicated from above, we can probably cache all this and only do it once
-  int gw = 0, gh = 0;
-  rcCalcGridSize( m_meshBMin, m_meshBMax, m_cellSize, &gw, &gh );
-  auto ts = static_cast< uint32_t >( m_tileSize );
-  const int tw = ( gw + ts - 1 ) / ts;
-  const int th = ( gh + ts - 1 ) / ts;
-  const float tcs = m_tileSize * m_cellSize;
+  const int tileCount = m_tilesX * m_tilesY;
+
+  m_tileHashes.assign( tileCount, 0 );
+  std::vector< TileData > tiles( tileCount );
 
-  for( int y = 0; y < th; y++ )
+  if( threadCount == 0 )
+    threadCount = std::max( 1u, std::thread::hardware_concurrency() );
+  threadCount = std::min( threadCount, static_cast< unsigned int >( std::max( tileCount, 1 ) ) );
+
+  // tiles are handed out one at a time, neighbouring tiles differ a lot in cost
+  std::atomic< int > nextTile( 0 );
+  std::atomic< int > reusedTiles( 0 );
+
+  auto buildTiles = [ & ]()
   {
-    for( int x = 0; x < tw; x++ )
-    {
-      m_lastBuiltTileBmin[ 0 ] = m_meshBMin[ 0 ] + x * tcs;
-      m_lastBuiltTileBmin[ 1 ] = m_meshBMin[ 1 ];
-      m_lastBuiltTileBmin[ 2 ] = m_meshBMin[ 2 ] + y * tcs;
+    TileBuildContext buildCtx;
 
-      m_lastBuiltTileBmax[ 0 ] = m_meshBMin[ 0 ] + ( x + 1 ) * tcs;
-      m_lastBuiltTileBmax[ 1 ] = m_meshBMax[ 1 ];
-      m_lastBuiltTileBmax[ 2 ] = m_meshBMin[ 2 ] + ( y + 1 ) * tcs;
+    for( int i = nextTile++; i < tileCount; i = nextTile++ )
+    {
+      const int x = i % m_tilesX;
+      const int y = i / m_tilesX;
 
-      int dataSize = 0;
+      m_tileHashes[ i ] = hashTileInput( x, y );
 
-      unsigned char* data = buildTileMesh( x, y, m_lastBuiltTileBmin, m_lastBuiltTileBmax, dataSize );
-      if( data )
+      // input geometry is the same as last time, keep the old tile (or the lack of one)
+      if( !m_prevTileHashes.empty() && m_prevTileHashes[ i ] == m_tileHashes[ i ] )
       {
-        // Remove any previous data (navmesh owns and deletes the data).
-        m_navMesh->removeTile( m_navMesh->getTileRefAt( x, y, 0 ), nullptr, nullptr );
+        std::swap( tiles[ i ], m_prevTiles[ i ] );
+        reusedTiles++;
+        continue;
+      }
 
-        // Let the navmesh own the data.
-        status = m_navMesh->addTile( data, dataSize, DT_TILE_FREE_DATA, 0, nullptr );
+      float bmin[ 3 ];
+      float bmax[ 3 ];
+      getTileBounds( x, y, bmin, bmax );
 
-        if( dtStatusFailed( status ) )
-        {
-          dtFree( data );
-        }
-      }
+      tiles[ i ].data = buildTileMesh( buildCtx, x, y, bmin, bmax, tiles[ i ].dataSize );
+    }
+  };
+
+  std::vector< std::thread > workers;
+  for( unsigned int i = 1; i < threadCount; ++i )
+    workers.emplace_back( buildTiles );
+
+  buildTiles();
+
+  for( auto& worker : workers )
+    worker.join();
+
+  // add tiles in y/x order, tile slots and refs then come out the same no matter which thread finished first
+  for( int i = 0; i < tileCount; ++i )
+  {
+    auto& tile = tiles[ i ];
+    if( !tile.data )
+      continue;
+
+    // Let the navmesh own the data.
+    status = m_navMesh->addTile( tile.data, tile.dataSize, DT_TILE_FREE_DATA, 0, nullptr );
+
+    if( dtStatusFailed( status ) )
+    {
+      dtFree( tile.data );
     }
   }
 
+  // tiles of the previous export which got rebuilt
+  freePreviousTiles();
+
+  printf( "[Navmesh]  - Built %d tiles on %u threads, reused %d unchanged\n", tileCount - reusedTiles.load(),
+          threadCount, reusedTiles.load() );
+
   return true;
 }
 
 
-unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty, const float* bmin, const float* bmax,
-                                                     int& dataSize )
+unsigned char* TiledNavmeshGenerator::buildTileMesh( TileBuildContext& buildCtx, const int tx, const int ty,
+                                                     const float* bmin, const float* bmax, int& dataSize ) const
 {
   const float* verts = m_mesh->getVerts();
   const int nverts = m_mesh->getVertCount();
-  const int ntris = m_mesh->getTriCount();
+
+  // drop whatever the previous tile on this context left behind on an early return
+  buildCtx.reset();
+
+  rcContext* ctx = &buildCtx.ctx;
+  rcConfig& cfg = buildCtx.cfg;
 
   // Init build configuration from GUI
-  memset( &m_cfg, 0, sizeof( m_cfg ) );
-  m_cfg.cs = m_cellSize;
-  m_cfg.ch = m_cellHeight;
-  m_cfg.walkableSlopeAngle = m_agentMaxSlope;
-  m_cfg.walkableHeight = static_cast< int >( ceilf( m_agentHeight / m_cfg.ch ) );
-  m_cfg.walkableClimb = static_cast< int >( floorf( m_agentMaxClimb / m_cfg.ch ) );
-  m_cfg.walkableRadius = static_cast< int >( ceilf( m_agentRadius / m_cfg.cs ) );
-  m_cfg.maxEdgeLen = static_cast< int >( m_edgeMaxLen / m_cellSize );
-  m_cfg.maxSimplificationError = m_edgeMaxError;
-  m_cfg.minRegionArea = static_cast< int >( rcSqr( m_regionMinSize ) ); // Note: area = size*size
-  m_cfg.mergeRegionArea = static_cast< int >( rcSqr( m_regionMergeSize ) ); // Note: area = size*size
-  m_cfg.maxVertsPerPoly = static_cast< int >( m_vertsPerPoly );
-  m_cfg.tileSize = static_cast< int >( m_tileSize );
-  m_cfg.borderSize = m_cfg.walkableRadius + 3; // Reserve enough padding.
-  m_cfg.width = m_cfg.tileSize + m_cfg.borderSize * 2;
-  m_cfg.height = m_cfg.tileSize + m_cfg.borderSize * 2;
-  m_cfg.detailSampleDist = m_detailSampleDist < 0.9f ? 0 : m_cellSize * m_detailSampleDist;
-  m_cfg.detailSampleMaxError = m_cellHeight * m_detailSampleMaxError;
+  memset( &cfg, 0, sizeof( cfg ) );
+  cfg.cs = m_cellSize;
+  cfg.ch = m_cellHeight;
+  cfg.walkableSlopeAngle = m_agentMaxSlope;
+  cfg.walkableHeight = static_cast< int >( ceilf( m_agentHeight / cfg.ch ) );
+  cfg.walkableClimb = static_cast< int >( floorf( m_agentMaxClimb / cfg.ch ) );
+  cfg.walkableRadius = static_cast< int >( ceilf( m_agentRadius / cfg.cs ) );
+  cfg.maxEdgeLen = static_cast< int >( m_edgeMaxLen / m_cellSize );
+  cfg.maxSimplificationError = m_edgeMaxError;
+  cfg.minRegionArea = static_cast< int >( rcSqr( m_regionMinSize ) ); // Note: area = size*size
+  cfg.mergeRegionArea = static_cast< int >( rcSqr( m_regionMergeSize ) ); // Note: area = size*size
+  cfg.maxVertsPerPoly = static_cast< int >( m_vertsPerPoly );
+  cfg.tileSize = static_cast< int >( m_tileSize );
+  cfg.borderSize = cfg.walkableRadius + 3; // Reserve enough padding.
+  cfg.width = cfg.tileSize + cfg.borderSize * 2;
+  cfg.height = cfg.tileSize + cfg.borderSize * 2;
+  cfg.detailSampleDist = m_detailSampleDist < 0.9f ? 0 : m_cellSize * m_detailSampleDist;
+  cfg.detailSampleMaxError = m_cellHeight * m_detailSampleMaxError;
 
   // Expand the heighfield bounding box by border size to find the extents of geometry we need to build this tile.
   //
@@ -287,21 +568,21 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   // For example if you build a navmesh for terrain, and want the navmesh tiles to match the terrain tile size
   // you will need to pass in data from neighbour terrain tiles too! In a simple case, just pass in all the 8 neighbours,
   // or use the bounding box below to only pass in a sliver of each of the 8 neighbours.
-  rcVcopy( m_cfg.bmin, bmin );
-  rcVcopy( m_cfg.bmax, bmax );
-  m_cfg.bmin[ 0 ] -= m_cfg.borderSize * m_cfg.cs;
-  m_cfg.bmin[ 2 ] -= m_cfg.borderSize * m_cfg.cs;
-  m_cfg.bmax[ 0 ] += m_cfg.borderSize * m_cfg.cs;
-  m_cfg.bmax[ 2 ] += m_cfg.borderSize * m_cfg.cs;
-
-  m_solid = rcAllocHeightfield();
-  if( !m_solid )
+  rcVcopy( cfg.bmin, bmin );
+  rcVcopy( cfg.bmax, bmax );
+  cfg.bmin[ 0 ] -= cfg.borderSize * cfg.cs;
+  cfg.bmin[ 2 ] -= cfg.borderSize * cfg.cs;
+  cfg.bmax[ 0 ] += cfg.borderSize * cfg.cs;
+  cfg.bmax[ 2 ] += cfg.borderSize * cfg.cs;
+
+  buildCtx.solid = rcAllocHeightfield();
+  if( !buildCtx.solid )
   {
     printf( "[Navmesh] buildNavigation: Out of memory 'solid'.\n" );
     return nullptr;
   }
 
-  if( !rcCreateHeightfield( m_ctx, *m_solid, m_cfg.width, m_cfg.height, m_cfg.bmin, m_cfg.bmax, m_cfg.cs, m_cfg.ch ) )
+  if( !rcCreateHeightfield( ctx, *buildCtx.solid, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch ) )
   {
     printf( "[Navmesh] buildNavigation: Could not create solid heightfield.\n" );
     return nullptr;
@@ -310,27 +591,16 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   // Allocate array that can hold triangle flags.
   // If you have multiple meshes you need to process, allocate
   // and array which can hold the max number of triangles you need to process.
-  m_triareas = new unsigned char[ m_chunkyMesh->maxTrisPerChunk ];
-  if( !m_triareas )
-  {
-    printf( "[Navmesh] buildNavigation: Out of memory 'm_triareas' (%d).\n", m_chunkyMesh->maxTrisPerChunk );
-    return nullptr;
-  }
-
-  float tbmin[ 2 ];
-  float tbmax[ 2 ];
-  tbmin[ 0 ] = m_cfg.bmin[ 0 ];
-  tbmin[ 1 ] = m_cfg.bmin[ 2 ];
-  tbmax[ 0 ] = m_cfg.bmax[ 0 ];
-  tbmax[ 1 ] = m_cfg.bmax[ 2 ];
+  buildCtx.triareas.resize( m_chunkyMesh->maxTrisPerChunk );
+  auto triareas = buildCtx.triareas.data();
 
   int cid[512];// TODO: Make grow when returning too many items.
-  const int ncid = rcGetChunksOverlappingRect( m_chunkyMesh, tbmin, tbmax, cid, 512 );
+  const int ncid = getTileChunks( cfg.bmin, cfg.bmax, cid, 512 );
 
   if( !ncid )
     return nullptr;
 
-  m_tileTriCount = 0;
+  buildCtx.tileTriCount = 0;
 
   for( int i = 0; i < ncid; ++i )
   {
@@ -338,44 +608,41 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
     const int* ctris = &m_chunkyMesh->tris[ node.i * 3 ];
     const int nctris = node.n;
 
-    m_tileTriCount += nctris;
+    buildCtx.tileTriCount += nctris;
 
-    memset( m_triareas, 0, nctris * sizeof( unsigned char ) );
-    rcMarkWalkableTriangles( m_ctx, m_cfg.walkableSlopeAngle, verts, nverts, ctris, nctris, m_triareas );
-    if( !rcRasterizeTriangles( m_ctx, verts, nverts, ctris, m_triareas, nctris, *m_solid, m_cfg.walkableClimb ) )
+    memset( triareas, 0, nctris * sizeof( unsigned char ) );
+    rcMarkWalkableTriangles( ctx, cfg.walkableSlopeAngle, verts, nverts, ctris, nctris, triareas );
+    if( !rcRasterizeTriangles( ctx, verts, nverts, ctris, triareas, nctris, *buildCtx.solid, cfg.walkableClimb ) )
       return nullptr;
   }
 
-  delete[] m_triareas;
-  m_triareas = nullptr;
-
   // Once all geometry is rasterized, we do initial pass of filtering to
   // remove unwanted overhangs caused by the conservative rasterization
   // as well as filter spans where the character cannot possibly stand.
-  rcFilterLowHangingWalkableObstacles( m_ctx, m_cfg.walkableClimb, *m_solid );
-  rcFilterLedgeSpans( m_ctx, m_cfg.walkableHeight, m_cfg.walkableClimb, *m_solid );
-  rcFilterWalkableLowHeightSpans( m_ctx, m_cfg.walkableHeight, *m_solid );
+  rcFilterLowHangingWalkableObstacles( ctx, cfg.walkableClimb, *buildCtx.solid );
+  rcFilterLedgeSpans( ctx, cfg.walkableHeight, cfg.walkableClimb, *buildCtx.solid );
+  rcFilterWalkableLowHeightSpans( ctx, cfg.walkableHeight, *buildCtx.solid );
 
   // Compact the heightfield so that it is faster to handle from now on.
   // This will result more cache coherent data as well as the neighbours
   // between walkable cells will be calculated.
-  m_chf = rcAllocCompactHeightfield();
-  if( !m_chf )
+  buildCtx.chf = rcAllocCompactHeightfield();
+  if( !buildCtx.chf )
   {
     printf( "[Navmesh] buildNavigation: Out of memory 'chf'." );
     return nullptr;
   }
-  if( !rcBuildCompactHeightfield( m_ctx, m_cfg.walkableHeight, m_cfg.walkableClimb, *m_solid, *m_chf ) )
+  if( !rcBuildCompactHeightfield( ctx, cfg.walkableHeight, cfg.walkableClimb, *buildCtx.solid, *buildCtx.chf ) )
   {
     printf( "[Navmesh] buildNavigation: Could not build compact data." );
     return nullptr;
   }
 
-  rcFreeHeightField( m_solid );
-  m_solid = nullptr;
+  rcFreeHeightField( buildCtx.solid );
+  buildCtx.solid = nullptr;
 
   // Erode the walkable area by agent radius.
-  if( !rcErodeWalkableArea( m_ctx, m_cfg.walkableRadius, *m_chf ) )
+  if( !rcErodeWalkableArea( ctx, cfg.walkableRadius, *buildCtx.chf ) )
   {
     printf( "[Navmesh] buildNavigation: Could not erode." );
     return nullptr;
@@ -384,7 +651,7 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   // (Optional) Mark areas.
 //  const ConvexVolume* vols = m_mesh->getConvexVolumes();
 //  for (int i  = 0; i < m_geom->getConvexVolumeCount(); ++i)
-//    rcMarkConvexPolyArea(m_ctx, vols[i].verts, vols[i].nverts, vols[i].hmin, vols[i].hmax, (unsigned char)vols[i].area, *m_chf);
+//    rcMarkConvexPolyArea(ctx, vols[i].verts, vols[i].nverts, vols[i].hmin, vols[i].hmax, (unsigned char)vols[i].area, *buildCtx.chf);
 
   // Partition the heightfield so that we can use simple algorithm later to triangulate the walkable areas.
   // There are 3 martitioning methods, each with some pros and cons:
@@ -415,14 +682,14 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   if( m_partitionType == SAMPLE_PARTITION_WATERSHED )
   {
     // Prepare for region partitioning, by calculating distance field along the walkable surface.
-    if( !rcBuildDistanceField( m_ctx, *m_chf ) )
+    if( !rcBuildDistanceField( ctx, *buildCtx.chf ) )
     {
       printf( "[Navmesh] buildNavigation: Could not build distance field." );
       return nullptr;
     }
 
     // Partition the walkable surface into simple regions without holes.
-    if( !rcBuildRegions( m_ctx, *m_chf, m_cfg.borderSize, m_cfg.minRegionArea, m_cfg.mergeRegionArea ) )
+    if( !rcBuildRegions( ctx, *buildCtx.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea ) )
     {
       printf( "[Navmesh] buildNavigation: Could not build watershed regions." );
       return nullptr;
@@ -432,7 +699,7 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   {
     // Partition the walkable surface into simple regions without holes.
     // Monotone partitioning does not need distancefield.
-    if( !rcBuildRegionsMonotone( m_ctx, *m_chf, m_cfg.borderSize, m_cfg.minRegionArea, m_cfg.mergeRegionArea ) )
+    if( !rcBuildRegionsMonotone( ctx, *buildCtx.chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea ) )
     {
       printf( "[Navmesh] buildNavigation: Could not build monotone regions." );
       return nullptr;
@@ -441,7 +708,7 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   else // SAMPLE_PARTITION_LAYERS
   {
     // Partition the walkable surface into simple regions without holes.
-    if( !rcBuildLayerRegions( m_ctx, *m_chf, m_cfg.borderSize, m_cfg.minRegionArea ) )
+    if( !rcBuildLayerRegions( ctx, *buildCtx.chf, cfg.borderSize, cfg.minRegionArea ) )
     {
       printf( "[Navmesh] buildNavigation: Could not build layer regions." );
       return nullptr;
@@ -449,104 +716,104 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
   }
 
   // Create contours.
-  m_cset = rcAllocContourSet();
-  if( !m_cset )
+  buildCtx.cset = rcAllocContourSet();
+  if( !buildCtx.cset )
   {
     printf( "[Navmesh] buildNavigation: Out of memory 'cset'." );
     return nullptr;
   }
-  if( !rcBuildContours( m_ctx, *m_chf, m_cfg.maxSimplificationError, m_cfg.maxEdgeLen, *m_cset ) )
+  if( !rcBuildContours( ctx, *buildCtx.chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *buildCtx.cset ) )
   {
     printf( "[Navmesh] buildNavigation: Could not create contours." );
     return nullptr;
   }
 
-  if( m_cset->nconts == 0 )
+  if( buildCtx.cset->nconts == 0 )
   {
     return nullptr;
   }
 
   // Build polygon navmesh from the contours.
-  m_pmesh = rcAllocPolyMesh();
-  if( !m_pmesh )
+  buildCtx.pmesh = rcAllocPolyMesh();
+  if( !buildCtx.pmesh )
   {
     printf( "[Navmesh] buildNavigation: Out of memory 'pmesh'." );
     return nullptr;
   }
-  if( !rcBuildPolyMesh( m_ctx, *m_cset, m_cfg.maxVertsPerPoly, *m_pmesh ) )
+  if( !rcBuildPolyMesh( ctx, *buildCtx.cset, cfg.maxVertsPerPoly, *buildCtx.pmesh ) )
   {
     printf( "[Navmesh] buildNavigation: Could not triangulate contours." );
     return nullptr;
   }
 
   // Build detail mesh.
-  m_dmesh = rcAllocPolyMeshDetail();
-  if( !m_dmesh )
+  buildCtx.dmesh = rcAllocPolyMeshDetail();
+  if( !buildCtx.dmesh )
   {
     printf( "[Navmesh] buildNavigation: Out of memory 'dmesh'." );
     return nullptr;
   }
 
-  if( !rcBuildPolyMeshDetail( m_ctx, *m_pmesh, *m_chf,
-                              m_cfg.detailSampleDist, m_cfg.detailSampleMaxError,
-                              *m_dmesh ) )
+  if( !rcBuildPolyMeshDetail( ctx, *buildCtx.pmesh, *buildCtx.chf,
+                              cfg.detailSampleDist, cfg.detailSampleMaxError,
+                              *buildCtx.dmesh ) )
   {
     printf( "[Navmesh] buildNavigation: Could build polymesh detail." );
     return nullptr;
   }
 
-  rcFreeCompactHeightfield( m_chf );
-  rcFreeContourSet( m_cset );
-  m_chf = nullptr;
-  m_cset = nullptr;
+  rcFreeCompactHeightfield( buildCtx.chf );
+  rcFreeContourSet( buildCtx.cset );
+  buildCtx.chf = nullptr;
+  buildCtx.cset = nullptr;
 
   unsigned char* navData = 0;
   int navDataSize = 0;
-  if( m_cfg.maxVertsPerPoly <= DT_VERTS_PER_POLYGON )
+  if( cfg.maxVertsPerPoly <= DT_VERTS_PER_POLYGON )
   {
-    if( m_pmesh->nverts >= 0xffff )
+    if( buildCtx.pmesh->nverts >= 0xffff )
     {
       // The vertex indices are ushorts, and cannot point to more than 0xffff vertices.
-      printf( "[Navmesh] Too many vertices per tile %d (max: %d).", m_pmesh->nverts, 0xffff );
+      printf( "[Navmesh] Too many vertices per tile %d (max: %d).", buildCtx.pmesh->nverts, 0xffff );
       return nullptr;
     }
 
     // Update poly flags from areas.
-    for( int i = 0; i < m_pmesh->npolys; ++i )
+    for( int i = 0; i < buildCtx.pmesh->npolys; ++i )
     {
-      if( m_pmesh->areas[ i ] == RC_WALKABLE_AREA )
-        m_pmesh->areas[ i ] = SAMPLE_POLYAREA_GROUND;
+      if( buildCtx.pmesh->areas[ i ] == RC_WALKABLE_AREA )
+        buildCtx.pmesh->areas[ i ] = SAMPLE_POLYAREA_GROUND;
 
-      if( m_pmesh->areas[ i ] == SAMPLE_POLYAREA_GROUND ||
-          m_pmesh->areas[ i ] == SAMPLE_POLYAREA_GRASS ||
-          m_pmesh->areas[ i ] == SAMPLE_POLYAREA_ROAD )
+      if( buildCtx.pmesh->areas[ i ] == SAMPLE_POLYAREA_GROUND ||
+          buildCtx.pmesh->areas[ i ] == SAMPLE_POLYAREA_GRASS ||
+          buildCtx.pmesh->areas[ i ] == SAMPLE_POLYAREA_ROAD )
       {
-        m_pmesh->flags[ i ] = SAMPLE_POLYFLAGS_WALK;
+        buildCtx.pmesh->flags[ i ] = SAMPLE_POLYFLAGS_WALK;
       }
-      else if( m_pmesh->areas[ i ] == SAMPLE_POLYAREA_WATER )
+      else if( buildCtx.pmesh->areas[ i ] == SAMPLE_POLYAREA_WATER )
       {
-        m_pmesh->flags[ i ] = SAMPLE_POLYFLAGS_SWIM;
+        buildCtx.pmesh->flags[ i ] = SAMPLE_POLYFLAGS_SWIM;
       }
-      else if( m_pmesh->areas[ i ] == SAMPLE_POLYAREA_DOOR )
+      else if( buildCtx.pmesh->areas[ i ] == SAMPLE_POLYAREA_DOOR )
       {
-        m_pmesh->flags[ i ] = SAMPLE_POLYFLAGS_WALK | SAMPLE_POLYFLAGS_DOOR;
+        buildCtx.pmesh->flags[ i ] = SAMPLE_POLYFLAGS_WALK | SAMPLE_POLYFLAGS_DOOR;
       }
     }
 
     dtNavMeshCreateParams params;
     memset( &params, 0, sizeof( params ) );
-    params.verts = m_pmesh->verts;
-    params.vertCount = m_pmesh->nverts;
-    params.polys = m_pmesh->polys;
-    params.polyAreas = m_pmesh->areas;
-    params.polyFlags = m_pmesh->flags;
-    params.polyCount = m_pmesh->npolys;
-    params.nvp = m_pmesh->nvp;
-    params.detailMeshes = m_dmesh->meshes;
-    params.detailVerts = m_dmesh->verts;
-    params.detailVertsCount = m_dmesh->nverts;
-    params.detailTris = m_dmesh->tris;
-    params.detailTriCount = m_dmesh->ntris;
+    params.verts = buildCtx.pmesh->verts;
+    params.vertCount = buildCtx.pmesh->nverts;
+    params.polys = buildCtx.pmesh->polys;
+    params.polyAreas = buildCtx.pmesh->areas;
+    params.polyFlags = buildCtx.pmesh->flags;
+    params.polyCount = buildCtx.pmesh->npolys;
+    params.nvp = buildCtx.pmesh->nvp;
+    params.detailMeshes = buildCtx.dmesh->meshes;
+    params.detailVerts = buildCtx.dmesh->verts;
+    params.detailVertsCount = buildCtx.dmesh->nverts;
+    params.detailTris = buildCtx.dmesh->tris;
+    params.detailTriCount = buildCtx.dmesh->ntris;
 
     params.offMeshConVerts = nullptr;
     params.offMeshConRad = nullptr;
@@ -562,10 +829,10 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
     params.tileX = tx;
     params.tileY = ty;
     params.tileLayer = 0;
-    rcVcopy( params.bmin, m_pmesh->bmin );
-    rcVcopy( params.bmax, m_pmesh->bmax );
-    params.cs = m_cfg.cs;
-    params.ch = m_cfg.ch;
+    rcVcopy( params.bmin, buildCtx.pmesh->bmin );
+    rcVcopy( params.bmax, buildCtx.pmesh->bmax );
+    params.cs = cfg.cs;
+    params.ch = cfg.ch;
     params.buildBvTree = true;
 
     if( !dtCreateNavMeshData( &params, &navData, &navDataSize ) )
@@ -575,10 +842,10 @@ unsigned char* TiledNavmeshGenerator::buildTileMesh( const int tx, const int ty,
     }
   }
 
-  rcFreePolyMesh( m_pmesh );
-  rcFreePolyMeshDetail( m_dmesh );
-  m_pmesh = nullptr;
-  m_dmesh = nullptr;
+  rcFreePolyMesh( buildCtx.pmesh );
+  rcFreePolyMeshDetail( buildCtx.dmesh );
+  buildCtx.pmesh = nullptr;
+  buildCtx.dmesh = nullptr;
 
   dataSize = navDataSize;
   return navData;
@@ -4,6 +4,8 @@
 #include <string>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "ext/MeshLoaderObj.h"
 #include "ext/ChunkyTriMesh.h"
@@ -58,45 +60,96 @@ public:
     int dataSize;
   };
 
+  // <name>.navhash next to the .nav, input geometry hash of every tile in y/x order
+  static const int TILEHASH_MAGIC = 'N'<<24 | 'H'<<16 | 'S'<<8 | 'H'; //'NHSH';
+  static const int TILEHASH_VERSION = 1;
+
+  struct TileHashHeader
+  {
+    int magic;
+    int version;
+    int tilesX;
+    int tilesY;
+  };
+
+  /*!
+   * scratch data of a single tile build, every build thread owns one
+   * so tiles never share heightfields or contours
+   */
+  struct TileBuildContext
+  {
+    TileBuildContext();
+    ~TileBuildContext();
+
+    // frees the intermediate results of the last tile
+    void reset();
+
+    rcContext ctx;
+    rcConfig cfg;
+
+    rcHeightfield* solid;
+    rcCompactHeightfield* chf;
+    rcContourSet* cset;
+    rcPolyMesh* pmesh;
+    rcPolyMeshDetail* dmesh;
+
+    std::vector< unsigned char > triareas;
+    int tileTriCount;
+  };
 
   TiledNavmeshGenerator() = default;
   ~TiledNavmeshGenerator();
 
   bool init( const std::string& path );
-  unsigned char* buildTileMesh( const int tx, const int ty, const float* bmin, const float* bmax, int& dataSize );
-  bool buildNavmesh();
+  unsigned char* buildTileMesh( TileBuildContext& buildCtx, const int tx, const int ty,
+                                const float* bmin, const float* bmax, int& dataSize ) const;
+
+  /*!
+   * loads the tiles and tile hashes of a previous export of the zone,
+   * buildNavmesh then only rebuilds the tiles whose input geometry changed since
+   */
+  bool loadPreviousNavmesh( const std::string& name );
+
+  /*! builds all tiles on threadCount threads, 0 uses one per core */
+  bool buildNavmesh( unsigned int threadCount = 0 );
   void saveNavmesh( const std::string& name );
 
 private:
-  rcConfig m_cfg;
-
-  rcMeshLoaderObj* m_mesh;
-  rcChunkyTriMesh* m_chunkyMesh;
+  struct TileData
+  {
+    unsigned char* data = nullptr;
+    int dataSize = 0;
+  };
 
-  rcContext* m_ctx;
-  dtNavMesh* m_navMesh;
-  dtNavMeshQuery* m_navQuery;
-  rcHeightfield* m_solid;
-  rcContourSet* m_cset;
-  rcPolyMesh* m_pmesh;
-  rcPolyMeshDetail* m_dmesh;
+  void getNavmeshParams( dtNavMeshParams& params ) const;
+  void getTileBounds( int tx, int ty, float* bmin, float* bmax ) const;
+  int getTileChunks( const float* bmin, const float* bmax, int* chunkIds, int maxChunks ) const;
+  uint64_t hashTileInput( int tx, int ty ) const;
+  void freePreviousTiles();
 
-  rcCompactHeightfield* m_chf;
+  rcMeshLoaderObj* m_mesh = nullptr;
+  rcChunkyTriMesh* m_chunkyMesh = nullptr;
 
-  unsigned char* m_triareas;
+  dtNavMesh* m_navMesh = nullptr;
+  dtNavMeshQuery* m_navQuery = nullptr;
 
   int m_maxTiles = 0;
   int m_maxPolysPerTile = 0;
 
-  int m_tileTriCount = 0;
+  int m_tilesX = 0;
+  int m_tilesY = 0;
 
   int m_partitionType = SamplePartitionType::SAMPLE_PARTITION_WATERSHED;
 
   float m_meshBMin[ 3 ];
   float m_meshBMax[ 3 ];
 
-  float m_lastBuiltTileBmin[ 3 ];
-  float m_lastBuiltTileBmax[ 3 ];
+  // input geometry hash of every tile in y/x order, saved next to the navmesh
+  std::vector< uint64_t > m_tileHashes;
+
+  // tiles and hashes of the previous export, empty if there is none or the grid changed
+  std::vector< uint64_t > m_prevTileHashes;
+  std::vector< TileData > m_prevTiles;
 
   // options
   float m_tileSize = 160.f;
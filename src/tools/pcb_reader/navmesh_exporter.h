@@ -41,6 +41,9 @@ public:
       return;
     }
 
+    // only tiles whose geometry changed since the last export are rebuilt
+    gen.loadPreviousNavmesh( zone.name );
+
     if( !gen.buildNavmesh() )
     {
       printf( "[Navmesh] Failed to build navmesh for '%s'\n", zone.name.c_str() );
@@ -80,6 +83,8 @@ public:
       return;
     }
 
+    gen.loadPreviousNavmesh( fileName );
+
     if( !gen.buildNavmesh() )
     {
       printf( "[Navmesh] Failed to build navmesh for '%s'\n", fileName.c_str() );
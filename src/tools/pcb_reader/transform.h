@@ -0,0 +1,159 @@
+#ifndef _TRANSFORM_H
+#define _TRANSFORM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define TRANSFORM_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "vec3.h"
+
+// 3x4 affine transform, rows are the output axes and the last column is the translation.
+// same convention as vec3 * matrix4, so a transform can replace a chain of those.
+struct affine3
+{
+  float m[ 3 ][ 4 ];
+
+  static affine3 identity()
+  {
+    return scaleOffset( vec3( 1.f, 1.f, 1.f ), vec3() );
+  }
+
+  static affine3 scaleOffset( const vec3& scale, const vec3& offset )
+  {
+    affine3 ret{};
+    ret.m[ 0 ][ 0 ] = scale.x;
+    ret.m[ 1 ][ 1 ] = scale.y;
+    ret.m[ 2 ][ 2 ] = scale.z;
+    ret.m[ 0 ][ 3 ] = offset.x;
+    ret.m[ 1 ][ 3 ] = offset.y;
+    ret.m[ 2 ][ 3 ] = offset.z;
+    return ret;
+  }
+
+  // scale, then rotate around x, y and z, then translate
+  static affine3 fromTransform( const vec3& scale, const vec3& rotation, const vec3& translation )
+  {
+    auto rot = matrix4::rotateZ( rotation.z ) * matrix4::rotateY( rotation.y ) * matrix4::rotateX( rotation.x );
+    const float s[ 3 ] = { scale.x, scale.y, scale.z };
+    const float t[ 3 ] = { translation.x, translation.y, translation.z };
+
+    affine3 ret{};
+    for( int row = 0; row < 3; ++row )
+    {
+      for( int col = 0; col < 3; ++col )
+        ret.m[ row ][ col ] = rot( row, col ) * s[ col ];
+      ret.m[ row ][ 3 ] = t[ row ];
+    }
+    return ret;
+  }
+
+  // applies rhs first, then this
+  affine3 operator*( const affine3& rhs ) const
+  {
+    affine3 ret{};
+    for( int row = 0; row < 3; ++row )
+    {
+      for( int col = 0; col < 4; ++col )
+      {
+        ret.m[ row ][ col ] = m[ row ][ 0 ] * rhs.m[ 0 ][ col ] +
+                              m[ row ][ 1 ] * rhs.m[ 1 ][ col ] +
+                              m[ row ][ 2 ] * rhs.m[ 2 ][ col ];
+      }
+      ret.m[ row ][ 3 ] += m[ row ][ 3 ];
+    }
+    return ret;
+  }
+
+  void apply( const float* in, float* out ) const
+  {
+    const float x = in[ 0 ], y = in[ 1 ], z = in[ 2 ];
+    out[ 0 ] = m[ 0 ][ 0 ] * x + m[ 0 ][ 1 ] * y + m[ 0 ][ 2 ] * z + m[ 0 ][ 3 ];
+    out[ 1 ] = m[ 1 ][ 0 ] * x + m[ 1 ][ 1 ] * y + m[ 1 ][ 2 ] * z + m[ 1 ][ 3 ];
+    out[ 2 ] = m[ 2 ][ 0 ] * x + m[ 2 ][ 1 ] * y + m[ 2 ][ 2 ] * z + m[ 2 ][ 3 ];
+  }
+};
+
+#ifdef TRANSFORM_SSE2
+namespace detail
+{
+  // a/b/c hold 4 packed xyz vertices, x/y/z one axis of each of them
+  inline void transformPacked( const affine3& t, __m128 a, __m128 b, __m128 c, float* out )
+  {
+    auto x = _mm_shuffle_ps( _mm_shuffle_ps( a, a, _MM_SHUFFLE( 3, 3, 0, 0 ) ),
+                             _mm_shuffle_ps( b, c, _MM_SHUFFLE( 1, 1, 2, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    auto y = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 1, 1 ) ),
+                             _mm_shuffle_ps( b, c, _MM_SHUFFLE( 2, 2, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+    auto z = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 1, 1, 2, 2 ) ),
+                             _mm_shuffle_ps( c, c, _MM_SHUFFLE( 3, 3, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+
+    __m128 res[ 3 ];
+    for( int row = 0; row < 3; ++row )
+    {
+      res[ row ] = _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, _mm_set1_ps( t.m[ row ][ 0 ] ) ),
+                                           _mm_mul_ps( y, _mm_set1_ps( t.m[ row ][ 1 ] ) ) ),
+                               _mm_add_ps( _mm_mul_ps( z, _mm_set1_ps( t.m[ row ][ 2 ] ) ),
+                                           _mm_set1_ps( t.m[ row ][ 3 ] ) ) );
+    }
+
+    auto& rx = res[ 0 ];
+    auto& ry = res[ 1 ];
+    auto& rz = res[ 2 ];
+    _mm_storeu_ps( out, _mm_shuffle_ps( _mm_shuffle_ps( rx, ry, _MM_SHUFFLE( 0, 0, 0, 0 ) ),
+                                        _mm_shuffle_ps( rz, rx, _MM_SHUFFLE( 1, 1, 0, 0 ) ),
+                                        _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    _mm_storeu_ps( out + 4, _mm_shuffle_ps( _mm_shuffle_ps( ry, rz, _MM_SHUFFLE( 1, 1, 1, 1 ) ),
+                                            _mm_shuffle_ps( rx, ry, _MM_SHUFFLE( 2, 2, 2, 2 ) ),
+                                            _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+    _mm_storeu_ps( out + 8, _mm_shuffle_ps( _mm_shuffle_ps( rz, rx, _MM_SHUFFLE( 3, 3, 2, 2 ) ),
+                                            _mm_shuffle_ps( ry, rz, _MM_SHUFFLE( 3, 3, 3, 3 ) ),
+                                            _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+  }
+}
+#endif
+
+// transforms count packed xyz float vertices from in to out, in and out may be the same buffer
+inline void transformVertices( const affine3& t, const float* in, float* out, size_t count )
+{
+  size_t i = 0;
+#ifdef TRANSFORM_SSE2
+  for( ; i + 4 <= count; i += 4 )
+  {
+    auto src = in + i * 3;
+    detail::transformPacked( t, _mm_loadu_ps( src ), _mm_loadu_ps( src + 4 ), _mm_loadu_ps( src + 8 ), out + i * 3 );
+  }
+#endif
+  for( ; i < count; ++i )
+    t.apply( in + i * 3, out + i * 3 );
+}
+
+// same for packed xyz uint16 vertices, fold the dequantization into t
+inline void transformVertices( const affine3& t, const uint16_t* in, float* out, size_t count )
+{
+  size_t i = 0;
+#ifdef TRANSFORM_SSE2
+  const auto zero = _mm_setzero_si128();
+  for( ; i + 4 <= count; i += 4 )
+  {
+    auto src = in + i * 3;
+    // 12 values, the second load only reads the 4 remaining ones so nothing past the vertices is touched
+    auto lo = _mm_loadu_si128( reinterpret_cast< const __m128i* >( src ) );
+    auto hi = _mm_loadl_epi64( reinterpret_cast< const __m128i* >( src + 8 ) );
+    detail::transformPacked( t, _mm_cvtepi32_ps( _mm_unpacklo_epi16( lo, zero ) ),
+                             _mm_cvtepi32_ps( _mm_unpackhi_epi16( lo, zero ) ),
+                             _mm_cvtepi32_ps( _mm_unpacklo_epi16( hi, zero ) ), out + i * 3 );
+  }
+#endif
+  for( ; i < count; ++i )
+  {
+    const float v[ 3 ] = { float( in[ i * 3 ] ), float( in[ i * 3 + 1 ] ), float( in[ i * 3 + 2 ] ) };
+    t.apply( v, out + i * 3 );
+  }
+}
+
+#endif
@@ -1,7 +1,5 @@
 #include "Action.h"
-#include "ActionLut.h"
 
-#include <Exd/ExdDataGenerated.h>
 #include <Util/Util.h>
 #include "Framework.h"
 #include "Script/ScriptMgr.h"
@@ -13,6 +11,8 @@
 
 #include "Territory/Zone.h"
 
+#include "Manager/CombatDataMgr.h"
+
 #include <Network/CommonActorControl.h>
 #include "Network/PacketWrappers/ActorControlPacket142.h"
 #include "Network/PacketWrappers/ActorControlPacket143.h"
@@ -34,14 +34,9 @@ Action::Action::Action() = default;
 Action::Action::~Action() = default;
 
 Action::Action::Action( Entity::CharaPtr caster, uint32_t actionId, FrameworkPtr fw ) :
-  Action( std::move( caster ), actionId, nullptr, std::move( fw ) )
-{
-}
-
-Action::Action::Action( Entity::CharaPtr caster, uint32_t actionId, Data::ActionPtr actionData, FrameworkPtr fw ) :
   m_pSource( std::move( caster ) ),
   m_pFw( std::move( fw ) ),
-  m_actionData( std::move( actionData ) ),
+  m_actionData( nullptr ),
   m_id( actionId ),
   m_targetId( 0 ),
   m_startTime( 0 ),
@@ -56,17 +51,12 @@ uint32_t Action::Action::getId() const
 
 bool Action::Action::init()
 {
-  if( !m_actionData )
-  {
-    // need to get actionData
-    auto exdData = m_pFw->get< Data::ExdDataGenerated >();
-    assert( exdData );
-
-    auto actionData = exdData->get< Data::Action >( m_id );
-    assert( actionData );
+  auto pCombatData = m_pFw->get< Manager::CombatDataMgr >();
+  assert( pCombatData );
 
-    m_actionData = actionData;
-  }
+  m_actionData = pCombatData->getAction( m_id );
+  if( !m_actionData )
+    return false;
 
   m_castTimeMs = static_cast< uint32_t >( m_actionData->cast100ms * 100 );
   m_recastTimeMs = static_cast< uint32_t >( m_actionData->recast100ms * 100 );
@@ -240,7 +230,7 @@ void Action::Action::start()
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
 
   // check the lut too and see if we have something usable, otherwise cancel the cast
-  if( !pScriptMgr->onStart( *this ) && !ActionLut::validEntryExists( getId() ) )
+  if( !pScriptMgr->onStart( *this ) && !m_actionData->hasLutEntry )
   {
     // script not implemented and insufficient lut data (no potencies)
     interrupt();
@@ -333,9 +323,9 @@ void Action::Action::execute()
     if( !m_hitActors.empty() )
     {
       // only call script if actors are hit
-      if( !pScriptMgr->onExecute( *this ) && ActionLut::validEntryExists( getId() ) )
+      if( !pScriptMgr->onExecute( *this ) && m_actionData->hasLutEntry )
       {
-        auto lutEntry = ActionLut::getEntry( getId() );
+        const auto& lutEntry = m_actionData->lutEntry;
 
         // no script exists but we have a valid lut entry
         if( auto player = getSourceChara()->getAsPlayer() )
@@ -390,10 +380,10 @@ bool Action::Action::playerPreCheck( Entity::Player& player )
   if( actionClass != Common::ClassJob::Adventurer && currentClass != actionClass )
   {
     // check if not a base class action
-    auto exdData = m_pFw->get< Data::ExdDataGenerated >();
-    assert( exdData );
+    auto pCombatData = m_pFw->get< Manager::CombatDataMgr >();
+    assert( pCombatData );
 
-    auto classJob = exdData->get< Data::ClassJob >( static_cast< uint8_t >( currentClass ) );
+    auto classJob = pCombatData->getClassJob( currentClass );
     if( !classJob )
       return false;
 
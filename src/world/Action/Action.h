@@ -5,10 +5,9 @@
 #include "Util/ActorFilter.h"
 #include "ForwardsZone.h"
 
-namespace Sapphire::Data
+namespace Sapphire::World::Manager
 {
-  struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
+  struct CombatActionData;
 }
 
 namespace Sapphire::World::Action
@@ -21,7 +20,6 @@ namespace Sapphire::World::Action
 
     Action();
     Action( Entity::CharaPtr caster, uint32_t actionId, FrameworkPtr fw );
-    Action( Entity::CharaPtr caster, uint32_t actionId, Data::ActionPtr actionData, FrameworkPtr fw );
 
     virtual ~Action();
 
@@ -167,7 +165,7 @@ namespace Sapphire::World::Action
     Common::ActionInterruptType m_interruptType;
 
     FrameworkPtr m_pFw;
-    Data::ActionPtr m_actionData;
+    const Manager::CombatActionData* m_actionData;
 
     Common::FFXIVARR_POSITION3 m_pos;
 
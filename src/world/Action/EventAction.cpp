@@ -8,6 +8,8 @@
 
 #include "Actor/Player.h"
 
+#include "Script/NativeScriptMgr.h"
+
 #include "EventAction.h"
 #include "Framework.h"
 
@@ -29,8 +31,9 @@ Action::EventAction::EventAction( Entity::CharaPtr pActor, uint32_t eventId, uin
   m_pFw = pFw;
   auto pExdData = pFw->get< Data::ExdDataGenerated >();
   m_castTimeMs = pExdData->get< Sapphire::Data::EventAction >( action )->castTime * 1000; // TODO: Add security checks.
-  m_onActionFinishClb = std::move( finishRef );
-  m_onActionInterruptClb = std::move( interruptRef );
+  // callbacks set by a script keep its module loaded as long as the action is around
+  m_onActionFinishClb = Scripting::bindToCallingModule( std::move( finishRef ) );
+  m_onActionInterruptClb = Scripting::bindToCallingModule( std::move( interruptRef ) );
   m_pSource = std::move( pActor );
   m_interruptType = Common::ActionInterruptType::None;
 }
@@ -184,7 +184,11 @@ void Sapphire::Entity::Actor::addInRangeActor( ActorPtr pActor )
   {
     auto pPlayer = pActor->getAsPlayer();
 
-    spawn( pPlayer );
+    // charas compete for the spawn slots of the player and are spawned by relevance in its next update
+    if( isPlayer() || isBattleNpc() )
+      pPlayer->markSpawnInterestDirty();
+    else
+      spawn( pPlayer );
 
     // if actor is a player, add it to the in range player set
     m_inRangePlayers.insert( pPlayer );
@@ -215,7 +219,11 @@ void Sapphire::Entity::Actor::removeInRangeActor( Actor& actor )
   // if actor is a player, despawn ourself for him
   // TODO: move to virtual onRemove?
   if( isPlayer() )
+  {
     actor.despawn( getAsPlayer() );
+    // a slot may have been freed up for a chara that is waiting for one
+    getAsPlayer()->markSpawnInterestDirty();
+  }
 
   if( actor.isPlayer() )
     m_inRangePlayers.erase( actor.getAsPlayer() );
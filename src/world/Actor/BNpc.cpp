@@ -19,11 +19,13 @@
 #include "Network/PacketWrappers/ActorControlPacket144.h"
 #include "Network/PacketWrappers/UpdateHpMpTpPacket.h"
 #include "Network/PacketWrappers/NpcSpawnPacket.h"
+#include "ZoneInSnapshot.h"
 #include "Network/PacketWrappers/MoveActorPacket.h"
 #include "Navi/NaviProvider.h"
 
 #include "Math/CalcBattle.h"
 #include "Math/CalcStats.h"
+#include "Manager/CombatDataMgr.h"
 
 #include "StatusEffect/StatusEffect.h"
 
@@ -76,7 +78,7 @@ Sapphire::Entity::BNpc::BNpc( uint32_t id, BNpcTemplatePtr pTemplate, float posX
   m_levelId = 0;
   m_flags = 0;
 
-  m_class = ClassJob::Adventurer;
+  setClass( ClassJob::Adventurer );
 
   m_pCurrentZone = std::move( pZone );
 
@@ -159,6 +161,12 @@ uint8_t Sapphire::Entity::BNpc::getLevel() const
   return m_level;
 }
 
+void Sapphire::Entity::BNpc::setLevel( uint8_t level )
+{
+  m_level = level;
+  calculateStats();
+}
+
 uint32_t Sapphire::Entity::BNpc::getBNpcBaseId() const
 {
   return m_bNpcBaseId;
@@ -175,6 +183,12 @@ void Sapphire::Entity::BNpc::spawn( PlayerPtr pTarget )
   pTarget->queuePacket( std::make_shared< NpcSpawnPacket >( *this, *pTarget ) );
 }
 
+void Sapphire::Entity::BNpc::spawn( PlayerPtr pTarget, ZoneInSnapshot& snapshot )
+{
+  m_lastRoamTargetReached = Util::getTimeSeconds();
+  snapshot.add( getId(), NpcSpawnPacket( *this, *pTarget ) );
+}
+
 void Sapphire::Entity::BNpc::despawn( PlayerPtr pTarget )
 {
   pTarget->freePlayerSpawnId( getId() );
@@ -715,10 +729,10 @@ void Sapphire::Entity::BNpc::calculateStats()
   uint8_t level = getLevel();
   uint8_t job = static_cast< uint8_t >( getClass() );
 
-  auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
+  auto pCombatData = m_pFw->get< World::Manager::CombatDataMgr >();
 
-  auto classInfo = pExdData->get< Sapphire::Data::ClassJob >( job );
-  auto paramGrowthInfo = pExdData->get< Sapphire::Data::ParamGrow >( level );
+  auto classInfo = pCombatData->getClassJob( static_cast< Common::ClassJob >( job ) );
+  auto paramGrowthInfo = pCombatData->getLevel( level );
 
   float base = Math::CalcStats::calculateBaseStat( *this );
 
@@ -742,4 +756,6 @@ void Sapphire::Entity::BNpc::calculateStats()
   m_baseStats.attack = m_baseStats.str;
   m_baseStats.attackPotMagic = m_baseStats.inte;
   m_baseStats.healingPotMagic = m_baseStats.mnd;
+
+  invalidateDerivedStats();
 }
\ No newline at end of file
@@ -56,11 +56,15 @@ namespace Sapphire::Entity
     virtual ~BNpc() override;
 
     void spawn( PlayerPtr pTarget ) override;
+    void spawn( PlayerPtr pTarget, ZoneInSnapshot& snapshot );
     void despawn( PlayerPtr pTarget ) override;
 
     uint16_t getModelChara() const;
     uint8_t getLevel() const override;
 
+    /*! sets the level and recalculates the stats depending on it */
+    void setLevel( uint8_t level );
+
     uint32_t getBNpcBaseId() const;
     uint32_t getBNpcNameId() const;
 
@@ -25,6 +25,7 @@
 #include "Chara.h"
 #include "Player.h"
 #include "Manager/TerritoryMgr.h"
+#include "Manager/CombatDataMgr.h"
 #include "Framework.h"
 #include "Common.h"
 
@@ -39,7 +40,8 @@ Sapphire::Entity::Chara::Chara( ObjKind type, FrameworkPtr pFw ) :
   m_targetId( INVALID_GAME_OBJECT_ID64 ),
   m_pFw( std::move( std::move( pFw ) ) ),
   m_directorId( 0 ),
-  m_radius( 1.f )
+  m_radius( 1.f ),
+  m_derivedStatsDirty( true )
 {
 
   m_lastTickTime = 0;
@@ -71,11 +73,40 @@ Sapphire::Common::Stance Sapphire::Entity::Chara::getStance() const
 }
 
 /*! \return actor stats */
-Sapphire::Entity::Chara::ActorStats Sapphire::Entity::Chara::getStats() const
+const Sapphire::Entity::Chara::ActorStats& Sapphire::Entity::Chara::getStats() const
 {
   return m_baseStats;
 }
 
+const Sapphire::Entity::Chara::DerivedStats& Sapphire::Entity::Chara::getDerivedStats() const
+{
+  if( m_derivedStatsDirty )
+  {
+    m_derivedStats.autoAttackPotency = Math::CalcStats::autoAttackPotency( *this );
+    m_derivedStats.autoAttack = Math::CalcStats::autoAttack( *this );
+    m_derivedStats.primaryAttackPower = Math::CalcStats::getPrimaryAttackPower( *this );
+    m_derivedStats.determination = Math::CalcStats::determination( *this );
+    m_derivedStats.tenacity = Math::CalcStats::tenacity( *this );
+    m_derivedStats.speed = Math::CalcStats::speed( *this );
+    m_derivedStats.criticalHitProbability = Math::CalcStats::criticalHitProbability( *this );
+    m_derivedStats.criticalHitBonus = Math::CalcStats::criticalHitBonus( *this );
+    m_derivedStats.directHitProbability = Math::CalcStats::directHitProbability( *this );
+    m_derivedStats.blockProbability = Math::CalcStats::blockProbability( *this );
+    m_derivedStats.blockStrength = Math::CalcStats::blockStrength( *this );
+    m_derivedStats.physicalDefence = Math::CalcStats::physicalDefence( *this );
+    m_derivedStats.magicDefence = Math::CalcStats::magicDefence( *this );
+
+    m_derivedStatsDirty = false;
+  }
+
+  return m_derivedStats;
+}
+
+void Sapphire::Entity::Chara::invalidateDerivedStats()
+{
+  m_derivedStatsDirty = true;
+}
+
 /*! \return current HP */
 uint32_t Sapphire::Entity::Chara::getHp() const
 {
@@ -121,6 +152,7 @@ Sapphire::Common::ClassJob Sapphire::Entity::Chara::getClass() const
 void Sapphire::Entity::Chara::setClass( Common::ClassJob classJob )
 {
   m_class = classJob;
+  invalidateDerivedStats();
 }
 
 /*! \param Id of the target to set */
@@ -456,6 +488,8 @@ void Sapphire::Entity::Chara::addStatusEffect( StatusEffect::StatusEffectPtr pEf
 
   pEffect->applyStatus();
   m_statusEffectMap[ nextSlot ] = pEffect;
+  scheduleStatusEffect( static_cast< uint8_t >( nextSlot ), pEffect );
+  invalidateDerivedStats();
 
   auto statusEffectAdd = makeZonePacket< FFXIVIpcEffectResult >( getId() );
 
@@ -541,6 +575,7 @@ void Sapphire::Entity::Chara::removeStatusEffect( uint8_t effectSlotId )
   sendToInRangeSet( makeActorControl142( getId(), StatusEffectLose, pEffect->getId() ), isPlayer() );
 
   m_statusEffectMap.erase( effectSlotId );
+  invalidateDerivedStats();
 
   sendStatusEffectUpdate();
 }
@@ -599,70 +634,78 @@ void Sapphire::Entity::Chara::sendStatusEffectUpdate()
 
 }
 
-void Sapphire::Entity::Chara::updateStatusEffects()
+void Sapphire::Entity::Chara::scheduleStatusEffect( uint8_t effectSlotId, StatusEffect::StatusEffectPtr pEffect )
 {
-  uint64_t currentTimeMs = Util::getTimeMs();
-
-  uint32_t thisTickDmg = 0;
-  uint32_t thisTickHeal = 0;
-
-  for( auto effectIt : m_statusEffectMap )
-  {
-    uint8_t effectIndex = effectIt.first;
-    auto effect = effectIt.second;
+  // charas outside of a zone are scheduled once they are pushed into one
+  auto pZone = getCurrentZone();
+  if( !pZone )
+    return;
 
-    uint64_t lastTick = effect->getLastTickMs();
-    uint64_t startTime = effect->getStartTimeMs();
-    uint32_t duration = effect->getDuration();
-    uint32_t tickRate = effect->getTickRate();
+  pZone->scheduleStatusEffect( pEffect->getNextUpdateMs(), getAsChara(), effectSlotId, pEffect );
+}
 
-    if( ( currentTimeMs - startTime ) > duration )
-    {
-      // remove status effect
-      removeStatusEffect( effectIndex );
-      // break because removing invalidates iterators
-      break;
-    }
+void Sapphire::Entity::Chara::scheduleStatusEffects()
+{
+  for( auto& effectIt : m_statusEffectMap )
+    scheduleStatusEffect( effectIt.first, effectIt.second );
+}
 
-    if( ( currentTimeMs - lastTick ) > tickRate )
-    {
-      effect->setLastTick( currentTimeMs );
-      effect->onTick();
+void Sapphire::Entity::Chara::cancelStatusEffectTimers()
+{
+  // timers only fire if they carry the current id of their effect
+  for( auto& effectIt : m_statusEffectMap )
+    effectIt.second->nextTimerId();
+}
 
-      auto thisEffect = effect->getTickEffect();
+std::pair< uint8_t, uint32_t > Sapphire::Entity::Chara::updateStatusEffect( uint8_t effectSlotId,
+                                                                            StatusEffect::StatusEffectPtr pEffect,
+                                                                            uint64_t currentTimeMs )
+{
+  std::pair< uint8_t, uint32_t > tickEffect{ 0, 0 };
 
-      switch( thisEffect.first )
-      {
+  // the slot may have been freed and reused since the timer was scheduled
+  auto effectIt = m_statusEffectMap.find( effectSlotId );
+  if( effectIt == m_statusEffectMap.end() || effectIt->second != pEffect )
+    return tickEffect;
 
-        case 1:
-        {
-          thisTickDmg += thisEffect.second;
-          break;
-        }
+  if( currentTimeMs - pEffect->getStartTimeMs() >= pEffect->getDuration() )
+  {
+    removeStatusEffect( effectSlotId );
+    return tickEffect;
+  }
 
-        case 2:
-        {
-          thisTickHeal += thisEffect.second;
-          break;
-        }
+  if( pEffect->getLastTickMs() == 0 || currentTimeMs - pEffect->getLastTickMs() >= pEffect->getTickRate() )
+  {
+    pEffect->setLastTick( currentTimeMs );
 
-      }
+    // dead charas keep their effects but do not tick
+    if( isAlive() )
+    {
+      // the zone calls the tick scripts of all effects due in this update in one go
+      getCurrentZone()->queueStatusEffectTick( getAsChara(), pEffect );
+      tickEffect = pEffect->getTickEffect();
     }
-
   }
 
-  if( thisTickDmg != 0 )
+  scheduleStatusEffect( effectSlotId, pEffect );
+
+  return tickEffect;
+}
+
+void Sapphire::Entity::Chara::applyStatusEffectTicks( uint32_t damage, uint32_t healing )
+{
+  if( damage != 0 )
   {
-    takeDamage( thisTickDmg );
+    takeDamage( damage );
     sendToInRangeSet( makeActorControl142( getId(), HPFloatingText, 0,
-                                           static_cast< uint8_t >( ActionEffectType::Damage ), thisTickDmg ) );
+                                           static_cast< uint8_t >( ActionEffectType::Damage ), damage ) );
   }
 
-  if( thisTickHeal != 0 )
+  if( healing != 0 )
   {
-    heal( thisTickDmg );
+    heal( healing );
     sendToInRangeSet( makeActorControl142( getId(), HPFloatingText, 0,
-                                           static_cast< uint8_t >( ActionEffectType::Heal ), thisTickHeal ) );
+                                           static_cast< uint8_t >( ActionEffectType::Heal ), healing ) );
   }
 }
 
@@ -723,10 +766,10 @@ float Sapphire::Entity::Chara::getRadius() const
 
 Sapphire::Common::BaseParam Sapphire::Entity::Chara::getPrimaryStat() const
 {
-  auto exdData = m_pFw->get< Data::ExdDataGenerated >();
-  assert( exdData );
+  auto pCombatData = m_pFw->get< World::Manager::CombatDataMgr >();
+  assert( pCombatData );
 
-  auto classJob = exdData->get< Data::ClassJob >( static_cast< uint16_t >( getClass() ) );
+  auto classJob = pCombatData->getClassJob( getClass() );
   assert( classJob );
 
   return static_cast< Sapphire::Common::BaseParam >( classJob->primaryStat );
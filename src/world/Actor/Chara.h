@@ -66,6 +66,28 @@ namespace Sapphire::Entity
 
     } m_baseStats;
 
+    /*!
+     * @brief Results of the stat formulas used when resolving damage
+     *
+     * These only depend on base/bonus stats, level, class and gear, so they are cached until one of those changes.
+     */
+    struct DerivedStats
+    {
+      float autoAttackPotency = 0.f;
+      float autoAttack = 0.f;
+      float primaryAttackPower = 0.f;
+      float determination = 0.f;
+      float tenacity = 0.f;
+      float speed = 0.f;
+      float criticalHitProbability = 0.f;
+      float criticalHitBonus = 0.f;
+      float directHitProbability = 0.f;
+      float blockProbability = 0.f;
+      float blockStrength = 0.f;
+      float physicalDefence = 0.f;
+      float magicDefence = 0.f;
+    };
+
     // array for bonuses, 80 to have some spare room.
     std::array< uint32_t, 80 > m_bonusStats;
 
@@ -134,6 +156,10 @@ namespace Sapphire::Entity
     /*! Detour Crowd actor scale */
     float m_radius;
 
+    /*! Cached derived stats, recalculated on first access after invalidateDerivedStats */
+    mutable DerivedStats m_derivedStats;
+    mutable bool m_derivedStatsDirty;
+
   public:
     Chara( Common::ObjKind type, FrameworkPtr pFw );
 
@@ -150,7 +176,24 @@ namespace Sapphire::Entity
 
     void removeSingleStatusEffectById( uint32_t id );
 
-    void updateStatusEffects();
+    /*! schedules the next tick or expiration of the effect in slot with the current zone */
+    void scheduleStatusEffect( uint8_t effectSlotId, StatusEffect::StatusEffectPtr pEffect );
+
+    /*! schedules all active effects, used when the chara enters a zone */
+    void scheduleStatusEffects();
+
+    /*! invalidates the pending timers of all active effects, used when the chara leaves a zone */
+    void cancelStatusEffectTimers();
+
+    /*!
+     * @brief Ticks or expires the effect in slot, called by the zone once the effect is due
+     * @return the tick effect to be applied to this chara, type 0 if there is none
+     */
+    std::pair< uint8_t, uint32_t > updateStatusEffect( uint8_t effectSlotId, StatusEffect::StatusEffectPtr pEffect,
+                                                       uint64_t currentTimeMs );
+
+    /*! applies the accumulated damage and healing of all effects that ticked in the same zone update */
+    void applyStatusEffectTicks( uint32_t damage, uint32_t healing );
 
     bool hasStatusEffect( uint32_t id );
 
@@ -189,7 +232,13 @@ namespace Sapphire::Entity
 
     void setStance( Common::Stance stance );
 
-    ActorStats getStats() const;
+    const ActorStats& getStats() const;
+
+    /*! @return the derived stats, recalculated first if anything they depend on changed */
+    const DerivedStats& getDerivedStats() const;
+
+    /*! marks the derived stats as outdated, call whenever stats, level, class or gear change */
+    void invalidateDerivedStats();
 
     uint32_t getStatValue( Common::BaseParam baseParam ) const;
 
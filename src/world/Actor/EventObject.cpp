@@ -2,6 +2,7 @@
 
 #include "Territory/InstanceContent.h"
 #include "Actor/Player.h"
+#include "Script/NativeScriptMgr.h"
 
 #include "Network/PacketWrappers/ActorControlPacket142.h"
 #include "Network/PacketWrappers/ActorControlPacket143.h"
@@ -61,7 +62,7 @@ Sapphire::Entity::EventObject::OnTalkEventHandler Sapphire::Entity::EventObject:
 
 void Sapphire::Entity::EventObject::setOnTalkHandler( Sapphire::Entity::EventObject::OnTalkEventHandler handler )
 {
-  m_onTalkEventHandler = handler;
+  m_onTalkEventHandler = Scripting::bindToCallingModule( std::move( handler ) );
 }
 
 void Sapphire::Entity::EventObject::setGimmickId( uint32_t gimmickId )
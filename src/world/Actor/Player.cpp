@@ -15,6 +15,7 @@
 #include "Manager/HousingMgr.h"
 #include "Manager/TerritoryMgr.h"
 #include "Manager/RNGMgr.h"
+#include "Manager/CombatDataMgr.h"
 
 #include "Territory/Zone.h"
 #include "Territory/ZonePosition.h"
@@ -109,10 +110,8 @@ Sapphire::Entity::Player::~Player()
 
 void Sapphire::Entity::Player::injectPacket( const std::string& path )
 {
-  auto pServerZone = m_pFw->get< World::ServerMgr >();
-  auto session = pServerZone->getSession( getId() );
-  if( session )
-    session->getZoneConnection()->injectPacket( path, *this );
+  if( m_pSession )
+    m_pSession->getZoneConnection()->injectPacket( path, *this );
 }
 
 // TODO: add a proper calculation based on race / job / level / gear
@@ -251,10 +250,11 @@ void Sapphire::Entity::Player::calculateStats()
   uint8_t job = static_cast< uint8_t >( getClass() );
 
   auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
+  auto pCombatData = m_pFw->get< World::Manager::CombatDataMgr >();
 
-  auto classInfo = pExdData->get< Sapphire::Data::ClassJob >( job );
+  auto classInfo = pCombatData->getClassJob( static_cast< Common::ClassJob >( job ) );
   auto tribeInfo = pExdData->get< Sapphire::Data::Tribe >( tribe );
-  auto paramGrowthInfo = pExdData->get< Sapphire::Data::ParamGrow >( level );
+  auto paramGrowthInfo = pCombatData->getLevel( level );
 
   float base = Math::CalcStats::calculateBaseStat( *this );
 
@@ -295,6 +295,7 @@ void Sapphire::Entity::Player::calculateStats()
   if( m_hp > m_baseStats.max_hp )
     m_hp = m_baseStats.max_hp;
 
+  invalidateDerivedStats();
 }
 
 
@@ -535,6 +536,7 @@ uint8_t Sapphire::Entity::Player::getGender() const
 void Sapphire::Entity::Player::initSpawnIdQueue()
 {
   m_actorSpawnIndexAllocator.freeAllSpawnIndexes();
+  m_spawnInterest.reset();
 }
 
 uint8_t Sapphire::Entity::Player::getSpawnIdForActorId( uint32_t actorId )
@@ -560,6 +562,31 @@ bool Sapphire::Entity::Player::isActorSpawnIdValid( uint8_t spawnIndex )
   return m_actorSpawnIndexAllocator.isSpawnIndexValid( spawnIndex );
 }
 
+bool Sapphire::Entity::Player::isActorSpawned( uint32_t actorId ) const
+{
+  return m_actorSpawnIndexAllocator.isActorSpawned( actorId );
+}
+
+std::size_t Sapphire::Entity::Player::getFreeActorSpawnIdCount() const
+{
+  return m_actorSpawnIndexAllocator.getFreeSpawnIndexCount();
+}
+
+void Sapphire::Entity::Player::markSpawnInterestDirty()
+{
+  m_spawnInterest.markDirty();
+}
+
+void Sapphire::Entity::Player::updateSpawnInterest( uint64_t tickCount )
+{
+  if( !isLoadingComplete() )
+    return;
+
+  auto pTeriMgr = m_pFw->get< TerritoryMgr >();
+  m_spawnInterest.update( *this, m_inRangeActor, pTeriMgr->getSpawnsPerTick(), pTeriMgr->getZoneInBundleSize(),
+                          tickCount );
+}
+
 void Sapphire::Entity::Player::registerAetheryte( uint8_t aetheryteId )
 {
   uint16_t index;
@@ -810,6 +837,7 @@ void Sapphire::Entity::Player::setInCombat( bool mode )
 void Sapphire::Entity::Player::setClassJob( Common::ClassJob classJob )
 {
   m_class = classJob;
+  invalidateDerivedStats();
   uint8_t level = getLevel();
 
   if( getHp() > getMaxHp() )
@@ -836,6 +864,7 @@ void Sapphire::Entity::Player::setLevel( uint8_t level )
   auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
   uint8_t classJobIndex = pExdData->get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( getClass() ) )->expArrayIndex;
   m_classArray[ classJobIndex ] = level;
+  invalidateDerivedStats();
 }
 
 void Sapphire::Entity::Player::setLevelForClass( uint8_t level, Common::ClassJob classjob )
@@ -847,6 +876,7 @@ void Sapphire::Entity::Player::setLevelForClass( uint8_t level, Common::ClassJob
     insertDbClass( classJobIndex );
 
   m_classArray[ classJobIndex ] = level;
+  invalidateDerivedStats();
 }
 
 void Sapphire::Entity::Player::sendModel()
@@ -914,6 +944,13 @@ void Sapphire::Entity::Player::spawn( Entity::PlayerPtr pTarget )
   pTarget->queuePacket( std::make_shared< PlayerSpawnPacket >( *getAsPlayer(), *pTarget ) );
 }
 
+void Sapphire::Entity::Player::spawn( Entity::PlayerPtr pTarget, ZoneInSnapshot& snapshot )
+{
+  Logger::debug( "[{0}] Spawning {1} for {2} on zone-in", pTarget->getId(), getName(), pTarget->getName() );
+
+  snapshot.add( getId(), PlayerSpawnPacket( *getAsPlayer(), *pTarget ) );
+}
+
 // despawn
 void Sapphire::Entity::Player::despawn( Entity::PlayerPtr pTarget )
 {
@@ -1090,8 +1127,6 @@ void Sapphire::Entity::Player::update( uint64_t tickCount )
   if( !isAlive() )
     return;
 
-  updateStatusEffects();
-
   m_lastUpdate = tickCount;
 
   if( !checkAction() )
@@ -1155,6 +1190,10 @@ void Sapphire::Entity::Player::freePlayerSpawnId( uint32_t actorId )
   if( spawnId == m_actorSpawnIndexAllocator.getAllocFailId() )
     return;
 
+  // the spawn was still waiting in the zone-in snapshot, the client does not know the actor
+  if( m_spawnInterest.cancelZoneInSpawn( actorId ) )
+    return;
+
   auto freeActorSpawnPacket = makeZonePacket< FFXIVIpcActorFreeSpawn >( getId() );
   freeActorSpawnPacket->data().actorId = actorId;
   freeActorSpawnPacket->data().spawnId = spawnId;
@@ -1247,13 +1286,11 @@ const uint8_t* Sapphire::Entity::Player::getGcRankArray() const
 
 void Sapphire::Entity::Player::queuePacket( Network::Packets::FFXIVPacketBasePtr pPacket )
 {
-  auto pServerZone = m_pFw->get< World::ServerMgr >();
-  auto pSession = pServerZone->getSession( m_id );
-
-  if( !pSession )
+  // the session handle is cached on load, no need to go through the session registry
+  if( !m_pSession )
     return;
 
-  auto pZoneCon = pSession->getZoneConnection();
+  auto pZoneCon = m_pSession->getZoneConnection();
 
   if( pZoneCon )
     pZoneCon->queueOutPacket( pPacket );
@@ -1262,13 +1299,10 @@ void Sapphire::Entity::Player::queuePacket( Network::Packets::FFXIVPacketBasePtr
 
 void Sapphire::Entity::Player::queueChatPacket( Network::Packets::FFXIVPacketBasePtr pPacket )
 {
-  auto pServerZone = m_pFw->get< World::ServerMgr >();
-  auto pSession = pServerZone->getSession( m_id );
-
-  if( !pSession )
+  if( !m_pSession )
     return;
 
-  auto pChatCon = pSession->getChatConnection();
+  auto pChatCon = m_pSession->getChatConnection();
 
   if( pChatCon )
     pChatCon->queueOutPacket( pPacket );
@@ -1281,6 +1315,9 @@ bool Sapphire::Entity::Player::isLoadingComplete() const
 
 void Sapphire::Entity::Player::setLoadingComplete( bool bComplete )
 {
+  if( bComplete && !m_bLoadingComplete )
+    m_spawnInterest.beginZoneIn( Util::getTimeMs() );
+
   m_bLoadingComplete = bComplete;
 }
 
@@ -1377,6 +1414,9 @@ void Sapphire::Entity::Player::hateListAdd( BNpcPtr pBNpc )
     m_freeHateSlotQueue.pop();
     m_actorIdTohateSlotMap[ pBNpc->getId() ] = hateId;
     sendHateList();
+
+    // whatever is fighting the player should be visible to it
+    m_spawnInterest.markDirty();
   }
 }
 
@@ -1400,12 +1440,12 @@ void Sapphire::Entity::Player::hateListRemove( BNpcPtr pBNpc )
 
 bool Sapphire::Entity::Player::hateListHasEntry( BNpcPtr pBNpc )
 {
-  for( const auto& entry : m_actorIdTohateSlotMap )
-  {
-    if( entry.first == pBNpc->getId() )
-      return true;
-  }
-  return false;
+  return hateListHasEntry( pBNpc->getId() );
+}
+
+bool Sapphire::Entity::Player::hateListHasEntry( uint32_t actorId ) const
+{
+  return m_actorIdTohateSlotMap.find( actorId ) != m_actorIdTohateSlotMap.end();
 }
 
 void Sapphire::Entity::Player::sendHateList()
@@ -8,6 +8,7 @@
 #include <spdlog/fmt/fmt.h>
 
 #include "Chara.h"
+#include "SpawnInterest.h"
 #include "Event/EventHandler.h"
 #include <map>
 #include <queue>
@@ -658,9 +659,24 @@ namespace Sapphire::Entity
     /*! checks if the given spawn id is valid */
     bool isActorSpawnIdValid( uint8_t spawnId );
 
+    /*! true if the actor has a spawn id for this player */
+    bool isActorSpawned( uint32_t actorId ) const;
+
+    /*! number of actor spawn ids that are not in use */
+    std::size_t getFreeActorSpawnIdCount() const;
+
+    /*! rank the in range charas again on the next spawn interest update */
+    void markSpawnInterestDirty();
+
+    /*! spawns the most relevant in range charas that are not spawned yet, see SpawnInterest */
+    void updateSpawnInterest( uint64_t tickCount );
+
     /*! send spawn packets to pTarget */
     void spawn( PlayerPtr pTarget ) override;
 
+    /*! write the spawn packet for pTarget into its zone-in snapshot */
+    void spawn( PlayerPtr pTarget, ZoneInSnapshot& snapshot );
+
     /*! send despawn packets to pTarget */
     void despawn( PlayerPtr pTarget ) override;
 
@@ -814,6 +830,8 @@ namespace Sapphire::Entity
 
     bool hateListHasEntry( BNpcPtr pBNpc );
 
+    bool hateListHasEntry( uint32_t actorId ) const;
+
     void sendHateList();
 
     bool actionHasCastTime( uint32_t actionId );
@@ -938,12 +956,27 @@ namespace Sapphire::Entity
     /*! return the current amount of currency of type */
     uint32_t getCurrency( Common::CurrencyType type );
 
+    /*! queues all slots of the container for the next inventory flush */
     void writeInventory( Common::InventoryType type );
 
+    /*! queues a single slot of the container for the next inventory flush */
+    void writeInventorySlot( Common::InventoryType type, uint16_t slotId );
+
     void writeItem( ItemPtr pItem ) const;
 
     void deleteItemDb( ItemPtr pItem ) const;
 
+    /*! removes the row of the item with the next inventory flush */
+    void removeItemDb( ItemPtr pItem ) const;
+
+    Inventory::InventoryChangeSet& getInventoryChanges();
+
+    /*!
+     * @brief Writes all inventory changes recorded since the last flush
+     * @param sync blocks until the changes are committed
+     */
+    void flushInventoryChanges( bool sync = false );
+
     /*! return the crystal amount of currency of type */
     uint32_t getCrystal( Common::CrystalType type );
 
@@ -1007,6 +1040,8 @@ namespace Sapphire::Entity
 
     InventoryMap m_storageMap;
 
+    Inventory::InventoryChangeSetPtr m_pInventoryChanges;
+
     Common::FFXIVARR_POSITION3 m_prevPos;
     uint32_t m_prevTerritoryTypeId;
     uint32_t m_prevTerritoryId;
@@ -1109,6 +1144,7 @@ namespace Sapphire::Entity
 
     Common::Util::SpawnIndexAllocator< uint8_t > m_objSpawnIndexAllocator;
     Common::Util::SpawnIndexAllocator< uint8_t > m_actorSpawnIndexAllocator;
+    SpawnInterest m_spawnInterest;
 
     std::array< Common::HuntingLogEntry, 12 > m_huntingLogEntries;
 
@@ -14,6 +14,8 @@
 #include "Territory/Zone.h"
 #include "ServerMgr.h"
 #include "Framework.h"
+#include "Script/ScriptMgr.h"
+#include "Script/NativeScriptMgr.h"
 
 #include "Action/EventAction.h"
 
@@ -94,6 +96,12 @@ void Sapphire::Entity::Player::eventStart( uint64_t actorId, uint32_t eventId,
 
   newEvent->setEventFinishCallback( callback );
 
+  // bind the script once here, every callback of the event dispatches through these slots.
+  // only looked up, most event ids never had a script and must not get an empty slot each
+  auto& nativeScriptMgr = m_pFw->get< Scripting::ScriptMgr >()->getNativeScriptHandler();
+  newEvent->setScriptSlots( nativeScriptMgr.findScriptSlot< ScriptAPI::EventScript >( eventId ),
+                            nativeScriptMgr.findScriptSlot< ScriptAPI::EventScript >( eventId & 0xFFFF0000 ) );
+
   addEvent( newEvent );
 
   setStateFlag( PlayerStateFlag::InNpcEvent );
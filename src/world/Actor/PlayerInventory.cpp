@@ -11,6 +11,7 @@
 
 #include "Inventory/Item.h"
 #include "Inventory/ItemContainer.h"
+#include "Inventory/InventoryChangeSet.h"
 
 
 #include "Player.h"
@@ -41,6 +42,8 @@ using namespace Sapphire::Network::ActorControl;
 
 void Sapphire::Entity::Player::initInventory()
 {
+  m_pInventoryChanges = Inventory::make_InventoryChangeSet( getId(), m_pFw );
+
   auto setupContainer = [ this ]( InventoryType type, uint8_t maxSize, const std::string& tableName,
                                   bool isMultiStorage, bool isPersistentStorage = true )
   { m_storageMap[ type ] = make_ItemContainer( type, maxSize, tableName, isMultiStorage, m_pFw, isPersistentStorage ); };
@@ -371,7 +374,7 @@ void Sapphire::Entity::Player::addCrystal( Common::CrystalType type, uint32_t am
 
   writeItem( currItem );
 
-  writeInventory( Crystal );
+  writeInventorySlot( Crystal, static_cast< uint8_t >( type ) - 1 );
 
 
   auto invUpdate = std::make_shared< UpdateInventorySlotPacket >( getId(),
@@ -474,56 +477,38 @@ uint32_t Sapphire::Entity::Player::getCrystal( CrystalType type )
 
 void Sapphire::Entity::Player::writeInventory( InventoryType type )
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-
-  auto storage = m_storageMap[ type ];
-
-  if( !storage->isPersistentStorage() )
-    return;
-
-  std::string query = "UPDATE " + storage->getTableName() + " SET ";
-
-  for( int32_t i = 0; i <= storage->getMaxSize(); i++ )
-  {
-    auto currItem = storage->getItem( i );
-
-    if( i > 0 )
-      query += ", ";
-
-    query += "container_" + std::to_string( i ) + " = " + std::to_string( currItem ? currItem->getUId() : 0 );
-  }
-
-  query += " WHERE CharacterId = " + std::to_string( getId() );
-
-  if( storage->isMultiStorage() )
-    query += " AND storageId = " + std::to_string( static_cast< uint16_t >( type ) );
+  m_pInventoryChanges->updateContainer( m_storageMap[ type ] );
+}
 
-  pDb->execute( query );
+void Sapphire::Entity::Player::writeInventorySlot( InventoryType type, uint16_t slotId )
+{
+  m_pInventoryChanges->updateSlot( m_storageMap[ type ], slotId );
 }
 
 void Sapphire::Entity::Player::writeItem( Sapphire::ItemPtr pItem ) const
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_UP );
-
-  // todo: add more fields
-  stmt->setInt( 1, pItem->getStackSize() );
-  stmt->setInt( 2, pItem->getDurability() );
-  stmt->setInt( 3, pItem->getStain() );
-
-  stmt->setInt64( 4, pItem->getUId() );
-
-  pDb->directExecute( stmt );
+  m_pInventoryChanges->updateItem( pItem );
 }
 
 void Sapphire::Entity::Player::deleteItemDb( Sapphire::ItemPtr item ) const
 {
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_DELETE );
+  m_pInventoryChanges->deleteItem( item );
+}
 
-  stmt->setInt64( 1, item->getUId() );
+void Sapphire::Entity::Player::removeItemDb( Sapphire::ItemPtr item ) const
+{
+  m_pInventoryChanges->removeItem( item );
+}
 
-  pDb->directExecute( stmt );
+Sapphire::Inventory::InventoryChangeSet& Sapphire::Entity::Player::getInventoryChanges()
+{
+  return *m_pInventoryChanges;
+}
+
+void Sapphire::Entity::Player::flushInventoryChanges( bool sync )
+{
+  if( m_pInventoryChanges )
+    m_pInventoryChanges->flush( sync );
 }
 
 
@@ -627,7 +612,7 @@ Sapphire::ItemPtr Sapphire::Entity::Player::addItem( uint32_t catalogId, uint32_
   auto storage = m_storageMap[ freeBagSlot.first ];
   storage->setItem( freeBagSlot.second, item );
 
-  writeInventory( static_cast< InventoryType >( freeBagSlot.first ) );
+  writeInventorySlot( static_cast< InventoryType >( freeBagSlot.first ), freeBagSlot.second );
 
   if( !silent )
   {
@@ -655,10 +640,8 @@ Sapphire::Entity::Player::moveItem( uint16_t fromInventoryId, uint8_t fromSlotId
 
   m_storageMap[ toInventoryId ]->setItem( toSlot, tmpItem );
 
-  writeInventory( static_cast< InventoryType >( toInventoryId ) );
-
-  if( fromInventoryId != toInventoryId )
-    writeInventory( static_cast< InventoryType >( fromInventoryId ) );
+  writeInventorySlot( static_cast< InventoryType >( toInventoryId ), toSlot );
+  writeInventorySlot( static_cast< InventoryType >( fromInventoryId ), fromSlotId );
 
   if( static_cast< InventoryType >( toInventoryId ) == GearSet0 )
     equipItem( static_cast< GearSetSlot >( toSlot ), tmpItem, true );
@@ -682,7 +665,7 @@ bool Sapphire::Entity::Player::updateContainer( uint16_t storageId, uint8_t slot
     case Bag:
     case CurrencyCrystal:
     {
-      writeInventory( static_cast< InventoryType >( storageId ) );
+      writeInventorySlot( static_cast< InventoryType >( storageId ), slotId );
       break;
     }
 
@@ -697,7 +680,7 @@ bool Sapphire::Entity::Player::updateContainer( uint16_t storageId, uint8_t slot
       else
         unequipItem( static_cast< GearSetSlot >( slotId ), pItem, true );
 
-      writeInventory( static_cast< InventoryType >( storageId ) );
+      writeInventorySlot( static_cast< InventoryType >( storageId ), slotId );
       break;
     }
     default:
@@ -758,8 +741,8 @@ void Sapphire::Entity::Player::mergeItem( uint16_t fromInventoryId, uint8_t from
   // we can destroy the original stack if there's no overflow
   if( stackOverflow == 0 )
   {
-    m_storageMap[ fromInventoryId ]->removeItem( fromSlotId );
-    deleteItemDb( fromItem );
+    m_storageMap[ fromInventoryId ]->removeItem( fromSlotId, false );
+    removeItemDb( fromItem );
   }
   else
   {
@@ -810,9 +793,9 @@ void Sapphire::Entity::Player::discardItem( uint16_t fromInventoryId, uint8_t fr
 
   auto fromItem = m_storageMap[ fromInventoryId ]->getItem( fromSlotId );
 
-  deleteItemDb( fromItem );
+  removeItemDb( fromItem );
 
-  m_storageMap[ fromInventoryId ]->removeItem( fromSlotId );
+  m_storageMap[ fromInventoryId ]->removeItem( fromSlotId, false );
   updateContainer( fromInventoryId, fromSlotId, nullptr );
 
   auto invTransPacket = makeZonePacket< FFXIVIpcInventoryTransaction >( getId() );
@@ -904,7 +887,9 @@ bool Sapphire::Entity::Player::collectHandInItems( std::vector< uint32_t > itemI
   // remove items
   for( auto item : foundItems )
   {
-    container->removeItem( item );
+    if( container->isPersistentStorage() )
+      removeItemDb( container->getItem( item ) );
+    container->removeItem( item, false );
   }
 
   return true;
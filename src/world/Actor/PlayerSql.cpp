@@ -1,4 +1,5 @@
 #include <set>
+#include <tuple>
 
 #include <Common.h>
 #include <Util/Util.h>
@@ -16,6 +17,7 @@
 #include "Territory/Zone.h"
 #include "Inventory/Item.h"
 #include "Inventory/ItemContainer.h"
+#include "Inventory/InventoryChangeSet.h"
 #include "Manager/ItemMgr.h"
 
 #include "ServerMgr.h"
@@ -626,29 +628,17 @@ void Sapphire::Entity::Player::insertQuest( uint16_t questId, uint8_t index, uin
 
 Sapphire::ItemPtr Sapphire::Entity::Player::createItem( uint32_t catalogId, uint32_t quantity )
 {
-  auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
-  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  auto itemInfo = pExdData->get< Sapphire::Data::Item >( catalogId );
   auto itemMgr = m_pFw->get< World::Manager::ItemMgr >();
+  auto itemInfo = itemMgr->getItemInfo( catalogId );
 
   if( !itemInfo )
     return nullptr;
 
-  if( !itemInfo )
-    return nullptr;
-
-  uint8_t flags = 0;
-
   ItemPtr pItem = make_Item( itemMgr->getNextUId(), catalogId, m_pFw );
 
   pItem->setStackSize( quantity );
 
-  pDb->execute( "INSERT INTO charaglobalitem ( CharacterId, itemId, catalogId, stack, flags ) VALUES ( " +
-                std::to_string( getId() ) + ", " +
-                std::to_string( pItem->getUId() ) + ", " +
-                std::to_string( pItem->getId() ) + ", " +
-                std::to_string( quantity ) + ", " +
-                std::to_string( flags ) + ");" );
+  m_pInventoryChanges->insertItem( pItem );
 
   return pItem;
 }
@@ -657,6 +647,12 @@ bool Sapphire::Entity::Player::loadInventory()
 {
   auto itemMgr = m_pFw->get< World::Manager::ItemMgr >();
   auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+
+  // storageId, slot, uId - collected first so all items can be fetched in one go
+  std::vector< std::tuple< uint16_t, uint16_t, uint64_t > > gearSetSlots;
+  std::vector< std::tuple< uint16_t, uint16_t, uint64_t > > bagSlots;
+  std::vector< uint64_t > uIds;
+
   //////////////////////////////////////////////////////////////////////////////////////////////////////
   // load active gearset
   auto res = pDb->query( "SELECT storageId, container_0, container_1, container_2, container_3, "
@@ -677,13 +673,8 @@ bool Sapphire::Entity::Player::loadInventory()
       if( uItemId == 0 )
         continue;
 
-      ItemPtr pItem = itemMgr->loadItem( uItemId );
-
-      if( pItem == nullptr )
-        continue;
-
-      m_storageMap[ storageId ]->getItemMap()[ i - 1 ] = pItem;
-      equipItem( static_cast< GearSetSlot >( i - 1 ), pItem, false );
+      gearSetSlots.emplace_back( storageId, i - 1, uItemId );
+      uIds.push_back( uItemId );
     }
   }
 
@@ -710,13 +701,30 @@ bool Sapphire::Entity::Player::loadInventory()
       if( uItemId == 0 )
         continue;
 
-      ItemPtr pItem = itemMgr->loadItem( uItemId );
+      bagSlots.emplace_back( storageId, i - 1, uItemId );
+      uIds.push_back( uItemId );
+    }
+  }
 
-      if( pItem == nullptr )
-        continue;
+  auto items = itemMgr->loadItems( uIds );
 
-      m_storageMap[ storageId ]->getItemMap()[ i - 1 ] = pItem;
-    }
+  for( auto& slot : gearSetSlots )
+  {
+    auto it = items.find( std::get< 2 >( slot ) );
+    if( it == items.end() )
+      continue;
+
+    m_storageMap[ std::get< 0 >( slot ) ]->getItemMap()[ std::get< 1 >( slot ) ] = it->second;
+    equipItem( static_cast< GearSetSlot >( std::get< 1 >( slot ) ), it->second, false );
+  }
+
+  for( auto& slot : bagSlots )
+  {
+    auto it = items.find( std::get< 2 >( slot ) );
+    if( it == items.end() )
+      continue;
+
+    m_storageMap[ std::get< 0 >( slot ) ]->getItemMap()[ std::get< 1 >( slot ) ] = it->second;
   }
 
   return true;
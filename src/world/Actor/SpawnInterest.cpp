@@ -0,0 +1,172 @@
+#include <Metrics/Metrics.h>
+#include <Util/UtilMath.h>
+
+#include <algorithm>
+
+#include "SpawnInterest.h"
+#include "Player.h"
+#include "BNpc.h"
+
+Sapphire::Entity::SpawnInterest::SpawnInterest() :
+  m_dirty( true ),
+  m_lastRankTime( 0 )
+{
+}
+
+void Sapphire::Entity::SpawnInterest::markDirty()
+{
+  m_dirty = true;
+}
+
+void Sapphire::Entity::SpawnInterest::beginZoneIn( uint64_t tickCount )
+{
+  m_zoneIn.begin( tickCount );
+  m_dirty = true;
+}
+
+void Sapphire::Entity::SpawnInterest::reset()
+{
+  m_zoneIn.reset();
+  m_dirty = true;
+}
+
+bool Sapphire::Entity::SpawnInterest::cancelZoneInSpawn( uint32_t actorId )
+{
+  return m_zoneIn.cancel( actorId );
+}
+
+Sapphire::Entity::SpawnInterest::Relevance Sapphire::Entity::SpawnInterest::getRelevance( Player& player, Actor& actor )
+{
+  if( static_cast< uint32_t >( player.getTargetId() ) == actor.getId() ||
+      ( actor.isBattleNpc() && player.hateListHasEntry( actor.getId() ) ) )
+    return Engaged;
+
+  if( static_cast< Chara& >( actor ).getTargetId() == player.getId() )
+    return TargetingPlayer;
+
+  if( actor.isPlayer() )
+    return OtherPlayer;
+
+  return Other;
+}
+
+bool Sapphire::Entity::SpawnInterest::isMoreRelevant( const Candidate& a, const Candidate& b )
+{
+  if( a.relevance != b.relevance )
+    return a.relevance > b.relevance;
+
+  return a.distance + SwapMargin < b.distance;
+}
+
+void Sapphire::Entity::SpawnInterest::spawn( PlayerPtr pPlayer, Actor& actor, bool zoneIn )
+{
+  if( !zoneIn )
+    actor.spawn( pPlayer );
+  else if( actor.isPlayer() )
+    actor.getAsPlayer()->spawn( pPlayer, m_zoneIn );
+  else
+    actor.getAsBNpc()->spawn( pPlayer, m_zoneIn );
+}
+
+void Sapphire::Entity::SpawnInterest::update( Player& player, const std::set< ActorPtr >& inRange,
+                                              uint32_t spawnsPerTick, uint32_t zoneInBundleSize, uint64_t tickCount )
+{
+  static auto& spawnCount = Metrics::Registry::counter( "world_spawn_interest_spawns_total", "",
+                                                        "Charas spawned for players by relevance" );
+  static auto& swapCount = Metrics::Registry::counter( "world_spawn_interest_swaps_total", "",
+                                                       "Spawned charas replaced by more relevant ones" );
+
+  if( m_zoneIn.isStreaming() )
+  {
+    m_zoneIn.flush( player, zoneInBundleSize, tickCount );
+
+    // a spawn or swap queued now would overtake the spawns still in the snapshot
+    if( m_zoneIn.isStreaming() )
+      return;
+  }
+
+  if( !m_dirty && tickCount - m_lastRankTime < RankInterval )
+    return;
+
+  m_dirty = false;
+  m_lastRankTime = tickCount;
+
+  m_candidates.clear();
+  uint32_t spawnedCount = 0;
+  for( auto& pActor : inRange )
+  {
+    if( !pActor->isPlayer() && !pActor->isBattleNpc() )
+      continue;
+
+    Candidate candidate{ pActor.get(), getRelevance( player, *pActor ),
+                         Common::Util::distance( player.getPos(), pActor->getPos() ),
+                         player.isActorSpawned( pActor->getId() ) };
+    spawnedCount += candidate.spawned ? 1 : 0;
+    m_candidates.push_back( candidate );
+  }
+
+  std::sort( m_candidates.begin(), m_candidates.end(), []( const Candidate& a, const Candidate& b )
+  {
+    if( a.relevance != b.relevance )
+      return a.relevance > b.relevance;
+    return a.distance < b.distance;
+  } );
+
+  // the first capacity candidates should be spawned, everything spawned behind them is up for replacement
+  auto freeSlots = player.getFreeActorSpawnIdCount();
+  auto capacity = std::min( m_candidates.size(), spawnedCount + freeSlots );
+  // the first pass after zoning spawns everything that fits, the snapshot spreads it over the ticks
+  bool zoneIn = m_zoneIn.isPending();
+  if( zoneIn )
+    m_zoneIn.build();
+
+  auto budget = spawnsPerTick == 0 || zoneIn ? capacity : spawnsPerTick;
+
+  auto pPlayer = player.getAsPlayer();
+  auto victim = m_candidates.size();
+
+  for( std::size_t i = 0; i < capacity && budget > 0; ++i )
+  {
+    auto& candidate = m_candidates[ i ];
+    if( candidate.spawned )
+      continue;
+
+    if( freeSlots == 0 )
+    {
+      // least relevant spawned chara that is not supposed to be
+      do
+        --victim;
+      while( victim >= capacity && !m_candidates[ victim ].spawned );
+
+      if( victim < capacity || !isMoreRelevant( candidate, m_candidates[ victim ] ) )
+        break;
+
+      m_candidates[ victim ].pActor->despawn( pPlayer );
+      m_candidates[ victim ].spawned = false;
+      swapCount.inc();
+    }
+    else
+      --freeSlots;
+
+    spawn( pPlayer, *candidate.pActor, zoneIn );
+    candidate.spawned = true;
+    spawnCount.inc();
+    --budget;
+  }
+
+  if( zoneIn )
+    m_zoneIn.flush( player, zoneInBundleSize, tickCount );
+
+  // out of budget with candidates left, continue on the next tick
+  if( budget == 0 )
+  {
+    for( std::size_t i = 0; i < capacity; ++i )
+    {
+      if( !m_candidates[ i ].spawned )
+      {
+        m_dirty = true;
+        break;
+      }
+    }
+  }
+}
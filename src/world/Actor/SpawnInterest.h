@@ -0,0 +1,90 @@
+#ifndef SAPPHIRE_SPAWNINTEREST_H
+#define SAPPHIRE_SPAWNINTEREST_H
+
+#include "ForwardsZone.h"
+#include "ZoneInSnapshot.h"
+
+#include <set>
+#include <vector>
+
+namespace Sapphire::Entity
+{
+
+  /*!
+   * @brief Decides which in range charas are spawned for a player
+   *
+   * The client only has MAX_DISPLAYED_ACTORS spawn slots. Instead of spawning whatever enters range
+   * first, candidates are ranked by how relevant they are to the player and by distance. Free slots
+   * go to the most relevant candidates, and once none are left a spawned chara is swapped out for a
+   * clearly more relevant one. At most spawnsPerTick charas are spawned per tick.
+   *
+   * Right after zoning everything that fits is spawned in one pass into a ZoneInSnapshot instead,
+   * which streams the spawns to the client in bundles over the next ticks.
+   */
+  class SpawnInterest
+  {
+  public:
+    SpawnInterest();
+
+    /*! the in range set or the relevance of a chara changed, rank again on the next update */
+    void markDirty();
+
+    /*! the player finished loading, the next update spawns everything relevant as one snapshot */
+    void beginZoneIn( uint64_t tickCount );
+
+    /*! the player left the zone, nothing spawned for it is sent anymore */
+    void reset();
+
+    /*!
+     * @brief The spawn of the actor is dropped from the zone-in snapshot if it was not sent yet
+     * @return true if the client never got the spawn
+     */
+    bool cancelZoneInSpawn( uint32_t actorId );
+
+    /*!
+     * @brief Spawns and swaps charas for the player
+     * @param inRange the in range set of the player
+     * @param spawnsPerTick at most this many charas are spawned, 0 for no limit
+     * @param zoneInBundleSize bytes of the zone-in snapshot sent per tick, 0 sends it at once
+     */
+    void update( Player& player, const std::set< ActorPtr >& inRange, uint32_t spawnsPerTick,
+                 uint32_t zoneInBundleSize, uint64_t tickCount );
+
+  private:
+    enum Relevance : uint8_t
+    {
+      Other,
+      OtherPlayer,
+      TargetingPlayer,
+      Engaged
+    };
+
+    struct Candidate
+    {
+      Actor* pActor;
+      Relevance relevance;
+      float distance;
+      bool spawned;
+    };
+
+    static Relevance getRelevance( Player& player, Actor& actor );
+
+    /*! true if a is worth despawning b for, distance has to differ by SwapMargin to avoid flapping */
+    static bool isMoreRelevant( const Candidate& a, const Candidate& b );
+
+    void spawn( PlayerPtr pPlayer, Actor& actor, bool zoneIn );
+
+    // only distances change without anything marking the interest dirty, they are checked this often
+    static constexpr uint64_t RankInterval = 1000;
+    static constexpr float SwapMargin = 5.f;
+
+    bool m_dirty;
+    uint64_t m_lastRankTime;
+    // kept around between updates to not allocate every time
+    std::vector< Candidate > m_candidates;
+    ZoneInSnapshot m_zoneIn;
+  };
+
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
+#include <Network/GamePacket.h>
+#include <Network/PacketContainer.h>
+
+#include "ZoneInSnapshot.h"
+#include "Player.h"
+
+Sapphire::Entity::ZoneInSnapshot::ZoneInSnapshot() :
+  m_state( Idle ),
+  m_startTime( 0 ),
+  m_nextEntry( 0 ),
+  m_bundleCount( 0 )
+{
+}
+
+void Sapphire::Entity::ZoneInSnapshot::begin( uint64_t tickCount )
+{
+  reset();
+  m_state = Pending;
+  m_startTime = tickCount;
+}
+
+void Sapphire::Entity::ZoneInSnapshot::reset()
+{
+  m_state = Idle;
+  m_entries.clear();
+  m_nextEntry = 0;
+  m_bundleCount = 0;
+}
+
+bool Sapphire::Entity::ZoneInSnapshot::isPending() const
+{
+  return m_state == Pending;
+}
+
+bool Sapphire::Entity::ZoneInSnapshot::isStreaming() const
+{
+  return m_state == Streaming;
+}
+
+void Sapphire::Entity::ZoneInSnapshot::build()
+{
+  // bundles of the last zone-in still waiting in the out queue keep their buffer
+  if( !m_pBuffer || m_pBuffer.use_count() > 1 )
+    m_pBuffer = std::make_shared< std::vector< uint8_t > >();
+  else
+    m_pBuffer->clear();
+
+  m_entries.clear();
+  m_nextEntry = 0;
+  m_bundleCount = 0;
+  m_state = Streaming;
+}
+
+void Sapphire::Entity::ZoneInSnapshot::add( uint32_t actorId, const Network::Packets::FFXIVPacketBase& packet )
+{
+  auto offset = m_pBuffer->size();
+  auto size = packet.getSize();
+
+  m_pBuffer->resize( offset + size );
+  packet.writeData( m_pBuffer->data() + offset );
+  m_entries.push_back( { actorId, static_cast< uint32_t >( size ), offset, packet.getIpcOpcode() } );
+}
+
+bool Sapphire::Entity::ZoneInSnapshot::cancel( uint32_t actorId )
+{
+  if( m_state != Streaming )
+    return false;
+
+  for( auto i = m_nextEntry; i < m_entries.size(); ++i )
+  {
+    auto entry = m_entries[ i ];
+    if( entry.actorId != actorId )
+      continue;
+
+    // queued bundles only refer to bytes in front of the next entry, those are not moved
+    auto pBegin = m_pBuffer->begin() + entry.offset;
+    m_pBuffer->erase( pBegin, pBegin + entry.size );
+    m_entries.erase( m_entries.begin() + i );
+
+    for( auto j = i; j < m_entries.size(); ++j )
+      m_entries[ j ].offset -= entry.size;
+
+    return true;
+  }
+
+  return false;
+}
+
+bool Sapphire::Entity::ZoneInSnapshot::queueBundle( Player& player, uint32_t maxSize )
+{
+  static auto& bundleCount = Metrics::Registry::counter( "world_zone_in_bundles_total", "",
+                                                         "Bundles of spawn packets queued for arrivals" );
+
+  auto first = m_nextEntry;
+  std::size_t size = 0;
+  while( m_nextEntry < m_entries.size() && ( size == 0 || size + m_entries[ m_nextEntry ].size <= maxSize ) )
+  {
+    size += m_entries[ m_nextEntry ].size;
+    ++m_nextEntry;
+  }
+
+  if( size == 0 )
+    return false;
+
+  player.queuePacket( std::make_shared< Network::Packets::FFXIVBundlePacket >(
+    m_pBuffer, m_entries[ first ].offset, size, static_cast< uint32_t >( m_nextEntry - first ) ) );
+  ++m_bundleCount;
+  bundleCount.inc();
+
+  // the connection only sees the bundle, so its spawns are counted like every other packet going out
+  for( auto i = first; i < m_nextEntry; ++i )
+  {
+    auto opcode = m_entries[ i ].opcode;
+    if( opcode == 0 )
+      continue;
+
+    auto& pCounter = m_opcodeCounters[ opcode ];
+    if( !pCounter )
+      pCounter = &Metrics::Registry::counter( "world_packets_out_total",
+                                              fmt::format( "opcode=\"0x{:04X}\"", opcode ),
+                                              "Game packets handled per ipc opcode" );
+    pCounter->inc();
+  }
+
+  return true;
+}
+
+void Sapphire::Entity::ZoneInSnapshot::flush( Player& player, uint32_t bundleSize, uint64_t tickCount )
+{
+  static auto& zoneInTime = Metrics::Registry::histogram( "world_zone_in_ms", "",
+                                                          "Time from a player finishing loading until every "
+                                                          "spawn of the arrival was queued in milliseconds" );
+  static auto& zoneInBytes = Metrics::Registry::histogram( "world_zone_in_bytes", "",
+                                                           "Bytes of spawn packets sent for an arrival" );
+
+  if( m_state != Streaming )
+    return;
+
+  // a bundle is sent as one piece, anything bigger than a container would bypass its cap
+  auto maxSize = bundleSize == 0 || bundleSize > Network::Packets::MaxContainerSize ?
+                 Network::Packets::MaxContainerSize : bundleSize;
+
+  // without a bundle size the whole arrival is queued right away, still in container sized bundles
+  do
+  {
+    if( !queueBundle( player, maxSize ) )
+      break;
+  } while( bundleSize == 0 );
+
+  if( m_nextEntry < m_entries.size() )
+    return;
+
+  auto totalSize = m_pBuffer->size();
+  auto duration = tickCount - m_startTime;
+  zoneInTime.record( duration );
+  zoneInBytes.record( totalSize );
+
+  Logger::debug( "Zone-in of Player#{0}: {1} spawns, {2} bytes in {3} bundles, {4}ms",
+                 player.getId(), m_entries.size(), totalSize, m_bundleCount, duration );
+
+  m_state = Idle;
+  m_entries.clear();
+  m_nextEntry = 0;
+}
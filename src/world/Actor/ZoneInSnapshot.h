@@ -0,0 +1,97 @@
+#ifndef SAPPHIRE_ZONEINSNAPSHOT_H
+#define SAPPHIRE_ZONEINSNAPSHOT_H
+
+#include "ForwardsZone.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Metrics
+{
+  class Counter;
+}
+
+namespace Sapphire::Entity
+{
+
+  /*!
+   * @brief The spawn packets of everything around a player that just finished loading a zone
+   *
+   * Instead of every spawn allocating and queueing a packet of its own, the spawns of an arrival are
+   * written back to back into one buffer in a single pass. The buffer is kept for the next zone-in
+   * once nothing queued refers to it anymore. It is queued in bundles of at most bundleSize bytes,
+   * one per tick, so arriving in a hub does not stall every other packet of the player. A bundle never
+   * exceeds the size of a packet container, and its spawns are counted per opcode when it is queued.
+   */
+  class ZoneInSnapshot
+  {
+  public:
+    ZoneInSnapshot();
+
+    /*! the player finished loading, the next build collects the spawns for the arrival */
+    void begin( uint64_t tickCount );
+
+    /*! drops the spawns that were not queued yet, the player left the zone */
+    void reset();
+
+    /*! true between begin and build */
+    bool isPending() const;
+
+    /*! true while spawns of the arrival are left to queue */
+    bool isStreaming() const;
+
+    /*! starts collecting spawns, add is only valid until the first flush */
+    void build();
+
+    /*! appends the spawn packet of an actor */
+    void add( uint32_t actorId, const Network::Packets::FFXIVPacketBase& packet );
+
+    /*!
+     * @brief Drops the spawn of an actor that was despawned before it was queued
+     * @return false if there is none or it was queued already
+     */
+    bool cancel( uint32_t actorId );
+
+    /*!
+     * @brief Queues the next bundle for the player, records the zone-in once the last one is queued
+     * @param bundleSize at most this many bytes per bundle, 0 queues every bundle at once,
+     *        bundles are capped to the size of a packet container either way
+     */
+    void flush( Player& player, uint32_t bundleSize, uint64_t tickCount );
+
+  private:
+    enum State : uint8_t
+    {
+      Idle,
+      Pending,
+      Streaming
+    };
+
+    struct Entry
+    {
+      uint32_t actorId;
+      uint32_t size;
+      std::size_t offset;
+      uint16_t opcode;
+    };
+
+    /*! queues the next bundle of at most maxSize bytes, returns false if nothing was left */
+    bool queueBundle( Player& player, uint32_t maxSize );
+
+    State m_state;
+    uint64_t m_startTime;
+
+    // shared with the bundles in the out queue, reused once they are all sent
+    std::shared_ptr< std::vector< uint8_t > > m_pBuffer;
+    std::vector< Entry > m_entries;
+    std::size_t m_nextEntry;
+    uint32_t m_bundleCount;
+
+    // world_packets_out_total counters of the spawn opcodes, the registry is only hit once per opcode
+    std::unordered_map< uint16_t, Metrics::Counter* > m_opcodeCounters;
+  };
+
+}
+
+#endif
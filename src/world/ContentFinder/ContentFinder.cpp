@@ -0,0 +1,689 @@
+#include <algorithm>
+
+#include <Common.h>
+#include <Logging/Logger.h>
+#include <Network/GamePacket.h>
+#include <Network/PacketDef/Zone/ServerZoneDef.h>
+#include <Exd/ExdDataGenerated.h>
+#include <Util/Util.h>
+
+#include "ContentFinder.h"
+
+#include "Actor/Player.h"
+#include "Manager/TerritoryMgr.h"
+#include "Territory/InstanceContent.h"
+
+#include "Framework.h"
+#include "ServerMgr.h"
+#include "Session.h"
+
+using namespace Sapphire::Network::Packets;
+using namespace Sapphire::Network::Packets::Server;
+
+namespace
+{
+  // players more than this many item levels apart end up in different bands and only get grouped up
+  // if no closer player of the role is waiting
+  constexpr uint16_t ItemLevelBandSize = 30;
+
+  // roulette ids as in ContentRoulette.exd, paired with the flag ContentFinderCondition.exd marks its duties with
+  template< typename T >
+  std::vector< uint8_t > getRoulettes( const T& cfc )
+  {
+    std::vector< uint8_t > roulettes;
+    const std::pair< uint8_t, bool > flags[] = {
+      { 1, cfc.levelingRoulette },
+      { 2, cfc.level5060Roulette },
+      { 3, cfc.mSQRoulette },
+      { 4, cfc.guildHestRoulette },
+      { 5, cfc.expertRoulette },
+      { 6, cfc.trialRoulette },
+      { 8, cfc.level70Roulette },
+      { 9, cfc.mentorRoulette },
+      { 15, cfc.allianceRoulette },
+      { 17, cfc.normalRaidRoulette },
+    };
+
+    for( auto& flag : flags )
+    {
+      if( flag.second )
+        roulettes.push_back( flag.first );
+    }
+    return roulettes;
+  }
+}
+
+Sapphire::ContentFinder::ContentFinder::ContentFinder( FrameworkPtr pFw ) :
+  World::Manager::BaseManager( pFw ),
+  m_matchInterval( 1000 ),
+  m_readyCheckTimeout( 45 ),
+  m_rng( std::random_device{}() ),
+  m_nextTicketId( 0 ),
+  m_stop( false ),
+  m_waitTime( Metrics::Registry::histogram( "world_cf_queue_wait_ms", "",
+                                            "Time from registration to a formed group in milliseconds" ) ),
+  m_passTime( Metrics::Registry::histogram( "world_cf_match_pass_us", "",
+                                            "Time a matching pass took in microseconds" ) ),
+  m_matchCount( Metrics::Registry::counter( "world_cf_matches", "", "Groups formed by the content finder" ) ),
+  m_readyCheckFailures( Metrics::Registry::counter( "world_cf_ready_check_failures", "",
+                                                    "Formed groups that did not pass the ready check" ) ),
+  m_queuedTickets( Metrics::Registry::gauge( "world_cf_queued_tickets", "",
+                                             "Parties and players waiting in the content finder" ) )
+{
+}
+
+Sapphire::ContentFinder::ContentFinder::~ContentFinder()
+{
+  if( !m_thread.joinable() )
+    return;
+
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+
+  m_condition.notify_one();
+  m_thread.join();
+}
+
+bool Sapphire::ContentFinder::ContentFinder::init()
+{
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+  auto& cfg = framework()->get< World::ServerMgr >()->getConfig();
+
+  m_matchInterval = cfg.contentFinder.matchInterval;
+  m_readyCheckTimeout = cfg.contentFinder.readyCheckTimeout;
+
+  auto getComposition = [ & ]( uint8_t contentMemberType, RoleArray& composition )
+  {
+    auto pMemberType = pExdData->get< Data::ContentMemberType >( contentMemberType );
+    if( !pMemberType )
+      return false;
+
+    composition[ Tank ] = pMemberType->tanksPerParty;
+    composition[ Healer ] = pMemberType->healersPerParty;
+    composition[ Dps ] = pMemberType->meleesPerParty + pMemberType->rangedPerParty;
+
+    return composition[ Tank ] + composition[ Healer ] + composition[ Dps ] > 0;
+  };
+
+  for( auto id : pExdData->getContentFinderConditionIdList() )
+  {
+    auto pCondition = pExdData->get< Data::ContentFinderCondition >( id );
+
+    // only InstanceContent can be handed to the TerritoryMgr
+    RoleArray composition{};
+    if( !pCondition || pCondition->contentLinkType != 1 ||
+        !getComposition( pCondition->contentMemberType, composition ) )
+      continue;
+
+    m_compositions[ getQueueKey( static_cast< uint16_t >( id ), 0 ) ] = composition;
+
+    for( auto rouletteId : getRoulettes( *pCondition ) )
+      m_rouletteContent[ rouletteId ].push_back( static_cast< uint16_t >( id ) );
+  }
+
+  for( auto& roulette : m_rouletteContent )
+  {
+    auto pRoulette = pExdData->get< Data::ContentRoulette >( roulette.first );
+
+    RoleArray composition{};
+    if( pRoulette && getComposition( pRoulette->contentMemberType, composition ) )
+      m_compositions[ getQueueKey( 0, roulette.first ) ] = composition;
+  }
+
+  Logger::info( "ContentFinder: {0} duties and roulettes can be queued for", m_compositions.size() );
+
+  m_thread = std::thread( &ContentFinder::run, this );
+
+  return true;
+}
+
+uint32_t Sapphire::ContentFinder::ContentFinder::getQueueKey( uint16_t contentFinderConditionId, uint8_t rouletteId )
+{
+  if( rouletteId != 0 )
+    return 0x10000 | rouletteId;
+
+  return contentFinderConditionId;
+}
+
+uint8_t Sapphire::ContentFinder::ContentFinder::getItemLevelBand( uint16_t itemLevel )
+{
+  return static_cast< uint8_t >( std::min< uint16_t >( itemLevel / ItemLevelBandSize, ItemLevelBands - 1 ) );
+}
+
+bool Sapphire::ContentFinder::ContentFinder::registerParty( const std::vector< Entity::PlayerPtr >& members,
+                                                            const std::vector< uint16_t >& contentFinderConditionIds,
+                                                            uint8_t rouletteId )
+{
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+
+  auto pTicket = std::make_shared< Ticket >();
+  pTicket->id = ++m_nextTicketId;
+  pTicket->roleCount = {};
+  pTicket->registerTime = Common::Util::getTimeMs();
+  pTicket->rouletteId = rouletteId;
+  pTicket->active = true;
+
+  uint8_t minLevel = 0xFF;
+  uint16_t minItemLevel = 0xFFFF;
+
+  for( auto& pPlayer : members )
+  {
+    // a duty that popped has to be answered first
+    if( m_playerReadyChecks.count( pPlayer->getId() ) > 0 )
+      return false;
+
+    auto pClassJob = pExdData->get< Data::ClassJob >( static_cast< uint8_t >( pPlayer->getClass() ) );
+    if( !pClassJob )
+      return false;
+
+    Role role;
+    switch( pClassJob->role )
+    {
+      case 1:
+        role = Tank;
+        break;
+      case 2:
+      case 3:
+        role = Dps;
+        break;
+      case 4:
+        role = Healer;
+        break;
+      default:
+        // crafters and gatherers
+        return false;
+    }
+
+    pTicket->members.push_back( { pPlayer->getId(), role, pPlayer->getItemLevel() } );
+    pTicket->roleCount[ role ]++;
+
+    minLevel = std::min( minLevel, pPlayer->getLevel() );
+    minItemLevel = std::min( minItemLevel, pPlayer->getItemLevel() );
+  }
+
+  if( pTicket->members.empty() )
+    return false;
+
+  auto fitsParty = [ & ]( uint32_t key )
+  {
+    auto it = m_compositions.find( key );
+    if( it == m_compositions.end() )
+      return false;
+
+    for( uint8_t role = 0; role < RoleCount; ++role )
+    {
+      if( pTicket->roleCount[ role ] > it->second[ role ] )
+        return false;
+    }
+    return true;
+  };
+
+  if( rouletteId != 0 )
+  {
+    auto pRoulette = pExdData->get< Data::ContentRoulette >( rouletteId );
+    if( pRoulette && minLevel >= pRoulette->requiredLevel && minItemLevel >= pRoulette->itemLevelRequired &&
+        fitsParty( getQueueKey( 0, rouletteId ) ) )
+      pTicket->queueKeys.push_back( getQueueKey( 0, rouletteId ) );
+  }
+  else
+  {
+    for( auto id : contentFinderConditionIds )
+    {
+      auto pCondition = pExdData->get< Data::ContentFinderCondition >( id );
+      if( pCondition && minLevel >= pCondition->classJobLevelRequired &&
+          minItemLevel >= pCondition->itemLevelRequired && fitsParty( getQueueKey( id, 0 ) ) )
+        pTicket->queueKeys.push_back( getQueueKey( id, 0 ) );
+    }
+  }
+
+  if( pTicket->queueKeys.empty() )
+    return false;
+
+  // registering again replaces the ticket the player is queued with
+  for( auto& member : pTicket->members )
+  {
+    auto it = m_playerTickets.find( member.playerId );
+    if( it != m_playerTickets.end() )
+      dropTicket( it->second, pTicket.get() );
+  }
+
+  for( auto& member : pTicket->members )
+    m_playerTickets[ member.playerId ] = pTicket;
+
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_commands.push_back( { pTicket, 0 } );
+  }
+
+  return true;
+}
+
+void Sapphire::ContentFinder::ContentFinder::withdraw( uint32_t playerId )
+{
+  auto readyCheckIt = m_playerReadyChecks.find( playerId );
+  if( readyCheckIt != m_playerReadyChecks.end() )
+  {
+    m_readyChecks[ readyCheckIt->second ].declined = true;
+    return;
+  }
+
+  auto it = m_playerTickets.find( playerId );
+  if( it == m_playerTickets.end() )
+    return;
+
+  dropTicket( it->second, nullptr );
+}
+
+void Sapphire::ContentFinder::ContentFinder::dropTicket( TicketPtr pTicket, const Ticket* pReplacement )
+{
+  for( auto& member : pTicket->members )
+  {
+    m_playerTickets.erase( member.playerId );
+
+    bool replaced = pReplacement &&
+                    std::any_of( pReplacement->members.begin(), pReplacement->members.end(),
+                                 [ & ]( const Member& other ) { return other.playerId == member.playerId; } );
+    if( !replaced )
+      sendNotify( member.playerId, 3, 1, 0, pTicket->rouletteId );
+  }
+
+  std::lock_guard< std::mutex > lock( m_mutex );
+  m_commands.push_back( { nullptr, pTicket->id } );
+}
+
+void Sapphire::ContentFinder::ContentFinder::acceptDuty( uint32_t playerId )
+{
+  auto it = m_playerReadyChecks.find( playerId );
+  if( it == m_playerReadyChecks.end() )
+    return;
+
+  m_readyChecks[ it->second ].accepted.insert( playerId );
+}
+
+bool Sapphire::ContentFinder::ContentFinder::isQueued( uint32_t playerId ) const
+{
+  return m_playerTickets.count( playerId ) > 0;
+}
+
+void Sapphire::ContentFinder::ContentFinder::run()
+{
+  while( true )
+  {
+    std::vector< Command > commands;
+
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+      m_condition.wait_for( lock, std::chrono::milliseconds( m_matchInterval ), [ this ]() { return m_stop; } );
+
+      if( m_stop )
+        return;
+
+      commands.swap( m_commands );
+    }
+
+    Metrics::ScopedTimer passTimer( m_passTime );
+
+    for( auto& command : commands )
+    {
+      if( command.pTicket )
+      {
+        addTicket( command.pTicket );
+        continue;
+      }
+
+      auto it = m_tickets.find( command.withdrawTicketId );
+      if( it != m_tickets.end() )
+        removeTicket( *it->second );
+    }
+
+    // only queues that got new tickets can form a group, a pass costs nothing for queues nobody joined
+    for( auto key : m_dirtyQueues )
+    {
+      auto& queue = m_queues[ key ];
+      queue.dirty = false;
+      matchQueue( key, queue );
+    }
+    m_dirtyQueues.clear();
+
+    m_queuedTickets.set( static_cast< int64_t >( m_tickets.size() ) );
+  }
+}
+
+void Sapphire::ContentFinder::ContentFinder::addTicket( TicketPtr pTicket )
+{
+  m_tickets[ pTicket->id ] = pTicket;
+
+  for( auto key : pTicket->queueKeys )
+  {
+    auto queueIt = m_queues.find( key );
+    if( queueIt == m_queues.end() )
+    {
+      queueIt = m_queues.emplace( key, Queue() ).first;
+      queueIt->second.composition = m_compositions.at( key );
+      queueIt->second.available = {};
+      queueIt->second.dirty = false;
+    }
+
+    auto& queue = queueIt->second;
+    if( pTicket->members.size() > 1 )
+      queue.parties.push_back( pTicket );
+    else
+    {
+      auto& member = pTicket->members.front();
+      queue.solo[ member.role ][ getItemLevelBand( member.itemLevel ) ].push_back( pTicket );
+      queue.available[ member.role ]++;
+    }
+
+    if( !queue.dirty )
+    {
+      queue.dirty = true;
+      m_dirtyQueues.push_back( key );
+    }
+  }
+}
+
+void Sapphire::ContentFinder::ContentFinder::removeTicket( Ticket& ticket )
+{
+  if( !ticket.active )
+    return;
+
+  ticket.active = false;
+
+  if( ticket.members.size() == 1 )
+  {
+    for( auto key : ticket.queueKeys )
+      m_queues[ key ].available[ ticket.members.front().role ]--;
+  }
+
+  m_tickets.erase( ticket.id );
+}
+
+Sapphire::ContentFinder::ContentFinder::TicketPtr
+  Sapphire::ContentFinder::ContentFinder::frontParty( Queue& queue )
+{
+  while( !queue.parties.empty() && !queue.parties.front()->active )
+    queue.parties.pop_front();
+
+  return queue.parties.empty() ? nullptr : queue.parties.front();
+}
+
+void Sapphire::ContentFinder::ContentFinder::takeSolo( Queue& queue, Role role, uint8_t count, uint8_t band,
+                                                       std::vector< TicketPtr >& tickets )
+{
+  // walk outwards from the band of the group, available guarantees enough active tickets are found
+  for( int32_t distance = 0; count > 0 && distance < ItemLevelBands; ++distance )
+  {
+    for( auto sign : { 1, -1 } )
+    {
+      auto index = band + sign * distance;
+      if( index < 0 || index >= ItemLevelBands || ( distance == 0 && sign < 0 ) )
+        continue;
+
+      auto& list = queue.solo[ role ][ index ];
+      while( count > 0 && !list.empty() )
+      {
+        auto pTicket = list.front();
+        list.pop_front();
+
+        if( !pTicket->active )
+          continue;
+
+        removeTicket( *pTicket );
+        tickets.push_back( pTicket );
+        count--;
+      }
+    }
+  }
+}
+
+void Sapphire::ContentFinder::ContentFinder::matchQueue( uint32_t key, Queue& queue )
+{
+  while( true )
+  {
+    RoleArray needed = queue.composition;
+    uint8_t band = ItemLevelBands;
+    uint64_t oldest = UINT64_MAX;
+
+    // the oldest party goes first, solo players fill the roles it is missing
+    auto pParty = frontParty( queue );
+    if( pParty )
+    {
+      uint32_t itemLevel = 0;
+      for( auto& member : pParty->members )
+        itemLevel += member.itemLevel;
+
+      band = getItemLevelBand( static_cast< uint16_t >( itemLevel / pParty->members.size() ) );
+
+      for( uint8_t role = 0; role < RoleCount; ++role )
+        needed[ role ] -= pParty->roleCount[ role ];
+    }
+
+    bool canMatch = true;
+    for( uint8_t role = 0; role < RoleCount; ++role )
+      canMatch &= queue.available[ role ] >= needed[ role ];
+
+    // a party that can't be filled yet does not hold back groups of solo players
+    if( !canMatch && pParty )
+    {
+      pParty = nullptr;
+      needed = queue.composition;
+      band = ItemLevelBands;
+      canMatch = true;
+      for( uint8_t role = 0; role < RoleCount; ++role )
+        canMatch &= queue.available[ role ] >= needed[ role ];
+    }
+
+    if( !canMatch )
+      return;
+
+    // without a party, the group is built around the player waiting the longest
+    if( band == ItemLevelBands )
+    {
+      for( uint8_t role = 0; role < RoleCount; ++role )
+      {
+        if( needed[ role ] == 0 )
+          continue;
+
+        for( uint8_t index = 0; index < ItemLevelBands; ++index )
+        {
+          auto& list = queue.solo[ role ][ index ];
+          while( !list.empty() && !list.front()->active )
+            list.pop_front();
+
+          if( !list.empty() && list.front()->registerTime < oldest )
+          {
+            oldest = list.front()->registerTime;
+            band = index;
+          }
+        }
+      }
+    }
+
+    Match match;
+    match.rouletteId = static_cast< uint8_t >( key >> 16 ? key & 0xFF : 0 );
+
+    if( pParty )
+    {
+      queue.parties.pop_front();
+      removeTicket( *pParty );
+      match.tickets.push_back( pParty );
+    }
+
+    for( uint8_t role = 0; role < RoleCount; ++role )
+      takeSolo( queue, static_cast< Role >( role ), needed[ role ], band, match.tickets );
+
+    if( match.rouletteId != 0 )
+    {
+      auto& content = m_rouletteContent.at( match.rouletteId );
+      std::uniform_int_distribution< std::size_t > distribution( 0, content.size() - 1 );
+      match.contentFinderConditionId = content[ distribution( m_rng ) ];
+    }
+    else
+      match.contentFinderConditionId = key;
+
+    auto now = Common::Util::getTimeMs();
+    for( auto& pTicket : match.tickets )
+    {
+      for( std::size_t i = 0; i < pTicket->members.size(); ++i )
+        m_waitTime.record( now - pTicket->registerTime );
+    }
+    m_matchCount.inc();
+
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_matches.push_back( std::move( match ) );
+  }
+}
+
+void Sapphire::ContentFinder::ContentFinder::update( uint64_t tickCount )
+{
+  std::vector< Match > matches;
+
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    matches.swap( m_matches );
+  }
+
+  for( auto& match : matches )
+    startReadyCheck( match, tickCount );
+
+  for( auto it = m_readyChecks.begin(); it != m_readyChecks.end(); )
+  {
+    auto& readyCheck = it->second;
+
+    std::size_t memberCount = 0;
+    for( auto& pTicket : readyCheck.match.tickets )
+      memberCount += pTicket->members.size();
+
+    if( readyCheck.accepted.size() == memberCount )
+      finishReadyCheck( readyCheck );
+    else if( readyCheck.declined || tickCount > readyCheck.expireTime )
+      failReadyCheck( readyCheck );
+    else
+    {
+      ++it;
+      continue;
+    }
+
+    for( auto& pTicket : readyCheck.match.tickets )
+    {
+      for( auto& member : pTicket->members )
+        m_playerReadyChecks.erase( member.playerId );
+    }
+    it = m_readyChecks.erase( it );
+  }
+}
+
+void Sapphire::ContentFinder::ContentFinder::startReadyCheck( Match& match, uint64_t tickCount )
+{
+  auto pServerMgr = framework()->get< World::ServerMgr >();
+
+  auto id = match.tickets.front()->id;
+  auto& readyCheck = m_readyChecks[ id ];
+  readyCheck.declined = false;
+  readyCheck.expireTime = tickCount + m_readyCheckTimeout * 1000;
+
+  for( auto& pTicket : match.tickets )
+  {
+    for( auto& member : pTicket->members )
+    {
+      m_playerReadyChecks[ member.playerId ] = id;
+
+      // players who logged out while queued decline right away
+      if( !pServerMgr->getSession( member.playerId ) )
+        readyCheck.declined = true;
+
+      sendNotify( member.playerId, 4, 0, static_cast< uint16_t >( match.contentFinderConditionId ), match.rouletteId );
+    }
+  }
+
+  readyCheck.match = std::move( match );
+}
+
+void Sapphire::ContentFinder::ContentFinder::finishReadyCheck( ReadyCheck& readyCheck )
+{
+  auto pServerMgr = framework()->get< World::ServerMgr >();
+  auto pTeriMgr = framework()->get< World::Manager::TerritoryMgr >();
+
+  auto& match = readyCheck.match;
+  auto pZone = pTeriMgr->createInstanceContent( match.contentFinderConditionId );
+
+  for( auto& pTicket : match.tickets )
+  {
+    for( auto& member : pTicket->members )
+    {
+      m_playerTickets.erase( member.playerId );
+
+      auto pSession = pServerMgr->getSession( member.playerId );
+      if( !pSession || !pSession->getPlayer() )
+        continue;
+
+      auto pPlayer = pSession->getPlayer();
+      if( !pZone )
+      {
+        sendNotify( member.playerId, 3, 1, 0, match.rouletteId );
+        continue;
+      }
+
+      pZone->getAsInstanceContent()->bindPlayer( member.playerId );
+      pPlayer->setInstance( pZone );
+    }
+  }
+
+  if( !pZone )
+    Logger::error( "ContentFinder: unable to create instance for contentFinderCondition#{0}",
+                   match.contentFinderConditionId );
+}
+
+void Sapphire::ContentFinder::ContentFinder::failReadyCheck( ReadyCheck& readyCheck )
+{
+  m_readyCheckFailures.inc();
+
+  std::vector< Command > requeued;
+
+  for( auto& pTicket : readyCheck.match.tickets )
+  {
+    bool ready = true;
+    for( auto& member : pTicket->members )
+      ready &= readyCheck.accepted.count( member.playerId ) > 0;
+
+    if( !ready )
+    {
+      for( auto& member : pTicket->members )
+      {
+        m_playerTickets.erase( member.playerId );
+        sendNotify( member.playerId, 3, 1, 0, pTicket->rouletteId );
+      }
+      continue;
+    }
+
+    // whoever was ready goes back into the queue, keeping their place
+    auto pRequeued = std::make_shared< Ticket >( *pTicket );
+    pRequeued->id = ++m_nextTicketId;
+    pRequeued->active = true;
+
+    for( auto& member : pRequeued->members )
+      m_playerTickets[ member.playerId ] = pRequeued;
+
+    requeued.push_back( { pRequeued, 0 } );
+  }
+
+  std::lock_guard< std::mutex > lock( m_mutex );
+  m_commands.insert( m_commands.end(), requeued.begin(), requeued.end() );
+}
+
+void Sapphire::ContentFinder::ContentFinder::sendNotify( uint32_t playerId, uint32_t state1, uint32_t state2,
+                                                         uint16_t contentFinderConditionId, uint8_t rouletteId )
+{
+  auto pSession = framework()->get< World::ServerMgr >()->getSession( playerId );
+  if( !pSession || !pSession->getPlayer() )
+    return;
+
+  auto notifyPacket = makeZonePacket< FFXIVIpcCFNotify >( playerId );
+  notifyPacket->data().state1 = state1;
+  notifyPacket->data().state2 = state2;
+  notifyPacket->data().param4 = rouletteId;
+  notifyPacket->data().contents[ 0 ] = contentFinderConditionId;
+  pSession->getPlayer()->queuePacket( notifyPacket );
+}
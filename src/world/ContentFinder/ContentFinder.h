@@ -2,6 +2,198 @@
 #define _CONTENTFINDER_H
 
 #include "../ForwardsZone.h"
+#include "Manager/BaseManager.h"
 
+#include <Metrics/Metrics.h>
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+namespace Sapphire::ContentFinder
+{
+
+  /*!
+   * @brief Matchmaking for duties and roulettes
+   *
+   * Registrations are queued per duty and per roulette, and inside a queue by role and item level band.
+   * Matching runs on its own thread at a fixed interval and only ever touches its own queues. Formed
+   * groups are handed back to the main thread, which runs the ready check and creates the instance.
+   * Everything but the matching thread itself has to be called from the main thread.
+   */
+  class ContentFinder : public World::Manager::BaseManager
+  {
+  public:
+    enum Role : uint8_t
+    {
+      Tank,
+      Healer,
+      Dps,
+      RoleCount
+    };
+
+    using RoleArray = std::array< uint8_t, RoleCount >;
+
+    explicit ContentFinder( FrameworkPtr pFw );
+
+    ~ContentFinder() override;
+
+    /*! caches the party composition of every duty and roulette and starts the matching thread */
+    bool init();
+
+    /*!
+     * @brief Registers a party, or a single player, as one ticket
+     * @param members the party, all of them are matched into the same group
+     * @param contentFinderConditionIds the duties the party is fine with, unsuited ones are dropped
+     * @param rouletteId registers for the roulette instead of the given duties if not 0
+     * @return false if nothing the party could be matched into is left or a member is in a ready check,
+     *         a ticket a member is already queued with is replaced otherwise
+     */
+    bool registerParty( const std::vector< Entity::PlayerPtr >& members,
+                        const std::vector< uint16_t >& contentFinderConditionIds, uint8_t rouletteId );
+
+    /*! withdraws the ticket of the player, for the whole party, or declines the ready check it is in */
+    void withdraw( uint32_t playerId );
+
+    /*! marks the player as ready for the duty that popped for it */
+    void acceptDuty( uint32_t playerId );
+
+    /*! returns true if the player is queued or in a ready check */
+    bool isQueued( uint32_t playerId ) const;
+
+    /*! runs ready checks for the groups matched since the last call */
+    void update( uint64_t tickCount );
+
+  private:
+    static constexpr uint8_t ItemLevelBands = 16;
+
+    struct Member
+    {
+      uint32_t playerId;
+      Role role;
+      uint16_t itemLevel;
+    };
+
+    struct Ticket
+    {
+      uint32_t id;
+      std::vector< Member > members;
+      RoleArray roleCount;
+      // duties or roulette the ticket is queued for, see getQueueKey
+      std::vector< uint32_t > queueKeys;
+      uint64_t registerTime;
+      uint8_t rouletteId;
+      // only touched by the matching thread, entries of inactive tickets left in queues are skipped
+      bool active;
+    };
+
+    using TicketPtr = std::shared_ptr< Ticket >;
+
+    struct Queue
+    {
+      RoleArray composition;
+      // active solo tickets per role
+      std::array< uint32_t, RoleCount > available;
+      // solo tickets in order of registration, by role and item level band
+      std::array< std::array< std::deque< TicketPtr >, ItemLevelBands >, RoleCount > solo;
+      std::deque< TicketPtr > parties;
+      bool dirty;
+    };
+
+    struct Command
+    {
+      TicketPtr pTicket;
+      // set to withdraw the ticket with that id instead of registering pTicket
+      uint32_t withdrawTicketId;
+    };
+
+    struct Match
+    {
+      uint32_t contentFinderConditionId;
+      uint8_t rouletteId;
+      std::vector< TicketPtr > tickets;
+    };
+
+    struct ReadyCheck
+    {
+      Match match;
+      std::set< uint32_t > accepted;
+      bool declined;
+      uint64_t expireTime;
+    };
+
+    static uint32_t getQueueKey( uint16_t contentFinderConditionId, uint8_t rouletteId );
+
+    static uint8_t getItemLevelBand( uint16_t itemLevel );
+
+    /*! matching thread, sleeps for the match interval between passes */
+    void run();
+
+    /*! takes the ticket out of the queue for all its members, those not part of pReplacement are told */
+    void dropTicket( TicketPtr pTicket, const Ticket* pReplacement );
+
+    void addTicket( TicketPtr pTicket );
+
+    /*! marks the ticket as done and takes it out of the counts of every queue it is in */
+    void removeTicket( Ticket& ticket );
+
+    /*! forms groups until the queue runs out of a role */
+    void matchQueue( uint32_t key, Queue& queue );
+
+    /*! takes the oldest active party of the queue, nullptr if there is none */
+    TicketPtr frontParty( Queue& queue );
+
+    /*! takes count solo tickets of the role, closest item level band first */
+    void takeSolo( Queue& queue, Role role, uint8_t count, uint8_t band, std::vector< TicketPtr >& tickets );
+
+    void startReadyCheck( Match& match, uint64_t tickCount );
+
+    void finishReadyCheck( ReadyCheck& readyCheck );
+
+    void failReadyCheck( ReadyCheck& readyCheck );
+
+    void sendNotify( uint32_t playerId, uint32_t state1, uint32_t state2, uint16_t contentFinderConditionId,
+                     uint8_t rouletteId );
+
+    // read only once init is done, shared by both threads
+    std::unordered_map< uint32_t, RoleArray > m_compositions;
+    std::unordered_map< uint8_t, std::vector< uint16_t > > m_rouletteContent;
+    uint32_t m_matchInterval;
+    uint32_t m_readyCheckTimeout;
+
+    // owned by the matching thread
+    std::unordered_map< uint32_t, TicketPtr > m_tickets;
+    std::unordered_map< uint32_t, Queue > m_queues;
+    std::vector< uint32_t > m_dirtyQueues;
+    std::mt19937 m_rng;
+
+    // owned by the main thread
+    uint32_t m_nextTicketId;
+    std::unordered_map< uint32_t, TicketPtr > m_playerTickets;
+    std::unordered_map< uint32_t, ReadyCheck > m_readyChecks;
+    std::unordered_map< uint32_t, uint32_t > m_playerReadyChecks;
+
+    // handed between the threads, guarded by m_mutex
+    std::vector< Command > m_commands;
+    std::vector< Match > m_matches;
+    bool m_stop;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::thread m_thread;
+
+    Metrics::Histogram& m_waitTime;
+    Metrics::Histogram& m_passTime;
+    Metrics::Counter& m_matchCount;
+    Metrics::Counter& m_readyCheckFailures;
+    Metrics::Gauge& m_queuedTickets;
+  };
+
+}
 
 #endif
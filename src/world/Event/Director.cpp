@@ -183,6 +183,15 @@ void Sapphire::Event::Director::setDirectorSequence( uint8_t value )
   m_sequence = value;
 }
 
+void Sapphire::Event::Director::resetDirector()
+{
+  m_sequence = 1;
+  m_branch = 0;
+  m_elapsedTime = 0;
+  memset( m_unionData.arrData, 0, sizeof( m_unionData ) );
+  m_customVarMap.clear();
+}
+
 void Sapphire::Event::Director::setCustomVar( uint32_t varId, uint32_t value )
 {
   m_customVarMap[ varId ] = value;
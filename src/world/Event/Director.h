@@ -107,6 +107,9 @@ namespace Sapphire::Event
     void setCustomVar( uint32_t varId, uint32_t value );
     uint32_t getCustomVar( uint32_t varId );
 
+    /*! resets sequence, branch and all vars to the state of a freshly created director */
+    void resetDirector();
+
   private:
     /*! Id of the content of the director */
     uint16_t m_contentId;
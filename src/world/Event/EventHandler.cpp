@@ -1,11 +1,15 @@
 #include "EventHandler.h"
 
+#include "Script/NativeScriptMgr.h"
+
 Sapphire::Event::EventHandler::EventHandler( uint64_t actorId, uint32_t eventId,
                                              EventType eventType, uint32_t eventParam ) :
   m_actorId( actorId ),
   m_eventId( eventId ),
   m_eventType( eventType ),
-  m_playedScene( false )
+  m_playedScene( false ),
+  m_pScriptSlot( nullptr ),
+  m_pBaseScriptSlot( nullptr )
 {
   m_entryId = static_cast< uint16_t >( eventId );
   m_type = static_cast< uint16_t >( eventId >> 16 );
@@ -50,7 +54,8 @@ Sapphire::Event::EventHandler::SceneReturnCallback Sapphire::Event::EventHandler
 
 void Sapphire::Event::EventHandler::setEventReturnCallback( SceneReturnCallback callback )
 {
-  m_returnCallback = callback;
+  // a callback set by a script keeps its module loaded until the callback is replaced or the event ends
+  m_returnCallback = Scripting::bindToCallingModule( std::move( callback ) );
 }
 
 Sapphire::Event::EventHandler::SceneChainCallback Sapphire::Event::EventHandler::getSceneChainCallback() const
@@ -60,7 +65,7 @@ Sapphire::Event::EventHandler::SceneChainCallback Sapphire::Event::EventHandler:
 
 void Sapphire::Event::EventHandler::setSceneChainCallback( Sapphire::Event::EventHandler::SceneChainCallback callback )
 {
-  m_chainCallback = callback;
+  m_chainCallback = Scripting::bindToCallingModule( std::move( callback ) );
 }
 
 Sapphire::Event::EventHandler::EventFinishCallback Sapphire::Event::EventHandler::getEventFinishCallback() const
@@ -70,7 +75,7 @@ Sapphire::Event::EventHandler::EventFinishCallback Sapphire::Event::EventHandler
 
 void Sapphire::Event::EventHandler::setEventFinishCallback( EventFinishCallback callback )
 {
-  m_finishCallback = callback;
+  m_finishCallback = Scripting::bindToCallingModule( std::move( callback ) );
 }
 
 bool Sapphire::Event::EventHandler::hasPlayedScene() const
@@ -93,3 +98,18 @@ void Sapphire::Event::EventHandler::removeNestedEvent()
   m_pNestedEvent.reset();
 }
 
+void Sapphire::Event::EventHandler::setScriptSlots( Scripting::ScriptSlot* pSlot, Scripting::ScriptSlot* pBaseSlot )
+{
+  m_pScriptSlot = pSlot;
+  m_pBaseScriptSlot = pBaseSlot;
+}
+
+Sapphire::Scripting::ScriptSlot* Sapphire::Event::EventHandler::getScriptSlot() const
+{
+  return m_pScriptSlot;
+}
+
+Sapphire::Scripting::ScriptSlot* Sapphire::Event::EventHandler::getBaseScriptSlot() const
+{
+  return m_pBaseScriptSlot;
+}
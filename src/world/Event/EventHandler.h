@@ -118,6 +118,15 @@ namespace Sapphire::Event
 
     void removeNestedEvent();
 
+    /*!
+     * @brief Binds the script slots of the event, the base slot is used if no script exists for the exact event id
+     */
+    void setScriptSlots( Scripting::ScriptSlot* pSlot, Scripting::ScriptSlot* pBaseSlot );
+
+    Scripting::ScriptSlot* getScriptSlot() const;
+
+    Scripting::ScriptSlot* getBaseScriptSlot() const;
+
   protected:
     uint64_t m_actorId;
     uint32_t m_eventId;
@@ -130,6 +139,8 @@ namespace Sapphire::Event
     SceneReturnCallback m_returnCallback;
     SceneChainCallback m_chainCallback;
     EventFinishCallback m_finishCallback;
+    Scripting::ScriptSlot* m_pScriptSlot;
+    Scripting::ScriptSlot* m_pBaseScriptSlot;
   };
 
 }
@@ -51,6 +51,7 @@ namespace Inventory
 using InventoryContainerPair = std::pair< Common::InventoryType, uint8_t >;
 using InventoryTypeList = std::vector< Common::InventoryType >;
 TYPE_FORWARD( HousingItem );
+TYPE_FORWARD( InventoryChangeSet );
 }
 
 namespace World::Manager
@@ -74,6 +75,7 @@ TYPE_FORWARD( BNpcTemplate );
 TYPE_FORWARD( BNpc );
 TYPE_FORWARD( SpawnPoint );
 TYPE_FORWARD( SpawnGroup );
+TYPE_FORWARD( ZoneInSnapshot );
 }
 
 namespace Event
@@ -115,6 +117,7 @@ TYPE_FORWARD( ContentFinder );
 namespace Scripting
 {
 class NativeScriptMgr;
+struct ScriptSlot;
 }
 
 }
@@ -0,0 +1,185 @@
+#include <Database/DatabaseDef.h>
+#include <Logging/Logger.h>
+
+#include "InventoryChangeSet.h"
+#include "ItemContainer.h"
+#include "Item.h"
+#include "Framework.h"
+
+Sapphire::Inventory::InventoryChangeSet::InventoryChangeSet( uint32_t characterId, FrameworkPtr pFw ) :
+  m_characterId( characterId ),
+  m_pFw( pFw ),
+  m_pFlushState( std::make_shared< FlushState >() )
+{
+}
+
+void Sapphire::Inventory::InventoryChangeSet::insertItem( ItemPtr pItem )
+{
+  m_insertedItems.push_back( pItem );
+}
+
+void Sapphire::Inventory::InventoryChangeSet::updateItem( ItemPtr pItem )
+{
+  m_updatedItems[ pItem->getUId() ] = pItem;
+}
+
+void Sapphire::Inventory::InventoryChangeSet::deleteItem( ItemPtr pItem )
+{
+  m_updatedItems.erase( pItem->getUId() );
+  m_deletedItems.insert( pItem->getUId() );
+}
+
+void Sapphire::Inventory::InventoryChangeSet::removeItem( ItemPtr pItem )
+{
+  m_updatedItems.erase( pItem->getUId() );
+  m_deletedItems.erase( pItem->getUId() );
+  m_removedItems.insert( pItem->getUId() );
+}
+
+void Sapphire::Inventory::InventoryChangeSet::updateSlot( ItemContainerPtr pContainer, uint16_t slotId )
+{
+  if( !pContainer->isPersistentStorage() )
+    return;
+
+  auto& changes = m_containerChanges[ pContainer->getId() ];
+  changes.pContainer = pContainer;
+  changes.slots.insert( slotId );
+}
+
+void Sapphire::Inventory::InventoryChangeSet::updateContainer( ItemContainerPtr pContainer )
+{
+  if( !pContainer->isPersistentStorage() )
+    return;
+
+  auto& changes = m_containerChanges[ pContainer->getId() ];
+  changes.pContainer = pContainer;
+
+  // the tables have one more column than the containers have slots, keep writing it like before
+  for( uint16_t slotId = 0; slotId <= pContainer->getMaxSize(); slotId++ )
+    changes.slots.insert( slotId );
+}
+
+bool Sapphire::Inventory::InventoryChangeSet::isEmpty() const
+{
+  return m_insertedItems.empty() && m_updatedItems.empty() && m_deletedItems.empty() && m_removedItems.empty() &&
+         m_containerChanges.empty();
+}
+
+bool Sapphire::Inventory::InventoryChangeSet::flush( bool sync )
+{
+  if( isEmpty() )
+    return true;
+
+  auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+
+  {
+    std::unique_lock< std::mutex > lock( m_pFlushState->mutex );
+
+    // a sync flush still has to wait for the batch in flight to keep the order intact
+    if( sync )
+      m_pFlushState->condition.wait( lock, [ this ]() { return !m_pFlushState->pending; } );
+    else if( m_pFlushState->pending )
+      return false;
+  }
+
+  auto transaction = std::make_shared< Db::Transaction >();
+
+  for( auto& pItem : m_insertedItems )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_INS );
+    stmt->setUInt( 1, m_characterId );
+    stmt->setUInt64( 2, pItem->getUId() );
+    stmt->setUInt( 3, pItem->getId() );
+    stmt->setUInt( 4, pItem->getStackSize() );
+    transaction->append( stmt );
+  }
+
+  for( auto& entry : m_updatedItems )
+  {
+    auto& pItem = entry.second;
+
+    auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_UP );
+    stmt->setInt( 1, pItem->getStackSize() );
+    stmt->setInt( 2, pItem->getDurability() );
+    stmt->setInt( 3, pItem->getStain() );
+    stmt->setInt64( 4, pItem->getUId() );
+    transaction->append( stmt );
+  }
+
+  // the wide container tables can't be addressed by a prepared statement per slot,
+  // only the changed columns of a container end up in its update
+  for( auto& entry : m_containerChanges )
+  {
+    auto& changes = entry.second;
+    auto& pContainer = changes.pContainer;
+
+    std::string query = "UPDATE " + pContainer->getTableName() + " SET ";
+
+    bool first = true;
+    for( auto slotId : changes.slots )
+    {
+      auto pItem = pContainer->getItem( static_cast< uint8_t >( slotId ) );
+
+      if( !first )
+        query += ", ";
+      first = false;
+
+      query += "container_" + std::to_string( slotId ) + " = " + std::to_string( pItem ? pItem->getUId() : 0 );
+    }
+
+    query += " WHERE CharacterId = " + std::to_string( m_characterId );
+
+    if( pContainer->isMultiStorage() )
+      query += " AND storageId = " + std::to_string( pContainer->getId() );
+
+    transaction->append( query );
+  }
+
+  for( auto uId : m_deletedItems )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_DELETE );
+    stmt->setInt64( 1, uId );
+    transaction->append( stmt );
+  }
+
+  for( auto uId : m_removedItems )
+  {
+    auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_REMOVE );
+    stmt->setInt64( 1, uId );
+    transaction->append( stmt );
+  }
+
+  m_insertedItems.clear();
+  m_updatedItems.clear();
+  m_deletedItems.clear();
+  m_removedItems.clear();
+  m_containerChanges.clear();
+
+  if( sync )
+  {
+    if( !pDb->directExecute( transaction ) )
+      Logger::error( "Inventory changes of character {0} were rolled back", m_characterId );
+    return true;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( m_pFlushState->mutex );
+    m_pFlushState->pending = true;
+  }
+
+  auto pFlushState = m_pFlushState;
+  auto characterId = m_characterId;
+  pDb->execute( transaction, [ pFlushState, characterId ]( bool committed )
+  {
+    if( !committed )
+      Logger::error( "Inventory changes of character {0} were rolled back", characterId );
+
+    {
+      std::lock_guard< std::mutex > lock( pFlushState->mutex );
+      pFlushState->pending = false;
+    }
+    pFlushState->condition.notify_all();
+  } );
+
+  return true;
+}
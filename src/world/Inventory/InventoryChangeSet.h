@@ -0,0 +1,86 @@
+#ifndef SAPPHIRE_INVENTORYCHANGESET_H
+#define SAPPHIRE_INVENTORYCHANGESET_H
+
+#include <Common.h>
+#include "ForwardsZone.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Inventory
+{
+
+  /*!
+   * @brief Records the inventory changes of a character and writes them to the db in batches
+   *
+   * Changes are coalesced until the next flush, an item modified multiple times is written once and
+   * only the container slots that actually changed are written. Values are read from the items and
+   * containers at the time of the flush.
+   *
+   * A flush is queued as a single transaction on the async db workers. The next flush is held back until
+   * the previous transaction has finished, so the db never sees the changes of a character out of order.
+   * A batch that fails is rolled back as a whole and its changes are lost, the error is logged.
+   */
+  class InventoryChangeSet
+  {
+  public:
+    InventoryChangeSet( uint32_t characterId, FrameworkPtr pFw );
+
+    void insertItem( ItemPtr pItem );
+
+    void updateItem( ItemPtr pItem );
+
+    /*! flags the item as deleted, pending updates of the item are dropped */
+    void deleteItem( ItemPtr pItem );
+
+    /*! removes the row of the item, written after every other change of the batch */
+    void removeItem( ItemPtr pItem );
+
+    void updateSlot( ItemContainerPtr pContainer, uint16_t slotId );
+
+    void updateContainer( ItemContainerPtr pContainer );
+
+    bool isEmpty() const;
+
+    /*!
+     * @brief Writes all recorded changes
+     * @param sync blocks until the changes are committed, used when the character is unloaded
+     * @return false if the previous batch is still in flight, the changes are kept for the next flush
+     */
+    bool flush( bool sync = false );
+
+  private:
+    struct ContainerChanges
+    {
+      ItemContainerPtr pContainer;
+      std::set< uint16_t > slots;
+    };
+
+    uint32_t m_characterId;
+    FrameworkPtr m_pFw;
+
+    std::vector< ItemPtr > m_insertedItems;
+    std::unordered_map< uint64_t, ItemPtr > m_updatedItems;
+    std::set< uint64_t > m_deletedItems;
+    std::set< uint64_t > m_removedItems;
+    std::map< uint16_t, ContainerChanges > m_containerChanges;
+
+    // shared with the callback of the batch in flight, a sync flush sleeps on it until the batch is done
+    struct FlushState
+    {
+      std::mutex mutex;
+      std::condition_variable condition;
+      bool pending = false;
+    };
+
+    std::shared_ptr< FlushState > m_pFlushState;
+  };
+
+}
+
+#endif //SAPPHIRE_INVENTORYCHANGESET_H
@@ -4,6 +4,7 @@
 
 #include "Framework.h"
 #include "Item.h"
+#include "Manager/ItemMgr.h"
 
 Sapphire::Item::Item( uint64_t uId, uint32_t catalogId, FrameworkPtr pFw, bool isHq ) :
   m_id( catalogId ),
@@ -15,8 +16,8 @@ Sapphire::Item::Item( uint64_t uId, uint32_t catalogId, FrameworkPtr pFw, bool i
   m_reservedFlag( 0 ),
   m_pFw( pFw )
 {
-  auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
-  auto itemInfo = pExdData->get< Sapphire::Data::Item >( catalogId );
+  auto pItemMgr = m_pFw->get< World::Manager::ItemMgr >();
+  auto itemInfo = pItemMgr->getItemInfo( catalogId );
 
   m_delayMs = itemInfo->delayms;
   m_physicalDmg = itemInfo->damagePhys;
@@ -1,4 +1,5 @@
 #include "ActionMgr.h"
+#include "CombatDataMgr.h"
 
 #include "Action/Action.h"
 #include "Action/ItemAction.h"
@@ -19,17 +20,18 @@ World::Manager::ActionMgr::ActionMgr( Sapphire::FrameworkPtr pFw ) :
 }
 
 void World::Manager::ActionMgr::handlePlacedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                                          Data::ActionPtr actionData, Common::FFXIVARR_POSITION3 pos )
+                                                          const CombatActionData& actionData,
+                                                          Common::FFXIVARR_POSITION3 pos )
 {
-  player.sendDebug( "got aoe act: {0}", actionData->name );
+  player.sendDebug( "got aoe act: {0}", actionId );
 
 
-  auto action = Action::make_Action( player.getAsPlayer(), actionId, actionData, framework() );
+  auto action = Action::make_Action( player.getAsPlayer(), actionId, framework() );
 
   if( !action->init() )
     return;
 
-  if( !actionData->targetArea )
+  if( !actionData.targetArea )
   {
     // not an action that has an aoe, cancel it
     action->interrupt();
@@ -38,13 +40,13 @@ void World::Manager::ActionMgr::handlePlacedPlayerAction( Entity::Player& player
 
   action->setPos( pos );
 
-  bootstrapAction( player, action, *actionData );
+  bootstrapAction( player, action );
 }
 
 void World::Manager::ActionMgr::handleTargetedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                                            Data::ActionPtr actionData, uint64_t targetId )
+                                                            const CombatActionData& actionData, uint64_t targetId )
 {
-  auto action = Action::make_Action( player.getAsPlayer(), actionId, actionData, framework() );
+  auto action = Action::make_Action( player.getAsPlayer(), actionId, framework() );
 
   action->setTargetId( targetId );
 
@@ -52,13 +54,13 @@ void World::Manager::ActionMgr::handleTargetedPlayerAction( Entity::Player& play
     return;
 
   // cancel any aoe actions casted with this packet
-  if( actionData->targetArea )
+  if( actionData.targetArea )
   {
     action->interrupt();
     return;
   }
 
-  bootstrapAction( player, action, *actionData );
+  bootstrapAction( player, action );
 }
 
 void World::Manager::ActionMgr::handleItemAction( Sapphire::Entity::Player& player, uint32_t itemId,
@@ -75,8 +77,7 @@ void World::Manager::ActionMgr::handleItemAction( Sapphire::Entity::Player& play
 }
 
 void World::Manager::ActionMgr::bootstrapAction( Entity::Player& player,
-                                                 Action::ActionPtr currentAction,
-                                                 Data::Action& actionData )
+                                                 Action::ActionPtr currentAction )
 {
   if( !currentAction->preCheck() )
   {
@@ -6,15 +6,14 @@
 
 namespace Sapphire::Data
 {
-  struct Action;
-  using ActionPtr = std::shared_ptr< Action >;
-
   struct ItemAction;
   using ItemActionPtr = std::shared_ptr< ItemAction >;
 }
 
 namespace Sapphire::World::Manager
 {
+  struct CombatActionData;
+
   class ActionMgr : public Manager::BaseManager
   {
   public:
@@ -22,15 +21,15 @@ namespace Sapphire::World::Manager
     ~ActionMgr() = default;
 
     void handleTargetedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                     Data::ActionPtr actionData, uint64_t targetId );
+                                     const CombatActionData& actionData, uint64_t targetId );
     void handlePlacedPlayerAction( Entity::Player& player, uint32_t actionId,
-                                   Data::ActionPtr actionData, Common::FFXIVARR_POSITION3 pos );
+                                   const CombatActionData& actionData, Common::FFXIVARR_POSITION3 pos );
 
     void handleItemAction( Entity::Player& player, uint32_t itemId, Data::ItemActionPtr itemActionData,
                            uint16_t itemSourceSlot, uint16_t itemSourceContainer );
 
   private:
-    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction, Data::Action& actionData );
+    void bootstrapAction( Entity::Player& player, Action::ActionPtr currentAction );
 
     // item action handlers
     void handleItemActionVFX( Entity::Player& player, uint32_t itemId, uint16_t vfxId );
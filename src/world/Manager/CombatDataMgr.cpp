@@ -0,0 +1,110 @@
+#include "CombatDataMgr.h"
+
+#include <Exd/ExdDataGenerated.h>
+#include <Logging/Logger.h>
+
+#include "Framework.h"
+
+Sapphire::World::Manager::CombatDataMgr::CombatDataMgr( Sapphire::FrameworkPtr pFw ) :
+  BaseManager( pFw )
+{
+
+}
+
+bool Sapphire::World::Manager::CombatDataMgr::init()
+{
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+
+  // id lists are ordered, the last entry is the highest id
+  auto& actionIds = pExdData->getActionIdList();
+  auto& classJobIds = pExdData->getClassJobIdList();
+  auto& paramGrowIds = pExdData->getParamGrowIdList();
+
+  if( actionIds.empty() || classJobIds.empty() || paramGrowIds.empty() )
+    return false;
+
+  m_actions.assign( *actionIds.rbegin() + 1, CombatActionData{} );
+  for( auto id : actionIds )
+  {
+    auto action = pExdData->get< Data::Action >( id );
+    if( !action )
+      continue;
+
+    auto& entry = m_actions[ id ];
+    entry.cast100ms = action->cast100ms;
+    entry.recast100ms = action->recast100ms;
+    entry.primaryCostValue = action->primaryCostValue;
+    entry.actionCombo = action->actionCombo;
+    entry.classJob = action->classJob;
+    entry.classJobLevel = action->classJobLevel;
+    entry.range = action->range;
+    entry.effectRange = action->effectRange;
+    entry.castType = action->castType;
+    entry.aspect = action->aspect;
+    entry.primaryCostType = action->primaryCostType;
+    entry.cooldownGroup = action->cooldownGroup;
+    entry.canTargetSelf = action->canTargetSelf;
+    entry.canTargetParty = action->canTargetParty;
+    entry.canTargetFriendly = action->canTargetFriendly;
+    entry.canTargetHostile = action->canTargetHostile;
+    entry.canTargetDead = action->canTargetDead;
+    entry.targetArea = action->targetArea;
+    entry.preservesCombo = action->preservesCombo;
+    entry.isValid = true;
+  }
+
+  uint32_t lutEntries = 0;
+  for( auto& lut : Action::ActionLut::m_actionLut )
+  {
+    if( lut.first >= m_actions.size() || !m_actions[ lut.first ].isValid )
+    {
+      Logger::warn( "CombatDataMgr: ActionLut entry for unknown action#{0}", lut.first );
+      continue;
+    }
+
+    auto& entry = m_actions[ lut.first ];
+    entry.lutEntry = lut.second;
+    entry.hasLutEntry = Action::ActionLut::validEntryExists( lut.first );
+    lutEntries++;
+  }
+
+  m_classJobs.assign( *classJobIds.rbegin() + 1, CombatClassJobData{} );
+  for( auto id : classJobIds )
+  {
+    auto classJob = pExdData->get< Data::ClassJob >( id );
+    if( !classJob )
+      continue;
+
+    auto& entry = m_classJobs[ id ];
+    entry.modifierHitPoints = classJob->modifierHitPoints;
+    entry.modifierManaPoints = classJob->modifierManaPoints;
+    entry.modifierStrength = classJob->modifierStrength;
+    entry.modifierVitality = classJob->modifierVitality;
+    entry.modifierDexterity = classJob->modifierDexterity;
+    entry.modifierIntelligence = classJob->modifierIntelligence;
+    entry.modifierMind = classJob->modifierMind;
+    entry.modifierPiety = classJob->modifierPiety;
+    entry.classJobParent = classJob->classJobParent;
+    entry.primaryStat = classJob->primaryStat;
+    entry.isValid = true;
+  }
+
+  m_levels.assign( *paramGrowIds.rbegin() + 1, CombatLevelData{} );
+  for( auto id : paramGrowIds )
+  {
+    auto paramGrow = pExdData->get< Data::ParamGrow >( id );
+    if( !paramGrow )
+      continue;
+
+    auto& entry = m_levels[ id ];
+    entry.mpModifier = paramGrow->mpModifier;
+    entry.baseSpeed = paramGrow->baseSpeed;
+    entry.hpModifier = paramGrow->hpModifier;
+    entry.isValid = true;
+  }
+
+  Logger::info( "CombatDataMgr: {0} actions ({1} lut entries), {2} classes, {3} levels",
+                actionIds.size(), lutEntries, classJobIds.size(), paramGrowIds.size() );
+
+  return true;
+}
@@ -0,0 +1,128 @@
+#ifndef SAPPHIRE_COMBATDATAMGR_H
+#define SAPPHIRE_COMBATDATAMGR_H
+
+#include <Common.h>
+#include "ForwardsZone.h"
+#include "BaseManager.h"
+
+#include "Action/ActionLut.h"
+
+#include <vector>
+
+namespace Sapphire::World::Manager
+{
+
+  /*!
+   * @brief The fields of an Action row that are used while casting, plus its ActionLut potencies
+   */
+  struct CombatActionData
+  {
+    uint16_t cast100ms;
+    uint16_t recast100ms;
+    uint16_t primaryCostValue;
+    uint16_t actionCombo;
+    int8_t classJob;
+    uint8_t classJobLevel;
+    int8_t range;
+    uint8_t effectRange;
+    uint8_t castType;
+    uint8_t aspect;
+    uint8_t primaryCostType;
+    uint8_t cooldownGroup;
+
+    bool isValid : 1;
+    bool canTargetSelf : 1;
+    bool canTargetParty : 1;
+    bool canTargetFriendly : 1;
+    bool canTargetHostile : 1;
+    bool canTargetDead : 1;
+    bool targetArea : 1;
+    bool preservesCombo : 1;
+    // set if the ActionLut has an entry with at least one potency for the action
+    bool hasLutEntry : 1;
+
+    Action::ActionEntry lutEntry;
+  };
+
+  /*!
+   * @brief The stat modifiers of a ClassJob row
+   */
+  struct CombatClassJobData
+  {
+    uint16_t modifierHitPoints;
+    uint16_t modifierManaPoints;
+    uint16_t modifierStrength;
+    uint16_t modifierVitality;
+    uint16_t modifierDexterity;
+    uint16_t modifierIntelligence;
+    uint16_t modifierMind;
+    uint16_t modifierPiety;
+    uint8_t classJobParent;
+    uint8_t primaryStat;
+    bool isValid;
+  };
+
+  /*!
+   * @brief The stat modifiers of a ParamGrow row
+   */
+  struct CombatLevelData
+  {
+    int32_t mpModifier;
+    int32_t baseSpeed;
+    uint16_t hpModifier;
+    bool isValid;
+  };
+
+  /*!
+   * @brief Combat relevant sheet data, flattened into dense tables at startup
+   *
+   * Every formula used to decode rows through the generic exd layer on each call. The tables here only hold
+   * the fields combat actually reads and are indexed directly by action id, class id and level.
+   */
+  class CombatDataMgr : public BaseManager
+  {
+  public:
+    CombatDataMgr( FrameworkPtr pFw );
+
+    bool init();
+
+    /*!
+     * @return the action data for actionId or nullptr if no such action exists
+     */
+    const CombatActionData* getAction( uint32_t actionId ) const
+    {
+      if( actionId >= m_actions.size() || !m_actions[ actionId ].isValid )
+        return nullptr;
+      return &m_actions[ actionId ];
+    }
+
+    /*!
+     * @return the class data for classJob or nullptr if no such class exists
+     */
+    const CombatClassJobData* getClassJob( Common::ClassJob classJob ) const
+    {
+      auto id = static_cast< uint8_t >( classJob );
+      if( id >= m_classJobs.size() || !m_classJobs[ id ].isValid )
+        return nullptr;
+      return &m_classJobs[ id ];
+    }
+
+    /*!
+     * @return the level data for level or nullptr if no such level exists
+     */
+    const CombatLevelData* getLevel( uint8_t level ) const
+    {
+      if( level >= m_levels.size() || !m_levels[ level ].isValid )
+        return nullptr;
+      return &m_levels[ level ];
+    }
+
+  private:
+    std::vector< CombatActionData > m_actions;
+    std::vector< CombatClassJobData > m_classJobs;
+    std::vector< CombatLevelData > m_levels;
+  };
+
+}
+
+#endif // SAPPHIRE_COMBATDATAMGR_H
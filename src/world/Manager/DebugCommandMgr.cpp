@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cinttypes>
 
 #include <Common.h>
@@ -802,6 +803,43 @@ void Sapphire::World::Manager::DebugCommandMgr::script( char* data, Entity::Play
       player.sendDebug( "Queued script reload for script: {0}", params );
     }
   }
+  else if( subCommand == "timings" || subCommand == "t" )
+  {
+    std::vector< Scripting::ScriptSlot* > slots;
+    pScriptMgr->getNativeScriptHandler().getCalledScriptSlots( slots );
+
+    if( slots.empty() )
+    {
+      player.sendDebug( "No scripts have been called since the last reset" );
+      return;
+    }
+
+    std::sort( slots.begin(), slots.end(), []( const Scripting::ScriptSlot* lhs, const Scripting::ScriptSlot* rhs )
+    {
+      return lhs->totalTimeUs > rhs->totalTimeUs;
+    } );
+
+    // defaults to the 10 most expensive scripts
+    uint32_t count = 10;
+    if( subCommand != params )
+      sscanf( params.c_str(), "%u", &count );
+
+    player.sendDebug( "Script timings, {0} of {1} scripts by total time:", std::min< std::size_t >( count, slots.size() ),
+                      slots.size() );
+
+    for( std::size_t i = 0; i < slots.size() && i < count; ++i )
+    {
+      auto pSlot = slots[ i ];
+      player.sendDebug( " - {0}#{1}: {2} calls, total {3}us, avg {4}us, max {5}us", pSlot->moduleName,
+                        pSlot->scriptId, pSlot->callCount, pSlot->totalTimeUs,
+                        pSlot->totalTimeUs / pSlot->callCount, pSlot->maxTimeUs );
+    }
+  }
+  else if( subCommand == "resettimings" || subCommand == "rt" )
+  {
+    pScriptMgr->getNativeScriptHandler().resetScriptTimings();
+    player.sendDebug( "Reset script timings" );
+  }
   else
   {
     player.sendDebug( "Unknown script subcommand: {0}", subCommand );
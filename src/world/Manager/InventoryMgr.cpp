@@ -4,6 +4,7 @@
 #include "Actor/Player.h"
 #include "Inventory/ItemContainer.h"
 #include "Inventory/HousingItem.h"
+#include "Inventory/InventoryChangeSet.h"
 #include "Manager/ItemMgr.h"
 #include <Network/PacketDef/Zone/ServerZoneDef.h>
 #include <Network/GamePacket.h>
@@ -175,13 +176,6 @@ void Sapphire::World::Manager::InventoryMgr::removeHousingItemPosition( Sapphire
 
 void Sapphire::World::Manager::InventoryMgr::saveItem( Sapphire::Entity::Player& player, Sapphire::ItemPtr item )
 {
-  auto pDb = framework()->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
-  auto stmt = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_INS );
-
-  stmt->setUInt( 1, player.getId() );
-  stmt->setUInt64( 2, item->getUId() );
-  stmt->setUInt( 3, item->getId() );
-  stmt->setUInt( 4, item->getStackSize() );
-
-  pDb->directExecute( stmt );
+  // written with the next inventory flush of the player, in order with the rest of their inventory changes
+  player.getInventoryChanges().insertItem( item );
 }
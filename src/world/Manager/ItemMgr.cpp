@@ -9,8 +9,11 @@
 #include <Logging/Logger.h>
 #include <Database/DatabaseDef.h>
 
+#include <algorithm>
+
 Sapphire::World::Manager::ItemMgr::ItemMgr( Sapphire::FrameworkPtr pFw ) :
-  BaseManager( pFw )
+  BaseManager( pFw ),
+  m_lastUId( 0 )
 {
 
 }
@@ -122,39 +125,99 @@ bool Sapphire::World::Manager::ItemMgr::isOneHandedWeapon( Common::ItemUICategor
 
 Sapphire::ItemPtr Sapphire::World::Manager::ItemMgr::loadItem( uint64_t uId )
 {
-  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+  auto items = loadItems( { uId } );
+
+  auto it = items.find( uId );
+  if( it == items.end() )
+    return nullptr;
+
+  return it->second;
+}
+
+std::unordered_map< uint64_t, Sapphire::ItemPtr >
+  Sapphire::World::Manager::ItemMgr::loadItems( const std::vector< uint64_t >& uIds )
+{
   auto pDb = framework()->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
 
-  //  1 catalogId, 2 stack, 3 reservedFlag, 4 signatureId, 5 flags, 6 durability, 7 refine, 8 materia_0, 9 materia_1,
-  //  10 materia_2, 11 materia_3, 12 materia_4, 13 stain, 14 pattern, 15 buffer_0, 16 buffer_1, 17 buffer_2,
-  //  18 buffer_3, 19 buffer_4
-  auto query = pDb->getPreparedStatement( Db::CHARA_ITEMGLOBAL_SELECT );
-  query->setUInt64( 1, uId );
+  std::unordered_map< uint64_t, ItemPtr > items;
+  items.reserve( uIds.size() );
 
-  auto itemRes = pDb->query( query );
-  if( !itemRes->next() )
-    return nullptr;
+  std::vector< uint64_t > pending;
+  pending.reserve( uIds.size() );
+  for( auto uId : uIds )
+  {
+    if( uId == 0 || items.count( uId ) != 0 )
+      continue;
 
-  try
+    items[ uId ] = nullptr;
+    pending.push_back( uId );
+  }
+
+  for( std::size_t offset = 0; offset < pending.size(); offset += BulkLoadChunkSize )
   {
-    auto itemInfo = pExdData->get< Sapphire::Data::Item >( itemRes->getUInt( 1 ) );
-    bool isHq = itemRes->getUInt( 3 ) == 1;
+    auto end = std::min( offset + BulkLoadChunkSize, pending.size() );
+
+    std::string idList;
+    for( auto i = offset; i < end; ++i )
+    {
+      if( i != offset )
+        idList += ",";
+      idList += std::to_string( pending[ i ] );
+    }
+
+    auto itemRes = pDb->query( "SELECT itemId, catalogId, stack, reservedFlag, durability, stain "
+                               "FROM charaglobalitem WHERE itemId IN (" + idList + ");" );
 
-    ItemPtr pItem = make_Item( uId,
-                               itemRes->getUInt( 1 ),
-                               framework(),
-                               isHq );
+    while( itemRes->next() )
+    {
+      auto uId = itemRes->getUInt64( 1 );
+      auto catalogId = itemRes->getUInt( 2 );
 
-    pItem->setStackSize( itemRes->getUInt( 2 ) );
-    pItem->setStain( itemRes->getUInt16( 13 ) );
-    pItem->setDurability( itemRes->getInt16( 6 ) );
+      // skip items that do not exist in the sheets anymore instead of failing the whole load
+      if( !getItemInfo( catalogId ) )
+      {
+        Logger::warn( "ItemMgr: item#{0} has unknown catalogId#{1}", uId, catalogId );
+        continue;
+      }
 
-    return pItem;
+      bool isHq = itemRes->getUInt( 4 ) == 1;
+
+      ItemPtr pItem = make_Item( uId, catalogId, framework(), isHq );
+
+      pItem->setStackSize( itemRes->getUInt( 3 ) );
+      pItem->setDurability( itemRes->getInt16( 5 ) );
+      pItem->setStain( itemRes->getUInt16( 6 ) );
+
+      items[ uId ] = pItem;
+    }
   }
-  catch( ... )
+
+  for( auto it = items.begin(); it != items.end(); )
   {
-    return nullptr;
+    if( it->second == nullptr )
+      it = items.erase( it );
+    else
+      ++it;
+  }
+
+  return items;
+}
+
+std::shared_ptr< Sapphire::Data::Item > Sapphire::World::Manager::ItemMgr::getItemInfo( uint32_t catalogId )
+{
+  {
+    std::shared_lock< std::shared_mutex > lock( m_itemInfoMutex );
+    auto it = m_itemInfoCache.find( catalogId );
+    if( it != m_itemInfoCache.end() )
+      return it->second;
   }
+
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+  auto itemInfo = pExdData->get< Sapphire::Data::Item >( catalogId );
+
+  // unknown ids are cached as well, so repeated lookups never hit the sheet again
+  std::unique_lock< std::shared_mutex > lock( m_itemInfoMutex );
+  return m_itemInfoCache.emplace( catalogId, itemInfo ).first->second;
 }
 
 
@@ -184,16 +247,17 @@ Sapphire::Common::ContainerType Sapphire::World::Manager::ItemMgr::getContainerT
 
 uint32_t Sapphire::World::Manager::ItemMgr::getNextUId()
 {
-  uint32_t charId = 0;
+  uint32_t charId = 0x00500001;
   auto pDb = framework()->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
   auto pQR = pDb->query( "SELECT MAX(ItemId) FROM charaglobalitem" );
 
-  if( !pQR->next() )
-    return 0x00500001;
+  if( pQR->next() )
+    charId = std::max( charId, pQR->getUInt( 1 ) + 1 );
 
-  charId = pQR->getUInt( 1 ) + 1;
-  if( charId < 0x00500001 )
-    return 0x00500001;
+  // new items are only inserted with the next inventory flush, ids handed out since then are not in the table yet
+  std::lock_guard< std::mutex > lock( m_uIdMutex );
+  charId = std::max( charId, m_lastUId + 1 );
+  m_lastUId = charId;
 
   return charId;
 }
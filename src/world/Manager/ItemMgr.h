@@ -5,6 +5,16 @@
 #include "ForwardsZone.h"
 #include "BaseManager.h"
 
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Sapphire::Data
+{
+  struct Item;
+}
+
 namespace Sapphire::World::Manager
 {
 
@@ -15,6 +25,18 @@ namespace Sapphire::World::Manager
 
     ItemPtr loadItem( uint64_t uId );
 
+    /*!
+     * @brief Loads multiple items with as few queries as possible
+     * @param uIds unique ids of the items, duplicates and 0 are ignored
+     * @return map of unique id to item, items that failed to load are missing
+     */
+    std::unordered_map< uint64_t, ItemPtr > loadItems( const std::vector< uint64_t >& uIds );
+
+    /*!
+     * @brief Returns the Item sheet row for catalogId, rows are only decoded once and shared afterwards
+     */
+    std::shared_ptr< Data::Item > getItemInfo( uint32_t catalogId );
+
     uint32_t getNextUId();
 
     /*! check if weapon category qualifies the weapon as onehanded */
@@ -23,6 +45,16 @@ namespace Sapphire::World::Manager
     static bool isEquipment( uint16_t containerId );
     static uint16_t getCharaEquipSlotCategoryToArmoryId( uint8_t slotId );
     static Common::ContainerType getContainerType( uint32_t containerId );
+
+  private:
+    /*! max amount of ids sent in a single IN () list */
+    static constexpr std::size_t BulkLoadChunkSize = 256;
+
+    std::unordered_map< uint32_t, std::shared_ptr< Data::Item > > m_itemInfoCache;
+    std::shared_mutex m_itemInfoMutex;
+
+    uint32_t m_lastUId;
+    std::mutex m_uIdMutex;
   };
 
 }
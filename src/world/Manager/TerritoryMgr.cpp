@@ -1,9 +1,11 @@
 #include <Logging/Logger.h>
 #include <Database/DatabaseDef.h>
 #include <Exd/ExdDataGenerated.h>
+#include <Util/Util.h>
 
 #include "ServerMgr.h"
 
+#include <sstream>
 #include <unordered_map>
 
 #include "Actor/Player.h"
@@ -20,10 +22,22 @@
 #include "Territory/House.h"
 #include "Territory/Housing/HousingInteriorTerritory.h"
 #include "NaviMgr.h"
+#include "Script/ScriptMgr.h"
+
+namespace
+{
+  // building an instance loads its whole layout, the pools are refilled at most one instance per interval
+  constexpr uint64_t InstancePoolRefillIntervalMs = 1000;
+}
 
 Sapphire::World::Manager::TerritoryMgr::TerritoryMgr( Sapphire::FrameworkPtr pFw ) :
   BaseManager( pFw ),
-  m_lastInstanceId( 10000 )
+  m_lastInstanceId( 10000 ),
+  m_inRangeDistance( 80.f ),
+  m_spawnsPerTick( 0 ),
+  m_zoneInBundleSize( 0 ),
+  m_instancePoolSize( 0 ),
+  m_lastPoolRefillTime( 0 )
 {
 
 }
@@ -75,6 +89,41 @@ bool Sapphire::World::Manager::TerritoryMgr::init()
   auto& cfg = framework()->get< World::ServerMgr >()->getConfig();
 
   m_inRangeDistance = cfg.network.inRangeDistance;
+  m_spawnsPerTick = cfg.network.spawnsPerTick;
+  m_zoneInBundleSize = cfg.network.zoneInBundleSize;
+  m_instancePoolSize = cfg.instances.poolSize;
+
+  if( m_instancePoolSize == 0 )
+    return true;
+
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+
+  std::istringstream contentList( cfg.instances.warmContent );
+  std::string entry;
+  while( std::getline( contentList, entry, ',' ) )
+  {
+    if( entry.empty() )
+      continue;
+
+    auto contentFinderConditionId = static_cast< uint32_t >( std::stoul( entry ) );
+    auto pContentFinderCondition = pExdData->get< Sapphire::Data::ContentFinderCondition >( contentFinderConditionId );
+    if( !pContentFinderCondition || pContentFinderCondition->contentLinkType != 1 )
+    {
+      Logger::error( "Instances.WarmContent: {0} is not an InstanceContent", contentFinderConditionId );
+      continue;
+    }
+
+    m_warmContent.emplace_back( contentFinderConditionId, pContentFinderCondition->content );
+  }
+
+  std::istringstream questBattleList( cfg.instances.warmQuestBattles );
+  while( std::getline( questBattleList, entry, ',' ) )
+  {
+    if( !entry.empty() )
+      m_warmQuestBattleIds.push_back( static_cast< uint32_t >( std::stoul( entry ) ) );
+  }
+
+  refillInstancePools( Common::Util::getTimeMs(), true );
 
   return true;
 }
@@ -284,9 +333,8 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createTerritoryInstanc
   return pZone;
 }
 
-Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createQuestBattle( uint32_t questBattleId )
+Sapphire::QuestBattlePtr Sapphire::World::Manager::TerritoryMgr::buildQuestBattle( uint32_t questBattleId )
 {
-
   auto it = m_questBattleToContentFinderMap.find( questBattleId );
   if( it == m_questBattleToContentFinderMap.end() )
     return nullptr;
@@ -320,6 +368,29 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createQuestBattle( uin
                                  pTeri->name, pQuestInfo->name, questBattleId, framework() );
   pZone->init();
 
+  return pZone;
+}
+
+Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createQuestBattle( uint32_t questBattleId )
+{
+  QuestBattlePtr pZone;
+
+  auto& pool = m_questBattlePool[ questBattleId ];
+  if( !pool.empty() )
+  {
+    pZone = pool.back();
+    pool.pop_back();
+    Logger::debug( "Reusing pooled instance #{0} for QuestBattle id: {1}", pZone->getGuId(), questBattleId );
+
+    // it may have sat in the pool for longer than the idle timeout, which would release it right away
+    pZone->setLastActivityTime( Common::Util::getTimeMs() );
+  }
+  else
+    pZone = buildQuestBattle( questBattleId );
+
+  if( !pZone )
+    return nullptr;
+
   m_questBattleIdToInstanceMap[ questBattleId ][ pZone->getGuId() ] = pZone;
   m_guIdToZonePtrMap[ pZone->getGuId() ] = pZone;
   m_instanceZoneSet.insert( pZone );
@@ -327,9 +398,9 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createQuestBattle( uin
   return pZone;
 }
 
-Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createInstanceContent( uint32_t contentFinderConditionId )
+Sapphire::InstanceContentPtr
+  Sapphire::World::Manager::TerritoryMgr::buildInstanceContent( uint32_t contentFinderConditionId )
 {
-
   auto pExdData = framework()->get< Data::ExdDataGenerated >();
   auto pContentFinderCondition = pExdData->get< Sapphire::Data::ContentFinderCondition >( contentFinderConditionId );
   if( !pContentFinderCondition )
@@ -354,7 +425,35 @@ Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createInstanceContent(
                                      pTeri->name, pInstanceContent->name, instanceContentId, framework() );
   pZone->init();
 
-  m_instanceContentIdToInstanceMap[ instanceContentId ][ pZone->getGuId() ] = pZone;
+  return pZone;
+}
+
+Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::createInstanceContent( uint32_t contentFinderConditionId )
+{
+  InstanceContentPtr pZone;
+
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+  auto pContentFinderCondition = pExdData->get< Sapphire::Data::ContentFinderCondition >( contentFinderConditionId );
+  if( !pContentFinderCondition )
+    return nullptr;
+
+  auto& pool = m_instanceContentPool[ pContentFinderCondition->content ];
+  if( !pool.empty() )
+  {
+    pZone = pool.back();
+    pool.pop_back();
+    Logger::debug( "Reusing pooled instance #{0} for InstanceContent id: {1}", pZone->getGuId(),
+                   pContentFinderCondition->content );
+
+    pZone->setLastActivityTime( Common::Util::getTimeMs() );
+  }
+  else
+    pZone = buildInstanceContent( contentFinderConditionId );
+
+  if( !pZone )
+    return nullptr;
+
+  m_instanceContentIdToInstanceMap[ pZone->getInstanceContentId() ][ pZone->getGuId() ] = pZone;
   m_guIdToZonePtrMap[ pZone->getGuId() ] = pZone;
   m_instanceZoneSet.insert( pZone );
 
@@ -440,20 +539,95 @@ bool Sapphire::World::Manager::TerritoryMgr::removeTerritoryInstance( uint32_t g
   if( ( pZone = getTerritoryByGuId( guId ) ) == nullptr )
     return false;
 
+  if( m_instanceZoneSet.count( pZone ) )
+  {
+    releaseInstance( pZone );
+    return true;
+  }
+
   m_guIdToZonePtrMap.erase( pZone->getGuId() );
+  m_zoneSet.erase( pZone );
+  m_territoryTypeIdToInstanceGuidMap[ pZone->getTerritoryTypeId() ].erase( pZone->getGuId() );
+
+  return true;
+}
+
+void Sapphire::World::Manager::TerritoryMgr::releaseInstance( ZonePtr pZone )
+{
+  auto guId = pZone->getGuId();
 
+  m_guIdToZonePtrMap.erase( guId );
   m_instanceZoneSet.erase( pZone );
-  m_zoneSet.erase( pZone );
 
-  if( isInstanceContentTerritory( pZone->getTerritoryTypeId() ) )
+  // players still inside keep a reference to the zone, it can't be handed out again
+  bool reusable = pZone->getPopCount() == 0;
+
+  if( auto pInstance = std::dynamic_pointer_cast< InstanceContent >( pZone ) )
   {
-    auto instance = std::dynamic_pointer_cast< InstanceContent >( pZone );
-    m_instanceContentIdToInstanceMap[ instance->getInstanceContentId() ].erase( pZone->getGuId() );
+    m_instanceContentIdToInstanceMap[ pInstance->getInstanceContentId() ].erase( guId );
+
+    auto& pool = m_instanceContentPool[ pInstance->getInstanceContentId() ];
+    if( !reusable || pool.size() >= m_instancePoolSize )
+      return;
+
+    // the old id stays dead, bindings and links of players to it are not picked up by the reused instance
+    pInstance->setGuId( getNextInstanceId() );
+    pInstance->reset();
+    pool.push_back( pInstance );
   }
-  else
-    m_territoryTypeIdToInstanceGuidMap[ pZone->getTerritoryTypeId() ].erase( pZone->getGuId() );
+  else if( auto pQuestBattle = std::dynamic_pointer_cast< QuestBattle >( pZone ) )
+  {
+    m_questBattleIdToInstanceMap[ pQuestBattle->getQuestBattleId() ].erase( guId );
 
-  return true;
+    auto& pool = m_questBattlePool[ pQuestBattle->getQuestBattleId() ];
+    if( !reusable || pool.size() >= m_instancePoolSize )
+      return;
+
+    pQuestBattle->setGuId( getNextInstanceId() );
+    pQuestBattle->reset();
+    pool.push_back( pQuestBattle );
+  }
+}
+
+void Sapphire::World::Manager::TerritoryMgr::refillInstancePools( uint64_t tickCount, bool fill )
+{
+  if( !fill )
+  {
+    if( tickCount - m_lastPoolRefillTime < InstancePoolRefillIntervalMs )
+      return;
+
+    m_lastPoolRefillTime = tickCount;
+  }
+
+  for( auto& content : m_warmContent )
+  {
+    auto& pool = m_instanceContentPool[ content.second ];
+    while( pool.size() < m_instancePoolSize )
+    {
+      auto pInstance = buildInstanceContent( content.first );
+      if( !pInstance )
+        break;
+
+      pool.push_back( pInstance );
+      if( !fill )
+        return;
+    }
+  }
+
+  for( auto questBattleId : m_warmQuestBattleIds )
+  {
+    auto& pool = m_questBattlePool[ questBattleId ];
+    while( pool.size() < m_instancePoolSize )
+    {
+      auto pQuestBattle = buildQuestBattle( questBattleId );
+      if( !pQuestBattle )
+        break;
+
+      pool.push_back( pQuestBattle );
+      if( !fill )
+        return;
+    }
+  }
 }
 
 Sapphire::ZonePtr Sapphire::World::Manager::TerritoryMgr::getTerritoryByGuId( uint32_t guId ) const
@@ -526,6 +700,10 @@ void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint64_t
     zone->update( tickCount );
   }
 
+  // instances only queue their scripts while updating, so instances sharing a script run back to back
+  auto pScriptMgr = framework()->get< Scripting::ScriptMgr >();
+  pScriptMgr->processInstanceUpdates( tickCount );
+
   // remove internal house zones with nobody in them
   for( auto it = m_landIdentToZonePtrMap.begin(); it != m_landIdentToZonePtrMap.end(); )
   {
@@ -547,32 +725,30 @@ void Sapphire::World::Manager::TerritoryMgr::updateTerritoryInstances( uint64_t
       it++;
   }
 
-  // remove internal house zones with nobody in them
-  for( auto it = m_questBattleIdToInstanceMap.begin(); it != m_questBattleIdToInstanceMap.end(); ++it )
+  // release instances with nobody in them, instanceContent only once nobody can come back to it
+  std::vector< ZonePtr > idleInstances;
+  for( auto& zone : m_instanceZoneSet )
   {
-    for( auto inIt = it->second.begin(); inIt != it->second.end(); )
-    {
-      auto zone = std::dynamic_pointer_cast< QuestBattle >( inIt->second );
-      if( !zone )
-        continue;
-
-      auto diff = std::difftime( tickCount, zone->getLastActivityTime() );
-
-      // todo: make this timeout configurable, though should be pretty relaxed in any case
-      if( diff > 60000 )
-      {
-        Logger::info( "Removing QuestBattle#{0} - has been inactive for 60 seconds", zone->getGuId() );
-
-        // remove zone from maps
-        m_instanceZoneSet.erase( zone );
-        m_guIdToZonePtrMap.erase( zone->getGuId() );
-        inIt = m_questBattleIdToInstanceMap[ zone->getQuestBattleId() ].erase( inIt );
-      }
-      else
-        inIt++;
-    }
+    auto diff = std::difftime( tickCount, zone->getLastActivityTime() );
+
+    // todo: make this timeout configurable, though should be pretty relaxed in any case
+    if( zone->getPopCount() != 0 || diff <= 60000 )
+      continue;
+
+    auto pInstance = std::dynamic_pointer_cast< InstanceContent >( zone );
+    if( pInstance && pInstance->getState() != InstanceContent::DutyFinished && pInstance->hasBoundPlayers() )
+      continue;
 
+    idleInstances.push_back( zone );
+  }
+
+  for( auto& zone : idleInstances )
+  {
+    Logger::info( "Removing instance#{0} - has been inactive for 60 seconds", zone->getGuId() );
+    releaseInstance( zone );
   }
+
+  refillInstancePools( tickCount );
 }
 
 Sapphire::World::Manager::TerritoryMgr::InstanceIdList
@@ -677,6 +853,16 @@ float Sapphire::World::Manager::TerritoryMgr::getInRangeDistance() const
   return m_inRangeDistance;
 }
 
+uint32_t Sapphire::World::Manager::TerritoryMgr::getSpawnsPerTick() const
+{
+  return m_spawnsPerTick;
+}
+
+uint32_t Sapphire::World::Manager::TerritoryMgr::getZoneInBundleSize() const
+{
+  return m_zoneInBundleSize;
+}
+
 void Sapphire::World::Manager::TerritoryMgr::createAndJoinQuestBattle( Entity::Player& player, uint16_t questBattleId )
 {
   auto qb = createQuestBattle( questBattleId );
@@ -115,6 +115,9 @@ namespace Sapphire::World::Manager
     /*! removes instance by instanceId, return true if successful */
     bool removeTerritoryInstance( uint32_t guId );
 
+    /*! unregisters an InstanceContent or QuestBattle and keeps it for reuse if it is empty and its pool has room */
+    void releaseInstance( ZonePtr pZone );
+
     /*! returns a ZonePtr to the instance or nullptr if not found */
     ZonePtr getTerritoryByGuId( uint32_t guId ) const;
 
@@ -161,7 +164,22 @@ namespace Sapphire::World::Manager
 
     float getInRangeDistance() const;
 
+    /*! charas spawned for a player per tick at most, 0 for no limit */
+    uint32_t getSpawnsPerTick() const;
+
+    /*! bytes of zone-in spawns sent to a player per tick, 0 sends them at once */
+    uint32_t getZoneInBundleSize() const;
+
   private:
+    /*! constructs and initializes an InstanceContent without registering it */
+    InstanceContentPtr buildInstanceContent( uint32_t contentFinderConditionId );
+
+    /*! constructs and initializes a QuestBattle without registering it */
+    QuestBattlePtr buildQuestBattle( uint32_t questBattleId );
+
+    /*! builds missing instances of the warm list, at most one per refill interval unless fill is set */
+    void refillInstancePools( uint64_t tickCount, bool fill = false );
+
     using TerritoryTypeDetailCache = std::unordered_map< uint16_t, Data::TerritoryTypePtr >;
     using InstanceIdToZonePtrMap = std::unordered_map< uint32_t, ZonePtr >;
     using LandSetIdToZonePtrMap = std::unordered_map< uint32_t, ZonePtr >;
@@ -173,6 +191,8 @@ namespace Sapphire::World::Manager
     using PositionMap = std::unordered_map< int32_t, ZonePositionPtr >;
     using InstanceIdList = std::vector< uint32_t >;
     using LandIdentToZonePtrMap = std::unordered_map< uint64_t, ZonePtr >;
+    using InstanceContentPool = std::unordered_map< uint16_t, std::vector< InstanceContentPtr > >;
+    using QuestBattlePool = std::unordered_map< uint16_t, std::vector< QuestBattlePtr > >;
 
     /*! map holding details for territory templates */
     TerritoryTypeDetailCache m_territoryTypeDetailCacheMap;
@@ -216,9 +236,30 @@ namespace Sapphire::World::Manager
     /*! Max distance at which actors in range of a player are sent */
     float m_inRangeDistance;
 
+    uint32_t m_spawnsPerTick;
+    uint32_t m_zoneInBundleSize;
+
     /*! Map used to find a contentFinderConditionID to a questBattle */
     QuestBattleIdToContentFinderCondMap m_questBattleToContentFinderMap;
 
+    /*! finished instances reset for reuse, by instanceContentId */
+    InstanceContentPool m_instanceContentPool;
+
+    /*! finished instances reset for reuse, by questBattleId */
+    QuestBattlePool m_questBattlePool;
+
+    /*! max amount of pooled instances per content, 0 disables pooling */
+    uint32_t m_instancePoolSize;
+
+    /*! time the pools were last checked for a missing instance */
+    uint64_t m_lastPoolRefillTime;
+
+    /*! contentFinderConditionId and instanceContentId of the content whose pool is kept filled */
+    std::vector< std::pair< uint32_t, uint16_t > > m_warmContent;
+
+    /*! questBattleIds whose pool is kept filled */
+    std::vector< uint32_t > m_warmQuestBattleIds;
+
   public:
     /*! returns a list of instanceContent InstanceIds currently active */
     InstanceIdList getInstanceContentIdList( uint16_t instanceContentId ) const;
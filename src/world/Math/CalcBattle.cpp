@@ -1,12 +1,13 @@
 #include <cmath>
 
-#include <Exd/ExdDataGenerated.h>
 #include <Common.h>
 
 #include "Actor/Chara.h"
 
 #include "Actor/Player.h"
 
+#include "Manager/CombatDataMgr.h"
+
 #include "CalcBattle.h"
 #include "Framework.h"
 
@@ -31,9 +32,9 @@ using namespace Sapphire::Entity;
 
 uint32_t CalcBattle::calculateHealValue( PlayerPtr pPlayer, uint32_t potency, Sapphire::FrameworkPtr pFw )
 {
-  auto pExdData = pFw->get< Data::ExdDataGenerated >();
-  auto classInfo = pExdData->get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( pPlayer->getClass() ) );
-  auto paramGrowthInfo = pExdData->get< Sapphire::Data::ParamGrow >( pPlayer->getLevel() );
+  auto pCombatData = pFw->get< World::Manager::CombatDataMgr >();
+  auto classInfo = pCombatData->getClassJob( pPlayer->getClass() );
+  auto paramGrowthInfo = pCombatData->getLevel( pPlayer->getLevel() );
 
   if( !classInfo || !paramGrowthInfo )
     return 0;
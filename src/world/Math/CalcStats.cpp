@@ -1,6 +1,5 @@
 #include <cmath>
 
-#include <Exd/ExdDataGenerated.h>
 #include <Common.h>
 #include <Logging/Logger.h>
 
@@ -9,6 +8,8 @@
 
 #include "Inventory/Item.h"
 
+#include "Manager/CombatDataMgr.h"
+
 #include "CalcStats.h"
 #include "Framework.h"
 
@@ -126,13 +127,13 @@ float CalcStats::calculateBaseStat( const Chara& chara )
 
 uint32_t CalcStats::calculateMaxHp( PlayerPtr pPlayer, Sapphire::FrameworkPtr pFw )
 {
-  auto pExdData = pFw->get< Data::ExdDataGenerated >();
+  auto pCombatData = pFw->get< World::Manager::CombatDataMgr >();
   // TODO: Replace ApproxBaseHP with something that can get us an accurate BaseHP.
   // Is there any way to pull reliable BaseHP without having to manually use a pet for every level, and using the values from a table?
   // More info here: https://docs.google.com/spreadsheets/d/1de06KGT0cNRUvyiXNmjNgcNvzBCCQku7jte5QxEQRbs/edit?usp=sharing
 
-  auto classInfo = pExdData->get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( pPlayer->getClass() ) );
-  auto paramGrowthInfo = pExdData->get< Sapphire::Data::ParamGrow >( pPlayer->getLevel() );
+  auto classInfo = pCombatData->getClassJob( pPlayer->getClass() );
+  auto paramGrowthInfo = pCombatData->getLevel( pPlayer->getLevel() );
 
   if( !classInfo || !paramGrowthInfo )
     return 0;
@@ -166,9 +167,9 @@ uint32_t CalcStats::calculateMaxHp( PlayerPtr pPlayer, Sapphire::FrameworkPtr pF
 
 uint32_t CalcStats::calculateMaxMp( PlayerPtr pPlayer, Sapphire::FrameworkPtr pFw )
 {
-  auto pExdData = pFw->get< Data::ExdDataGenerated >();
-  auto classInfo = pExdData->get< Sapphire::Data::ClassJob >( static_cast< uint8_t >( pPlayer->getClass() ) );
-  auto paramGrowthInfo = pExdData->get< Sapphire::Data::ParamGrow >( pPlayer->getLevel() );
+  auto pCombatData = pFw->get< World::Manager::CombatDataMgr >();
+  auto classInfo = pCombatData->getClassJob( pPlayer->getClass() );
+  auto paramGrowthInfo = pCombatData->getLevel( pPlayer->getLevel() );
 
   if( !classInfo || !paramGrowthInfo )
     return 0;
@@ -540,11 +541,13 @@ float CalcStats::calculateAutoAttackDamage( const Sapphire::Entity::Chara& chara
   // D = ⌊ f(ptc) × f(aa) × f(ap) × f(det) × f(tnc) × traits ⌋ × f(ss) ⌋ ×
   // f(chr) ⌋ × f(dhr) ⌋ × rand[ 0.95, 1.05 ] ⌋ × buff_1 ⌋ × buff... ⌋
 
-  auto pot = autoAttackPotency( chara );
-  auto aa = autoAttack( chara );
-  auto ap = getPrimaryAttackPower( chara );
-  auto det = determination( chara );
-  auto ten = tenacity( chara );
+  const auto& stats = chara.getDerivedStats();
+
+  auto pot = stats.autoAttackPotency;
+  auto aa = stats.autoAttack;
+  auto ap = stats.primaryAttackPower;
+  auto det = stats.determination;
+  auto ten = stats.tenacity;
 
   Logger::debug( "auto attack: pot: {} aa: {} ap: {} det: {} ten: {}", pot, aa, ap, det, ten );
 
@@ -552,7 +555,7 @@ float CalcStats::calculateAutoAttackDamage( const Sapphire::Entity::Chara& chara
 
   // todo: traits
 
-  factor = std::floor( factor * speed( chara ) );
+  factor = std::floor( factor * stats.speed );
 
   // todo: surely this aint right?
   //factor = std::floor( factor * criticalHitProbability( chara ) );
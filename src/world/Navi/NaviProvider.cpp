@@ -2,6 +2,7 @@
 #include <Framework.h>
 #include <Territory/Zone.h>
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <ServerMgr.h>
 
 #include "Actor/Actor.h"
@@ -266,6 +267,10 @@ Sapphire::Common::FFXIVARR_POSITION3
   Sapphire::World::Navi::NaviProvider::findRandomPositionInCircle( const Sapphire::Common::FFXIVARR_POSITION3& startPos,
                                                                    float maxRadius )
 {
+  static auto& queryTime = Metrics::Registry::histogram( "world_navi_query_us", "query=\"randomPosition\"",
+                                                         "Navmesh query time in microseconds" );
+  Metrics::ScopedTimer timer( queryTime );
+
   dtStatus status;
 
   float spos[ 3 ] = { startPos.x, startPos.y, startPos.z };
@@ -317,6 +322,10 @@ std::vector< Sapphire::Common::FFXIVARR_POSITION3 >
   if( !m_naviMesh || !m_naviMeshQuery )
     throw std::runtime_error( "No navimesh loaded" );
 
+  static auto& queryTime = Metrics::Registry::histogram( "world_navi_query_us", "query=\"followPath\"",
+                                                         "Navmesh query time in microseconds" );
+  Metrics::ScopedTimer timer( queryTime );
+
   auto resultCoords = std::vector< Common::FFXIVARR_POSITION3 >();
 
   dtPolyRef startRef, endRef = 0;
@@ -2,11 +2,14 @@
 #include <Network/CommonNetwork.h>
 #include <Util/Util.h>
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <utility>
+#include <experimental/filesystem>
 
 #include <Network/Acceptor.h>
 #include <Network/PacketContainer.h>
 #include <Network/GamePacketParser.h>
+#include <Network/PacketCapture.h>
 
 #include "Territory/Zone.h"
 
@@ -20,6 +23,8 @@
 #include "Framework.h"
 #include "Forwards.h"
 
+namespace fs = std::experimental::filesystem;
+
 using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
@@ -155,38 +160,42 @@ void Sapphire::Network::GameConnection::onDisconnect()
 void Sapphire::Network::GameConnection::onRecv( std::vector< uint8_t >& buffer )
 {
   m_packets.insert( std::end( m_packets ), std::begin( buffer ), std::end( buffer ) );
-  // This is assumed packet always start with valid FFXIVARR_PACKET_HEADER for now.
-  Packets::FFXIVARR_PACKET_HEADER packetHeader{};
-  const auto headerResult = Packets::getHeader( m_packets, 0, packetHeader );
-
-  if( headerResult == Incomplete )
-    return;
 
-  if( headerResult == Malformed )
+  // a single read can hold several packets or end in the middle of one, handle every complete packet
+  while( !m_packets.empty() )
   {
-    Logger::info( "Dropping connection due to malformed packet header." );
-    disconnect();
-    return;
-  }
+    Packets::FFXIVARR_PACKET_HEADER packetHeader{};
+    const auto headerResult = Packets::getHeader( m_packets, 0, packetHeader );
 
-  // Dissect packet list
-  std::vector< Packets::FFXIVARR_PACKET_RAW > packetList;
-  const auto packetResult = Packets::getPackets( m_packets, sizeof( struct FFXIVARR_PACKET_HEADER ),
-                                                 packetHeader, packetList );
+    if( headerResult == Incomplete )
+      return;
 
-  if( packetResult == Incomplete )
-    return;
+    if( headerResult == Malformed )
+    {
+      Logger::info( "Dropping connection due to malformed packet header." );
+      disconnect();
+      return;
+    }
 
-  if( packetResult == Malformed )
-  {
-    Logger::info( "Dropping connection due to malformed packets." );
-    disconnect();
-    return;
-  }
+    // Dissect packet list
+    std::vector< Packets::FFXIVARR_PACKET_RAW > packetList;
+    const auto packetResult = Packets::getPackets( m_packets, sizeof( struct FFXIVARR_PACKET_HEADER ),
+                                                   packetHeader, packetList );
+
+    if( packetResult == Incomplete )
+      return;
+
+    if( packetResult == Malformed )
+    {
+      Logger::info( "Dropping connection due to malformed packets." );
+      disconnect();
+      return;
+    }
 
-  // Handle it
-  handlePackets( packetHeader, packetList );
-  m_packets.clear();
+    // Handle it
+    handlePackets( packetHeader, packetList );
+    m_packets.erase( m_packets.begin(), m_packets.begin() + packetHeader.size );
+  }
 }
 
 void Sapphire::Network::GameConnection::onError( const asio::error_code& error )
@@ -204,9 +213,25 @@ void Sapphire::Network::GameConnection::queueOutPacket( Sapphire::Network::Packe
   m_outQueue.push( outPacket );
 }
 
+Sapphire::Metrics::Counter& Sapphire::Network::GameConnection::getOpcodeCounter( OpcodeCounterMap& cache,
+                                                                                 const std::string& name,
+                                                                                 uint16_t opcode )
+{
+  auto it = cache.find( opcode );
+  if( it != cache.end() )
+    return *it->second;
+
+  auto& counter = Metrics::Registry::counter( name, fmt::format( "opcode=\"0x{:04X}\"", opcode ),
+                                              "Game packets handled per ipc opcode" );
+  cache[ opcode ] = &counter;
+  return counter;
+}
+
 void Sapphire::Network::GameConnection::handleZonePacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
+  getOpcodeCounter( m_packetInCounters, "world_packets_in_total", opcode ).inc();
+
   auto it = m_zoneHandlerMap.find( opcode );
 
   if( it != m_zoneHandlerMap.end() )
@@ -231,6 +256,8 @@ void Sapphire::Network::GameConnection::handleZonePacket( Sapphire::Network::Pac
 void Sapphire::Network::GameConnection::handleChatPacket( Sapphire::Network::Packets::FFXIVARR_PACKET_RAW& pPacket )
 {
   uint16_t opcode = *reinterpret_cast< uint16_t* >( &pPacket.data[ 0x02 ] );
+  getOpcodeCounter( m_packetInCounters, "world_chat_packets_in_total", opcode ).inc();
+
   auto it = m_chatHandlerMap.find( opcode );
 
   if( it != m_chatHandlerMap.end() )
@@ -280,14 +307,41 @@ void Sapphire::Network::GameConnection::sendPackets( Packets::PacketContainer* p
 
 void Sapphire::Network::GameConnection::processInQueue()
 {
+  // packets handled in the same tick share a timestamp, replaying them keeps them in the same tick
+  auto tickCount = m_pCapture ? Common::Util::getTimeMs() : 0;
+
   // handle the incoming game packets
   while( m_inQueue.size() )
   {
     auto pPacket = m_inQueue.pop();
+
+    if( m_pCapture )
+      m_pCapture->write( tickCount, pPacket );
+
     handlePacket( pPacket );
   }
 }
 
+bool Sapphire::Network::GameConnection::startCapture( const std::string& folderPath )
+{
+  std::error_code ec;
+  fs::create_directories( folderPath, ec );
+
+  auto fileName = fmt::format( "{0}_{1}.scap", m_pSession ? m_pSession->getId() : 0, Common::Util::getTimeMs() );
+  auto path = ( fs::path( folderPath ) / fileName ).string();
+
+  auto pCapture = std::make_unique< PacketCaptureWriter >();
+  if( !pCapture->open( path, m_pSession ? m_pSession->getId() : 0, static_cast< uint16_t >( m_conType ) ) )
+  {
+    Logger::error( "Unable to open packet capture {0}", path );
+    return false;
+  }
+
+  Logger::info( "Capturing inbound packets to {0}", path );
+  m_pCapture = std::move( pCapture );
+  return true;
+}
+
 void Sapphire::Network::GameConnection::processOutQueue()
 {
   if( m_outQueue.size() < 1 )
@@ -310,13 +364,22 @@ void Sapphire::Network::GameConnection::processOutQueue()
     pRP.addPacket( pPacket );
     totalSize += pPacket->getSize();
 
+    if( auto opcode = pPacket->getIpcOpcode() )
+      getOpcodeCounter( m_packetOutCounters, "world_packets_out_total", opcode ).inc();
+
     // todo: figure out a good max set size and make it configurable
-    if( totalSize > 10000 )
+    if( totalSize > MaxContainerSize )
       break;
   }
 
   if( totalSize > 0 )
+  {
+    static auto& bytesOut = Metrics::Registry::counter( "world_packet_bytes_out_total", "",
+                                                        "Bytes of game packets queued for sending" );
+    bytesOut.inc( static_cast< uint64_t >( totalSize ) );
+
     sendPackets( &pRP );
+  }
 
 }
 
@@ -435,6 +498,10 @@ void Sapphire::Network::GameConnection::handlePackets( const Sapphire::Network::
           sendSinglePacket( pe1 );
           Logger::info( "[{0}] Setting session for zone connection", id );
           session->setZoneConnection( pCon );
+
+          auto& capturePath = pServerZone->getConfig().network.capturePath;
+          if( !capturePath.empty() && !m_pCapture )
+            startCapture( capturePath );
         }
           // chat connection, assinging it to the session
         else if( ipcHeader.connectionType == ConnectionType::Chat )
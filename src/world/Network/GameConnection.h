@@ -6,6 +6,7 @@
 #include <Network/CommonNetwork.h>
 #include <Util/LockedQueue.h>
 #include <map>
+#include <unordered_map>
 
 #include "ForwardsZone.h"
 
@@ -15,6 +16,12 @@ namespace Sapphire::Network::Packets
 {
   class GamePacket;
   class PacketContainer;
+  class PacketCaptureWriter;
+}
+
+namespace Sapphire::Metrics
+{
+  class Counter;
 }
 
 namespace Sapphire::Network
@@ -55,6 +62,16 @@ namespace Sapphire::Network
     Common::Util::LockedQueue< Packets::FFXIVPacketBasePtr > m_outQueue;
     std::vector< uint8_t > m_packets;
 
+    // per opcode packet counters, cached per connection so the registry is only hit once per opcode
+    using OpcodeCounterMap = std::unordered_map< uint16_t, Metrics::Counter* >;
+    OpcodeCounterMap m_packetInCounters;
+    OpcodeCounterMap m_packetOutCounters;
+
+    Metrics::Counter& getOpcodeCounter( OpcodeCounterMap& cache, const std::string& name, uint16_t opcode );
+
+    // set while the inbound packets of this connection are captured
+    std::unique_ptr< Packets::PacketCaptureWriter > m_pCapture;
+
   public:
     ConnectionType m_conType;
 
@@ -80,6 +97,11 @@ namespace Sapphire::Network
 
     void processInQueue();
 
+    /*!
+     * @brief Captures every inbound packet handled from now on into a file in folderPath
+     */
+    bool startCapture( const std::string& folderPath );
+
     void processOutQueue();
 
     void handlePacket( Network::Packets::FFXIVARR_PACKET_RAW& pPacket );
@@ -10,6 +10,7 @@
 #include "Framework.h"
 
 #include "Manager/ActionMgr.h"
+#include "Manager/CombatDataMgr.h"
 
 using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
@@ -42,13 +43,13 @@ void Sapphire::Network::GameConnection::actionHandler( FrameworkPtr pFw,
     }
     case Common::SkillType::Normal:
     {
-      auto action = exdData->get< Data::Action >( actionId );
+      auto action = pFw->get< World::Manager::CombatDataMgr >()->getAction( actionId );
 
       // ignore invalid actions
       if( !action )
         return;
 
-      actionMgr->handleTargetedPlayerAction( player, actionId, action, targetId );
+      actionMgr->handleTargetedPlayerAction( player, actionId, *action, targetId );
       break;
     }
 
@@ -102,15 +103,12 @@ void Sapphire::Network::GameConnection::placedActionHandler( FrameworkPtr pFw,
   player.sendDebug( "Skill type: {0}, sequence: {1}, actionId: {2}, x:{3}, y:{4}, z:{5}",
                     type, sequence, actionId, pos.x, pos.y, pos.z );
 
-  auto exdData = m_pFw->get< Data::ExdDataGenerated >();
-  assert( exdData );
-
-  auto action = exdData->get< Data::Action >( actionId );
+  auto action = pFw->get< World::Manager::CombatDataMgr >()->getAction( actionId );
 
   // ignore invalid actions
   if( !action )
     return;
 
   auto actionMgr = pFw->get< World::Manager::ActionMgr >();
-  actionMgr->handlePlacedPlayerAction( player, actionId, action, pos );
+  actionMgr->handlePlacedPlayerAction( player, actionId, *action, pos );
 }
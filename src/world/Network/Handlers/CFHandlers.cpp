@@ -5,8 +5,7 @@
 #include <Network/PacketContainer.h>
 #include <Exd/ExdDataGenerated.h>
 
-#include "Manager/TerritoryMgr.h"
-#include "Territory/InstanceContent.h"
+#include "ContentFinder/ContentFinder.h"
 
 #include "Network/GameConnection.h"
 #include "Network/PacketWrappers/ServerNoticePacket.h"
@@ -18,7 +17,6 @@
 using namespace Sapphire::Common;
 using namespace Sapphire::Network::Packets;
 using namespace Sapphire::Network::Packets::Server;
-using namespace Sapphire::World::Manager;
 
 
 void Sapphire::Network::GameConnection::cfDutyInfoRequest( FrameworkPtr pFw,
@@ -45,8 +43,7 @@ void Sapphire::Network::GameConnection::cfRegisterDuty( FrameworkPtr pFw,
                                                         Entity::Player& player )
 {
   Packets::FFXIVARR_PACKET_RAW copy = inPacket;
-  auto pTeriMgr = pFw->get< TerritoryMgr >();
-  auto pExdData = pFw->get< Data::ExdDataGenerated >();
+  auto pContentFinder = pFw->get< ContentFinder::ContentFinder >();
 
   std::vector< uint16_t > selectedContent;
 
@@ -61,38 +58,28 @@ void Sapphire::Network::GameConnection::cfRegisterDuty( FrameworkPtr pFw,
     selectedContent.push_back( id );
   }
 
-  // todo: rand bias problem, will do for now tho
-  auto index = std::rand() % selectedContent.size();
-  auto contentId = selectedContent.at( index );
+  // todo: parties register as a whole once there are parties
+  if( pContentFinder->registerParty( { player.getAsPlayer() }, selectedContent, 0 ) )
+  {
+    player.sendDebug( "Registered for {0} duties", selectedContent.size() );
+    return;
+  }
 
-  player.sendDebug( "Duty register request for contentid#{0}", contentId );
+  // the client shows the registration as withdrawn, so no old ticket or ready check may outlive it either
+  pContentFinder->withdraw( player.getId() );
 
   // let's cancel it because otherwise you can't register it again
   auto cfCancelPacket = makeZonePacket< FFXIVIpcCFNotify >( player.getId() );
   cfCancelPacket->data().state1 = 3;
   cfCancelPacket->data().state2 = 1; // Your registration is withdrawn.
   queueOutPacket( cfCancelPacket );
-
-  auto cfCondition = pExdData->get< Sapphire::Data::ContentFinderCondition >( contentId );
-  if( !cfCondition )
-    return;
-
-  auto instance = pTeriMgr->createInstanceContent( cfCondition->content );
-  if( !instance )
-    return;
-
-  auto pInstance = instance->getAsInstanceContent();
-  pInstance->bindPlayer( player.getId() );
-
-  player.sendDebug( "Created instance with id#", instance->getGuId() );
-
-  player.setInstance( instance );
 }
 
 void Sapphire::Network::GameConnection::cfRegisterRoulette( FrameworkPtr pFw,
                                                             const Packets::FFXIVARR_PACKET_RAW& inPacket,
                                                             Entity::Player& player )
 {
+  // todo: queue through the ContentFinder once the roulette id is part of a verified client ipc struct
   auto cfCancelPacket = makeZonePacket< FFXIVIpcCFNotify >( player.getId() );
   cfCancelPacket->data().state1 = 3;
   cfCancelPacket->data().state2 = 1; // Your registration is withdrawn.
@@ -105,5 +92,6 @@ void Sapphire::Network::GameConnection::cfDutyAccepted( FrameworkPtr pFw,
                                                         const Packets::FFXIVARR_PACKET_RAW& inPacket,
                                                         Entity::Player& player )
 {
-  player.sendDebug( "TODO: Duty accept" );
+  auto pContentFinder = pFw->get< ContentFinder::ContentFinder >();
+  pContentFinder->acceptDuty( player.getId() );
 }
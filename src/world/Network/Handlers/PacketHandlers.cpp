@@ -42,6 +42,8 @@
 
 #include "Action/Action.h"
 
+#include "ContentFinder/ContentFinder.h"
+
 #include "Session.h"
 #include "ServerMgr.h"
 #include "Forwards.h"
@@ -557,6 +559,8 @@ void Sapphire::Network::GameConnection::logoutHandler( FrameworkPtr pFw,
   logoutPacket->data().flags2 = 0x2000;
   queueOutPacket( logoutPacket );
 
+  pFw->get< ContentFinder::ContentFinder >()->withdraw( player.getId() );
+
   player.setMarkedForRemoval();
 }
 
@@ -1,51 +1,103 @@
 #include "NativeScriptMgr.h"
 
+#include <utility>
+
 #include <Crypt/md5.h>
+#include <Logging/Logger.h>
 #include "ServerMgr.h"
 
 #include "Framework.h"
 
+namespace
+{
+  thread_local Sapphire::Scripting::ModuleRef s_callingModule;
+}
+
 namespace Sapphire::Scripting
 {
 
+  ModuleCallScope::ModuleCallScope( ModuleRef module ) :
+    m_previous( std::exchange( s_callingModule, std::move( module ) ) )
+  {
+  }
+
+  ModuleCallScope::~ModuleCallScope()
+  {
+    s_callingModule = std::move( m_previous );
+  }
+
+  const ModuleRef& getCallingModule()
+  {
+    return s_callingModule;
+  }
+
   bool NativeScriptMgr::loadScript( const std::string& path )
   {
     auto module = m_loader.loadModule( path );
     if( !module )
       return false;
 
-    auto scripts = m_loader.getScripts( module->handle );
-    if( !scripts )
-    {
-      m_loader.unloadScript( module );
-      return false;
-    }
-
-    //
-    bool success = false;
+    bindModule( module );
 
-    for( int i = 0;; i++ )
-    {
-      if( scripts[ i ] == nullptr )
-        break;
+    return true;
+  }
 
-      auto script = scripts[ i ];
-      module->scripts.push_back( script );
+  void NativeScriptMgr::bindModule( ScriptInfo* info )
+  {
+    // the reference only counts holders, freeing the module is left to freeRetiredModules
+    auto& module = m_boundModules[ info ];
+    module = ModuleRef( info, []( ScriptInfo* ) {} );
 
+    for( auto script : info->scripts )
+    {
       script->setFramework( framework().get() );
 
-      m_scripts[ script->getType() ][ script->getId() ] = script;
-
-      success = true;
+      auto pSlot = getScriptSlot( script->getType(), script->getId() );
+      pSlot->pScript = script;
+      pSlot->moduleName = info->library_name;
+      pSlot->module = module;
     }
+  }
 
-    if( !success )
+  void NativeScriptMgr::retireModule( ScriptInfo* info )
+  {
+    for( auto& script : info->scripts )
     {
-      m_loader.unloadScript( module->handle );
-      return false;
+      // the slot stays around, objects bound to it pick up the script again once it is reloaded
+      auto pSlot = findScriptSlot( script->getType(), script->getId() );
+      if( pSlot && pSlot->pScript == script )
+      {
+        pSlot->pScript = nullptr;
+        pSlot->module.reset();
+      }
     }
 
-    return true;
+    m_loader.detachModule( info );
+
+    auto it = m_boundModules.find( info );
+    if( it == m_boundModules.end() )
+      return;
+
+    m_retiredModules.push_back( std::move( it->second ) );
+    m_boundModules.erase( it );
+  }
+
+  void NativeScriptMgr::freeRetiredModules()
+  {
+    for( auto it = m_retiredModules.begin(); it != m_retiredModules.end(); )
+    {
+      // pending scene callbacks and running calls hold a reference, once only ours is left the module is unused
+      if( it->use_count() == 1 )
+      {
+        auto info = it->get();
+        Logger::debug( "Freeing retired script module {0}", info->library_name );
+
+        it = m_retiredModules.erase( it );
+        m_loader.freeModule( info );
+      }
+      else
+        ++it;
+    }
   }
 
   const std::string NativeScriptMgr::getModuleExtension()
@@ -64,14 +116,9 @@ namespace Sapphire::Scripting
 
   bool NativeScriptMgr::unloadScript( ScriptInfo* info )
   {
-    for( auto& script : info->scripts )
-    {
-      m_scripts[ script->getType() ].erase( script->getId() );
-
-      delete script;
-    }
+    retireModule( info );
 
-    return m_loader.unloadScript( info );
+    return true;
   }
 
   void NativeScriptMgr::queueScriptReload( const std::string& name )
@@ -80,34 +127,122 @@ namespace Sapphire::Scripting
     if( !info )
       return;
 
-    // backup actual lib path
-    std::string libPath( info->library_path );
+    queueScriptLoad( info->library_path );
+  }
 
-    if( !unloadScript( info ) )
-      return;
+  void NativeScriptMgr::queueScriptLoad( const std::string& path )
+  {
+    {
+      std::lock_guard< std::mutex > lock( m_stageMutex );
+      m_scriptLoadQueue.push( path );
+    }
+
+    m_stageCondition.notify_one();
+  }
+
+  void NativeScriptMgr::stageModules()
+  {
+    while( true )
+    {
+      std::string path;
 
-    m_scriptLoadQueue.push( libPath );
+      {
+        std::unique_lock< std::mutex > lock( m_stageMutex );
+        m_stageCondition.wait( lock, [ this ]() { return m_stopStaging || !m_scriptLoadQueue.empty(); } );
+
+        if( m_stopStaging )
+          return;
+
+        path = m_scriptLoadQueue.front();
+        m_scriptLoadQueue.pop();
+      }
+
+      // copying, loading and validating the module is the slow part and never touches the loaded scripts
+      auto info = m_loader.stageModule( path );
+
+      std::lock_guard< std::mutex > lock( m_stageMutex );
+      m_stagedModules.push_back( { path, info } );
+    }
   }
 
   void NativeScriptMgr::processLoadQueue()
   {
-    std::vector< std::string > deferredLoads;
+    std::vector< StagedModule > stagedModules;
 
-    while( !m_scriptLoadQueue.empty() )
     {
-      auto item = m_scriptLoadQueue.front();
+      std::lock_guard< std::mutex > lock( m_stageMutex );
+      stagedModules.swap( m_stagedModules );
+    }
 
-      // if it fails, we defer the loading to the next tick
-      if( !loadScript( item ) )
-        deferredLoads.push_back( item );
+    for( auto& module : stagedModules )
+    {
+      // if it fails, the module is most likely still being written, we try again with the next tick
+      if( !module.info )
+      {
+        queueScriptLoad( module.path );
+        continue;
+      }
+
+      // no script callback is running between two ticks, so the scripts can be swapped in one go
+      if( auto oldInfo = m_loader.getScriptInfo( module.info->library_name ) )
+        retireModule( oldInfo );
+
+      m_loader.commitModule( module.info );
+      bindModule( module.info );
 
-      m_scriptLoadQueue.pop();
+      Logger::info( "Swapped in script module {0}", module.info->library_name );
     }
 
-    if( !deferredLoads.empty() )
+    freeRetiredModules();
+  }
+
+  ScriptSlot* NativeScriptMgr::getScriptSlot( std::size_t type, uint32_t scriptId )
+  {
+    auto& pSlot = m_scripts[ type ][ scriptId ];
+    if( !pSlot )
     {
-      for( auto& item : deferredLoads )
-        m_scriptLoadQueue.push( item );
+      pSlot = std::make_unique< ScriptSlot >();
+      pSlot->scriptId = scriptId;
+    }
+
+    return pSlot.get();
+  }
+
+  ScriptSlot* NativeScriptMgr::findScriptSlot( std::size_t type, uint32_t scriptId ) const
+  {
+    auto typeIt = m_scripts.find( type );
+    if( typeIt == m_scripts.end() )
+      return nullptr;
+
+    auto slotIt = typeIt->second.find( scriptId );
+    if( slotIt == typeIt->second.end() )
+      return nullptr;
+
+    return slotIt->second.get();
+  }
+
+  void NativeScriptMgr::getCalledScriptSlots( std::vector< ScriptSlot* >& slots )
+  {
+    for( auto& type : m_scripts )
+    {
+      for( auto& slot : type.second )
+      {
+        if( slot.second->callCount > 0 )
+          slots.push_back( slot.second.get() );
+      }
+    }
+  }
+
+  void NativeScriptMgr::resetScriptTimings()
+  {
+    for( auto& type : m_scripts )
+    {
+      for( auto& slot : type.second )
+      {
+        slot.second->callCount = 0;
+        slot.second->totalTimeUs = 0;
+        slot.second->maxTimeUs = 0;
+      }
     }
   }
 
@@ -122,10 +257,32 @@ namespace Sapphire::Scripting
   }
 
   NativeScriptMgr::NativeScriptMgr( FrameworkPtr pFw  ) :
-    World::Manager::BaseManager( pFw )
+    World::Manager::BaseManager( pFw ),
+    m_stopStaging( false )
   {
     auto pServerMgr = framework()->get< Sapphire::World::ServerMgr >();
     m_loader.setCachePath( pServerMgr->getConfig().scripts.cachePath );
+
+    m_stageThread = std::thread( &NativeScriptMgr::stageModules, this );
+  }
+
+  NativeScriptMgr::~NativeScriptMgr()
+  {
+    {
+      std::lock_guard< std::mutex > lock( m_stageMutex );
+      m_stopStaging = true;
+    }
+
+    m_stageCondition.notify_one();
+    m_stageThread.join();
+
+    for( auto& module : m_stagedModules )
+    {
+      if( module.info )
+        m_loader.freeModule( module.info );
+    }
+
+    // retired modules are left alone, objects torn down after us may still hold callbacks into them
   }
 
 
@@ -1,9 +1,15 @@
 #ifndef NATIVE_SCRIPT_MGR_H
 #define NATIVE_SCRIPT_MGR_H
 
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <set>
 #include <queue>
+#include <thread>
+#include <vector>
 #include "Manager/BaseManager.h"
 
 #include "ScriptLoader.h"
@@ -11,6 +17,108 @@
 namespace Sapphire::Scripting
 {
 
+  /*!
+   * @brief Reference to a loaded module, a replaced or unloaded module is only freed once no reference to it is left
+   */
+  using ModuleRef = std::shared_ptr< ScriptInfo >;
+
+  /*!
+   * @brief A resolved binding of a script type and id to the currently loaded script
+   *
+   * Slots are never moved or freed once created, so game objects keep a pointer to their slot instead of looking
+   * the script up on every call. Loading a module fills the slots of its scripts and unloading clears them,
+   * which rebinds every holder of a slot on hot reload.
+   */
+  struct ScriptSlot
+  {
+    Sapphire::ScriptAPI::ScriptObject* pScript{ nullptr };
+    uint32_t scriptId{ 0 };
+    std::string moduleName;
+    // the module pScript lives in, taken by every call through the slot
+    ModuleRef module;
+
+    // execution time of the bound scripts, only ever touched from the game thread
+    uint64_t callCount{ 0 };
+    uint64_t totalTimeUs{ 0 };
+    uint64_t maxTimeUs{ 0 };
+
+    void recordCall( uint64_t timeUs )
+    {
+      callCount++;
+      totalTimeUs += timeUs;
+      if( timeUs > maxTimeUs )
+        maxTimeUs = timeUs;
+    }
+  };
+
+  /*!
+   * @brief Makes a module the one being called into for as long as the scope lives, nested scopes restore the outer one
+   *
+   * Holds a reference to the module, so it stays loaded even if it is replaced while the call is running.
+   */
+  class ModuleCallScope
+  {
+  public:
+    explicit ModuleCallScope( ModuleRef module );
+
+    ~ModuleCallScope();
+
+    ModuleCallScope( const ModuleCallScope& ) = delete;
+
+    ModuleCallScope& operator=( const ModuleCallScope& ) = delete;
+
+  private:
+    ModuleRef m_previous;
+  };
+
+  /*!
+   * @brief Gets the module of the script currently running on this thread
+   *
+   * @return the module or nullptr if no script is running
+   */
+  const ModuleRef& getCallingModule();
+
+  /*!
+   * @brief A callback handed to the game by a script, keeps the module of the script loaded until it is destroyed
+   */
+  template< typename Result, typename... Args >
+  class ModuleBoundCallback
+  {
+  public:
+    ModuleBoundCallback( ModuleRef module, std::function< Result( Args... ) > callback ) :
+      m_module( std::move( module ) ),
+      m_callback( std::move( callback ) )
+    {
+    }
+
+    Result operator()( Args... args ) const
+    {
+      ModuleCallScope scope( m_module );
+      return m_callback( std::forward< Args >( args )... );
+    }
+
+  private:
+    // declared first, the callback code lives in the module and has to be destroyed before the module can go
+    ModuleRef m_module;
+    std::function< Result( Args... ) > m_callback;
+  };
+
+  /*!
+   * @brief Binds a callback to the module of the script currently running, if any
+   *
+   * @param callback the callback to bind
+   * @return the bound callback or the callback itself if it was not created by a script
+   */
+  template< typename Result, typename... Args >
+  std::function< Result( Args... ) > bindToCallingModule( std::function< Result( Args... ) > callback )
+  {
+    auto& module = getCallingModule();
+    if( !callback || !module )
+      return callback;
+
+    return ModuleBoundCallback< Result, Args... >( module, std::move( callback ) );
+  }
+
   /*!
    * @brief Contains all the functionality for easily loading, unloading, reloading and generally accessing scripts.
    */
@@ -18,31 +126,87 @@ namespace Sapphire::Scripting
   {
   protected:
     /*!
-     * @brief An internal list that maps script types to another list containing scripts indexed by their assoicated id
+     * @brief An internal list that maps script types to another list containing script slots indexed by their assoicated id
      */
-    std::unordered_map< std::size_t, std::unordered_map< uint32_t, Sapphire::ScriptAPI::ScriptObject* > > m_scripts;
+    std::unordered_map< std::size_t, std::unordered_map< uint32_t, std::unique_ptr< ScriptSlot > > > m_scripts;
 
 
     ScriptLoader m_loader;
 
     /*!
-     * @brief The queue that scripts to be reloaded are placed into.
+     * @brief A module loaded by the staging thread, waiting to be swapped in by processLoadQueue
+     */
+    struct StagedModule
+    {
+      std::string path;
+      // nullptr if the module failed to load
+      ScriptInfo* info;
+    };
+
+    /*!
+     * @brief The queue that modules to be loaded by the staging thread are placed into, guarded by m_stageMutex.
      */
     std::queue< std::string > m_scriptLoadQueue;
 
+    /*!
+     * @brief Modules the staging thread is done with, guarded by m_stageMutex.
+     */
+    std::vector< StagedModule > m_stagedModules;
+
+    std::mutex m_stageMutex;
+    std::condition_variable m_stageCondition;
+    bool m_stopStaging;
+    std::thread m_stageThread;
+
+    /*!
+     * @brief References to the modules bound to slots, the module of a reference without any other holder is unused
+     */
+    std::unordered_map< ScriptInfo*, ModuleRef > m_boundModules;
+
+    /*!
+     * @brief Replaced or unloaded modules, kept loaded until no script call or callback holds a reference to them
+     */
+    std::vector< ModuleRef > m_retiredModules;
+
     /*!
      * @brief Used to unload a script
      *
-     * Used to unload a script, clears m_scripts of any scripts assoicated with a ScriptInfo and then unloads that module
+     * Used to unload a script, clears m_scripts of any scripts assoicated with a ScriptInfo and retires that module
      *
      * @param info A pointer to the ScriptInfo object that is to be erased
      * @return true if successful, false if not
      */
     bool unloadScript( ScriptInfo* info );
 
+    /*!
+     * @brief Body of the staging thread, loads queued modules until the NativeScriptMgr is destroyed
+     */
+    void stageModules();
+
+    /*!
+     * @brief Points the slots of all scripts in a module to the module
+     */
+    void bindModule( ScriptInfo* info );
+
+    /*!
+     * @brief Clears the slots still pointing to scripts of a module and schedules the module to be freed
+     */
+    void retireModule( ScriptInfo* info );
+
+    /*!
+     * @brief Frees the retired modules nothing refers to anymore
+     */
+    void freeRetiredModules();
+
+    ScriptSlot* getScriptSlot( std::size_t type, uint32_t scriptId );
+
+    ScriptSlot* findScriptSlot( std::size_t type, uint32_t scriptId ) const;
+
   public:
     NativeScriptMgr( FrameworkPtr pFw );
 
+    ~NativeScriptMgr();
+
     /*!
      * @brief Loads a script from a path
      *
@@ -66,11 +230,21 @@ namespace Sapphire::Scripting
      *
      * Due to the nature of how this works, there's no return.
      * It will just silently fail over and over again to infinity and beyond until the server restarts... not that should ever happen under normal circumstances.
+     * The current module stays in use until the new one is swapped in.
      *
      * @param name The name of the module to be reloaded.
      */
     void queueScriptReload( const std::string& name );
 
+    /*!
+     * @brief Queues a module to be loaded on the staging thread, replacing an already loaded module of the same name
+     *
+     * Can be called from any thread, the module is swapped in by the next processLoadQueue call.
+     *
+     * @param path The path to the module to load
+     */
+    void queueScriptLoad( const std::string& path );
+
     /*!
      * @brief Case-insensitive search for modules, useful for debug commands
      *
@@ -80,7 +254,9 @@ namespace Sapphire::Scripting
     void findScripts( std::set< Sapphire::Scripting::ScriptInfo* >& scripts, const std::string& search );
 
     /*!
-     * @brief Called on a regular interval, allows for scripts to be loaded from the internal load queue.
+     * @brief Called on a regular interval, swaps in the modules loaded by the staging thread.
+     *
+     * Has to be called from the game thread between two ticks, when no script callback is running.
      */
     void processLoadQueue();
 
@@ -109,14 +285,53 @@ namespace Sapphire::Scripting
     template< typename T >
     T* getScript( uint32_t scriptId )
     {
-      auto type = typeid( T ).hash_code();
-
-      auto script = m_scripts[ type ].find( scriptId );
-      if( script == m_scripts[ type ].end() )
+      auto pSlot = findScriptSlot< T >( scriptId );
+      if( !pSlot )
         return nullptr;
 
-      return dynamic_cast< T* >( script->second );
+      // slots are keyed by the type hash each script passes to ScriptObject, so the script is always a T
+      return static_cast< T* >( pSlot->pScript );
+    }
+
+    /*!
+     * @brief Gets the slot of a script, creating an empty one if no script with the id was loaded yet
+     *
+     * Used to bind scripts to game objects when they are created, the slot is filled as soon as a matching script is loaded.
+     *
+     * @tparam T The type of the script
+     * @param scriptId The ID of the script
+     * @return the slot, valid for the lifetime of the NativeScriptMgr
+     */
+    template< typename T >
+    ScriptSlot* getScriptSlot( uint32_t scriptId )
+    {
+      return getScriptSlot( typeid( T ).hash_code(), scriptId );
+    }
+
+    /*!
+     * @brief Gets the slot of a script without creating it
+     *
+     * @tparam T The type of the script
+     * @param scriptId The ID of the script
+     * @return the slot or nullptr if no script with the id was ever loaded or bound
+     */
+    template< typename T >
+    ScriptSlot* findScriptSlot( uint32_t scriptId ) const
+    {
+      return findScriptSlot( typeid( T ).hash_code(), scriptId );
     }
+
+    /*!
+     * @brief Collects all slots which had scripts called through them, used for the script timing debug command
+     *
+     * @param slots the list the slots are appended to
+     */
+    void getCalledScriptSlots( std::vector< ScriptSlot* >& slots );
+
+    /*!
+     * @brief Resets the execution time accounting of every slot
+     */
+    void resetScriptTimings();
   };
 
 
@@ -52,13 +52,27 @@ Sapphire::Scripting::ScriptInfo* Sapphire::Scripting::ScriptLoader::loadModule(
     return nullptr;
   }
 
-  // copy to temp dir
+  auto info = stageModule( path );
+  if( !info )
+    return nullptr;
+
+  commitModule( info );
+
+  return info;
+}
+
+Sapphire::Scripting::ScriptInfo* Sapphire::Scripting::ScriptLoader::stageModule( const std::string& path )
+{
+  fs::path f( path );
+
+  // copy to temp dir, every staged copy gets its own name as the same path can't be loaded twice
   fs::path cacheDir( f.parent_path() /= m_cachePath );
-  fs::create_directories( cacheDir );
-  fs::path dest( cacheDir /= f.filename().string() );
+  fs::path dest( cacheDir );
+  dest /= f.stem().string() + "." + std::to_string( ++m_stageCounter ) + f.extension().string();
 
   try
   {
+    fs::create_directories( cacheDir );
     fs::copy_file( f, dest, fs::copy_options::overwrite_existing );
   }
   catch( const fs::filesystem_error& err )
@@ -79,22 +93,64 @@ Sapphire::Scripting::ScriptInfo* Sapphire::Scripting::ScriptLoader::loadModule(
   {
     Logger::error( "Failed to load module from: {0}", path );
 
+    fs::remove( dest );
     return nullptr;
   }
 
-  Logger::debug( "Loaded module: {0}",  f.filename().string() );
-
   auto info = new ScriptInfo;
   info->handle = handle;
   info->library_name = f.stem().string();
   info->cache_path = dest.string();
   info->library_path = f.string();
 
-  m_scriptMap.insert( std::make_pair( f.stem().string(), info ) );
+  auto scripts = getScripts( handle );
+  if( scripts )
+  {
+    for( int i = 0; scripts[ i ] != nullptr; i++ )
+      info->scripts.push_back( scripts[ i ] );
+  }
+
+  if( info->scripts.empty() )
+  {
+    Logger::error( "Module {0} does not contain any scripts", f.filename().string() );
+
+    // nothing was handed out yet, the module can go right away
+    freeModule( info );
+    return nullptr;
+  }
+
+  Logger::debug( "Loaded module: {0}",  f.filename().string() );
 
   return info;
 }
 
+void Sapphire::Scripting::ScriptLoader::commitModule( ScriptInfo* info )
+{
+  m_scriptMap[ info->library_name ] = info;
+}
+
+void Sapphire::Scripting::ScriptLoader::detachModule( ScriptInfo* info )
+{
+  auto it = m_scriptMap.find( info->library_name );
+  if( it != m_scriptMap.end() && it->second == info )
+    m_scriptMap.erase( it );
+}
+
+void Sapphire::Scripting::ScriptLoader::freeModule( ScriptInfo* info )
+{
+  for( auto script : info->scripts )
+    delete script;
+
+  if( !unloadModule( info->handle ) )
+    Logger::error( "failed to unload module: {0}", info->library_name );
+
+  // remove cached file
+  std::error_code err;
+  fs::remove( info->cache_path, err );
+
+  delete info;
+}
+
 Sapphire::ScriptAPI::ScriptObject** Sapphire::Scripting::ScriptLoader::getScripts( ModuleHandle handle )
 {
   using getScripts = Sapphire::ScriptAPI::ScriptObject** ( * )();
@@ -127,22 +183,11 @@ bool Sapphire::Scripting::ScriptLoader::unloadScript( ModuleHandle handle )
     if( it->second->handle == handle )
     {
       auto info = it->second;
+      m_scriptMap.erase( it );
 
-      if( unloadModule( handle ) )
-      {
-        m_scriptMap.erase( it );
-
-        // remove cached file
-        fs::remove( info->cache_path );
+      freeModule( info );
 
-        delete info;
-
-        return true;
-      }
-
-      Logger::error( "failed to unload module: {0}", info->library_name );
-
-      return false;
+      return true;
     }
   }
 
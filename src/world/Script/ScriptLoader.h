@@ -1,6 +1,7 @@
 #ifndef CORE_SCRIPTLOADER_H
 #define CORE_SCRIPTLOADER_H
 
+#include <atomic>
 #include <unordered_map>
 #include <set>
 
@@ -37,6 +38,11 @@ namespace Sapphire::Scripting
      */
     std::string m_cachePath;
 
+    /*!
+     * @brief Counter used to give every staged module its own cache file, so a new build can be loaded next to the old one.
+     */
+    std::atomic< uint32_t > m_stageCounter{ 0 };
+
   protected:
 
     /*!
@@ -66,14 +72,41 @@ namespace Sapphire::Scripting
     ScriptInfo* loadModule( const std::string& );
 
     /*!
-     * @brief Unload a script from it's ScriptInfo object
+     * @brief Loads and validates a module without registering it
+     *
+     * Copies the module into the cache folder, loads it and collects its scripts. Only reads the cache path, so it is
+     * safe to call from a worker thread while the game thread keeps using the registered modules.
+     *
+     * @return A pointer to a ScriptInfo with its scripts filled in, nullptr if the module could not be loaded
+     */
+    ScriptInfo* stageModule( const std::string& path );
+
+    /*!
+     * @brief Registers a module returned by stageModule, has to be called from the game thread
+     */
+    void commitModule( ScriptInfo* info );
+
+    /*!
+     * @brief Removes a module from the list of loaded modules without unloading it
+     *
+     * The module has to be released with freeModule once nothing references its scripts anymore.
+     */
+    void detachModule( ScriptInfo* info );
+
+    /*!
+     * @brief Deletes the scripts of a module that is not registered, unloads it and frees the ScriptInfo
+     */
+    void freeModule( ScriptInfo* info );
+
+    /*!
+     * @brief Unload a script from it's ScriptInfo object, this also deletes all scripts of the module
      *
      * @return true if successful, false if not
      */
     bool unloadScript( ScriptInfo* );
 
     /*!
-     * @brief Unload a script via it's module handle
+     * @brief Unload a script via it's module handle, this also deletes all scripts of the module
      *
      * @return true if successful, false if not
      */
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <chrono>
+
 #include <Logging/Logger.h>
 #include <Exd/ExdDataGenerated.h>
 
@@ -29,6 +32,91 @@
 
 namespace fs = std::experimental::filesystem;
 
+namespace
+{
+  uint64_t elapsedUs( std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end )
+  {
+    return static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >( end - start ).count() );
+  }
+
+  /*!
+   * @brief Accounts the time spent in a script call to the slot the script was called through
+   *
+   * Also marks the module of the script as being called into, callbacks the script hands out are bound to it.
+   */
+  class ScriptCallTimer
+  {
+  public:
+    explicit ScriptCallTimer( Sapphire::Scripting::ScriptSlot& slot ) :
+      m_slot( slot ),
+      m_scope( slot.module ),
+      m_start( std::chrono::steady_clock::now() )
+    {
+    }
+
+    ~ScriptCallTimer()
+    {
+      m_slot.recordCall( elapsedUs( m_start, std::chrono::steady_clock::now() ) );
+    }
+
+  private:
+    Sapphire::Scripting::ScriptSlot& m_slot;
+    Sapphire::Scripting::ModuleCallScope m_scope;
+    std::chrono::steady_clock::time_point m_start;
+  };
+
+  template< typename T >
+  T* getSlotScript( Sapphire::Scripting::ScriptSlot* pSlot )
+  {
+    if( !pSlot )
+      return nullptr;
+
+    // slots are keyed by script type, see NativeScriptMgr::getScript
+    return static_cast< T* >( pSlot->pScript );
+  }
+
+  /*!
+   * @brief Calls func for every entry with a script bound, entries sharing a script are called back to back
+   *
+   * The end of one call is taken as the start of the next call through the same slot, timing a batch
+   * therefore takes a single clock read per call.
+   */
+  template< typename T, typename Entry, typename GetSlot, typename Func >
+  void callScriptBatch( std::vector< Entry >& entries, GetSlot getSlot, Func func )
+  {
+    std::stable_sort( entries.begin(), entries.end(), [ &getSlot ]( const Entry& lhs, const Entry& rhs )
+    {
+      return std::less< Sapphire::Scripting::ScriptSlot* >()( getSlot( lhs ), getSlot( rhs ) );
+    } );
+
+    Sapphire::Scripting::ScriptSlot* pLastSlot = nullptr;
+    std::chrono::steady_clock::time_point callStart;
+
+    for( auto& entry : entries )
+    {
+      auto pSlot = getSlot( entry );
+      auto script = getSlotScript< T >( pSlot );
+      if( !script )
+        continue;
+
+      if( pSlot != pLastSlot )
+      {
+        callStart = std::chrono::steady_clock::now();
+        pLastSlot = pSlot;
+      }
+
+      {
+        Sapphire::Scripting::ModuleCallScope scope( pSlot->module );
+        func( *script, entry );
+      }
+
+      auto callEnd = std::chrono::steady_clock::now();
+      pSlot->recordCall( elapsedUs( callStart, callEnd ) );
+      callStart = callEnd;
+    }
+  }
+}
+
 Sapphire::Scripting::ScriptMgr::ScriptMgr( FrameworkPtr pFw ) :
   World::Manager::BaseManager( pFw ),
   m_firstScriptChangeNotificiation( false )
@@ -98,20 +186,13 @@ void Sapphire::Scripting::ScriptMgr::watchDirectories()
                            return;
                          }
 
+                         // this runs on the watchdog thread, modules are loaded on the staging thread
+                         // and swapped in by update(), which replaces any loaded module of the same name
                          for( const auto& path : paths )
                          {
-                           if( m_nativeScriptMgr->isModuleLoaded( path.stem().string() ) )
-                           {
-                             Logger::debug( "Reloading changed script: {0}", path.stem().string() );
-
-                             m_nativeScriptMgr->queueScriptReload( path.stem().string() );
-                           }
-                           else
-                           {
-                             Logger::debug( "Loading new script: {0}", path.stem().string() );
-
-                             m_nativeScriptMgr->loadScript( path.string() );
-                           }
+                           Logger::debug( "Queueing changed script: {0}", path.stem().string() );
+
+                           m_nativeScriptMgr->queueScriptLoad( path.string() );
                          }
                        } );
 }
@@ -160,75 +241,106 @@ void Sapphire::Scripting::ScriptMgr::onPlayerFirstEnterWorld( Entity::Player& pl
 //   }
 }
 
+Sapphire::Scripting::ScriptSlot* Sapphire::Scripting::ScriptMgr::getEventScriptSlot( Entity::Player& player,
+                                                                                     uint32_t eventId,
+                                                                                     bool useBaseScript )
+{
+  ScriptSlot* pSlot = nullptr;
+  ScriptSlot* pBaseSlot = nullptr;
+
+  // events started through Player::eventStart already carry their slots
+  if( auto pEvent = player.getEvent( eventId ) )
+  {
+    pSlot = pEvent->getScriptSlot();
+    pBaseSlot = pEvent->getBaseScriptSlot();
+  }
+
+  // no slot existed when the event started, a script may have been loaded since
+  if( !pSlot )
+    pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventScript >( eventId );
+  if( useBaseScript && !pBaseSlot )
+    pBaseSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventScript >( eventId & 0xFFFF0000 );
+
+  if( pSlot && pSlot->pScript )
+    return pSlot;
+
+  if( useBaseScript && pBaseSlot && pBaseSlot->pScript )
+    return pBaseSlot;
+
+  return nullptr;
+}
+
 bool Sapphire::Scripting::ScriptMgr::onTalk( Entity::Player& player, uint64_t actorId, uint32_t eventId )
 {
   // check if the actor is an eobj and call its script if we have one
   auto zone = player.getCurrentZone();
   if( auto eobj = zone->getEObj( actorId ) )
   {
-    auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventObjectScript >( eobj->getObjectId() );
+    auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventObjectScript >( eobj->getObjectId() );
+    auto script = getSlotScript< Sapphire::ScriptAPI::EventObjectScript >( pSlot );
     if( script )
     {
+      ScriptCallTimer timer( *pSlot );
       script->onTalk( eventId, player, *eobj );
       return true;
     }
   }
 
   // check for a direct eventid match first, otherwise default to base type
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( script )
-  {
-    script->onTalk( eventId, player, actorId );
-    return true;
-  }
-  else
-  {
-    script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId & 0xFFFF0000 );
-    if( !script )
-      return false;
+  auto pSlot = getEventScriptSlot( player, eventId, true );
+  if( !pSlot )
+    return false;
 
-    script->onTalk( eventId, player, actorId );
-    return true;
-  }
+  ScriptCallTimer timer( *pSlot );
+  getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onTalk( eventId, player, actorId );
+  return true;
 }
 
 bool Sapphire::Scripting::ScriptMgr::onEnterTerritory( Entity::Player& player, uint32_t eventId,
                                                        uint16_t param1, uint16_t param2 )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( !script )
+  auto pSlot = getEventScriptSlot( player, eventId, false );
+  if( !pSlot )
     return false;
-  script->onEnterTerritory( player, eventId, param1, param2 );
+
+  ScriptCallTimer timer( *pSlot );
+  getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onEnterTerritory( player, eventId, param1, param2 );
   return true;
 }
 
 bool Sapphire::Scripting::ScriptMgr::onWithinRange( Entity::Player& player, uint32_t eventId, uint32_t param1,
                                                     float x, float y, float z )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( !script )
+  auto pSlot = getEventScriptSlot( player, eventId, false );
+  if( !pSlot )
     return false;
-  script->onWithinRange( player, eventId, param1, x, y, z );
+
+  ScriptCallTimer timer( *pSlot );
+  getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onWithinRange( player, eventId, param1, x, y, z );
   return true;
 }
 
 bool Sapphire::Scripting::ScriptMgr::onOutsideRange( Entity::Player& player, uint32_t eventId, uint32_t param1,
                                                      float x, float y, float z )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( !script )
+  auto pSlot = getEventScriptSlot( player, eventId, false );
+  if( !pSlot )
     return false;
-  script->onOutsideRange( player, eventId, param1, x, y, z );
+
+  ScriptCallTimer timer( *pSlot );
+  getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onOutsideRange( player, eventId, param1, x, y, z );
   return true;
 }
 
 bool Sapphire::Scripting::ScriptMgr::onEmote( Entity::Player& player, uint64_t actorId,
                                               uint32_t eventId, uint8_t emoteId )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( !script )
+  auto pSlot = getEventScriptSlot( player, eventId, false );
+  if( !pSlot )
     return false;
-  script->onEmote( actorId, eventId, emoteId, player );
+
+  ScriptCallTimer timer( *pSlot );
+  getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onEmote( actorId, eventId, emoteId, player );
   return true;
 }
 
@@ -243,10 +355,12 @@ bool Sapphire::Scripting::ScriptMgr::onEventHandlerReturn( Entity::Player& playe
 bool Sapphire::Scripting::ScriptMgr::onEventHandlerTradeReturn( Entity::Player& player, uint32_t eventId,
                                                                 uint16_t subEvent, uint16_t param, uint32_t catalogId )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
-  if( script )
+  auto pSlot = getEventScriptSlot( player, eventId, false );
+  if( pSlot )
   {
-    script->onEventHandlerTradeReturn( player, eventId, subEvent, param, catalogId );
+    ScriptCallTimer timer( *pSlot );
+    getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot )->onEventHandlerTradeReturn( player, eventId, subEvent,
+                                                                                            param, catalogId );
     return true;
   }
 
@@ -262,11 +376,13 @@ bool Sapphire::Scripting::ScriptMgr::onEventItem( Entity::Player& player, uint32
   std::string objName = pEventMgr->getEventName( eventId );
   player.sendDebug( "Calling: {0}.{1} - {2}", objName, eventName, eventId );
 
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( eventId );
+  auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventScript >( eventId );
+  auto script = getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot );
   if( script )
   {
     player.eventStart( targetId, eventId, Event::EventHandler::Item, 0, 0 );
 
+    ScriptCallTimer timer( *pSlot );
     script->onEventItem( player, eventItemId, eventId, castTime, targetId );
     return true;
   }
@@ -287,13 +403,15 @@ bool Sapphire::Scripting::ScriptMgr::onBNpcKill( Entity::Player& player, uint16_
 
     uint32_t questId = activeQuests->c.questId | Event::EventHandler::EventHandlerType::Quest << 16;
 
-    auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( questId );
+    auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventScript >( questId );
+    auto script = getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot );
     if( script )
     {
       std::string objName = pEventMgr->getEventName( questId );
 
       player.sendDebug( "Calling: {0}.onBnpcKill nameId#{1}", objName, nameId );
 
+      ScriptCallTimer timer( *pSlot );
       script->onBNpcKill( nameId, player );
     }
   }
@@ -314,7 +432,8 @@ bool Sapphire::Scripting::ScriptMgr::onEObjHit( Sapphire::Entity::Player& player
 
     uint32_t questId = activeQuests->c.questId | Event::EventHandler::EventHandlerType::Quest << 16;
 
-    auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::EventScript >( questId );
+    auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::EventScript >( questId );
+    auto script = getSlotScript< Sapphire::ScriptAPI::EventScript >( pSlot );
     if( script )
     {
       didCallScript = true;
@@ -322,6 +441,7 @@ bool Sapphire::Scripting::ScriptMgr::onEObjHit( Sapphire::Entity::Player& player
 
       player.sendDebug( "Calling: {0}.onEObjHit actorId#{1}", objName, actorId );
 
+      ScriptCallTimer timer( *pSlot );
       script->onEObjHit( player, actorId, actionId );
     }
   }
@@ -331,10 +451,12 @@ bool Sapphire::Scripting::ScriptMgr::onEObjHit( Sapphire::Entity::Player& player
 
 bool Sapphire::Scripting::ScriptMgr::onExecute( World::Action::Action& action )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto script = getSlotScript< Sapphire::ScriptAPI::ActionScript >( pSlot );
 
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onExecute( action );
     return true;
   }
@@ -343,10 +465,12 @@ bool Sapphire::Scripting::ScriptMgr::onExecute( World::Action::Action& action )
 
 bool Sapphire::Scripting::ScriptMgr::onInterrupt( World::Action::Action& action )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto script = getSlotScript< Sapphire::ScriptAPI::ActionScript >( pSlot );
 
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onInterrupt( action );
     return true;
   }
@@ -355,10 +479,12 @@ bool Sapphire::Scripting::ScriptMgr::onInterrupt( World::Action::Action& action
 
 bool Sapphire::Scripting::ScriptMgr::onStart( World::Action::Action& action )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto pSlot = m_nativeScriptMgr->findScriptSlot< Sapphire::ScriptAPI::ActionScript >( action.getId() );
+  auto script = getSlotScript< Sapphire::ScriptAPI::ActionScript >( pSlot );
 
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onStart( action );
     return true;
   }
@@ -366,15 +492,18 @@ bool Sapphire::Scripting::ScriptMgr::onStart( World::Action::Action& action )
   return false;
 }
 
-bool Sapphire::Scripting::ScriptMgr::onStatusReceive( Entity::CharaPtr pActor, uint32_t effectId )
+bool Sapphire::Scripting::ScriptMgr::onStatusReceive( Entity::CharaPtr pActor,
+                                                      Sapphire::StatusEffect::StatusEffect& effect )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::StatusEffectScript >( effectId );
+  auto pSlot = effect.getScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::StatusEffectScript >( pSlot );
 
   if( script )
   {
     if( pActor->isPlayer() )
-      pActor->getAsPlayer()->sendDebug( "Calling status receive for statusid#{0}", effectId );
+      pActor->getAsPlayer()->sendDebug( "Calling status receive for statusid#{0}", effect.getId() );
 
+    ScriptCallTimer timer( *pSlot );
     script->onApply( *pActor );
     return true;
   }
@@ -384,12 +513,14 @@ bool Sapphire::Scripting::ScriptMgr::onStatusReceive( Entity::CharaPtr pActor, u
 
 bool Sapphire::Scripting::ScriptMgr::onStatusTick( Entity::CharaPtr pChara, Sapphire::StatusEffect::StatusEffect& effect )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::StatusEffectScript >( effect.getId() );
+  auto pSlot = effect.getScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::StatusEffectScript >( pSlot );
   if( script )
   {
     if( pChara->isPlayer() )
       pChara->getAsPlayer()->sendDebug( "Calling status tick for statusid#{0}", effect.getId() );
 
+    ScriptCallTimer timer( *pSlot );
     script->onTick( *pChara );
     return true;
   }
@@ -397,14 +528,37 @@ bool Sapphire::Scripting::ScriptMgr::onStatusTick( Entity::CharaPtr pChara, Sapp
   return false;
 }
 
-bool Sapphire::Scripting::ScriptMgr::onStatusTimeOut( Entity::CharaPtr pChara, uint32_t effectId )
+void Sapphire::Scripting::ScriptMgr::onStatusTicks(
+  std::vector< std::pair< Entity::CharaPtr, StatusEffect::StatusEffectPtr > >& ticks )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::StatusEffectScript >( effectId );
+  using StatusEffectTick = std::pair< Entity::CharaPtr, StatusEffect::StatusEffectPtr >;
+
+  callScriptBatch< Sapphire::ScriptAPI::StatusEffectScript >( ticks,
+    []( const StatusEffectTick& tick )
+    {
+      return tick.second->getScriptSlot();
+    },
+    []( Sapphire::ScriptAPI::StatusEffectScript& script, StatusEffectTick& tick )
+    {
+      auto& pChara = tick.first;
+      if( pChara->isPlayer() )
+        pChara->getAsPlayer()->sendDebug( "Calling status tick for statusid#{0}", tick.second->getId() );
+
+      script.onTick( *pChara );
+    } );
+}
+
+bool Sapphire::Scripting::ScriptMgr::onStatusTimeOut( Entity::CharaPtr pChara,
+                                                      Sapphire::StatusEffect::StatusEffect& effect )
+{
+  auto pSlot = effect.getScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::StatusEffectScript >( pSlot );
   if( script )
   {
     if( pChara->isPlayer() )
-      pChara->getAsPlayer()->sendDebug( "Calling status timeout for statusid#{0}", effectId );
+      pChara->getAsPlayer()->sendDebug( "Calling status timeout for statusid#{0}", effect.getId() );
 
+    ScriptCallTimer timer( *pSlot );
     script->onExpire( *pChara );
     return true;
   }
@@ -414,9 +568,11 @@ bool Sapphire::Scripting::ScriptMgr::onStatusTimeOut( Entity::CharaPtr pChara, u
 
 bool Sapphire::Scripting::ScriptMgr::onZoneInit( ZonePtr pZone )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::ZoneScript >( pZone->getTerritoryTypeId() );
+  auto pSlot = pZone->getScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::ZoneScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onZoneInit();
     return true;
   }
@@ -426,9 +582,11 @@ bool Sapphire::Scripting::ScriptMgr::onZoneInit( ZonePtr pZone )
 
 bool Sapphire::Scripting::ScriptMgr::onInstanceInit( InstanceContentPtr instance )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::InstanceContentScript >( instance->getDirectorId() );
+  auto pSlot = instance->getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::InstanceContentScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onInit( *instance );
     return true;
   }
@@ -436,25 +594,50 @@ bool Sapphire::Scripting::ScriptMgr::onInstanceInit( InstanceContentPtr instance
   return false;
 }
 
-bool Sapphire::Scripting::ScriptMgr::onInstanceUpdate( InstanceContentPtr instance, uint64_t tickCount )
+void Sapphire::Scripting::ScriptMgr::queueInstanceUpdate( InstanceContentPtr instance )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::InstanceContentScript >( instance->getDirectorId() );
+  m_instanceContentUpdates.push_back( instance );
+}
 
-  if( script )
-  {
-    script->onUpdate( *instance, tickCount );
-    return true;
-  }
+void Sapphire::Scripting::ScriptMgr::queueInstanceUpdate( QuestBattlePtr instance )
+{
+  m_questBattleUpdates.push_back( instance );
+}
 
-  return false;
+void Sapphire::Scripting::ScriptMgr::processInstanceUpdates( uint64_t tickCount )
+{
+  callScriptBatch< Sapphire::ScriptAPI::InstanceContentScript >( m_instanceContentUpdates,
+    []( const InstanceContentPtr& instance )
+    {
+      return instance->getInstanceScriptSlot();
+    },
+    [ tickCount ]( Sapphire::ScriptAPI::InstanceContentScript& script, InstanceContentPtr& instance )
+    {
+      script.onUpdate( *instance, tickCount );
+    } );
+
+  callScriptBatch< Sapphire::ScriptAPI::QuestBattleScript >( m_questBattleUpdates,
+    []( const QuestBattlePtr& instance )
+    {
+      return instance->getInstanceScriptSlot();
+    },
+    [ tickCount ]( Sapphire::ScriptAPI::QuestBattleScript& script, QuestBattlePtr& instance )
+    {
+      script.onUpdate( *instance, tickCount );
+    } );
+
+  m_instanceContentUpdates.clear();
+  m_questBattleUpdates.clear();
 }
 
 bool Sapphire::Scripting::ScriptMgr::onInstanceEnterTerritory( InstanceContentPtr instance, Entity::Player& player,
                                                                uint32_t eventId, uint16_t param1, uint16_t param2 )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::InstanceContentScript >( instance->getDirectorId() );
+  auto pSlot = instance->getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::InstanceContentScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onEnterTerritory( *instance, player, eventId, param1, param2 );
     return true;
   }
@@ -464,9 +647,11 @@ bool Sapphire::Scripting::ScriptMgr::onInstanceEnterTerritory( InstanceContentPt
 
 bool Sapphire::Scripting::ScriptMgr::onPlayerSetup( QuestBattle& instance, Entity::Player& player )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance.getDirectorId() );
+  auto pSlot = instance.getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::QuestBattleScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onPlayerSetup( instance, player );
     return true;
   }
@@ -476,9 +661,11 @@ bool Sapphire::Scripting::ScriptMgr::onPlayerSetup( QuestBattle& instance, Entit
 
 bool Sapphire::Scripting::ScriptMgr::onInstanceInit( QuestBattlePtr instance )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance->getDirectorId() );
+  auto pSlot = instance->getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::QuestBattleScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onInit( *instance );
     return true;
   }
@@ -486,26 +673,14 @@ bool Sapphire::Scripting::ScriptMgr::onInstanceInit( QuestBattlePtr instance )
   return false;
 }
 
-bool Sapphire::Scripting::ScriptMgr::onInstanceUpdate( QuestBattlePtr instance, uint64_t tickCount )
-{
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance->getDirectorId() );
-
-  if( script )
-  {
-    script->onUpdate( *instance, tickCount );
-    return true;
-  }
-
-  return false;
-}
-
-
 bool Sapphire::Scripting::ScriptMgr::onDutyCommence( QuestBattle& instance, Entity::Player& player )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance.getDirectorId() );
+  auto pSlot = instance.getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::QuestBattleScript >( pSlot );
 
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onDutyCommence( instance, player );
     return true;
   }
@@ -516,9 +691,11 @@ bool Sapphire::Scripting::ScriptMgr::onDutyCommence( QuestBattle& instance, Enti
 bool Sapphire::Scripting::ScriptMgr::onInstanceEnterTerritory( QuestBattlePtr instance, Entity::Player& player,
                                                                uint32_t eventId, uint16_t param1, uint16_t param2 )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance->getDirectorId() );
+  auto pSlot = instance->getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::QuestBattleScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onEnterTerritory( *instance, player, eventId, param1, param2 );
     return true;
   }
@@ -534,9 +711,11 @@ Sapphire::Scripting::NativeScriptMgr& Sapphire::Scripting::ScriptMgr::getNativeS
 bool
 Sapphire::Scripting::ScriptMgr::onDutyComplete( Sapphire::QuestBattlePtr instance, Sapphire::Entity::Player& player )
 {
-  auto script = m_nativeScriptMgr->getScript< Sapphire::ScriptAPI::QuestBattleScript >( instance->getDirectorId() );
+  auto pSlot = instance->getInstanceScriptSlot();
+  auto script = getSlotScript< Sapphire::ScriptAPI::QuestBattleScript >( pSlot );
   if( script )
   {
+    ScriptCallTimer timer( *pSlot );
     script->onDutyComplete( *instance, player );
     return true;
   }
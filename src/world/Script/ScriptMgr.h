@@ -4,6 +4,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include <Common.h>
 #include "Forwards.h"
@@ -28,6 +29,20 @@ namespace Sapphire::Scripting
      */
     bool m_firstScriptChangeNotificiation;
 
+    /*!
+     * @brief Instances which updated this tick, their scripts are called in one batch by processInstanceUpdates
+     */
+    std::vector< InstanceContentPtr > m_instanceContentUpdates;
+    std::vector< QuestBattlePtr > m_questBattleUpdates;
+
+    /*!
+     * @brief Gets the slot of the script handling an event, preferring the slots bound when the event was started
+     *
+     * @param useBaseScript fall back to the script of the event type if there is none for the exact event id
+     * @return the slot or nullptr if no script is loaded for the event
+     */
+    ScriptSlot* getEventScriptSlot( Entity::Player& player, uint32_t eventId, bool useBaseScript );
+
   public:
     ScriptMgr( FrameworkPtr pFw );
 
@@ -78,11 +93,18 @@ namespace Sapphire::Scripting
 
     bool onExecute( World::Action::Action& action );
 
-    bool onStatusReceive( Entity::CharaPtr pActor, uint32_t effectId );
+    bool onStatusReceive( Entity::CharaPtr pActor, Sapphire::StatusEffect::StatusEffect& effect );
 
     bool onStatusTick( Entity::CharaPtr pActor, Sapphire::StatusEffect::StatusEffect& effect );
 
-    bool onStatusTimeOut( Entity::CharaPtr pActor, uint32_t effectId );
+    /*!
+     * @brief Calls the tick scripts of all status effects that ticked in a zone update
+     *
+     * Effects sharing a script are called back to back, the list is reordered accordingly.
+     */
+    void onStatusTicks( std::vector< std::pair< Entity::CharaPtr, StatusEffect::StatusEffectPtr > >& ticks );
+
+    bool onStatusTimeOut( Entity::CharaPtr pActor, Sapphire::StatusEffect::StatusEffect& effect );
 
     bool onZoneInit( ZonePtr pZone );
 
@@ -94,7 +116,10 @@ namespace Sapphire::Scripting
 
     bool onInstanceInit( InstanceContentPtr instance );
 
-    bool onInstanceUpdate( InstanceContentPtr instance, uint64_t tickCount );
+    /*!
+     * @brief Queues the update script of an instance, called for all queued instances by processInstanceUpdates
+     */
+    void queueInstanceUpdate( InstanceContentPtr instance );
 
     bool
     onInstanceEnterTerritory( InstanceContentPtr instance, Entity::Player& player, uint32_t eventId, uint16_t param1,
@@ -104,7 +129,12 @@ namespace Sapphire::Scripting
 
     bool onInstanceInit( QuestBattlePtr instance );
 
-    bool onInstanceUpdate( QuestBattlePtr instance, uint64_t tickCount );
+    void queueInstanceUpdate( QuestBattlePtr instance );
+
+    /*!
+     * @brief Calls the update scripts of all instances queued since the last call, grouped by script
+     */
+    void processInstanceUpdates( uint64_t tickCount );
 
     bool onDutyCommence( QuestBattle& instance, Entity::Player& player );
 
@@ -10,6 +10,7 @@
 
 #include <Version.h>
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <Config/ConfigMgr.h>
 
 #include <Exd/ExdDataGenerated.h>
@@ -39,10 +40,14 @@
 #include "Manager/InventoryMgr.h"
 #include "Manager/EventMgr.h"
 #include "Manager/ItemMgr.h"
+#include "Manager/CombatDataMgr.h"
 #include "Manager/MarketMgr.h"
 #include "Manager/RNGMgr.h"
 #include "Manager/NaviMgr.h"
 #include "Manager/ActionMgr.h"
+#include "ContentFinder/ContentFinder.h"
+
+#include <sstream>
 
 using namespace Sapphire::World::Manager;
 
@@ -51,6 +56,7 @@ Sapphire::World::ServerMgr::ServerMgr( const std::string& configName, FrameworkP
   m_configName( configName ),
   m_bRunning( true ),
   m_lastDBPingTime( 0 ),
+  m_lastExdSnapshotTime( 0 ),
   m_worldId( 67 )
 {
 }
@@ -99,10 +105,25 @@ bool Sapphire::World::ServerMgr::loadSettings( int32_t argc, char* argv[] )
 
   m_config.navigation.meshPath = pConfig->getValue< std::string >( "Navigation", "MeshPath", "navi" );
 
+  m_config.instances.poolSize = pConfig->getValue< uint32_t >( "Instances", "PoolSize", 2 );
+  m_config.instances.warmContent = pConfig->getValue< std::string >( "Instances", "WarmContent", "" );
+  m_config.instances.warmQuestBattles = pConfig->getValue< std::string >( "Instances", "WarmQuestBattles", "" );
+
+  m_config.contentFinder.matchInterval = pConfig->getValue< uint32_t >( "ContentFinder", "MatchInterval", 1000 );
+  m_config.contentFinder.readyCheckTimeout = pConfig->getValue< uint32_t >( "ContentFinder", "ReadyCheckTimeout", 45 );
+
+  m_config.exd.preloadSheets = pConfig->getValue< std::string >( "Exd", "PreloadSheets", "" );
+  m_config.exd.language = pConfig->getValue< std::string >( "Exd", "Language", "en" );
+  m_config.exd.strict = pConfig->getValue( "Exd", "Strict", false );
+  m_config.exd.snapshotPath = pConfig->getValue< std::string >( "Exd", "SnapshotPath", "./cache/exd.snapshot" );
+
   m_config.network.disconnectTimeout = pConfig->getValue< uint16_t >( "Network", "DisconnectTimeout", 20 );
   m_config.network.listenIp = pConfig->getValue< std::string >( "Network", "ListenIp", "0.0.0.0" );
   m_config.network.listenPort = pConfig->getValue< uint16_t >( "Network", "ListenPort", 54992 );
   m_config.network.inRangeDistance = pConfig->getValue< float >( "Network", "InRangeDistance", 80.f );
+  m_config.network.spawnsPerTick = pConfig->getValue< uint32_t >( "Network", "SpawnsPerTick", 8 );
+  m_config.network.zoneInBundleSize = pConfig->getValue< uint32_t >( "Network", "ZoneInBundleSize", 8192 );
+  m_config.network.capturePath = pConfig->getValue< std::string >( "Network", "CapturePath", "" );
 
   m_config.motd = pConfig->getValue< std::string >( "General", "MotD", "" );
 
@@ -133,10 +154,41 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
 
   Logger::setLogLevel( m_config.global.general.logLevel );
 
+  Metrics::Registry::startExporter( m_config.global.metrics.path + "/world.prom", m_config.global.metrics.interval );
+
   Logger::info( "Setting up generated EXD data" );
+  Data::ExdProfile exdProfile;
+  exdProfile.strict = m_config.exd.strict;
+  exdProfile.snapshotPath = m_config.exd.snapshotPath;
+
+  std::istringstream sheetList( m_config.exd.preloadSheets );
+  std::string sheet;
+  while( std::getline( sheetList, sheet, ',' ) )
+  {
+    sheet.erase( 0, sheet.find_first_not_of( ' ' ) );
+    sheet.erase( sheet.find_last_not_of( ' ' ) + 1 );
+    if( !sheet.empty() )
+      exdProfile.preloadSheets.insert( sheet );
+  }
+
+  static const std::map< std::string, xiv::exd::Language > languages =
+  {
+    { "ja", xiv::exd::Language::ja },
+    { "en", xiv::exd::Language::en },
+    { "de", xiv::exd::Language::de },
+    { "fr", xiv::exd::Language::fr },
+  };
+  auto language = languages.find( m_config.exd.language );
+  if( language == languages.end() )
+  {
+    Logger::fatal( "Exd.Language: unknown language {0}", m_config.exd.language );
+    return;
+  }
+  exdProfile.language = language->second;
+
   auto pExdData = std::make_shared< Data::ExdDataGenerated >();
   auto dataPath = m_config.global.general.dataPath;
-  if( !pExdData->init( dataPath ) )
+  if( !pExdData->init( dataPath, exdProfile ) )
   {
     Logger::fatal( "Error setting up generated EXD data. Make sure that DataPath is set correctly in global.ini" );
     Logger::fatal( "DataPath: {0}", dataPath );
@@ -144,6 +196,15 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   }
   framework()->set< Data::ExdDataGenerated >( pExdData );
 
+  Logger::info( "CombatDataMgr: Building combat data" );
+  auto pCombatDataMgr = std::make_shared< Manager::CombatDataMgr >( framework() );
+  if( !pCombatDataMgr->init() )
+  {
+    Logger::fatal( "Unable to build combat data!" );
+    return;
+  }
+  framework()->set< Manager::CombatDataMgr >( pCombatDataMgr );
+
   auto pDb = std::make_shared< Db::DbWorkerPool< Db::ZoneDbConnection > >();
   Sapphire::Db::DbLoader loader;
   loader.addDb( *pDb, m_config.global.database );
@@ -154,6 +215,10 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   }
   framework()->set< Db::DbWorkerPool< Db::ZoneDbConnection > >( pDb );
 
+  // items are created while loading housing and markets already
+  auto pItemMgr = std::make_shared< Manager::ItemMgr >( framework() );
+  framework()->set< Manager::ItemMgr >( pItemMgr );
+
   Logger::info( "LinkshellMgr: Caching linkshells" );
   auto pLsMgr = std::make_shared< Manager::LinkshellMgr >( framework() );
   if( !pLsMgr->loadLinkshells() )
@@ -205,7 +270,17 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
     return;
   }
 
+  auto pContentFinder = std::make_shared< ContentFinder::ContentFinder >( framework() );
+  framework()->set< ContentFinder::ContentFinder >( pContentFinder );
+
+  if( !pContentFinder->init() )
+  {
+    Logger::fatal( "Failed to setup content finder!" );
+    return;
+  }
 
+  // every sheet startup needs is open by now, the next start maps them instead
+  pExdData->writeSnapshot();
 
   Network::HivePtr hive( new Network::Hive() );
   Network::addServerToHive< Network::GameConnection >( m_ip, m_port, hive, framework() );
@@ -218,7 +293,6 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   auto pShopMgr = std::make_shared< Manager::ShopMgr >( framework() );
   auto pInventoryMgr = std::make_shared< Manager::InventoryMgr >( framework() );
   auto pEventMgr = std::make_shared< Manager::EventMgr >( framework() );
-  auto pItemMgr = std::make_shared< Manager::ItemMgr >( framework() );
   auto pRNGMgr = std::make_shared< Manager::RNGMgr >( framework() );
 
   framework()->set< DebugCommandMgr >( pDebugCom );
@@ -226,13 +300,15 @@ void Sapphire::World::ServerMgr::run( int32_t argc, char* argv[] )
   framework()->set< Manager::ShopMgr >( pShopMgr );
   framework()->set< Manager::InventoryMgr >( pInventoryMgr );
   framework()->set< Manager::EventMgr >( pEventMgr );
-  framework()->set< Manager::ItemMgr >( pItemMgr );
   framework()->set< Manager::RNGMgr >( pRNGMgr );
 
   Logger::info( "World server running on {0}:{1}", m_ip, m_port );
 
   mainLoop();
 
+  // sheets first used while running were read from the game files, keep them for the next start
+  pExdData->writeSnapshot();
+
   for( auto& thread_entry : thread_list )
   {
     thread_entry.join();
@@ -264,12 +340,20 @@ void Sapphire::World::ServerMgr::mainLoop()
 {
   auto pTeriMgr = framework()->get< TerritoryMgr >();
   auto pScriptMgr = framework()->get< Scripting::ScriptMgr >();
+  auto pContentFinder = framework()->get< ContentFinder::ContentFinder >();
   auto pDb = framework()->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
+  auto pExdData = framework()->get< Data::ExdDataGenerated >();
+
+  auto& sessionCount = Metrics::Registry::gauge( "world_sessions", "", "Active sessions" );
+  auto& dbQueueSize = Metrics::Registry::gauge( "world_db_queue_size", "", "Async database operations waiting for a worker" );
+  auto& loopTime = Metrics::Registry::histogram( "world_main_loop_us", "", "Main loop update time in microseconds" );
 
   while( isRunning() )
   {
     std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
 
+    Metrics::ScopedTimer loopTimer( loopTime );
+
     auto currTime = Common::Util::getTimeSeconds();
     auto tickCount = Common::Util::getTimeMs();
 
@@ -277,10 +361,12 @@ void Sapphire::World::ServerMgr::mainLoop()
 
     pScriptMgr->update();
 
-    std::lock_guard< std::mutex > lock( m_sessionMutex );
-    for( auto sessionIt : m_sessionMapById )
+    pContentFinder->update( tickCount );
+
+    // iterate a snapshot of the registry so lookups from other threads are never blocked by the update
+    auto sessions = m_sessionMapById.snapshot();
+    for( auto& session : sessions )
     {
-      auto session = sessionIt.second;
       if( session && session->getPlayer() )
       {
 
@@ -292,47 +378,48 @@ void Sapphire::World::ServerMgr::mainLoop()
       }
     }
 
+    sessionCount.set( static_cast< int64_t >( m_sessionMapById.size() ) );
+    dbQueueSize.set( static_cast< int64_t >( pDb->getQueueSize() ) );
+
     if( currTime - m_lastDBPingTime > 3 )
     {
       pDb->keepAlive();
       m_lastDBPingTime = currTime;
     }
 
-    auto it = m_sessionMapById.begin();
-    for( ; it != m_sessionMapById.end(); )
+    // does nothing unless a sheet had to be read from the game files since the last write
+    if( currTime - m_lastExdSnapshotTime > 300 )
+    {
+      pExdData->writeSnapshot();
+      m_lastExdSnapshotTime = currTime;
+    }
+
+    for( auto& session : sessions )
     {
-      auto diff = std::difftime( currTime, it->second->getLastDataTime() );
+      auto diff = std::difftime( currTime, session->getLastDataTime() );
 
-      auto pPlayer = it->second->getPlayer();
+      auto pPlayer = session->getPlayer();
 
       // remove session of players marked for removel ( logoff / kick )
       if( pPlayer->isMarkedForRemoval() && diff > 5 )
       {
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          Logger::info( "[{0}] Session removal", it->second->getId() );
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-          continue;
-        }
+        session->close();
+        Logger::info( "[{0}] Session removal", session->getId() );
+        pContentFinder->withdraw( pPlayer->getId() );
+        m_sessionMapById.eraseIf( session->getId(), session );
+        m_sessionMapByName.eraseIf( pPlayer->getName(), session );
+        continue;
       }
 
       // remove sessions that simply timed out
       if( diff > 20 )
       {
-        Logger::info( "[{0}] Session time out", it->second->getId() );
-
-        it->second->close();
-        // if( it->second.unique() )
-        {
-          it = m_sessionMapById.erase( it );
-          removeSession( pPlayer->getName() );
-        }
-      }
-      else
-      {
-        ++it;
+        Logger::info( "[{0}] Session time out", session->getId() );
+
+        session->close();
+        pContentFinder->withdraw( pPlayer->getId() );
+        m_sessionMapById.eraseIf( session->getId(), session );
+        m_sessionMapByName.eraseIf( pPlayer->getName(), session );
       }
 
     }
@@ -342,13 +429,12 @@ void Sapphire::World::ServerMgr::mainLoop()
 
 bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
 {
+  // only serializes session creation, lookups go through the sharded registry without this lock
   std::lock_guard< std::mutex > lock( m_sessionMutex );
 
   const auto session_id_str = std::to_string( sessionId );
 
-  auto it = m_sessionMapById.find( sessionId );
-
-  if( it != m_sessionMapById.end() )
+  if( m_sessionMapById.contains( sessionId ) )
   {
     Logger::error( "[{0}] Error creating session", session_id_str );
     return false;
@@ -357,15 +443,16 @@ bool Sapphire::World::ServerMgr::createSession( uint32_t sessionId )
   Logger::info( "[{0}] Creating new session", session_id_str );
 
   std::shared_ptr< Session > newSession( new Session( sessionId, framework() ) );
-  m_sessionMapById[ sessionId ] = newSession;
+  m_sessionMapById.set( sessionId, newSession );
 
   if( !newSession->loadPlayer() )
   {
     Logger::error( "[{0}] Error loading player {0}", session_id_str );
+    m_sessionMapById.erase( sessionId );
     return false;
   }
 
-  m_sessionMapByName[ newSession->getPlayer()->getName() ] = newSession;
+  m_sessionMapByName.set( newSession->getPlayer()->getName(), newSession );
 
   return true;
 
@@ -378,25 +465,12 @@ void Sapphire::World::ServerMgr::removeSession( uint32_t sessionId )
 
 Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( uint32_t id )
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
-  auto it = m_sessionMapById.find( id );
-
-  if( it != m_sessionMapById.end() )
-    return ( it->second );
-
-  return nullptr;
+  return m_sessionMapById.get( id );
 }
 
 Sapphire::World::SessionPtr Sapphire::World::ServerMgr::getSession( const std::string& playerName )
 {
-  //std::lock_guard<std::mutex> lock( m_sessionMutex );
-
-  auto it = m_sessionMapByName.find( playerName );
-
-  if( it != m_sessionMapByName.end() )
-    return ( it->second );
-
-  return nullptr;
+  return m_sessionMapByName.get( playerName );
 }
 
 void Sapphire::World::ServerMgr::removeSession( const std::string& playerName )
@@ -8,6 +8,7 @@
 #include "ForwardsZone.h"
 #include "Manager/BaseManager.h"
 #include <Config/ConfigDef.h>
+#include <Util/ShardedMap.h>
 
 namespace Sapphire::World
 {
@@ -57,6 +58,7 @@ namespace Sapphire::World
     uint16_t m_port;
     std::string m_ip;
     int64_t m_lastDBPingTime;
+    int64_t m_lastExdSnapshotTime;
     bool m_bRunning;
     uint16_t m_worldId;
 
@@ -66,8 +68,8 @@ namespace Sapphire::World
 
     Sapphire::Common::Config::WorldConfig m_config;
 
-    std::map< uint32_t, SessionPtr > m_sessionMapById;
-    std::map< std::string, SessionPtr > m_sessionMapByName;
+    Common::Util::ShardedMap< uint32_t, SessionPtr > m_sessionMapById;
+    Common::Util::ShardedMap< std::string, SessionPtr > m_sessionMapByName;
     std::map< uint32_t, std::string > m_playerNameMapById;
     std::map< uint32_t, uint32_t > m_zones;
     std::map< std::string, Entity::BNpcTemplatePtr > m_bNpcTemplateMap;
@@ -74,6 +74,7 @@ void Sapphire::World::Session::close()
   if( m_pPlayer )
   {
     // do one last update to db
+    m_pPlayer->flushInventoryChanges( true );
     m_pPlayer->updateSql();
     // reset the zone, so the zone handler knows to remove the actor
     m_pPlayer->setCurrentZone( nullptr );
@@ -141,17 +142,24 @@ void Sapphire::World::Session::startReplay( const std::string& path )
           return std::get< 0 >( left ) < std::get< 0 >( right );
         } );
 
+  if( loadedSets.empty() )
+  {
+    getPlayer()->sendDebug( "No sets found in folder." );
+    return;
+  }
+
   uint64_t startTime = std::get< 0 >( loadedSets.at( 0 ) );
+  auto replayStart = Common::Util::getTimeMs();
 
   for( auto set : loadedSets )
   {
     m_replayCache.push_back( std::tuple< uint64_t, std::string >(
-      Common::Util::getTimeMs() + ( std::get< 0 >( set ) - startTime ), std::get< 1 >( set ) ) );
+      replayStart + ( std::get< 0 >( set ) - startTime ), std::get< 1 >( set ) ) );
 
     Logger::info( "Registering {0} for {1}", std::get< 1 >( set ), std::get< 0 >( set ) - startTime );
   }
 
-  getPlayer()->sendDebug( "Registered {0} sets for replay" ), m_replayCache.size();
+  getPlayer()->sendDebug( "Registered {0} sets for replay", m_replayCache.size() );
   m_isReplaying = true;
 }
 
@@ -163,19 +171,16 @@ void Sapphire::World::Session::stopReplay()
 
 void Sapphire::World::Session::processReplay()
 {
-  int at = 0;
-  for( const auto& set : m_replayCache )
+  auto tickCount = Common::Util::getTimeMs();
+
+  // the cache is sorted, every set that is due sits at the front
+  while( !m_replayCache.empty() && std::get< 0 >( m_replayCache.front() ) <= tickCount )
   {
-    if( std::get< 0 >( set ) <= Common::Util::getTimeMs() )
-    {
-      m_pZoneConnection->injectPacket( std::get< 1 >( set ), *getPlayer().get() );
-      m_replayCache.erase( m_replayCache.begin() + at );
-      //g_framework.getLogger().info( "Sent for " + std::to_string( std::get< 0 >( set ) ) + ", left: " + std::to_string( m_replayCache.size() ) );
-    }
-    at++;
+    m_pZoneConnection->injectPacket( std::get< 1 >( m_replayCache.front() ), *getPlayer() );
+    m_replayCache.pop_front();
   }
 
-  if( m_replayCache.size() == 0 )
+  if( m_replayCache.empty() )
     m_isReplaying = false;
 }
 
@@ -201,7 +206,14 @@ void Sapphire::World::Session::update()
     m_pZoneConnection->processInQueue();
 
     // SESSION LOGIC
-    m_pPlayer->update( Common::Util::getTimeMs() );
+    auto tickCount = Common::Util::getTimeMs();
+    m_pPlayer->update( tickCount );
+
+    // once the tick moved everyone, spawn what became relevant
+    m_pPlayer->updateSpawnInterest( tickCount );
+
+    // everything changed in the inventory this tick goes out as one batch
+    m_pPlayer->flushInventoryChanges();
 
     if( Common::Util::getTimeSeconds() - static_cast< uint32_t >( getLastSqlTime() ) > 10 )
     {
@@ -1,7 +1,10 @@
 #ifndef _SESSION_H_
 #define _SESSION_H_
 
+#include <deque>
 #include <memory>
+#include <string>
+#include <tuple>
 
 #include "ForwardsZone.h"
 
@@ -62,7 +65,8 @@ namespace Sapphire::World
     bool m_isValid;
 
     bool m_isReplaying;
-    std::vector< std::tuple< uint64_t, std::string > > m_replayCache;
+    // sorted by the time a set is due, processed sets are popped from the front
+    std::deque< std::tuple< uint64_t, std::string > > m_replayCache;
 
     Network::GameConnectionPtr m_pZoneConnection;
     Network::GameConnectionPtr m_pChatConnection;
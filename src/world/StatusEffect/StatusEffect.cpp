@@ -9,6 +9,7 @@
 #include "Actor/Actor.h"
 
 #include "Script/ScriptMgr.h"
+#include "Script/NativeScriptMgr.h"
 
 #include "StatusEffect.h"
 #include "Framework.h"
@@ -26,8 +27,12 @@ Sapphire::StatusEffect::StatusEffect::StatusEffect( uint32_t id, Entity::CharaPt
   m_startTime( 0 ),
   m_tickRate( tickRate ),
   m_lastTick( 0 ),
+  m_timerId( 0 ),
   m_pFw( pFw )
 {
+  auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  m_pScriptSlot = pScriptMgr->getNativeScriptHandler().getScriptSlot< ScriptAPI::StatusEffectScript >( id );
+
   auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
   auto entry = pExdData->get< Sapphire::Data::Status >( id );
   m_name = entry->name;
@@ -67,6 +72,11 @@ void Sapphire::StatusEffect::StatusEffect::onTick()
   pScriptMgr->onStatusTick( m_targetActor, *this );
 }
 
+Sapphire::Scripting::ScriptSlot* Sapphire::StatusEffect::StatusEffect::getScriptSlot() const
+{
+  return m_pScriptSlot;
+}
+
 uint32_t Sapphire::StatusEffect::StatusEffect::getSrcActorId() const
 {
   return m_sourceActor->getId();
@@ -105,13 +115,13 @@ void Sapphire::StatusEffect::StatusEffect::applyStatus()
   //effectPacket.data().effects[4].unknown_5 = 0x80;
   //m_sourceActor->sendToInRangeSet( effectPacket, true );
 
-  pScriptMgr->onStatusReceive( m_targetActor, m_id );
+  pScriptMgr->onStatusReceive( m_targetActor, *this );
 }
 
 void Sapphire::StatusEffect::StatusEffect::removeStatus()
 {
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
-  pScriptMgr->onStatusTimeOut( m_targetActor, m_id );
+  pScriptMgr->onStatusTimeOut( m_targetActor, *this );
 }
 
 uint32_t Sapphire::StatusEffect::StatusEffect::getId() const
@@ -144,6 +154,27 @@ void Sapphire::StatusEffect::StatusEffect::setLastTick( uint64_t lastTick )
   m_lastTick = lastTick;
 }
 
+uint64_t Sapphire::StatusEffect::StatusEffect::getNextUpdateMs() const
+{
+  uint64_t expireTime = m_startTime + m_duration;
+
+  // the first tick happens right after the effect has been applied
+  if( m_lastTick == 0 )
+    return m_startTime;
+
+  return std::min( m_lastTick + m_tickRate, expireTime );
+}
+
+uint32_t Sapphire::StatusEffect::StatusEffect::nextTimerId()
+{
+  return ++m_timerId;
+}
+
+uint32_t Sapphire::StatusEffect::StatusEffect::getTimerId() const
+{
+  return m_timerId;
+}
+
 void Sapphire::StatusEffect::StatusEffect::setParam( uint16_t param )
 {
   m_param = param;
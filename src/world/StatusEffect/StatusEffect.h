@@ -39,6 +39,14 @@ public:
 
   void setLastTick( uint64_t lastTick );
 
+  /*! returns the time the effect next needs attention, either its next tick or its expiration */
+  uint64_t getNextUpdateMs() const;
+
+  /*! invalidates all timers scheduled for this effect so far and returns the id for the next one */
+  uint32_t nextTimerId();
+
+  uint32_t getTimerId() const;
+
   void setParam( uint16_t param );
 
   void registerTickEffect( uint8_t type, uint32_t param );
@@ -47,6 +55,9 @@ public:
 
   const std::string& getName() const;
 
+  /*! slot of the script handling this effect, bound when the effect is created */
+  Scripting::ScriptSlot* getScriptSlot() const;
+
 private:
   uint32_t m_id;
   Entity::CharaPtr m_sourceActor;
@@ -55,10 +66,12 @@ private:
   uint64_t m_startTime;
   uint32_t m_tickRate;
   uint64_t m_lastTick;
+  uint32_t m_timerId;
   uint16_t m_param;
   std::string m_name;
   std::pair< uint8_t, uint32_t > m_currTickEffect;
   FrameworkPtr m_pFw;
+  Scripting::ScriptSlot* m_pScriptSlot;
 
 };
 
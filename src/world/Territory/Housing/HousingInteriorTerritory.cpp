@@ -45,6 +45,8 @@ Housing::HousingInteriorTerritory::~HousingInteriorTerritory() = default;
 
 bool Sapphire::World::Territory::Housing::HousingInteriorTerritory::init()
 {
+  loadSpawnGroups();
+
   updateHousingObjects();
 
   return true;
@@ -44,6 +44,7 @@ Sapphire::HousingZone::HousingZone( uint8_t wardNum,
 
 bool Sapphire::HousingZone::init()
 {
+  loadSpawnGroups();
 
   auto pDb = m_pFw->get< Db::DbWorkerPool< Db::ZoneDbConnection > >();
   {
@@ -9,6 +9,7 @@
 #include "Event/Director.h"
 #include "Event/EventDefs.h"
 #include "Script/ScriptMgr.h"
+#include "Script/NativeScriptMgr.h"
 
 #include "Actor/Player.h"
 #include "Actor/EventObject.h"
@@ -41,7 +42,8 @@ Sapphire::InstanceContent::InstanceContent( std::shared_ptr< Sapphire::Data::Ins
   m_state( Created ),
   m_pEntranceEObj( nullptr ),
   m_instanceCommenceTime( 0 ),
-  m_currentBgm( pInstanceConfiguration->bGM )
+  m_currentBgm( pInstanceConfiguration->bGM ),
+  m_pInstanceScriptSlot( nullptr )
 {
 
 }
@@ -52,17 +54,45 @@ bool Sapphire::InstanceContent::init()
     return false;
 
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  m_pInstanceScriptSlot = pScriptMgr->getNativeScriptHandler().getScriptSlot< ScriptAPI::InstanceContentScript >( getDirectorId() );
   pScriptMgr->onInstanceInit( getAsInstanceContent() );
 
   return true;
 }
 
 
+void Sapphire::InstanceContent::reset()
+{
+  // eobjs are registered again by the script, it is free to have changed them in any way during the duty
+  clearActors();
+  resetDirector();
+
+  m_state = Created;
+  m_currentBgm = m_instanceConfiguration->bGM;
+  m_instanceExpireTime = 0;
+  m_instanceCommenceTime = 0;
+  m_lastActivityTime = Util::getTimeMs();
+
+  m_pEntranceEObj = nullptr;
+  m_eventObjectMap.clear();
+  m_eventIdToObjectMap.clear();
+  m_spawnedPlayers.clear();
+  m_boundPlayerIds.clear();
+
+  auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  pScriptMgr->onInstanceInit( getAsInstanceContent() );
+}
+
 Sapphire::InstanceContent::~InstanceContent()
 {
 
 }
 
+Sapphire::Scripting::ScriptSlot* Sapphire::InstanceContent::getInstanceScriptSlot() const
+{
+  return m_pInstanceScriptSlot;
+}
+
 uint32_t Sapphire::InstanceContent::getInstanceContentId() const
 {
   return m_instanceContentId;
@@ -158,7 +188,7 @@ void Sapphire::InstanceContent::onUpdate( uint64_t tickCount )
   }
 
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
-  pScriptMgr->onInstanceUpdate( getAsInstanceContent(), tickCount );
+  pScriptMgr->queueInstanceUpdate( getAsInstanceContent() );
 
   m_lastUpdate = tickCount;
 }
@@ -445,6 +475,11 @@ bool Sapphire::InstanceContent::isPlayerBound( uint32_t playerId ) const
   return m_boundPlayerIds.count( playerId ) > 0;
 }
 
+bool Sapphire::InstanceContent::hasBoundPlayers() const
+{
+  return !m_boundPlayerIds.empty();
+}
+
 void Sapphire::InstanceContent::unbindPlayer( uint32_t playerId )
 {
   m_boundPlayerIds.erase( playerId );
@@ -35,6 +35,9 @@ namespace Sapphire
 
     bool init() override;
 
+    /*! resets a finished instance to the state it had right after init, so it can be reused. The instance has to be empty. */
+    void reset();
+
     void onBeforePlayerZoneIn( Entity::Player& player ) override;
 
     void onPlayerZoneIn( Entity::Player& player ) override;
@@ -86,6 +89,9 @@ namespace Sapphire
 
     uint32_t getInstanceContentId() const;
 
+    /*! slot of the director script of the instance, bound on init */
+    Scripting::ScriptSlot* getInstanceScriptSlot() const;
+
     Entity::EventObjectPtr getEObjByName( const std::string& name );
 
     /*! binds a player to the instance */
@@ -97,6 +103,9 @@ namespace Sapphire
     /*! return true if the player is bound to the instance */
     bool isPlayerBound( uint32_t playerId ) const;
 
+    /*! return true if any player is bound to the instance */
+    bool hasBoundPlayers() const;
+
     /*! number of milliseconds after all players are ready for the instance to commence (spawn circle removed) */
     const uint32_t instanceStartDelay = 1250;
 
@@ -110,6 +119,7 @@ namespace Sapphire
     uint64_t m_instanceCommenceTime;
 
     Entity::EventObjectPtr m_pEntranceEObj;
+    Scripting::ScriptSlot* m_pInstanceScriptSlot;
 
     std::map< std::string, Entity::EventObjectPtr > m_eventObjectMap;
     std::unordered_map< uint32_t, Entity::EventObjectPtr > m_eventIdToObjectMap;
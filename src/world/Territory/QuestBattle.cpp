@@ -9,6 +9,7 @@
 #include "Event/Director.h"
 #include "Event/EventDefs.h"
 #include "Script/ScriptMgr.h"
+#include "Script/NativeScriptMgr.h"
 
 #include "Actor/Player.h"
 #include "Actor/EventObject.h"
@@ -41,7 +42,8 @@ Sapphire::QuestBattle::QuestBattle( std::shared_ptr< Sapphire::Data::QuestBattle
   m_pBattleDetails( pBattleDetails ),
   m_questBattleId( questBattleId ),
   m_state( Created ),
-  m_instanceCommenceTime( 0 )
+  m_instanceCommenceTime( 0 ),
+  m_pInstanceScriptSlot( nullptr )
 {
 
 }
@@ -52,11 +54,37 @@ bool Sapphire::QuestBattle::init()
     return false;
 
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  m_pInstanceScriptSlot = pScriptMgr->getNativeScriptHandler().getScriptSlot< ScriptAPI::QuestBattleScript >( getDirectorId() );
   pScriptMgr->onInstanceInit( getAsQuestBattle() );
 
   return true;
 }
 
+void Sapphire::QuestBattle::reset()
+{
+  // eobjs are registered again by the script, it is free to have changed them in any way during the duty
+  clearActors();
+  resetDirector();
+
+  m_state = Created;
+  m_instanceExpireTime = 0;
+  m_instanceCommenceTime = 0;
+  m_instanceFailTime = 0;
+  m_lastActivityTime = Util::getTimeMs();
+
+  m_eventObjectMap.clear();
+  m_eventIdToObjectMap.clear();
+  m_pPlayer.reset();
+
+  auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  pScriptMgr->onInstanceInit( getAsQuestBattle() );
+}
+
+Sapphire::Scripting::ScriptSlot* Sapphire::QuestBattle::getInstanceScriptSlot() const
+{
+  return m_pInstanceScriptSlot;
+}
+
 uint32_t Sapphire::QuestBattle::getQuestBattleId() const
 {
   return m_questBattleId;
@@ -158,7 +186,7 @@ void Sapphire::QuestBattle::onUpdate( uint64_t tickCount )
   }
 
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
-  pScriptMgr->onInstanceUpdate( getAsQuestBattle(), tickCount );
+  pScriptMgr->queueInstanceUpdate( getAsQuestBattle() );
 
   m_lastUpdate = tickCount;
 }
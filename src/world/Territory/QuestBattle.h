@@ -27,6 +27,9 @@ namespace Sapphire
 
     bool init() override;
 
+    /*! resets a finished instance to the state it had right after init, so it can be reused. The instance has to be empty. */
+    void reset();
+
     void onBeforePlayerZoneIn( Entity::Player& player ) override;
 
     void onPlayerZoneIn( Entity::Player& player ) override;
@@ -76,6 +79,9 @@ namespace Sapphire
 
     uint32_t getQuestBattleId() const;
 
+    /*! slot of the director script of the instance, bound on init */
+    Scripting::ScriptSlot* getInstanceScriptSlot() const;
+
     Entity::EventObjectPtr getEObjByName( const std::string& name );
 
     /*! number of milliseconds after all players are ready for the instance to commence (spawn circle removed) */
@@ -95,6 +101,7 @@ namespace Sapphire
     std::map< std::string, Entity::EventObjectPtr > m_eventObjectMap;
     std::unordered_map< uint32_t, Entity::EventObjectPtr > m_eventIdToObjectMap;
     Entity::PlayerPtr m_pPlayer;
+    Scripting::ScriptSlot* m_pInstanceScriptSlot;
 
   };
 
@@ -4,6 +4,7 @@
 #include <random>
 
 #include <Logging/Logger.h>
+#include <Metrics/Metrics.h>
 #include <Util/Util.h>
 #include <Util/UtilMath.h>
 #include <Network/GamePacket.h>
@@ -34,6 +35,9 @@
 #include "Network/GameConnection.h"
 
 #include "Script/ScriptMgr.h"
+#include "Script/NativeScriptMgr.h"
+
+#include "StatusEffect/StatusEffect.h"
 
 #include "Session.h"
 #include "ForwardsZone.h"
@@ -61,7 +65,10 @@ Sapphire::Zone::Zone() :
   m_weatherOverride( Weather::None ),
   m_lastMobUpdate( 0 ),
   m_nextEObjId( 0x400D0000 ),
-  m_nextActorId( 0x500D0000 )
+  m_nextActorId( 0x500D0000 ),
+  m_pTickTime( nullptr ),
+  m_statusEffectTimers( 50, Util::getTimeMs() ),
+  m_pScriptSlot( nullptr )
 {
 }
 
@@ -73,7 +80,10 @@ Sapphire::Zone::Zone( uint16_t territoryTypeId, uint32_t guId,
   m_nextActorId( 0x500D0000 ),
   m_pFw( pFw ),
   m_lastUpdate( 0 ),
-  m_lastActivityTime( Util::getTimeMs() )
+  m_lastActivityTime( Util::getTimeMs() ),
+  m_pTickTime( nullptr ),
+  m_statusEffectTimers( 50, Util::getTimeMs() ),
+  m_pScriptSlot( nullptr )
 {
   auto pExdData = m_pFw->get< Data::ExdDataGenerated >();
   m_guId = guId;
@@ -88,9 +98,13 @@ Sapphire::Zone::Zone( uint16_t territoryTypeId, uint32_t guId,
   m_bgPath = m_territoryTypeInfo->bg;
 
   loadWeatherRates();
-  loadSpawnGroups();
 
   m_currentWeather = getNextWeather();
+
+  // instances of the same territory type share one histogram
+  m_pTickTime = &Metrics::Registry::histogram( "world_zone_tick_us",
+                                               "territory=\"" + std::to_string( territoryTypeId ) + "\"",
+                                               "Zone update time in microseconds" );
 }
 
 void Sapphire::Zone::loadWeatherRates()
@@ -104,7 +118,7 @@ void Sapphire::Zone::loadWeatherRates()
                           uint8_t{ 0 } : m_territoryTypeInfo->weatherRate;
 
   uint8_t sumPc = 0;
-  auto weatherRateFields = pExdData->m_WeatherRateDat.get_row( weatherRateId );
+  auto weatherRateFields = pExdData->getWeatherRateDat().get_row( weatherRateId );
   for( size_t i = 0; i < 16; )
   {
     int32_t weatherId = std::get< int32_t >( weatherRateFields[ i ] );
@@ -124,7 +138,10 @@ Sapphire::Zone::~Zone()
 
 bool Sapphire::Zone::init()
 {
+  loadSpawnGroups();
+
   auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+  m_pScriptSlot = pScriptMgr->getNativeScriptHandler().getScriptSlot< ScriptAPI::ZoneScript >( m_territoryTypeId );
 
   if( pScriptMgr->onZoneInit( shared_from_this() ) )
   {
@@ -269,6 +286,10 @@ void Sapphire::Zone::pushActor( Entity::ActorPtr pActor )
     updateCellActivity( cx, cy, 2 );
 
   }
+
+  // timers scheduled by the previous zone are stale now
+  if( pActor->isChara() )
+    pActor->getAsChara()->scheduleStatusEffects();
 }
 
 void Sapphire::Zone::removeActor( Entity::ActorPtr pActor )
@@ -312,6 +333,9 @@ void Sapphire::Zone::removeActor( Entity::ActorPtr pActor )
   pActor->removeFromInRange();
   pActor->clearInRangeSet();
 
+  // the timers stay in this zone's wheel, they must not fire for a chara that is somewhere else now
+  if( pActor->isChara() )
+    pActor->getAsChara()->cancelStatusEffectTimers();
 }
 
 void Sapphire::Zone::queuePacketForRange( Entity::Player& sourcePlayer, uint32_t range,
@@ -321,19 +345,18 @@ void Sapphire::Zone::queuePacketForRange( Entity::Player& sourcePlayer, uint32_t
   if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
     return;
 
-  auto pServerZone = m_pFw->get< World::ServerMgr >();
-  for( auto entry : m_playerMap )
+  for( auto& entry : m_playerMap )
   {
-    auto player = entry.second;
+    auto& player = entry.second;
     float distance = Util::distance( sourcePlayer.getPos().x, sourcePlayer.getPos().y, sourcePlayer.getPos().z,
                                      player->getPos().x, player->getPos().y, player->getPos().z );
 
     if( ( distance < range ) && sourcePlayer.getId() != player->getId() )
     {
 
-      auto pSession = pServerZone->getSession( player->getId() );
+      auto pSession = player->getSession();
       //pPacketEntry->setValAt< uint32_t >( 0x08, player->getId() );
-      if( pSession )
+      if( pSession && pSession->getZoneConnection() )
         pSession->getZoneConnection()->queueOutPacket( pPacketEntry );
     }
   }
@@ -347,15 +370,14 @@ void Sapphire::Zone::queuePacketForZone( Entity::Player& sourcePlayer,
   if( pTeriMgr->isPrivateTerritory( getTerritoryTypeId() ) )
     return;
 
-  auto pServerZone = m_pFw->get< World::ServerMgr >();
-  for( auto entry : m_playerMap )
+  for( auto& entry : m_playerMap )
   {
-    auto player = entry.second;
+    auto& player = entry.second;
     if( ( sourcePlayer.getId() != player->getId() ) ||
         ( ( sourcePlayer.getId() == player->getId() ) && forSelf ) )
     {
-      auto pSession = pServerZone->getSession( player->getId() );
-      if( pSession )
+      auto pSession = player->getSession();
+      if( pSession && pSession->getZoneConnection() )
         pSession->getZoneConnection()->queueOutPacket( pPacketEntry );
     }
   }
@@ -371,6 +393,11 @@ uint32_t Sapphire::Zone::getGuId() const
   return m_guId;
 }
 
+void Sapphire::Zone::setGuId( uint32_t guId )
+{
+  m_guId = guId;
+}
+
 const std::string& Sapphire::Zone::getName() const
 {
   return m_placeName;
@@ -473,8 +500,15 @@ uint64_t Sapphire::Zone::getLastActivityTime() const
   return m_lastActivityTime;
 }
 
+void Sapphire::Zone::setLastActivityTime( uint64_t time )
+{
+  m_lastActivityTime = time;
+}
+
 bool Sapphire::Zone::update( uint64_t tickCount )
 {
+  auto tickStart = std::chrono::steady_clock::now();
+
   //TODO: this should be moved to a updateWeather call and pulled out of updateSessions
   bool changedWeather = checkWeather();
 
@@ -484,6 +518,7 @@ bool Sapphire::Zone::update( uint64_t tickCount )
     m_pNaviProvider->updateCrowd( dt );
 
   updateSessions( tickCount, changedWeather );
+  updateStatusEffects( tickCount );
   onUpdate( tickCount );
 
   updateSpawnPoints();
@@ -493,9 +528,97 @@ bool Sapphire::Zone::update( uint64_t tickCount )
 
   m_lastUpdate = tickCount;
 
+  if( m_pTickTime )
+    m_pTickTime->record( static_cast< uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >(
+      std::chrono::steady_clock::now() - tickStart ).count() ) );
+
   return true;
 }
 
+void Sapphire::Zone::scheduleStatusEffect( uint64_t dueTimeMs, Entity::CharaPtr pChara, uint8_t effectSlotId,
+                                           StatusEffect::StatusEffectPtr pEffect )
+{
+  m_statusEffectTimers.schedule( dueTimeMs, { pChara, pEffect, effectSlotId, pEffect->nextTimerId() } );
+}
+
+void Sapphire::Zone::updateStatusEffects( uint64_t tickCount )
+{
+  m_statusEffectTimers.advance( tickCount, [ this, tickCount ]( StatusEffectTimer& timer )
+  {
+    auto pChara = timer.pChara.lock();
+    auto pEffect = timer.pEffect.lock();
+
+    // the effect got rescheduled, or the chara left the zone or is gone
+    if( !pChara || !pEffect || pEffect->getTimerId() != timer.timerId )
+      return;
+
+    if( pChara->getCurrentZone().get() != this )
+      return;
+
+    auto tickEffect = pChara->updateStatusEffect( timer.effectSlotId, pEffect, tickCount );
+    if( tickEffect.first != 1 && tickEffect.first != 2 )
+      return;
+
+    // effects ticking in the same update are sent as one packet per chara
+    auto& result = m_statusEffectTickResults[ pChara->getId() ];
+    result.pChara = pChara;
+
+    if( tickEffect.first == 1 )
+      result.damage += tickEffect.second;
+    else
+      result.heal += tickEffect.second;
+  } );
+
+  if( !m_statusEffectScriptTicks.empty() )
+  {
+    auto pScriptMgr = m_pFw->get< Scripting::ScriptMgr >();
+    pScriptMgr->onStatusTicks( m_statusEffectScriptTicks );
+    m_statusEffectScriptTicks.clear();
+  }
+
+  if( m_statusEffectTickResults.empty() )
+    return;
+
+  for( auto& entry : m_statusEffectTickResults )
+  {
+    auto& result = entry.second;
+    result.pChara->applyStatusEffectTicks( result.damage, result.heal );
+  }
+
+  m_statusEffectTickResults.clear();
+}
+
+void Sapphire::Zone::queueStatusEffectTick( Entity::CharaPtr pChara, StatusEffect::StatusEffectPtr pEffect )
+{
+  m_statusEffectScriptTicks.emplace_back( pChara, pEffect );
+}
+
+Sapphire::Scripting::ScriptSlot* Sapphire::Zone::getScriptSlot() const
+{
+  return m_pScriptSlot;
+}
+
+void Sapphire::Zone::clearActors()
+{
+  // removeActor erases bnpcs from the map, iterate a copy
+  auto bNpcs = m_bNpcMap;
+  for( auto& entry : bNpcs )
+    removeActor( entry.second );
+
+  for( auto& entry : m_eventObjects )
+    removeActor( entry.second );
+  m_eventObjects.clear();
+
+  for( auto& group : m_spawnGroups )
+  {
+    for( auto& point : group.getSpawnPointList() )
+    {
+      point->setLinkedBNpc( nullptr );
+      point->setTimeOfDeath( 0 );
+    }
+  }
+}
+
 void Sapphire::Zone::updateSessions( uint64_t tickCount, bool changedWeather )
 {
   // update sessions in this zone
@@ -525,8 +648,9 @@ void Sapphire::Zone::updateSessions( uint64_t tickCount, bool changedWeather )
       pPlayer->queuePacket( weatherChangePacket );
     }
 
-    // perform session duties
-    pPlayer->getSession()->update();
+    // perform session duties, players without a session are driven by whoever created them (e.g. combat_sim)
+    if( auto pSession = pPlayer->getSession() )
+      pSession->update();
 
     // this session is not linked to this area anymore, remove it from zone session list
     if( ( !pPlayer->getCurrentZone() ) || ( pPlayer->getCurrentZone() != shared_from_this() ) )
@@ -3,6 +3,7 @@
 
 #include <unordered_map>
 #include <Common.h>
+#include <Util/TimerWheel.h>
 
 #include "Cell.h"
 #include "CellHandler.h"
@@ -29,6 +30,11 @@ namespace Sapphire
     struct TerritoryType;
   }
 
+  namespace Metrics
+  {
+    class Histogram;
+  }
+
   class Zone : public CellHandler< Cell >, public std::enable_shared_from_this< Zone >
   {
   protected:
@@ -65,6 +71,32 @@ namespace Sapphire
     uint32_t m_effectCounter;
     std::shared_ptr< World::Navi::NaviProvider > m_pNaviProvider;
 
+    Metrics::Histogram* m_pTickTime;
+
+    struct StatusEffectTimer
+    {
+      std::weak_ptr< Entity::Chara > pChara;
+      std::weak_ptr< StatusEffect::StatusEffect > pEffect;
+      uint8_t effectSlotId;
+      uint32_t timerId;
+    };
+
+    struct StatusEffectTickResult
+    {
+      Entity::CharaPtr pChara;
+      uint32_t damage{ 0 };
+      uint32_t heal{ 0 };
+    };
+
+    /*! pending ticks and expirations of all status effects on charas in this zone */
+    Common::Util::TimerWheel< StatusEffectTimer > m_statusEffectTimers;
+    /*! tick results of the current update, kept around to avoid reallocating it every update */
+    std::unordered_map< uint32_t, StatusEffectTickResult > m_statusEffectTickResults;
+    /*! effects which ticked in the current update, their scripts are called in one batch */
+    std::vector< std::pair< Entity::CharaPtr, StatusEffect::StatusEffectPtr > > m_statusEffectScriptTicks;
+
+    Scripting::ScriptSlot* m_pScriptSlot;
+
   public:
     Zone();
 
@@ -86,6 +118,8 @@ namespace Sapphire
 
     uint64_t getLastActivityTime() const;
 
+    void setLastActivityTime( uint64_t time );
+
     virtual bool init();
 
     virtual void loadCellCache();
@@ -132,6 +166,9 @@ namespace Sapphire
 
     uint32_t getGuId() const;
 
+    /*! gives a pooled instance a new id before it is reused */
+    void setGuId( uint32_t guId );
+
     uint32_t getNextEObjId();
 
     uint32_t getNextActorId();
@@ -155,6 +192,24 @@ namespace Sapphire
 
     void updateSessions( uint64_t tickCount, bool changedWeather );
 
+    /*!
+     * @brief Schedules a status effect update, any update scheduled earlier for the same effect is dropped
+     * @param dueTimeMs time the effect has to tick or expire at
+     */
+    void scheduleStatusEffect( uint64_t dueTimeMs, Entity::CharaPtr pChara, uint8_t effectSlotId,
+                               StatusEffect::StatusEffectPtr pEffect );
+
+    /*! ticks and expires all status effects that are due, charas without due effects are never touched */
+    void updateStatusEffects( uint64_t tickCount );
+
+    /*! queues the tick script of an effect, called once all effects due in the current update were processed */
+    void queueStatusEffectTick( Entity::CharaPtr pChara, StatusEffect::StatusEffectPtr pEffect );
+
+    Scripting::ScriptSlot* getScriptSlot() const;
+
+    /*! removes every bnpc and eobj and lets all spawn points respawn right away, the zone has to be empty */
+    void clearActors();
+
     Entity::EventObjectPtr registerEObj( const std::string& name, uint32_t objectId, uint32_t mapLink,
                                          uint8_t state, Common::FFXIVARR_POSITION3 pos, float scale, float rotation );
 